@@ -97,7 +97,7 @@ bool ForsythFaceReorderer::reorderFaces(
     {
         {
             Vertex initVertex;
-            initVertex.m_pFaceList = 0;
+            initVertex.m_firstFace = 0;
             initVertex.m_aliveFaceCount = 0;
             initVertex.m_posInCache = -1;
             initVertex.m_score = 0;
@@ -128,7 +128,7 @@ bool ForsythFaceReorderer::reorderFaces(
         for (uint32 vi = 0; vi < vertexCount; ++vi)
         {
             Vertex& v = m_vertices[vi];
-            v.m_pFaceList = &m_vertexFaceLists[pos];
+            v.m_firstFace = pos;
             pos += v.m_aliveFaceCount;
             v.m_aliveFaceCount = 0;
         }
@@ -140,7 +140,7 @@ bool ForsythFaceReorderer::reorderFaces(
             for (uint j = 0; j < verticesPerFace; ++j)
             {
                 Vertex& v = m_vertices[pVertexIndex[j]];
-                v.m_pFaceList[v.m_aliveFaceCount++] = fi;
+                m_vertexFaceLists[v.m_firstFace + v.m_aliveFaceCount++] = fi;
             }
         }
     }
@@ -176,7 +176,7 @@ bool ForsythFaceReorderer::reorderFaces(
             for (int i = 0; i < m_cacheUsedSize; ++i)
             {
                 const Vertex& v = m_vertices[m_cache[i]];
-                const uint32* const pFaces = v.m_pFaceList;
+                const uint32* const pFaces = &m_vertexFaceLists[v.m_firstFace];
                 for (valency_type j = 0; j < v.m_aliveFaceCount; ++j)
                 {
                     const uint32 faceIndex = pFaces[j];
@@ -234,7 +234,7 @@ bool ForsythFaceReorderer::reorderFaces(
                 const float oldScore = v.m_score;
                 computeVertexScore(v);
                 const float differenceScore = v.m_score - oldScore;
-                const uint32* const pFaces = v.m_pFaceList;
+                const uint32* const pFaces = &m_vertexFaceLists[v.m_firstFace];
                 for (valency_type j = 0; j < v.m_aliveFaceCount; ++j)
                 {
                     m_faceScores[pFaces[j]] += differenceScore;
@@ -325,7 +325,7 @@ void ForsythFaceReorderer::removeFaceFromVertex(const uint32 vertexIndex, const
 {
     Vertex& v = m_vertices[vertexIndex];
     assert(v.m_aliveFaceCount > 0);
-    uint32* const pFaces = v.m_pFaceList;
+    uint32* const pFaces = &m_vertexFaceLists[v.m_firstFace];
     for (int j = 0;; ++j)
     {
         if (pFaces[j] == faceIndex)
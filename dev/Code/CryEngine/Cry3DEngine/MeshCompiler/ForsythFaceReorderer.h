@@ -41,9 +41,10 @@ private:
     typedef int8 cachepos_type;
     static const cachepos_type sk_maxCachePos = 127;
 
+    // Kept small (12 bytes), the search for the best face walks the vertices of the cache on every step
     struct Vertex
     {
-        uint32*       m_pFaceList;
+        uint32        m_firstFace;        // offset of the vertex's face list in m_vertexFaceLists
         valency_type  m_aliveFaceCount;
         cachepos_type m_posInCache;
         float         m_score;
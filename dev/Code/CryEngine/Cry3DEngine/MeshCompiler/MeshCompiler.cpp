@@ -17,6 +17,11 @@
 #include "ForsythFaceReorderer.h"
 #include "PVRTTriStrip/PVRTTriStrip.h"
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/std/parallel/atomic.h>
+
 #include <cstring>    // memset()
 
 
@@ -26,6 +31,7 @@ namespace mesh_compiler
     CMeshCompiler::CMeshCompiler()
         : m_pVertexMap(0)
         , m_pIndexMap(0)
+        , m_pJobContext(0)
     {
     }
 
@@ -79,6 +85,30 @@ namespace mesh_compiler
             }
         };
 
+        // VertexLess with the bone mapping as a tie-break, for the hashed welding which keeps vertices
+        // with different bone mappings apart. VertexLess itself is left as is so serial compiles don't change.
+        struct VertexLessWithBoneMapping
+            : public VertexLess
+        {
+            VertexLessWithBoneMapping(const CMesh& a_mesh)
+                : VertexLess(a_mesh)
+            {
+            }
+
+            bool operator()(int a, int b) const
+            {
+                if (VertexLess::operator()(a, b))
+                {
+                    return true;
+                }
+                if (VertexLess::operator()(b, a))
+                {
+                    return false;
+                }
+                return mesh.m_pBoneMapping && memcmp(&mesh.m_pBoneMapping[a], &mesh.m_pBoneMapping[b], sizeof(mesh.m_pBoneMapping[a])) < 0;
+            }
+        };
+
         // Copies a vertex from old to new mesh
         inline void CopyMeshVertex(CMesh& newMesh, int newVertex, const CMesh& oldMesh, int oldVertex)
         {
@@ -155,6 +185,248 @@ namespace mesh_compiler
             }
             vertexNewToOld.resize(nVertsNew);
         }
+
+        // Hashes and compares the same vertex data as VertexLessWithBoneMapping, byte by byte
+        class VertexHasher
+        {
+        public:
+            VertexHasher(const CMesh& a_mesh)
+                : mesh(a_mesh)
+                , texCoordStreamCount(0)
+            {
+                assert(mesh.m_pPositionsF16 == 0);
+                for (uint streamIndex = 0; streamIndex < CMesh::maxStreamsPerType; ++streamIndex)
+                {
+                    SMeshTexCoord* texCoords = mesh.GetStreamPtr<SMeshTexCoord>(CMesh::TEXCOORDS, streamIndex);
+                    if (texCoords)
+                    {
+                        texCoordStreams[texCoordStreamCount++] = texCoords;
+                    }
+                }
+            }
+
+            uint32 Hash(int a) const
+            {
+                uint32 hash = 2166136261u;
+                if (mesh.m_pTopologyIds)
+                {
+                    hash = HashBytes(hash, &mesh.m_pTopologyIds[a], sizeof(mesh.m_pTopologyIds[a]));
+                }
+                hash = HashBytes(hash, &mesh.m_pPositions[a], sizeof(mesh.m_pPositions[a]));
+                for (uint i = 0; i < texCoordStreamCount; ++i)
+                {
+                    hash = HashBytes(hash, &texCoordStreams[i][a], sizeof(texCoordStreams[i][a]));
+                }
+                if (mesh.m_pNorms)
+                {
+                    hash = HashBytes(hash, &mesh.m_pNorms[a], sizeof(mesh.m_pNorms[a]));
+                }
+                if (mesh.m_pColor0)
+                {
+                    hash = HashBytes(hash, &mesh.m_pColor0[a], sizeof(mesh.m_pColor0[a]));
+                }
+                if (mesh.m_pColor1)
+                {
+                    hash = HashBytes(hash, &mesh.m_pColor1[a], sizeof(mesh.m_pColor1[a]));
+                }
+                if (mesh.m_pVertMats)
+                {
+                    hash = HashBytes(hash, &mesh.m_pVertMats[a], sizeof(mesh.m_pVertMats[a]));
+                }
+                if (mesh.m_pTangents)
+                {
+                    hash = HashBytes(hash, &mesh.m_pTangents[a], sizeof(mesh.m_pTangents[a]));
+                }
+                if (mesh.m_pBoneMapping)
+                {
+                    hash = HashBytes(hash, &mesh.m_pBoneMapping[a], sizeof(mesh.m_pBoneMapping[a]));
+                }
+                return hash;
+            }
+
+            bool Equal(int a, int b) const
+            {
+                if (mesh.m_pTopologyIds && mesh.m_pTopologyIds[a] != mesh.m_pTopologyIds[b])
+                {
+                    return false;
+                }
+                if (memcmp(&mesh.m_pPositions[a], &mesh.m_pPositions[b], sizeof(mesh.m_pPositions[a])))
+                {
+                    return false;
+                }
+                for (uint i = 0; i < texCoordStreamCount; ++i)
+                {
+                    if (memcmp(&texCoordStreams[i][a], &texCoordStreams[i][b], sizeof(texCoordStreams[i][a])))
+                    {
+                        return false;
+                    }
+                }
+                return
+                    !(mesh.m_pNorms    && memcmp(&mesh.m_pNorms[a],    &mesh.m_pNorms[b],    sizeof(mesh.m_pNorms[a]))) &&
+                    !(mesh.m_pColor0   && memcmp(&mesh.m_pColor0[a],   &mesh.m_pColor0[b],   sizeof(mesh.m_pColor0[a]))) &&
+                    !(mesh.m_pColor1   && memcmp(&mesh.m_pColor1[a],   &mesh.m_pColor1[b],   sizeof(mesh.m_pColor1[a]))) &&
+                    !(mesh.m_pVertMats && memcmp(&mesh.m_pVertMats[a], &mesh.m_pVertMats[b], sizeof(mesh.m_pVertMats[a]))) &&
+                    !(mesh.m_pTangents && memcmp(&mesh.m_pTangents[a], &mesh.m_pTangents[b], sizeof(mesh.m_pTangents[a]))) &&
+                    !(mesh.m_pBoneMapping && memcmp(&mesh.m_pBoneMapping[a], &mesh.m_pBoneMapping[b], sizeof(mesh.m_pBoneMapping[a])));
+            }
+
+        private:
+            // FNV-1a
+            static uint32 HashBytes(uint32 hash, const void* pData, size_t size)
+            {
+                const uint8* const pBytes = (const uint8*)pData;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    hash = (hash ^ pBytes[i]) * 16777619u;
+                }
+                return hash;
+            }
+
+            const CMesh& mesh;
+            const SMeshTexCoord* texCoordStreams[CMesh::maxStreamsPerType];
+            uint texCoordStreamCount;
+        };
+
+        // Same result as ComputeVertexRemapping(), but duplicates are found with an open addressing
+        // hash table so only the unique vertices have to be sorted.
+        // Unlike ComputeVertexRemapping(), vertices that only differ in their bone mapping aren't welded:
+        // the sort there keeps any of them, so the result would depend on which one the hash table met first.
+        // Meshes without bone mapping compile the same either way.
+        void ComputeVertexRemappingHashed(const CMesh& mesh, std::vector<int>& vertexOldToNew, std::vector<int>& vertexNewToOld)
+        {
+            const int nVerts = mesh.GetVertexCount();
+
+            const VertexHasher hasher(mesh);
+
+            // Power of two size, at most half full so probe sequences stay short
+            uint32 tableSize = 16;
+            while (tableSize < (uint32)nVerts * 2)
+            {
+                tableSize *= 2;
+            }
+            const uint32 tableMask = tableSize - 1;
+            std::vector<int> table(tableSize, -1);
+            std::vector<uint32> hashes(nVerts);
+
+            // firstOccurrence[i] is the first vertex that is a duplicate of vertex i, i itself for unique vertices
+            std::vector<int> firstOccurrence(nVerts);
+            vertexNewToOld.clear();
+
+            for (int i = 0; i < nVerts; ++i)
+            {
+                const uint32 hash = hasher.Hash(i);
+                hashes[i] = hash;
+
+                uint32 slot = hash & tableMask;
+                for (;; )
+                {
+                    const int j = table[slot];
+                    if (j < 0)
+                    {
+                        table[slot] = i;
+                        firstOccurrence[i] = i;
+                        vertexNewToOld.push_back(i);
+                        break;
+                    }
+                    if (hashes[j] == hash && hasher.Equal(i, j))
+                    {
+                        firstOccurrence[i] = j;
+                        break;
+                    }
+                    slot = (slot + 1) & tableMask;
+                }
+            }
+
+            // Unique vertices never compare equal, so they end up in the same order as with ComputeVertexRemapping()
+            std::sort(vertexNewToOld.begin(), vertexNewToOld.end(), VertexLessWithBoneMapping(mesh));
+
+            vertexOldToNew.resize(nVerts);
+            for (int i = 0, n = (int)vertexNewToOld.size(); i < n; ++i)
+            {
+                vertexOldToNew[vertexNewToOld[i]] = i;
+            }
+            for (int i = 0; i < nVerts; ++i)
+            {
+                vertexOldToNew[i] = vertexOldToNew[firstOccurrence[i]];
+            }
+        }
+
+        // Reorders the faces of a subset with the Forsyth algorithm. The indices are rebased to the subset's
+        // smallest index, outIndices receives the reordered rebased indices.
+        bool ReorderSubsetFaces(const CMesh& mesh, const SMeshSubset& subset, size_t cacheSize, uint verticesPerFace,
+            ForsythFaceReorderer& ffr, uint32* inIndices, uint32* outIndices)
+        {
+            int subsetMinIndex = mesh.m_pIndices[subset.nFirstIndexId];
+            for (int j = 1; j < subset.nNumIndices; ++j)
+            {
+                const int idx = mesh.m_pIndices[subset.nFirstIndexId + j];
+                if (idx < subsetMinIndex)
+                {
+                    subsetMinIndex = idx;
+                }
+            }
+
+            for (int j = 0; j < subset.nNumIndices; ++j)
+            {
+                inIndices[j] = mesh.m_pIndices[subset.nFirstIndexId + j] - subsetMinIndex;
+            }
+
+            return ffr.reorderFaces(
+                cacheSize,
+                verticesPerFace,
+                subset.nNumIndices,
+                inIndices,
+                outIndices,
+                0);   // faceToOldFace[] - we don't need it
+        }
+
+        // Reorders the faces of all the subsets, one job per subset, writing the reordered rebased indices
+        // of each subset at its nFirstIndexId in outIndices. Each job has its own reorderer.
+        bool ReorderSubsetFacesInParallel(const CMesh& mesh, size_t cacheSize, uint verticesPerFace,
+            std::vector<uint32>& outIndices, AZ::JobContext* pJobContext)
+        {
+            const int nIndices = mesh.GetIndexCount();
+            outIndices.resize(nIndices);
+            std::vector<uint32> inIndices(nIndices);
+
+            // Start the biggest subsets first, they decide when the last job finishes
+            std::vector<int> subsetOrder;
+            subsetOrder.reserve(mesh.GetSubSetCount());
+            for (int i = 0; i < mesh.GetSubSetCount(); ++i)
+            {
+                if (mesh.m_subsets[i].nNumIndices > 0)
+                {
+                    subsetOrder.push_back(i);
+                }
+            }
+            std::sort(subsetOrder.begin(), subsetOrder.end(), [&mesh](int a, int b)
+                {
+                    return mesh.m_subsets[a].nNumIndices > mesh.m_subsets[b].nNumIndices;
+                });
+
+            AZStd::atomic_bool bOk(true);
+            AZ::JobCompletion completion(pJobContext);
+            for (size_t i = 0; i < subsetOrder.size(); ++i)
+            {
+                const SMeshSubset& subset = mesh.m_subsets[subsetOrder[i]];
+                auto reorderJobFunc = [&mesh, &subset, &inIndices, &outIndices, &bOk, cacheSize, verticesPerFace]()
+                {
+                    ForsythFaceReorderer ffr;
+                    if (!ReorderSubsetFaces(mesh, subset, cacheSize, verticesPerFace, ffr,
+                        &inIndices[subset.nFirstIndexId], &outIndices[subset.nFirstIndexId]))
+                    {
+                        bOk = false;
+                    }
+                };
+
+                AZ::Job* job = AZ::CreateJobFunction(reorderJobFunc, true, pJobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            return bOk;
+        }
     } // namespace
 
     //////////////////////////////////////////////////////////////////////////
@@ -934,7 +1206,17 @@ namespace mesh_compiler
             }
         }
 
-        if (!CreateIndicesAndDeleteDuplicateVertices(outMesh))
+        AZ::JobContext* pJobContext = 0;
+        if (flags & MESH_COMPILE_PARALLEL)
+        {
+            pJobContext = m_pJobContext;
+            if (!pJobContext)
+            {
+                AZ::JobManagerBus::BroadcastResult(pJobContext, &AZ::JobManagerEvents::GetGlobalContext);
+            }
+        }
+
+        if (!CreateIndicesAndDeleteDuplicateVertices(outMesh, (flags & MESH_COMPILE_PARALLEL) != 0))
         {
             return false;
         }
@@ -950,7 +1232,7 @@ namespace mesh_compiler
 
         if (flags & MESH_COMPILE_OPTIMIZE)
         {
-            const bool bOk = StripifyMesh_Forsyth(outMesh);
+            const bool bOk = StripifyMesh_Forsyth(outMesh, pJobContext);
             if (!bOk)
             {
                 m_LastError.Format("Mesh compilation failed - stripifier failed. Contact an RC programmer.");
@@ -992,7 +1274,7 @@ namespace mesh_compiler
     }
 
 
-    bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh)
+    bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh, AZ::JobContext* pJobContext)
     {
         if (mesh.GetFaceCount() > 0)
         {
@@ -1101,6 +1383,14 @@ namespace mesh_compiler
             buffer1.resize(maxIndexCountInSubset);
         }
 
+        // In parallel mode the faces of all the subsets are reordered up front, vertices are still
+        // reordered below, in subset order, so the result doesn't depend on which job finishes first.
+        std::vector<uint32> reorderedIndices;
+        if (pJobContext && !ReorderSubsetFacesInParallel(mesh, cacheSize, kVerticesPerFace, reorderedIndices, pJobContext))
+        {
+            return false;
+        }
+
         int newVertexCount = 0;
 
         for (int i = 0; i < newMesh.GetSubSetCount(); i++)
@@ -1127,22 +1417,18 @@ namespace mesh_compiler
                 }
             }
 
-            for (int j = 0; j < subset.nNumIndices; ++j)
+            const uint32* pReorderedIndices;
+            if (pJobContext)
             {
-                buffer0[j] = mesh.m_pIndices[subset.nFirstIndexId + j] - subsetMinIndex;
+                pReorderedIndices = &reorderedIndices[subset.nFirstIndexId];
             }
-
-            const bool bOk = ffr.reorderFaces(
-                    cacheSize,
-                    kVerticesPerFace,
-                    subset.nNumIndices,
-                    &buffer0[0], // inVertexIndices
-                    &buffer1[0], // outVertexIndices
-                    0);   // faceToOldFace[] - we don't need it
-
-            if (!bOk)
+            else
             {
-                return false;
+                if (!ReorderSubsetFaces(mesh, subset, cacheSize, kVerticesPerFace, ffr, &buffer0[0], &buffer1[0]))
+                {
+                    return false;
+                }
+                pReorderedIndices = &buffer1[0];
             }
 
             // Reorder vertices
@@ -1160,7 +1446,7 @@ namespace mesh_compiler
 
             for (int j = 0; j < subset.nNumIndices; ++j)
             {
-                const uint32 idx = buffer1[j];
+                const uint32 idx = pReorderedIndices[j];
                 const int oldVertexIndex = subsetMinIndex + idx;
                 if (buffer0[idx] == -1)
                 {
@@ -1344,7 +1630,7 @@ namespace mesh_compiler
 
             for (int j = 0; j < subset.nNumIndices; ++j)
             {
-                const uint32 idx = buffer1[j];
+                const uint32 idx = pReorderedIndices[j];
                 const int oldVertexIndex = subsetMinIndex + idx;
                 if (buffer0[idx] == -1)
                 {
@@ -1389,7 +1675,7 @@ namespace mesh_compiler
     //
     // Note that mesh.subsets[] is neither used nor changed.
     //
-    bool CMeshCompiler::CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh)
+    bool CMeshCompiler::CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh, bool bHashVertices)
     {
         assert(mesh.m_pPositionsF16 == 0);
 
@@ -1404,7 +1690,14 @@ namespace mesh_compiler
 
         std::vector<int> vertexOldToNew;
         std::vector<int> vertexNewToOld;
-        ComputeVertexRemapping(oldMesh, vertexOldToNew, vertexNewToOld);
+        if (bHashVertices)
+        {
+            ComputeVertexRemappingHashed(oldMesh, vertexOldToNew, vertexNewToOld);
+        }
+        else
+        {
+            ComputeVertexRemapping(oldMesh, vertexOldToNew, vertexNewToOld);
+        }
 
         const int newVertexCount = (int)vertexNewToOld.size();
 
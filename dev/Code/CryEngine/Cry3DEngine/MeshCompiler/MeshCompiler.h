@@ -17,6 +17,11 @@
 
 #include "IIndexedMesh.h"
 
+namespace AZ
+{
+    class JobContext;
+}
+
 namespace mesh_compiler
 {
     enum EMeshCompileFlags
@@ -31,6 +36,11 @@ namespace mesh_compiler
         MESH_COMPILE_PVR_STRIPIFY = BIT(5),
 
         MESH_COMPILE_VALIDATE_FAIL_ON_DEGENERATE_FACES = BIT(6),
+
+        // Welds duplicate vertices with a hash table instead of sorting all of them, and reorders the faces
+        // of the subsets in parallel jobs. The compiled mesh is the same as the one compiled without this flag,
+        // except that vertices which only differ in their bone mapping aren't welded.
+        MESH_COMPILE_PARALLEL = BIT(7),
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -53,6 +63,13 @@ namespace mesh_compiler
             m_pIndexMap = pIndexMap;
         }
 
+        // Job context used by MESH_COMPILE_PARALLEL, the global one is used if not set.
+        // Without any job context the subsets are processed on the calling thread.
+        void SetJobContext(AZ::JobContext* pJobContext)
+        {
+            m_pJobContext = pJobContext;
+        }
+
         static inline bool IsEquivalentVec3dCheckYFirst(const Vec3& v0, const Vec3& v1, float fEpsilon)
         {
             if (fabsf(v0.y - v1.y) < fEpsilon)
@@ -207,8 +224,8 @@ namespace mesh_compiler
         }
 
     private:
-        bool CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh);
-        bool StripifyMesh_Forsyth(CMesh& mesh);
+        bool CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh, bool bHashVertices);
+        bool StripifyMesh_Forsyth(CMesh& mesh, AZ::JobContext* pJobContext);
         bool StripifyMesh_PVRTriStripList(CMesh& mesh);
 
     public:
@@ -228,6 +245,8 @@ namespace mesh_compiler
         std::vector<int>* m_pVertexMap;
         std::vector<int>* m_pIndexMap;
 
+        AZ::JobContext* m_pJobContext;
+
         string m_LastError;
     };
 } // namespace mesh_compiler
@@ -0,0 +1,293 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "StdAfx.h"
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include "MeshCompiler/MeshCompiler.h"
+
+#include <random>
+
+// Differential tests: compiling with MESH_COMPILE_PARALLEL has to produce exactly the same mesh as without it.
+class MeshCompilerTest
+    : public UnitTest::AllocatorsTestFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+
+        if (!AZ::AllocatorInstance<AZ::LegacyAllocator>::GetAllocator().IsReady())
+        {
+            AZ::AllocatorInstance<AZ::LegacyAllocator>::Create();
+        }
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+        AZ::JobManagerDesc desc;
+        AZ::JobManagerThreadDesc threadDesc;
+        for (int i = 0; i < 4; ++i)
+        {
+            desc.m_workerThreads.push_back(threadDesc);
+        }
+        m_jobManager = aznew AZ::JobManager(desc);
+        m_jobContext = aznew AZ::JobContext(*m_jobManager);
+    }
+
+    void TearDown() override
+    {
+        delete m_jobContext;
+        delete m_jobManager;
+
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::LegacyAllocator>::Destroy();
+
+        UnitTest::AllocatorsTestFixture::TearDown();
+    }
+
+protected:
+    // A height field of size x size quads, split in columns of subsets that alternate physicalization types.
+    static void CreateGridMesh(CMesh& mesh, int size, int subsetCount)
+    {
+        const int vertexCount = (size + 1) * (size + 1);
+        mesh.SetVertexCount(vertexCount);
+        mesh.SetTexCoordsCount(vertexCount);
+
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> height(0.0f, 0.25f);
+        for (int y = 0; y <= size; ++y)
+        {
+            for (int x = 0; x <= size; ++x)
+            {
+                const int v = y * (size + 1) + x;
+                mesh.m_pPositions[v] = Vec3((float)x, (float)y, height(random));
+                mesh.m_pNorms[v] = SMeshNormal(Vec3(0.0f, 0.0f, 1.0f));
+                mesh.m_pTexCoord[v] = SMeshTexCoord((float)x / size, (float)y / size);
+            }
+        }
+
+        mesh.SetFaceCount(size * size * 2);
+        for (int y = 0; y < size; ++y)
+        {
+            for (int x = 0; x < size; ++x)
+            {
+                const int v = y * (size + 1) + x;
+                const unsigned char subset = (unsigned char)(x * subsetCount / size);
+                SMeshFace& face0 = mesh.m_pFaces[(y * size + x) * 2 + 0];
+                face0.v[0] = v;
+                face0.v[1] = v + 1;
+                face0.v[2] = v + size + 2;
+                face0.nSubset = subset;
+                SMeshFace& face1 = mesh.m_pFaces[(y * size + x) * 2 + 1];
+                face1.v[0] = v;
+                face1.v[1] = v + size + 2;
+                face1.v[2] = v + size + 1;
+                face1.nSubset = subset;
+            }
+        }
+
+        for (int i = 0; i < subsetCount; ++i)
+        {
+            SMeshSubset subset;
+            subset.nMatID = i;
+            subset.nPhysicalizeType = (i % 2) ? PHYS_GEOM_TYPE_NONE : PHYS_GEOM_TYPE_DEFAULT;
+            mesh.m_subsets.push_back(subset);
+        }
+    }
+
+    // Faces picking vertices around a sliding window, with positions on a coarse lattice and few distinct
+    // colors, so many corners are duplicates and the vertex cache has something to optimize.
+    static void CreateSoupMesh(CMesh& mesh, int faceCount, int subsetCount)
+    {
+        const int vertexCount = faceCount;
+        mesh.SetVertexCount(vertexCount);
+        mesh.SetTexCoordsCount(vertexCount);
+        mesh.ReallocStream(CMesh::COLORS, 0, vertexCount);
+
+        std::mt19937 random(5678);
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            mesh.m_pPositions[v] = Vec3((float)(random() % 8), (float)(random() % 8), (float)(random() % 4));
+            mesh.m_pNorms[v] = SMeshNormal(Vec3(0.0f, 1.0f, 0.0f));
+            mesh.m_pTexCoord[v] = SMeshTexCoord((float)(random() % 2), 0.0f);
+            mesh.m_pColor0[v] = SMeshColor(255, (uint8)((random() % 2) * 255), 0, 255);
+        }
+
+        mesh.SetFaceCount(faceCount);
+        for (int i = 0; i < faceCount; ++i)
+        {
+            SMeshFace& face = mesh.m_pFaces[i];
+            for (int j = 0; j < 3; ++j)
+            {
+                face.v[j] = (i + (int)(random() % 32)) % vertexCount;
+            }
+            face.nSubset = (unsigned char)(random() % subsetCount);
+        }
+
+        for (int i = 0; i < subsetCount; ++i)
+        {
+            SMeshSubset subset;
+            subset.nMatID = i;
+            mesh.m_subsets.push_back(subset);
+        }
+    }
+
+    static bool Compile(const CMesh& source, int flags, AZ::JobContext* jobContext, CMesh& compiled, std::vector<int>* vertexMap)
+    {
+        compiled.Copy(source);
+        mesh_compiler::CMeshCompiler meshCompiler;
+        meshCompiler.SetVertexRemapping(vertexMap);
+        meshCompiler.SetJobContext(jobContext);
+        return meshCompiler.Compile(compiled, flags);
+    }
+
+    static void ExpectSameMesh(const CMesh& expected, const CMesh& actual)
+    {
+        EXPECT_TRUE(mesh_compiler::CMeshCompiler::CompareMeshes(expected, actual));
+        ASSERT_EQ(expected.m_subsets.size(), actual.m_subsets.size());
+        for (int i = 0; i < expected.GetSubSetCount(); ++i)
+        {
+            const SMeshSubset& expectedSubset = expected.m_subsets[i];
+            const SMeshSubset& actualSubset = actual.m_subsets[i];
+            EXPECT_EQ(expectedSubset.nMatID, actualSubset.nMatID);
+            EXPECT_EQ(expectedSubset.nFirstIndexId, actualSubset.nFirstIndexId);
+            EXPECT_EQ(expectedSubset.nNumIndices, actualSubset.nNumIndices);
+            EXPECT_EQ(expectedSubset.nFirstVertId, actualSubset.nFirstVertId);
+            EXPECT_EQ(expectedSubset.nNumVerts, actualSubset.nNumVerts);
+            EXPECT_EQ(0, memcmp(&expectedSubset.vCenter, &actualSubset.vCenter, sizeof(expectedSubset.vCenter)));
+            EXPECT_EQ(0, memcmp(&expectedSubset.fRadius, &actualSubset.fRadius, sizeof(expectedSubset.fRadius)));
+        }
+    }
+
+    AZ::JobManager* m_jobManager = nullptr;
+    AZ::JobContext* m_jobContext = nullptr;
+};
+
+TEST_F(MeshCompilerTest, CompileParallel_GridMeshWithTangents_MatchesSerialCompile)
+{
+    CMesh source;
+    CreateGridMesh(source, 48, 6);
+
+    const int flags = mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_TANGENTS | mesh_compiler::MESH_COMPILE_VALIDATE;
+
+    CMesh expected;
+    ASSERT_TRUE(Compile(source, flags, nullptr, expected, nullptr));
+    EXPECT_GT(expected.GetIndexCount(), 0);
+
+    CMesh actual;
+    ASSERT_TRUE(Compile(source, flags | mesh_compiler::MESH_COMPILE_PARALLEL, m_jobContext, actual, nullptr));
+    ExpectSameMesh(expected, actual);
+}
+
+TEST_F(MeshCompilerTest, CompileParallel_SoupMeshWithVertexMap_MatchesSerialCompile)
+{
+    CMesh source;
+    CreateSoupMesh(source, 6000, 9);
+
+    const int flags = mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_VALIDATE;
+
+    CMesh expected;
+    std::vector<int> expectedVertexMap;
+    ASSERT_TRUE(Compile(source, flags, nullptr, expected, &expectedVertexMap));
+    // Duplicated corners have been welded
+    EXPECT_LT(expected.GetVertexCount(), expected.GetIndexCount());
+
+    CMesh actual;
+    std::vector<int> actualVertexMap;
+    ASSERT_TRUE(Compile(source, flags | mesh_compiler::MESH_COMPILE_PARALLEL, m_jobContext, actual, &actualVertexMap));
+    ExpectSameMesh(expected, actual);
+    EXPECT_EQ(expectedVertexMap, actualVertexMap);
+}
+
+TEST_F(MeshCompilerTest, CompileParallel_NoJobContext_MatchesSerialCompile)
+{
+    // Without a job context the subsets are reordered on the calling thread, vertices are still hashed.
+    CMesh source;
+    CreateSoupMesh(source, 3000, 4);
+
+    const int flags = mesh_compiler::MESH_COMPILE_OPTIMIZE;
+
+    CMesh expected;
+    ASSERT_TRUE(Compile(source, flags, nullptr, expected, nullptr));
+
+    CMesh actual;
+    ASSERT_TRUE(Compile(source, flags | mesh_compiler::MESH_COMPILE_PARALLEL, nullptr, actual, nullptr));
+    ExpectSameMesh(expected, actual);
+}
+
+TEST_F(MeshCompilerTest, CompileParallel_SkinnedSoupMesh_KeepsBoneMappingsApart)
+{
+    // The serial compile welds corners that only differ in their bone mapping, the parallel one keeps them apart.
+    CMesh unskinned;
+    CreateSoupMesh(unskinned, 6000, 5);
+
+    CMesh source;
+    source.Copy(unskinned);
+    source.ReallocStream(CMesh::BONEMAPPING, 0, source.GetVertexCount());
+    std::mt19937 random(91011);
+    for (int v = 0; v < source.GetVertexCount(); ++v)
+    {
+        SMeshBoneMapping_uint16& boneMapping = source.m_pBoneMapping[v];
+        const SMeshBoneMapping_uint16::BoneId boneId = (SMeshBoneMapping_uint16::BoneId)(random() % 3);
+        for (int j = 0; j < 4; ++j)
+        {
+            boneMapping.boneIds[j] = (SMeshBoneMapping_uint16::BoneId)(boneId + j);
+            boneMapping.weights[j] = (SMeshBoneMapping_uint16::Weight)((j == 0) ? 255 : 0);
+        }
+    }
+
+    const int flags = mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_VALIDATE;
+
+    CMesh expectedUnskinned;
+    ASSERT_TRUE(Compile(unskinned, flags, nullptr, expectedUnskinned, nullptr));
+
+    CMesh serial;
+    ASSERT_TRUE(Compile(source, flags, nullptr, serial, nullptr));
+    EXPECT_EQ(expectedUnskinned.GetVertexCount(), serial.GetVertexCount());
+
+    CMesh parallel;
+    ASSERT_TRUE(Compile(source, flags | mesh_compiler::MESH_COMPILE_PARALLEL, m_jobContext, parallel, nullptr));
+    ASSERT_NE(nullptr, parallel.m_pBoneMapping);
+    EXPECT_GT(parallel.GetVertexCount(), expectedUnskinned.GetVertexCount());
+}
+
+TEST_F(MeshCompilerTest, CompileParallel_SameBoneMappings_MatchesSerialCompile)
+{
+    CMesh source;
+    CreateSoupMesh(source, 6000, 5);
+    source.ReallocStream(CMesh::BONEMAPPING, 0, source.GetVertexCount());
+    for (int v = 0; v < source.GetVertexCount(); ++v)
+    {
+        SMeshBoneMapping_uint16& boneMapping = source.m_pBoneMapping[v];
+        for (int j = 0; j < 4; ++j)
+        {
+            boneMapping.boneIds[j] = (SMeshBoneMapping_uint16::BoneId)j;
+            boneMapping.weights[j] = (SMeshBoneMapping_uint16::Weight)((j == 0) ? 255 : 0);
+        }
+    }
+
+    const int flags = mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_VALIDATE;
+
+    CMesh expected;
+    std::vector<int> expectedVertexMap;
+    ASSERT_TRUE(Compile(source, flags, nullptr, expected, &expectedVertexMap));
+
+    CMesh actual;
+    std::vector<int> actualVertexMap;
+    ASSERT_TRUE(Compile(source, flags | mesh_compiler::MESH_COMPILE_PARALLEL, m_jobContext, actual, &actualVertexMap));
+    ExpectSameMesh(expected, actual);
+    EXPECT_EQ(expectedVertexMap, actualVertexMap);
+}
@@ -0,0 +1,391 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Asset/AssetLoadTimeline.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Data
+    {
+        namespace
+        {
+            /// Appends a string to a JSON document, escaping the characters JSON doesn't allow in strings.
+            void AppendJsonString(AZStd::string& output, const char* value)
+            {
+                output += '"';
+                for (const char* character = value; *character; ++character)
+                {
+                    switch (*character)
+                    {
+                    case '"':
+                        output += "\\\"";
+                        break;
+                    case '\\':
+                        output += "\\\\";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(*character) >= 0x20)
+                        {
+                            output += *character;
+                        }
+                        break;
+                    }
+                }
+                output += '"';
+            }
+        }
+
+        const char* ToString(AssetLoadPhase phase)
+        {
+            switch (phase)
+            {
+            case AssetLoadPhase::Queued:
+                return "Queued";
+            case AssetLoadPhase::StreamOpen:
+                return "StreamOpen";
+            case AssetLoadPhase::LoadData:
+                return "LoadData";
+            case AssetLoadPhase::InitAsset:
+                return "InitAsset";
+            case AssetLoadPhase::Ready:
+                return "Ready";
+            case AssetLoadPhase::Error:
+                return "Error";
+            case AssetLoadPhase::BlockingWait:
+                return "BlockingWait";
+            case AssetLoadPhase::AssetMutexWait:
+                return "AssetMutexWait";
+            default:
+                return "Unknown";
+            }
+        }
+
+        //=========================================================================
+        // AssetLoadTimeline
+        //=========================================================================
+        AssetLoadTimeline::~AssetLoadTimeline()
+        {
+            Stop();
+            FreeSlots();
+        }
+
+        void AssetLoadTimeline::Start(AZ::u32 capacity)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_controlMutex);
+
+            // No thread can be writing to the slots once recording is stopped
+            m_isRecording.store(false, AZStd::memory_order_seq_cst);
+            while (m_numWriters.load(AZStd::memory_order_acquire) != 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
+            if (capacity != m_capacity)
+            {
+                FreeSlots();
+                if (capacity)
+                {
+                    m_slots = reinterpret_cast<Slot*>(azmalloc(sizeof(Slot) * capacity, AZStd::alignment_of<Slot>::value, AZ::SystemAllocator, "AssetLoadTimeline"));
+                    for (AZ::u32 index = 0; index < capacity; ++index)
+                    {
+                        new(&m_slots[index]) Slot();
+                    }
+                }
+                m_capacity = capacity;
+            }
+
+            for (AZ::u32 index = 0; index < m_capacity; ++index)
+            {
+                m_slots[index].m_isCommitted.store(false, AZStd::memory_order_relaxed);
+            }
+            m_numEvents.store(0, AZStd::memory_order_relaxed);
+
+            m_isRecording.store(m_capacity != 0, AZStd::memory_order_seq_cst);
+        }
+
+        void AssetLoadTimeline::Stop()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_controlMutex);
+
+            m_isRecording.store(false, AZStd::memory_order_seq_cst);
+            while (m_numWriters.load(AZStd::memory_order_acquire) != 0)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
+        void AssetLoadTimeline::RecordInstant(AssetLoadPhase phase, const AssetId& assetId, const AssetType& assetType)
+        {
+            if (IsRecording())
+            {
+                AssetLoadTimelineEvent event;
+                event.m_assetId = assetId;
+                event.m_assetType = assetType;
+                event.m_startUs = AZStd::GetTimeNowMicroSecond();
+                event.m_threadId = AZStd::this_thread::get_id();
+                event.m_phase = phase;
+                RecordEvent(event);
+            }
+        }
+
+        void AssetLoadTimeline::RecordEvent(const AssetLoadTimelineEvent& event)
+        {
+            // Register as a writer before checking the recording flag again, Start() and Stop() clear the flag
+            // before waiting for the writers so either they see us or we see the flag cleared.
+            m_numWriters.fetch_add(1, AZStd::memory_order_seq_cst);
+            if (m_isRecording.load(AZStd::memory_order_seq_cst))
+            {
+                const AZ::u64 index = m_numEvents.fetch_add(1, AZStd::memory_order_relaxed);
+                if (index < m_capacity)
+                {
+                    Slot& slot = m_slots[index];
+                    slot.m_event = event;
+                    slot.m_isCommitted.store(true, AZStd::memory_order_release);
+                }
+            }
+            m_numWriters.fetch_sub(1, AZStd::memory_order_release);
+        }
+
+        void AssetLoadTimeline::FreeSlots()
+        {
+            if (m_slots)
+            {
+                for (AZ::u32 index = 0; index < m_capacity; ++index)
+                {
+                    m_slots[index].~Slot();
+                }
+                azfree(m_slots, AZ::SystemAllocator);
+                m_slots = nullptr;
+            }
+            m_capacity = 0;
+        }
+
+        AZStd::vector<AssetLoadTimelineEvent> AssetLoadTimeline::GetEvents() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_controlMutex);
+
+            const AZ::u64 numEvents = AZStd::GetMin<AZ::u64>(m_numEvents.load(AZStd::memory_order_acquire), m_capacity);
+            AZStd::vector<AssetLoadTimelineEvent> events;
+            events.reserve(static_cast<size_t>(numEvents));
+            for (AZ::u64 index = 0; index < numEvents; ++index)
+            {
+                // Events still being written are left out
+                if (m_slots[index].m_isCommitted.load(AZStd::memory_order_acquire))
+                {
+                    events.push_back(m_slots[index].m_event);
+                }
+            }
+
+            // Events are reserved when they end, spans that started earlier may come later in the buffer
+            AZStd::sort(events.begin(), events.end(), [](const AssetLoadTimelineEvent& lhs, const AssetLoadTimelineEvent& rhs)
+            {
+                return lhs.m_startUs < rhs.m_startUs;
+            });
+            return events;
+        }
+
+        AZ::u64 AssetLoadTimeline::GetNumDroppedEvents() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_controlMutex);
+
+            const AZ::u64 numEvents = m_numEvents.load(AZStd::memory_order_relaxed);
+            return numEvents > m_capacity ? numEvents - m_capacity : 0;
+        }
+
+        AZStd::vector<AssetTypeLoadStatistics> AssetLoadTimeline::GetTypeStatistics() const
+        {
+            AZStd::vector<AssetLoadTimelineEvent> events = GetEvents();
+
+            AZStd::unordered_map<AssetType, AssetTypeLoadStatistics> statisticsByType;
+            AZStd::unordered_map<AssetId, AZStd::sys_time_t> queuedTimes;
+            for (const AssetLoadTimelineEvent& event : events)
+            {
+                AssetTypeLoadStatistics& statistics = statisticsByType[event.m_assetType];
+                statistics.m_assetType = event.m_assetType;
+
+                switch (event.m_phase)
+                {
+                case AssetLoadPhase::Queued:
+                    queuedTimes[event.m_assetId] = event.m_startUs;
+                    break;
+                case AssetLoadPhase::StreamOpen:
+                {
+                    statistics.m_streamOpenUs += event.m_durationUs;
+                    auto queuedIt = queuedTimes.find(event.m_assetId);
+                    if (queuedIt != queuedTimes.end())
+                    {
+                        statistics.m_queuedUs += event.m_startUs - queuedIt->second;
+                    }
+                    break;
+                }
+                case AssetLoadPhase::LoadData:
+                    ++statistics.m_numLoads;
+                    statistics.m_loadDataUs += event.m_durationUs;
+                    statistics.m_maxLoadDataUs = AZStd::GetMax(statistics.m_maxLoadDataUs, event.m_durationUs);
+                    statistics.m_readUs += event.m_readUs;
+                    statistics.m_bytesRead += event.m_bytesRead;
+                    break;
+                case AssetLoadPhase::InitAsset:
+                    statistics.m_initAssetUs += event.m_durationUs;
+                    break;
+                case AssetLoadPhase::Ready:
+                case AssetLoadPhase::Error:
+                {
+                    if (event.m_phase == AssetLoadPhase::Error)
+                    {
+                        ++statistics.m_numErrors;
+                    }
+                    auto queuedIt = queuedTimes.find(event.m_assetId);
+                    if (queuedIt != queuedTimes.end())
+                    {
+                        statistics.m_readyUs += event.m_startUs - queuedIt->second;
+                        queuedTimes.erase(queuedIt);
+                    }
+                    break;
+                }
+                case AssetLoadPhase::BlockingWait:
+                    statistics.m_blockingWaitUs += event.m_durationUs;
+                    break;
+                case AssetLoadPhase::AssetMutexWait:
+                    statistics.m_assetMutexWaitUs += event.m_durationUs;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            AZStd::vector<AssetTypeLoadStatistics> result;
+            result.reserve(statisticsByType.size());
+            for (const auto& statistics : statisticsByType)
+            {
+                result.push_back(statistics.second);
+            }
+            AZStd::sort(result.begin(), result.end(), [](const AssetTypeLoadStatistics& lhs, const AssetTypeLoadStatistics& rhs)
+            {
+                return lhs.m_loadDataUs > rhs.m_loadDataUs;
+            });
+            return result;
+        }
+
+        void AssetLoadTimeline::WriteChromeTrace(AZStd::string& output) const
+        {
+            AZStd::vector<AssetLoadTimelineEvent> events = GetEvents();
+
+            // Chrome wants small thread ids, and timestamps relative to the start of the trace read better
+            AZStd::unordered_map<AssetId, AZStd::string> assetNames;
+            AZStd::unordered_map<size_t, AZ::u32> threadIndices;
+            const AZStd::sys_time_t traceStartUs = events.empty() ? 0 : events.front().m_startUs;
+
+            output.clear();
+            output.reserve(events.size() * 192);
+            output += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            for (size_t index = 0; index < events.size(); ++index)
+            {
+                const AssetLoadTimelineEvent& event = events[index];
+
+                auto nameIt = assetNames.find(event.m_assetId);
+                if (nameIt == assetNames.end())
+                {
+                    AZStd::string assetPath;
+                    if (event.m_assetId.IsValid())
+                    {
+                        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, event.m_assetId);
+                        if (assetPath.empty())
+                        {
+                            assetPath = event.m_assetId.ToString<AZStd::string>();
+                        }
+                    }
+                    else
+                    {
+                        assetPath = "AssetManager";
+                    }
+                    nameIt = assetNames.insert(AZStd::make_pair(event.m_assetId, AZStd::move(assetPath))).first;
+                }
+
+                const size_t threadHash = AZStd::hash<AZStd::thread_id>()(event.m_threadId);
+                const AZ::u32 threadIndex = threadIndices.insert(AZStd::make_pair(threadHash, static_cast<AZ::u32>(threadIndices.size()))).first->second;
+
+                const bool isInstant = event.m_phase == AssetLoadPhase::Queued || event.m_phase == AssetLoadPhase::Ready || event.m_phase == AssetLoadPhase::Error;
+
+                output += index ? ",\n{\"name\":" : "\n{\"name\":";
+                AppendJsonString(output, ToString(event.m_phase));
+                output += ",\"cat\":\"asset\"";
+                if (isInstant)
+                {
+                    output += AZStd::string::format(",\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu",
+                        static_cast<unsigned long long>(event.m_startUs - traceStartUs));
+                }
+                else
+                {
+                    output += AZStd::string::format(",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu",
+                        static_cast<unsigned long long>(event.m_startUs - traceStartUs), static_cast<unsigned long long>(event.m_durationUs));
+                }
+                output += AZStd::string::format(",\"pid\":1,\"tid\":%u,\"args\":{\"asset\":", threadIndex);
+                AppendJsonString(output, nameIt->second.c_str());
+                output += ",\"type\":";
+                AppendJsonString(output, event.m_assetType.ToString<AZStd::string>().c_str());
+                if (event.m_phase == AssetLoadPhase::LoadData)
+                {
+                    output += AZStd::string::format(",\"readUs\":%llu,\"bytesRead\":%llu",
+                        static_cast<unsigned long long>(event.m_readUs), static_cast<unsigned long long>(event.m_bytesRead));
+                }
+                output += "}}";
+            }
+            output += "\n]}\n";
+        }
+
+        bool AssetLoadTimeline::ExportChromeTrace(const char* filePath) const
+        {
+            IO::FileIOBase* fileIO = IO::FileIOBase::GetInstance();
+            if (!fileIO)
+            {
+                AZ_Error("AssetManager", false, "Can't export the asset load timeline to %s, there is no file IO.", filePath);
+                return false;
+            }
+
+            AZStd::string trace;
+            WriteChromeTrace(trace);
+
+            IO::HandleType fileHandle = IO::InvalidHandle;
+            if (!fileIO->Open(filePath, IO::OpenMode::ModeWrite | IO::OpenMode::ModeCreatePath, fileHandle))
+            {
+                AZ_Error("AssetManager", false, "Can't open %s to export the asset load timeline.", filePath);
+                return false;
+            }
+            const bool isWritten = fileIO->Write(fileHandle, trace.data(), trace.size());
+            fileIO->Close(fileHandle);
+            return isWritten;
+        }
+
+        void AssetLoadTimeline::PrintStatistics() const
+        {
+            AZStd::vector<AssetTypeLoadStatistics> typeStatistics = GetTypeStatistics();
+
+            AZ_TracePrintf("AssetManager", "Asset load timeline, times in ms (%llu events dropped)\n", static_cast<unsigned long long>(GetNumDroppedEvents()));
+            AZ_TracePrintf("AssetManager", "%-38s %6s %6s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n",
+                "Type", "Loads", "Errors", "Queued", "Open", "LoadData", "MaxLoad", "Read", "MB", "Init", "Wait", "Mutex");
+            for (const AssetTypeLoadStatistics& statistics : typeStatistics)
+            {
+                AZ_TracePrintf("AssetManager", "%-38s %6u %6u %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                    statistics.m_assetType.ToString<AZStd::string>().c_str(), statistics.m_numLoads, statistics.m_numErrors,
+                    statistics.m_queuedUs / 1000.0, statistics.m_streamOpenUs / 1000.0, statistics.m_loadDataUs / 1000.0,
+                    statistics.m_maxLoadDataUs / 1000.0, statistics.m_readUs / 1000.0, statistics.m_bytesRead / (1024.0 * 1024.0),
+                    statistics.m_initAssetUs / 1000.0, statistics.m_blockingWaitUs / 1000.0, statistics.m_assetMutexWaitUs / 1000.0);
+            }
+        }
+    } // namespace Data
+} // namespace AZ
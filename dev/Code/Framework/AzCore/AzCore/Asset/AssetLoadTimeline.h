@@ -0,0 +1,206 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace Data
+    {
+        /// Steps of an asset load recorded by the AssetLoadTimeline.
+        enum class AssetLoadPhase : AZ::u8
+        {
+            Queued,         ///< A load job was created for the asset, instant.
+            StreamOpen,     ///< The catalog lookup of the asset stream and the opening of the stream.
+            LoadData,       ///< AssetHandler::LoadAssetData, includes the stream reads (and their decompression).
+            InitAsset,      ///< AssetHandler::InitAsset and the notification of the jobs waiting for the asset.
+            Ready,          ///< OnAssetReady was dispatched on the AssetBus, instant.
+            Error,          ///< OnAssetError was dispatched on the AssetBus, instant.
+            BlockingWait,   ///< A thread blocked until the asset was loaded by another thread.
+            AssetMutexWait, ///< A thread waited for the asset manager mutex, only recorded when the mutex is contended.
+            Count
+        };
+
+        const char* ToString(AssetLoadPhase phase);
+
+        /// One step of an asset load, instant steps have no duration.
+        struct AssetLoadTimelineEvent
+        {
+            AssetId             m_assetId;
+            AssetType           m_assetType;
+            AZStd::sys_time_t   m_startUs = 0;
+            AZStd::sys_time_t   m_durationUs = 0;
+            AZStd::sys_time_t   m_readUs = 0;       ///< Time spent in the stream reads, LoadData steps only.
+            AZ::u64             m_bytesRead = 0;    ///< LoadData steps only.
+            AZStd::thread_id    m_threadId;
+            AssetLoadPhase      m_phase = AssetLoadPhase::Queued;
+        };
+
+        /// Load times of all the assets of a type, summed over the recorded events.
+        struct AssetTypeLoadStatistics
+        {
+            AssetType           m_assetType;
+            AZ::u32             m_numLoads = 0;
+            AZ::u32             m_numErrors = 0;
+            AZStd::sys_time_t   m_queuedUs = 0;         ///< From the Queued step to the start of the load job.
+            AZStd::sys_time_t   m_streamOpenUs = 0;
+            AZStd::sys_time_t   m_loadDataUs = 0;
+            AZStd::sys_time_t   m_maxLoadDataUs = 0;
+            AZStd::sys_time_t   m_readUs = 0;
+            AZ::u64             m_bytesRead = 0;
+            AZStd::sys_time_t   m_initAssetUs = 0;
+            AZStd::sys_time_t   m_readyUs = 0;          ///< From the Queued step to the Ready or Error notification.
+            AZStd::sys_time_t   m_blockingWaitUs = 0;
+            AZStd::sys_time_t   m_assetMutexWaitUs = 0;
+        };
+
+        /**
+         * Records the steps of the asset loads, to find where the time of a slow level load goes.
+         * Events are written to a fixed size buffer without locks, when the buffer is full the following events are dropped.
+         * When the timeline isn't recording, recording an event costs a relaxed atomic load.
+         * The AssetManager owns a timeline, it is started and stopped with the asset_loadTimeline console variable and
+         * exported with the asset_exportLoadTimeline command.
+         */
+        class AssetLoadTimeline
+        {
+        public:
+            static const AZ::u32 DefaultCapacity = 64 * 1024;
+
+            AssetLoadTimeline() = default;
+            ~AssetLoadTimeline();
+
+            AssetLoadTimeline(const AssetLoadTimeline&) = delete;
+            AssetLoadTimeline& operator=(const AssetLoadTimeline&) = delete;
+
+            /// Starts recording, the events recorded before are discarded.
+            void Start(AZ::u32 capacity = DefaultCapacity);
+
+            /// Stops recording, returns once no thread is writing an event.
+            void Stop();
+
+            bool IsRecording() const { return m_isRecording.load(AZStd::memory_order_relaxed); }
+
+            /// Records an event if the timeline is recording. Thread safe and lock free.
+            void Record(const AssetLoadTimelineEvent& event)
+            {
+                if (IsRecording())
+                {
+                    RecordEvent(event);
+                }
+            }
+
+            /// Records an instant step if the timeline is recording.
+            void RecordInstant(AssetLoadPhase phase, const AssetId& assetId, const AssetType& assetType);
+
+            /// Returns the recorded events sorted by start time, can be called while recording.
+            AZStd::vector<AssetLoadTimelineEvent> GetEvents() const;
+
+            /// Returns the number of events that didn't fit in the buffer.
+            AZ::u64 GetNumDroppedEvents() const;
+
+            /// Returns the load statistics of each asset type, sorted by the time spent in LoadAssetData.
+            AZStd::vector<AssetTypeLoadStatistics> GetTypeStatistics() const;
+
+            /**
+             * Writes the events in the Chrome trace event format, the file can be opened in chrome://tracing.
+             * The assets are named with their path when the catalog knows it.
+             */
+            void WriteChromeTrace(AZStd::string& output) const;
+            bool ExportChromeTrace(const char* filePath) const;
+
+            /// Prints the statistics of each asset type.
+            void PrintStatistics() const;
+
+        private:
+            struct Slot
+            {
+                AssetLoadTimelineEvent      m_event;
+                AZStd::atomic<bool>         m_isCommitted;  ///< Set once the event is written.
+            };
+
+            void RecordEvent(const AssetLoadTimelineEvent& event);
+            void FreeSlots();
+
+            Slot*                       m_slots = nullptr;
+            AZ::u32                     m_capacity = 0;
+            AZStd::atomic<bool>         m_isRecording{ false };
+            AZStd::atomic<AZ::u64>      m_numEvents{ 0 };   ///< Number of slots reserved, including the dropped events.
+            AZStd::atomic<AZ::u32>      m_numWriters{ 0 };  ///< Threads writing an event, Stop() waits for them.
+            mutable AZStd::mutex        m_controlMutex;     ///< Serializes Start(), Stop() and the readers of the events.
+        };
+
+        /**
+         * Records the duration of a scope to a timeline. Nothing is recorded, and the time isn't read, unless the
+         * timeline was recording when the scope started.
+         */
+        class AssetLoadTimelineScope
+        {
+        public:
+            AssetLoadTimelineScope(AssetLoadTimeline& timeline, AssetLoadPhase phase, const AssetId& assetId, const AssetType& assetType)
+                : m_timeline(timeline.IsRecording() ? &timeline : nullptr)
+                , m_assetId(assetId)
+                , m_assetType(assetType)
+                , m_phase(phase)
+            {
+                if (m_timeline)
+                {
+                    m_startUs = AZStd::GetTimeNowMicroSecond();
+                }
+            }
+
+            ~AssetLoadTimelineScope()
+            {
+                if (m_timeline)
+                {
+                    AssetLoadTimelineEvent event;
+                    event.m_assetId = m_assetId;
+                    event.m_assetType = m_assetType;
+                    event.m_startUs = m_startUs;
+                    event.m_durationUs = AZStd::GetTimeNowMicroSecond() - m_startUs;
+                    event.m_readUs = m_readUs;
+                    event.m_bytesRead = m_bytesRead;
+                    event.m_threadId = AZStd::this_thread::get_id();
+                    event.m_phase = m_phase;
+                    m_timeline->Record(event);
+                }
+            }
+
+            AssetLoadTimelineScope(const AssetLoadTimelineScope&) = delete;
+            AssetLoadTimelineScope& operator=(const AssetLoadTimelineScope&) = delete;
+
+            bool IsRecording() const { return m_timeline != nullptr; }
+
+            /// Adds stream reads to the recorded step.
+            void AddRead(AZStd::sys_time_t readUs, AZ::u64 bytesRead)
+            {
+                m_readUs += readUs;
+                m_bytesRead += bytesRead;
+            }
+
+        private:
+            AssetLoadTimeline*  m_timeline;
+            const AssetId&      m_assetId;
+            const AssetType&    m_assetType;
+            AssetLoadPhase      m_phase;
+            AZStd::sys_time_t   m_startUs = 0;
+            AZStd::sys_time_t   m_readUs = 0;
+            AZ::u64             m_bytesRead = 0;
+        };
+    } // namespace Data
+} // namespace AZ
@@ -13,6 +13,8 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetInternal/LegacyBlockingAssetTypeManager.h>
 #include <AzCore/Asset/LegacyAssetHandler.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/AssetTracking.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
@@ -20,6 +22,8 @@
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/osstring.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/IO/FileIO.h>
@@ -31,6 +35,133 @@ namespace AZ
     {
         static const char* kAssetDBInstanceVarName = "AssetDatabaseInstace";
 
+        static void OnLoadTimelineChanged(const bool& isRecording);
+
+        AZ_CVAR(AZ::u32, asset_loadTimelineCapacity, AssetLoadTimeline::DefaultCapacity, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of asset load steps asset_loadTimeline records, the following steps are dropped.");
+        AZ_CVAR(bool, asset_loadTimeline, false, OnLoadTimelineChanged, AZ::ConsoleFunctorFlags::Null,
+            "Records the steps of the asset loads and the waits on them, export them with asset_exportLoadTimeline.");
+
+        static void OnLoadTimelineChanged(const bool& isRecording)
+        {
+            if (AssetManager::IsReady())
+            {
+                if (isRecording)
+                {
+                    AssetManager::Instance().GetLoadTimeline().Start(asset_loadTimelineCapacity);
+                }
+                else
+                {
+                    AssetManager::Instance().GetLoadTimeline().Stop();
+                }
+            }
+        }
+
+        static void asset_exportLoadTimeline(const AZ::StringSet& arguments)
+        {
+            if (!AssetManager::IsReady())
+            {
+                AZ_Warning("AssetManager", false, "There is no asset manager to export the load timeline of.");
+                return;
+            }
+
+            const AssetLoadTimeline& timeline = AssetManager::Instance().GetLoadTimeline();
+            const char* filePath = arguments.empty() ? "@user@/AssetLoadTimeline.json" : arguments.front().c_str();
+            if (timeline.ExportChromeTrace(filePath))
+            {
+                AZ_TracePrintf("AssetManager", "Exported the asset load timeline to %s\n", filePath);
+            }
+            timeline.PrintStatistics();
+        }
+        AZ_CONSOLEFREEFUNC(asset_exportLoadTimeline, AZ::ConsoleFunctorFlags::Null,
+            "Writes the asset load timeline to a Chrome trace file (default @user@/AssetLoadTimeline.json) and prints the load times of each asset type.");
+
+        static const AssetId s_noAssetId;
+        static const AssetType s_noAssetType = AssetType::CreateNull();
+
+        /**
+         * Locks the asset mutex like a lock_guard. When the load timeline is recording and the mutex is contended,
+         * the time spent waiting for it is recorded.
+         */
+        class AssetMutexLock
+        {
+        public:
+            AssetMutexLock(AZStd::recursive_mutex& mutex, AssetLoadTimeline& timeline, const AssetId& assetId, const AssetType& assetType)
+                : m_mutex(mutex)
+            {
+                if (!timeline.IsRecording())
+                {
+                    m_mutex.lock();
+                }
+                else if (!m_mutex.try_lock())
+                {
+                    AssetLoadTimelineScope waitScope(timeline, AssetLoadPhase::AssetMutexWait, assetId, assetType);
+                    m_mutex.lock();
+                }
+            }
+
+            ~AssetMutexLock()
+            {
+                m_mutex.unlock();
+            }
+
+            AssetMutexLock(const AssetMutexLock&) = delete;
+            AssetMutexLock& operator=(const AssetMutexLock&) = delete;
+
+        private:
+            AZStd::recursive_mutex& m_mutex;
+        };
+
+        /**
+         * Forwards to the stream of an asset and measures the reads, used to record the time LoadAssetData spends
+         * reading (and decompressing) data to the load timeline.
+         */
+        class TimedReadStream
+            : public IO::GenericStream
+        {
+        public:
+            TimedReadStream(IO::GenericStream& stream, AssetLoadTimelineScope& scope)
+                : m_stream(stream)
+                , m_scope(scope)
+            {
+            }
+
+            bool IsOpen() const override { return m_stream.IsOpen(); }
+            bool CanSeek() const override { return m_stream.CanSeek(); }
+            bool CanRead() const override { return m_stream.CanRead(); }
+            bool CanWrite() const override { return m_stream.CanWrite(); }
+            void Seek(IO::OffsetType bytes, SeekMode mode) override { m_stream.Seek(bytes, mode); }
+            IO::SizeType Write(IO::SizeType bytes, const void* iBuffer) override { return m_stream.Write(bytes, iBuffer); }
+            IO::SizeType WriteAtOffset(IO::SizeType bytes, const void* iBuffer, IO::OffsetType offset) override { return m_stream.WriteAtOffset(bytes, iBuffer, offset); }
+            IO::SizeType GetCurPos() const override { return m_stream.GetCurPos(); }
+            IO::SizeType GetLength() const override { return m_stream.GetLength(); }
+            bool IsCompressed() const override { return m_stream.IsCompressed(); }
+            const char* GetFilename() const override { return m_stream.GetFilename(); }
+            IO::OpenMode GetModeFlags() const override { return m_stream.GetModeFlags(); }
+            bool ReOpen() override { return m_stream.ReOpen(); }
+            void Close() override { m_stream.Close(); }
+
+            IO::SizeType Read(IO::SizeType bytes, void* oBuffer) override
+            {
+                const AZStd::sys_time_t startUs = AZStd::GetTimeNowMicroSecond();
+                const IO::SizeType bytesRead = m_stream.Read(bytes, oBuffer);
+                m_scope.AddRead(AZStd::GetTimeNowMicroSecond() - startUs, bytesRead);
+                return bytesRead;
+            }
+
+            IO::SizeType ReadAtOffset(IO::SizeType bytes, void* oBuffer, IO::OffsetType offset) override
+            {
+                const AZStd::sys_time_t startUs = AZStd::GetTimeNowMicroSecond();
+                const IO::SizeType bytesRead = m_stream.ReadAtOffset(bytes, oBuffer, offset);
+                m_scope.AddRead(AZStd::GetTimeNowMicroSecond() - startUs, bytesRead);
+                return bytesRead;
+            }
+
+        private:
+            IO::GenericStream& m_stream;
+            AssetLoadTimelineScope& m_scope;
+        };
+
         /*
          * This is the base class for Async AssetDatabase jobs
          */
@@ -134,17 +265,21 @@ namespace AZ
 
                         const bool loadSucceeded = LoadData();
 
-                        // Queue the result for dispatch to main thread.
-                        m_assetHandler->InitAsset(m_asset, loadSucceeded, false);
-
-                        // Notify any dependent jobs.
-                        if (loadSucceeded)
-                        {
-                            EBUS_EVENT_ID(m_asset.GetId(), AssetJobBus, OnAssetReady, m_asset);
-                        }
-                        else
                         {
-                            EBUS_EVENT_ID(m_asset.GetId(), AssetJobBus, OnAssetError, m_asset);
+                            AssetLoadTimelineScope initScope(m_owner->GetLoadTimeline(), AssetLoadPhase::InitAsset, m_asset.GetId(), m_asset.GetType());
+
+                            // Queue the result for dispatch to main thread.
+                            m_assetHandler->InitAsset(m_asset, loadSucceeded, false);
+
+                            // Notify any dependent jobs.
+                            if (loadSucceeded)
+                            {
+                                EBUS_EVENT_ID(m_asset.GetId(), AssetJobBus, OnAssetReady, m_asset);
+                            }
+                            else
+                            {
+                                EBUS_EVENT_ID(m_asset.GetId(), AssetJobBus, OnAssetError, m_asset);
+                            }
                         }
 
                         m_owner->UnregisterAssetLoading(m_asset);
@@ -158,27 +293,44 @@ namespace AZ
             {
                 AZ_ASSET_NAMED_SCOPE(m_asset.GetHint().c_str());
 
-                AssetStreamInfo loadInfo = m_owner->GetLoadStreamInfoForAsset(m_asset.GetId(), m_asset.GetType());
-                if (!loadInfo.IsValid())
+                AssetLoadTimeline& timeline = m_owner->GetLoadTimeline();
+                AssetStreamInfo loadInfo;
+                IO::FileIOStream stream;
                 {
-                    // opportunity for handler to do default substitution:
-                    AZ::Data::AssetId fallbackId = m_assetHandler->AssetMissingInCatalog(m_asset);
-                    if (fallbackId.IsValid())
+                    AssetLoadTimelineScope openScope(timeline, AssetLoadPhase::StreamOpen, m_asset.GetId(), m_asset.GetType());
+
+                    loadInfo = m_owner->GetLoadStreamInfoForAsset(m_asset.GetId(), m_asset.GetType());
+                    if (!loadInfo.IsValid())
                     {
-                        loadInfo = m_owner->GetLoadStreamInfoForAsset(fallbackId, m_asset.GetType());
+                        // opportunity for handler to do default substitution:
+                        AZ::Data::AssetId fallbackId = m_assetHandler->AssetMissingInCatalog(m_asset);
+                        if (fallbackId.IsValid())
+                        {
+                            loadInfo = m_owner->GetLoadStreamInfoForAsset(fallbackId, m_asset.GetType());
+                        }
+                    }
+
+                    if (loadInfo.IsValid() && !loadInfo.m_isCustomStreamType)
+                    {
+                        stream.Open(loadInfo.m_streamName.c_str(), loadInfo.m_streamFlags);
+                        stream.Seek(loadInfo.m_dataOffset, IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
                     }
                 }
-                
+
                 if (loadInfo.IsValid())
                 {
+                    AssetLoadTimelineScope loadScope(timeline, AssetLoadPhase::LoadData, m_asset.GetId(), m_asset.GetType());
                     if (loadInfo.m_isCustomStreamType)
                     {
                         return m_assetHandler->LoadAssetData(m_asset, loadInfo.m_streamName.c_str(), m_assetLoadFilterCB);
                     }
+                    else if (loadScope.IsRecording())
+                    {
+                        TimedReadStream timedStream(stream, loadScope);
+                        return m_assetHandler->LoadAssetData(m_asset, &timedStream, m_assetLoadFilterCB);
+                    }
                     else
                     {
-                        IO::FileIOStream stream(loadInfo.m_streamName.c_str(), loadInfo.m_streamFlags);
-                        stream.Seek(loadInfo.m_dataOffset, IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
                         return  m_assetHandler->LoadAssetData(m_asset, &stream, m_assetLoadFilterCB);
                     }
                 }
@@ -223,7 +375,10 @@ namespace AZ
             {
                 BusConnect(m_assetData.GetId());
 
-                Wait();
+                {
+                    AssetLoadTimelineScope waitScope(AssetManager::Instance().GetLoadTimeline(), AssetLoadPhase::BlockingWait, m_assetData.GetId(), m_assetData.GetType());
+                    Wait();
+                }
 
                 BusDisconnect(m_assetData.GetId());
 
@@ -300,6 +455,281 @@ namespace AZ
             AssetInternal::LegacyBlockingAssetTypeManager* m_blockingAssetTypeManager = nullptr;
         };
 
+        /**
+         * Loads the assets of an AssetPreloadGraph, each asset is queued once all its dependencies have been loaded.
+         * Listens to the AssetJobBus for the loads of the graph, including the ones queued by other systems.
+         */
+        class AssetPreloadGraphLoader
+            : public AssetPreloadGraph
+            , public AssetJobBus::MultiHandler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(AssetPreloadGraphLoader, SystemAllocator, 0);
+
+            AssetPreloadGraphLoader(AssetManager* owner, const AssetFilterCB& assetLoadFilterCB)
+                : m_owner(owner)
+                , m_assetLoadFilterCB(assetLoadFilterCB)
+            {
+                m_startTimeUs = AZStd::GetTimeNowMicroSecond();
+            }
+
+            ~AssetPreloadGraphLoader() override
+            {
+                // Disconnect before our members are destroyed, this waits for notifications in flight on other threads
+                AssetJobBus::MultiHandler::BusDisconnect();
+            }
+
+            /// Reads the dependency graph of the asset from the catalog.
+            void Build(const AssetId& assetId, const AssetType& assetType)
+            {
+                AddNode(assetId, assetType);
+
+                // The nodes vector is the breadth first queue, dependencies are appended as they are discovered
+                for (AZ::u32 nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
+                {
+                    AZ::Outcome<AZStd::vector<ProductDependency>, AZStd::string> result = AZ::Failure<AZStd::string>("No response");
+                    AssetCatalogRequestBus::BroadcastResult(result, &AssetCatalogRequestBus::Events::GetDirectProductDependencies, m_nodes[nodeIndex].m_asset.GetId());
+                    if (!result.IsSuccess())
+                    {
+                        continue;
+                    }
+
+                    for (const ProductDependency& dependency : result.GetValue())
+                    {
+                        const AZ::u32 dependencyIndex = AddNode(dependency.m_assetId, AssetType::CreateNull());
+                        AZStd::vector<AZ::u32>& dependencies = m_nodes[nodeIndex].m_dependencies;
+                        if (dependencyIndex != InvalidIndex && dependencyIndex != nodeIndex &&
+                            AZStd::find(dependencies.begin(), dependencies.end(), dependencyIndex) == dependencies.end())
+                        {
+                            dependencies.push_back(dependencyIndex);
+                        }
+                    }
+                }
+
+                SortGraph();
+
+                m_catalogTimeUs = AZStd::GetTimeNowMicroSecond() - m_startTimeUs;
+            }
+
+            /// Queues the loads of the assets without dependencies, the others are queued as their dependencies finish loading.
+            void Start()
+            {
+                // Assets that are already loaded report themselves when we connect
+                for (const Node& node : m_nodes)
+                {
+                    AssetJobBus::MultiHandler::BusConnect(node.m_asset.GetId());
+                }
+
+                AZStd::vector<AZ::u32> readyNodes;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    m_isStarted = true;
+                    for (AZ::u32 nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
+                    {
+                        Node& node = m_nodes[nodeIndex];
+                        if (node.m_numPendingDependencies == 0 && !node.m_isLoaded)
+                        {
+                            MarkQueued(node);
+                            readyNodes.push_back(nodeIndex);
+                        }
+                    }
+                    CheckComplete();
+                }
+                QueueLoads(readyNodes);
+            }
+
+            //////////////////////////////////////////////////////////////////////////
+            // AssetJobBus
+            void OnAssetReady(const Asset<AssetData>& asset) override
+            {
+                OnNodeLoaded(asset.GetId(), false);
+            }
+
+            void OnAssetError(const Asset<AssetData>& asset) override
+            {
+                OnNodeLoaded(asset.GetId(), true);
+            }
+            //////////////////////////////////////////////////////////////////////////
+
+        private:
+            static const AZ::u32 InvalidIndex = AZ::u32(-1);
+
+            AZ::u32 AddNode(const AssetId& assetId, const AssetType& assetType)
+            {
+                AssetInfo assetInfo;
+                AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+                if (!assetInfo.m_assetId.IsValid())
+                {
+                    if (assetType.IsNull())
+                    {
+                        return InvalidIndex; // we can't load a dependency the catalog doesn't know about
+                    }
+                    assetInfo.m_assetId = assetId;
+                    assetInfo.m_assetType = assetType;
+                }
+
+                auto nodeIt = m_nodeIndices.find(assetInfo.m_assetId);
+                if (nodeIt != m_nodeIndices.end())
+                {
+                    return nodeIt->second;
+                }
+
+                // Assets without a handler are loaded by other systems, when their dependents request them
+                if (!m_owner->GetHandler(assetInfo.m_assetType))
+                {
+                    return InvalidIndex;
+                }
+
+                // Create the asset without loading it, so our reference keeps it alive from the moment it is loaded
+                Asset<AssetData> asset = m_owner->GetAsset(assetInfo.m_assetId, assetInfo.m_assetType, false);
+                if (!asset || m_owner->FindAsset(assetInfo.m_assetId) != asset)
+                {
+                    return InvalidIndex; // each reference to an asset that isn't shared loads its own copy
+                }
+
+                const AZ::u32 nodeIndex = aznumeric_cast<AZ::u32>(m_nodes.size());
+                m_nodes.emplace_back();
+                m_nodes.back().m_asset = asset;
+                m_nodeIndices.insert(AZStd::make_pair(assetInfo.m_assetId, nodeIndex));
+                return nodeIndex;
+            }
+
+            /// Drops the cyclic references, computes the priorities and links the dependents.
+            void SortGraph()
+            {
+                if (m_nodes.empty())
+                {
+                    return;
+                }
+
+                // Depth first traversal from the root, a reference to an asset on the stack closes a cycle
+                enum : AZ::u8 { Unvisited, OnStack, Visited };
+                AZStd::vector<AZ::u8> visitState(m_nodes.size(), Unvisited);
+                AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>> stack; // node index, next dependency
+                AZStd::vector<AZ::u32> postOrder;
+                postOrder.reserve(m_nodes.size());
+
+                stack.push_back(AZStd::make_pair(0u, 0u));
+                visitState[0] = OnStack;
+                while (!stack.empty())
+                {
+                    const AZ::u32 nodeIndex = stack.back().first;
+                    AZStd::vector<AZ::u32>& dependencies = m_nodes[nodeIndex].m_dependencies;
+                    const AZ::u32 next = stack.back().second;
+                    if (next == dependencies.size())
+                    {
+                        visitState[nodeIndex] = Visited;
+                        postOrder.push_back(nodeIndex);
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    const AZ::u32 dependencyIndex = dependencies[next];
+                    if (visitState[dependencyIndex] == OnStack)
+                    {
+                        AZ_Warning("AssetManager", false, "Asset %s has a cyclic dependency on %s, the cycle is loaded in no particular order.",
+                            m_nodes[nodeIndex].m_asset.ToString<AZStd::string>().c_str(), m_nodes[dependencyIndex].m_asset.ToString<AZStd::string>().c_str());
+                        dependencies.erase(dependencies.begin() + next);
+                        continue;
+                    }
+
+                    ++stack.back().second;
+                    if (visitState[dependencyIndex] == Unvisited)
+                    {
+                        visitState[dependencyIndex] = OnStack;
+                        stack.push_back(AZStd::make_pair(dependencyIndex, 0u));
+                    }
+                }
+
+                // Reverse post order visits the dependents of an asset before the asset
+                for (auto nodeIt = postOrder.rbegin(); nodeIt != postOrder.rend(); ++nodeIt)
+                {
+                    Node& node = m_nodes[*nodeIt];
+                    node.m_numPendingDependencies = aznumeric_cast<AZ::u32>(node.m_dependencies.size());
+                    for (AZ::u32 dependencyIndex : node.m_dependencies)
+                    {
+                        Node& dependency = m_nodes[dependencyIndex];
+                        dependency.m_priority = AZ::GetMax(dependency.m_priority, node.m_priority + 1);
+                        dependency.m_dependents.push_back(*nodeIt);
+                    }
+                }
+            }
+
+            void OnNodeLoaded(const AssetId& assetId, bool hasFailed)
+            {
+                auto nodeIt = m_nodeIndices.find(assetId);
+                if (nodeIt == m_nodeIndices.end())
+                {
+                    return;
+                }
+
+                AZStd::vector<AZ::u32> readyNodes;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    Node& node = m_nodes[nodeIt->second];
+                    if (node.m_isLoaded)
+                    {
+                        return; // assets that finish loading while we connect can report twice
+                    }
+
+                    node.m_isLoaded = true;
+                    node.m_hasFailed = hasFailed;
+                    node.m_loadedTimeUs = AZStd::GetTimeNowMicroSecond() - m_startTimeUs;
+                    ++m_numLoaded;
+                    m_numFailed += hasFailed ? 1 : 0;
+
+                    // A failed dependency still releases its dependents, their handlers report the missing data like with GetAsset()
+                    for (AZ::u32 dependentIndex : node.m_dependents)
+                    {
+                        Node& dependent = m_nodes[dependentIndex];
+                        if (--dependent.m_numPendingDependencies == 0 && m_isStarted && !dependent.m_isQueued && !dependent.m_isLoaded)
+                        {
+                            MarkQueued(dependent);
+                            readyNodes.push_back(dependentIndex);
+                        }
+                    }
+                    CheckComplete();
+                }
+                QueueLoads(readyNodes);
+            }
+
+            void MarkQueued(Node& node)
+            {
+                node.m_isQueued = true;
+                node.m_queueTimeUs = AZStd::GetTimeNowMicroSecond() - m_startTimeUs;
+            }
+
+            void CheckComplete()
+            {
+                if (m_numLoaded == m_nodes.size() && !m_isComplete)
+                {
+                    m_isComplete = true;
+                    m_completeTimeUs = AZStd::GetTimeNowMicroSecond() - m_startTimeUs;
+                    m_completeCondition.notify_all();
+                }
+            }
+
+            void QueueLoads(AZStd::vector<AZ::u32>& nodeIndices)
+            {
+                // The job manager runs jobs in the order they are queued, start with the longest chains
+                AZStd::sort(nodeIndices.begin(), nodeIndices.end(), [this](AZ::u32 lhs, AZ::u32 rhs)
+                {
+                    return m_nodes[lhs].m_priority > m_nodes[rhs].m_priority;
+                });
+
+                for (AZ::u32 nodeIndex : nodeIndices)
+                {
+                    const Asset<AssetData>& asset = m_nodes[nodeIndex].m_asset;
+                    m_owner->GetAsset(asset.GetId(), asset.GetType(), true, m_assetLoadFilterCB);
+                }
+            }
+
+            AssetManager* m_owner;
+            AssetFilterCB m_assetLoadFilterCB;
+            AZStd::unordered_map<AssetId, AZ::u32> m_nodeIndices;   ///< Read only once the graph is built.
+            bool m_isStarted = false;
+        };
+
         class ReloadAssetJob
             : public LoadAssetJob
         {
@@ -474,6 +904,11 @@ namespace AZ
             m_jobManager = aznew JobManager(jobDesc);
             m_jobContext = aznew JobContext(*m_jobManager);
 
+            if (asset_loadTimeline)
+            {
+                m_loadTimeline.Start(asset_loadTimelineCapacity);
+            }
+
             AssetManagerBus::Handler::BusConnect();
         }
 
@@ -684,7 +1119,7 @@ namespace AZ
             // If the catalog is not available, use the original assetId
             const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, assetToFind, s_noAssetType);
             AssetMap::iterator it = m_assets.find(assetToFind);
             if (it != m_assets.end())
             {
@@ -734,7 +1169,7 @@ namespace AZ
                 bool isNewEntry = false;
                 AssetHandler* handler = nullptr;
 
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, assetInfo.m_assetId, assetType);
                 {
                     // check if asset already exists
                     {
@@ -791,6 +1226,7 @@ namespace AZ
                             // start the data loading
                             assetData->m_status = static_cast<int>(AssetData::AssetStatus::Loading);
                             loadJob = aznew LoadAssetJob(m_jobContext, this, assetData, handler, assetLoadFilterCB);
+                            m_loadTimeline.RecordInstant(AssetLoadPhase::Queued, assetInfo.m_assetId, assetData->GetType());
                         }
                         else if (loadBlocking && assetData->GetStatus() == AssetData::AssetStatus::Loading)
                         {
@@ -859,6 +1295,19 @@ namespace AZ
             return asset;
         }
 
+        //=========================================================================
+        // PreloadAsset
+        //=========================================================================
+        AZStd::shared_ptr<AssetPreloadGraph> AssetManager::PreloadAsset(const AssetId& assetId, const AssetType& assetType, const AssetFilterCB& assetLoadFilterCB)
+        {
+            AZ_Error("AssetDatabase", assetId.IsValid(), "PreloadAsset called with invalid asset Id.");
+
+            AZStd::shared_ptr<AssetPreloadGraphLoader> graph = AZStd::make_shared<AssetPreloadGraphLoader>(this, assetLoadFilterCB);
+            graph->Build(assetId, assetType);
+            graph->Start();
+            return graph;
+        }
+
         //=========================================================================
         // CreateAsset
         // [8/31/2012]
@@ -912,7 +1361,7 @@ namespace AZ
             bool destroyAsset = false;
             if (removeAssetFromHash)
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+                AssetMutexLock asset_lock(m_assetMutex, m_loadTimeline, assetId, assetType);
                 AssetMap::iterator it = m_assets.find(assetId);
                 // need to check the count again in here in case
                // someone was trying to get the asset on another thread
@@ -1157,6 +1606,7 @@ namespace AZ
             AssetData* data = asset.Get();
             AZ_Assert(data, "NotifyAssetReady: asset is missing info!");
             data->m_status = static_cast<int>(AssetData::AssetStatus::Ready);
+            m_loadTimeline.RecordInstant(AssetLoadPhase::Ready, asset.GetId(), asset.GetType());
             EBUS_EVENT_ID(asset.GetId(), AssetBus, OnAssetReady, asset);
         }
 
@@ -1193,6 +1643,7 @@ namespace AZ
         void AssetManager::NotifyAssetError(Asset<AssetData> asset)
         {
             asset.Get()->m_status = static_cast<int>(AssetData::AssetStatus::Error);
+            m_loadTimeline.RecordInstant(AssetLoadPhase::Error, asset.GetId(), asset.GetType());
             EBUS_EVENT_ID(asset.GetId(), AssetBus, OnAssetError, asset);
         }
 
@@ -1202,7 +1653,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::AddJob(AssetDatabaseJob* job)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, s_noAssetId, s_noAssetType);
 
             m_activeJobs.push_back(*job);
         }
@@ -1215,7 +1666,7 @@ namespace AZ
             {
                 const AZ::Data::AssetId& assetId = asset.GetId();
 
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, assetId, asset.GetType());
                 m_assetsLoadingByThread[assetId] = AZStd::this_thread::get_id();
             }
 
@@ -1232,7 +1683,7 @@ namespace AZ
             {
                 const AZ::Data::AssetId& assetId = asset.GetId();
 
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, assetId, asset.GetType());
                 m_assetsLoadingByThread.erase(assetId);
             }
         }
@@ -1243,7 +1694,7 @@ namespace AZ
         //=========================================================================
         void AssetManager::RemoveJob(AssetDatabaseJob* job)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetMutexLock assetLock(m_assetMutex, m_loadTimeline, s_noAssetId, s_noAssetType);
 
             m_activeJobs.erase(*job);
         }
@@ -1325,6 +1776,101 @@ namespace AZ
             AssetBus::QueueFunction(&AssetManager::NotifyAssetReloadError, this, Asset<AssetData>(asset));
         }
 
+        //=========================================================================
+        // AssetPreloadGraph
+        //=========================================================================
+        Asset<AssetData> AssetPreloadGraph::GetRootAsset() const
+        {
+            return m_nodes.empty() ? Asset<AssetData>() : m_nodes.front().m_asset;
+        }
+
+        bool AssetPreloadGraph::IsComplete() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_isComplete;
+        }
+
+        void AssetPreloadGraph::BlockUntilComplete()
+        {
+            const Asset<AssetData> rootAsset = GetRootAsset();
+            AssetLoadTimelineScope waitScope(AssetManager::Instance().GetLoadTimeline(), AssetLoadPhase::BlockingWait, rootAsset.GetId(), rootAsset.GetType());
+
+            AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+            m_completeCondition.wait(lock, [this]() { return m_isComplete; });
+        }
+
+        const AZStd::vector<AssetPreloadGraph::Node>& AssetPreloadGraph::GetNodes() const
+        {
+            return m_nodes;
+        }
+
+        AZ::u32 AssetPreloadGraph::GetNumFailed() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_numFailed;
+        }
+
+        AZStd::sys_time_t AssetPreloadGraph::GetCatalogTimeUs() const
+        {
+            return m_catalogTimeUs;
+        }
+
+        AZStd::sys_time_t AssetPreloadGraph::GetTotalTimeUs() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_completeTimeUs;
+        }
+
+        AZStd::vector<AZ::u32> AssetPreloadGraph::GetCriticalPath() const
+        {
+            AZStd::vector<AZ::u32> path;
+            if (m_nodes.empty())
+            {
+                return path;
+            }
+
+            // Follow the dependency that finished last, the cycles were dropped so this always reaches a leaf
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ::u32 nodeIndex = 0;
+            path.push_back(nodeIndex);
+            while (!m_nodes[nodeIndex].m_dependencies.empty())
+            {
+                const AZStd::vector<AZ::u32>& dependencies = m_nodes[nodeIndex].m_dependencies;
+                nodeIndex = dependencies.front();
+                for (AZ::u32 dependencyIndex : dependencies)
+                {
+                    if (m_nodes[dependencyIndex].m_loadedTimeUs > m_nodes[nodeIndex].m_loadedTimeUs)
+                    {
+                        nodeIndex = dependencyIndex;
+                    }
+                }
+                path.push_back(nodeIndex);
+            }
+            return path;
+        }
+
+        void AssetPreloadGraph::PrintTimingReport() const
+        {
+            if (m_nodes.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<AZ::u32> criticalPath = GetCriticalPath();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_TracePrintf("AssetManager", "Preload of %s: %u assets (%u failed) in %.2f ms, %.2f ms reading the catalog.\n",
+                m_nodes.front().m_asset.ToString<AZStd::string>().c_str(), aznumeric_cast<AZ::u32>(m_nodes.size()), m_numFailed,
+                m_completeTimeUs / 1000.0f, m_catalogTimeUs / 1000.0f);
+            AZ_TracePrintf("AssetManager", "Critical path:\n");
+            for (AZ::u32 nodeIndex : criticalPath)
+            {
+                const Node& node = m_nodes[nodeIndex];
+                AZ_TracePrintf("AssetManager", "    %s queued at %.2f ms, loaded at %.2f ms\n",
+                    node.m_asset.ToString<AZStd::string>().c_str(), node.m_queueTimeUs / 1000.0f, node.m_loadedTimeUs / 1000.0f);
+            }
+        }
+
         //=========================================================================
         // AssetHandler
         // [04/03/2014]
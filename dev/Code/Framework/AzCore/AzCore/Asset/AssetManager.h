@@ -13,14 +13,19 @@
 #pragma once
 
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetLoadTimeline.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
+#include <AzCore/std/parallel/condition_variable.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -39,6 +44,7 @@ namespace AZ
         class LegacyAssetHandler;
         class AssetCatalog;
         class AssetDatabaseJob;
+        class AssetPreloadGraph;
 
         class AssetStreamInfo
         {
@@ -182,6 +188,20 @@ namespace AZ
             */
             Asset<AssetData> GetAsset(const AssetId& assetId, const AssetType& assetType, bool queueLoadData = true, const AZ::Data::AssetFilterCB& assetLoadFilterCB = nullptr, bool loadBlocking = false, bool isCreate = false);
 
+            /**
+             * Loads an asset together with all of its product dependencies.
+             * The dependencies are read from the AssetCatalogRequestBus up front and each asset of the graph is queued as soon as
+             * its own dependencies are loaded, so independent branches load in parallel and handlers find the dependencies they
+             * request during LoadAssetData already loaded. Assets on the longest dependency chains are queued first.
+             * Dependencies without a registered handler are left to the systems that load them.
+             * If the catalog doesn't provide product dependencies this loads just the asset, like GetAsset().
+             * \param assetId a valid id of the asset
+             * \param assetType the type of the asset
+             * \param assetLoadFilterCB optional filter predicate passed to the loads of the graph.
+             * \return the load graph, it holds a reference to every asset of the graph and reports the load timing.
+             */
+            AZStd::shared_ptr<AssetPreloadGraph> PreloadAsset(const AssetId& assetId, const AssetType& assetType, const AssetFilterCB& assetLoadFilterCB = nullptr);
+
             /// Locates an existing asset in the database. If the asset is unknown, a null asset pointer is returned.
             template<class AssetClass>
             Asset<AssetClass> FindAsset(const AssetId& assetId);
@@ -227,6 +247,11 @@ namespace AZ
 
             JobManager* GetJobManager() const { return m_jobManager; }
 
+            /**
+            * Gets the timeline the steps of the asset loads are recorded to, see the asset_loadTimeline console variable.
+            */
+            AssetLoadTimeline& GetLoadTimeline() { return m_loadTimeline; }
+
             void        DispatchEvents();
 
             /**
@@ -304,6 +329,76 @@ namespace AZ
 
             // Setting this to true will cause all loadAssets jobs that have not started yet to cancel as soon as they start.
             bool m_cancelAllActiveJobs = false;
+
+            AssetLoadTimeline m_loadTimeline;
+        };
+
+        /**
+         * Dependency graph of an asset requested with AssetManager::PreloadAsset(), with the timing of each load.
+         * Holds a reference to every asset of the graph, so the dependencies loaded ahead of their dependents stay in memory
+         * until the dependents pick them up. Release it once the root asset is ready.
+         */
+        class AssetPreloadGraph
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(AssetPreloadGraph, SystemAllocator, 0);
+
+            struct Node
+            {
+                Asset<AssetData>        m_asset;
+                AZStd::vector<AZ::u32>  m_dependencies;                 ///< Indices of the direct dependencies, cyclic references are dropped.
+                AZStd::vector<AZ::u32>  m_dependents;                   ///< Indices of the assets that directly depend on this one.
+                AZ::u32                 m_priority = 0;                 ///< Longest chain of dependents above the asset, higher priorities are queued first.
+                AZ::u32                 m_numPendingDependencies = 0;   ///< Dependencies that haven't finished loading.
+                AZStd::sys_time_t       m_queueTimeUs = 0;              ///< When the load was queued, relative to the PreloadAsset() call.
+                AZStd::sys_time_t       m_loadedTimeUs = 0;             ///< When the load finished, relative to the PreloadAsset() call.
+                bool                    m_isQueued = false;
+                bool                    m_isLoaded = false;
+                bool                    m_hasFailed = false;
+            };
+
+            virtual ~AssetPreloadGraph() = default;
+
+            /// The asset passed to PreloadAsset(), null if it has no handler.
+            Asset<AssetData> GetRootAsset() const;
+
+            /// Returns true when every asset of the graph finished loading.
+            bool IsComplete() const;
+
+            /// Blocks until every asset of the graph finished loading.
+            /// Don't call it from the thread a LegacyAssetHandler of the graph loads its assets on.
+            void BlockUntilComplete();
+
+            /// The nodes of the graph, the root asset is the first one. Only access them once the graph is complete.
+            const AZStd::vector<Node>& GetNodes() const;
+
+            /// Number of assets of the graph that failed to load.
+            AZ::u32 GetNumFailed() const;
+
+            /// Time spent reading the dependencies from the catalog.
+            AZStd::sys_time_t GetCatalogTimeUs() const;
+
+            /// Time from the PreloadAsset() call until every asset of the graph was loaded.
+            AZStd::sys_time_t GetTotalTimeUs() const;
+
+            /// The chain of dependencies that finished last, from the root to a leaf. These loads bound the total time.
+            AZStd::vector<AZ::u32> GetCriticalPath() const;
+
+            /// Prints the timing of the graph and its critical path.
+            void PrintTimingReport() const;
+
+        protected:
+            AssetPreloadGraph() = default;
+
+            AZStd::vector<Node>         m_nodes;
+            AZStd::sys_time_t           m_startTimeUs = 0;
+            AZStd::sys_time_t           m_catalogTimeUs = 0;
+            AZStd::sys_time_t           m_completeTimeUs = 0;
+            AZ::u32                     m_numLoaded = 0;
+            AZ::u32                     m_numFailed = 0;
+            bool                        m_isComplete = false;
+            mutable AZStd::mutex        m_mutex;                ///< Lock when accessing the load state of the nodes.
+            AZStd::condition_variable   m_completeCondition;
         };
 
         /**
@@ -16,6 +16,7 @@
 #include <AzCore/Casting/lossy_cast.h>
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/PhasedTickScheduler.h>
 #include <AzCore/Component/TickBus.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
@@ -458,6 +459,8 @@ namespace AZ
 
         CreateReflectionManager();
 
+        LoadReflectionSnapshot();
+
         NameDictionary::Create();
 
         // Call this and child class's reflects
@@ -467,6 +470,8 @@ namespace AZ
         TickBus::AllowFunctionQueuing(true);
         SystemTickBus::AllowFunctionQueuing(true);
 
+        m_phasedTickScheduler = AZStd::make_unique<PhasedTickScheduler>();
+
         ComponentApplicationBus::Handler::BusConnect();
 
         m_currentTime = AZStd::chrono::system_clock::now();
@@ -558,6 +563,11 @@ namespace AZ
         m_entities.clear();
         m_entities.rehash(0); // force free all memory
 
+        m_phasedTickScheduler.reset();
+
+        // Saved now to also cover the modules loaded after startup, e.g. from another application descriptor
+        SaveReflectionSnapshot();
+
         DestroyReflectionManager();
 
         // Uninit and unload any dynamic modules.
@@ -738,6 +748,54 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // LoadReflectionSnapshot
+    //=========================================================================
+    void ComponentApplication::LoadReflectionSnapshot()
+    {
+        if (!m_startupParameters.m_reflectionSnapshotFile)
+        {
+            return;
+        }
+
+        // Component descriptors come from the executable and the dynamic modules
+        AZStd::vector<AZStd::string> moduleNames;
+        if (m_startupParameters.m_loadDynamicModules)
+        {
+            for (const DynamicModuleDescriptor& module : m_descriptor.m_modules)
+            {
+                moduleNames.emplace_back(module.m_dynamicLibraryPath.c_str());
+            }
+        }
+        const u64 key = ReflectionSnapshot::ComputeKey(m_startupParameters.m_reflectionSnapshotBuildId, moduleNames);
+
+        ReflectionSnapshot snapshot;
+        if (snapshot.Load(m_startupParameters.m_reflectionSnapshotFile, key))
+        {
+            ReflectionEnvironment::GetReflectionManager()->SetSnapshot(AZStd::move(snapshot));
+        }
+        else
+        {
+            m_recordedReflectionSnapshot = AZStd::make_unique<ReflectionSnapshot>(key);
+            ReflectionEnvironment::GetReflectionManager()->RecordSnapshot(m_recordedReflectionSnapshot.get());
+        }
+    }
+
+    //=========================================================================
+    // SaveReflectionSnapshot
+    //=========================================================================
+    void ComponentApplication::SaveReflectionSnapshot()
+    {
+        if (!m_recordedReflectionSnapshot)
+        {
+            return;
+        }
+
+        ReflectionEnvironment::GetReflectionManager()->RecordSnapshot(nullptr);
+        m_recordedReflectionSnapshot->Save(m_startupParameters.m_reflectionSnapshotFile);
+        m_recordedReflectionSnapshot.reset();
+    }
+
     //=========================================================================
     // RegisterComponentDescriptor
     // [5/30/2012]
@@ -1193,22 +1251,14 @@ namespace AZ
             // Call deprecated ReflectSerialize() function.
             // Issue a warning if any classes reflected as a result of this call.
 #ifdef AZ_ENABLE_TRACING
-            int serializedClassCount = 0;
-            auto countClassesFn = [&serializedClassCount](const SerializeContext::ClassData*, const Uuid&)
-            {
-                ++serializedClassCount;
-                return true;
-            };
-
-            serializeContext->EnumerateAll(countClassesFn);
+            // Counted without enumerating, which would reflect all the classes deferred by the reflection snapshot
+            const size_t previousClassCount = serializeContext->GetNumReflectedClasses();
 #endif // AZ_ENABLE_TRACING
 
             ReflectSerialize();
 
 #ifdef AZ_ENABLE_TRACING
-            int previousClassCount = serializedClassCount;
-            serializedClassCount = 0;
-            serializeContext->EnumerateAll(countClassesFn);
+            const size_t serializedClassCount = serializeContext->GetNumReflectedClasses();
             AZ_Warning("Application", serializedClassCount == previousClassCount,
                 "Classes reflected via deprecated ComponentApplication::ReflectSerialize() function, use ComponentApplication::Reflect() instead.");
 #endif // AZ_ENABLE_TRACING
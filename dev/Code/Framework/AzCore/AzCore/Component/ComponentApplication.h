@@ -35,6 +35,7 @@ namespace AZ
     class BehaviorContext;
     class Module;
     class ModuleManager;
+    class PhasedTickScheduler;
 
     namespace Debug
     {
@@ -170,6 +171,14 @@ namespace AZ
 
             /// Specifies which system components to create & activate. If no tags specified, all system components are used. Specify as comma separated list.
             const char* m_systemComponentTags = nullptr;
+
+            /// If set, path of the reflection snapshot (see \ref ReflectionSnapshot). If the file was saved by the same build with
+            /// the same modules, classes are reflected to the SerializeContext when first used instead of when their descriptors
+            /// are registered, otherwise the snapshot is recorded until Destroy and saved then.
+            const char* m_reflectionSnapshotFile = nullptr;
+
+            /// Identifies the build, a reflection snapshot is only used by the build that saved it.
+            const char* m_reflectionSnapshotBuildId = nullptr;
         };
 
         ComponentApplication();
@@ -280,6 +289,11 @@ namespace AZ
         /// Create the drillers
         void        CreateDrillers();
 
+        /// Defers reflection using the snapshot in m_startupParameters, or starts recording one.
+        void        LoadReflectionSnapshot();
+        /// Saves the snapshot recorded since startup, if any.
+        void        SaveReflectionSnapshot();
+
         /**
          * This is the function that will be called instantly after the memory
          * manager is created. This is where we should register all core component
@@ -344,6 +358,7 @@ namespace AZ
         AZStd::chrono::system_clock::time_point     m_currentTime;
         float                                       m_deltaTime;
         AZStd::unique_ptr<ModuleManager>            m_moduleManager;
+        AZStd::unique_ptr<PhasedTickScheduler>      m_phasedTickScheduler;
         Descriptor                                  m_descriptor;
         bool                                        m_isStarted;
         bool                                        m_isSystemAllocatorOwner;
@@ -357,6 +372,8 @@ namespace AZ
         Debug::DrillerManager*                      m_drillerManager;
 
         StartupParameters                           m_startupParameters;
+
+        AZStd::unique_ptr<ReflectionSnapshot>       m_recordedReflectionSnapshot;       ///< Snapshot recorded since startup, when there was no valid one.
     };
 }
 
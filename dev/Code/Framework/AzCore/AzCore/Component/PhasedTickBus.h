@@ -0,0 +1,177 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+/** @file
+ * Header file for the phased tick bus. Handlers on this bus opt in to being ticked
+ * from job worker threads. Each handler declares the tick phase it runs in and the
+ * resources it reads and writes, and the PhasedTickScheduler runs handlers that do not
+ * conflict with each other in parallel.
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    class PhasedTickEvents;
+
+    /**
+     * Resources a phased tick handler touches from OnPhasedTick.
+     * Resource tags are arbitrary values agreed upon by the systems sharing the data, for example AZ_CRC("Transforms").
+     * Handlers that only read the same resource may tick at the same time. A handler that writes a resource is ordered
+     * after every handler of the same phase that connected before it and reads or writes that resource.
+     */
+    class PhasedTickResources
+    {
+    public:
+        void Read(Crc32 tag)        { m_reads.push_back(tag); }
+        void Write(Crc32 tag)       { m_writes.push_back(tag); }
+
+        /// The handler must be ticked on the thread that issues the tick, serially with every other handler of its phase.
+        void RequireMainThread()    { m_mainThreadOnly = true; }
+
+        const AZStd::vector<Crc32>& GetReads() const    { return m_reads; }
+        const AZStd::vector<Crc32>& GetWrites() const   { return m_writes; }
+        bool IsMainThreadOnly() const                   { return m_mainThreadOnly; }
+
+        void Clear()
+        {
+            m_reads.clear();
+            m_writes.clear();
+            m_mainThreadOnly = false;
+        }
+
+    private:
+        AZStd::vector<Crc32> m_reads;
+        AZStd::vector<Crc32> m_writes;
+        bool m_mainThreadOnly = false;
+    };
+
+    /**
+     * Timing statistics the PhasedTickScheduler gathers for each handler.
+     */
+    struct PhasedTickStats
+    {
+        AZ::u64             m_tickCount = 0;        ///< Number of OnPhasedTick calls since the stats were last reset.
+        AZStd::sys_time_t   m_lastTimeUs = 0;       ///< Duration of the most recent OnPhasedTick in microseconds.
+        AZStd::sys_time_t   m_totalTimeUs = 0;      ///< Accumulated OnPhasedTick duration in microseconds.
+        AZStd::sys_time_t   m_peakTimeUs = 0;       ///< Longest OnPhasedTick duration in microseconds.
+    };
+
+    /**
+     * Interface of the phased tick scheduler, accessible through AZ::Interface<IPhasedTickScheduler>.
+     */
+    class IPhasedTickScheduler
+    {
+    public:
+        AZ_RTTI(IPhasedTickScheduler, "{6B0E8A44-2C7D-4A5E-9F0B-3E1D7C52A9B6}");
+
+        virtual ~IPhasedTickScheduler() = default;
+
+        /// Called by the PhasedTickBus connection policy, the handler set is rebuilt before the next tick.
+        virtual void OnPhasedHandlerConnected(PhasedTickEvents* handler) = 0;
+        virtual void OnPhasedHandlerDisconnected(PhasedTickEvents* handler) = 0;
+
+        /// Requests the handler set to be rebuilt, call when a handler changes its phase or resources while connected.
+        virtual void InvalidatePhasedHandlers() = 0;
+
+        /// Retrieves the timing stats of a connected handler. Returns false if the handler is not known to the scheduler.
+        virtual bool GetHandlerStats(const PhasedTickEvents* handler, PhasedTickStats& stats) const = 0;
+
+        virtual void ResetStats() = 0;
+    };
+
+    /**
+     * Interface for AZ::PhasedTickBus, an opt-in alternative to AZ::TickBus.
+     * Handlers of a phase are ticked at the position given by GetTickPhase() relative to regular TickBus handlers,
+     * so a handler with phase TICK_ANIMATION runs after every TickBus handler with a lower tick order. Within a
+     * phase, handlers run on AZ::JobManager worker threads, ordered only by the resources they declare.
+     * Handlers that don't override DeclareTickResources() run on the ticking thread, in connection order.
+     * @note A handler may disconnect itself during OnPhasedTick, but must not disconnect or destroy other
+     * phased handlers while a phase is running.
+     */
+    class PhasedTickEvents
+        : public AZ::EBusTraits
+    {
+    public:
+        AZ_RTTI(PhasedTickEvents, "{0F7B5D6E-93B2-4F3C-8E71-6A2D8C4B1E05}");
+
+        virtual ~PhasedTickEvents() = default;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static const AZ::EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::Multiple;
+        typedef AZStd::recursive_mutex MutexType;
+
+        /**
+         * Keeps the PhasedTickScheduler in sync with the handlers connected to the bus.
+         */
+        template <class Bus>
+        struct PhasedTickConnectionPolicy
+            : public EBusConnectionPolicy<Bus>
+        {
+            static void Connect(typename Bus::BusPtr& busPtr, typename Bus::Context& context, typename Bus::HandlerNode& handler, const typename Bus::BusIdType& id = 0)
+            {
+                EBusConnectionPolicy<Bus>::Connect(busPtr, context, handler, id);
+                if (IPhasedTickScheduler* scheduler = Interface<IPhasedTickScheduler>::Get())
+                {
+                    scheduler->OnPhasedHandlerConnected(handler);
+                }
+            }
+
+            static void Disconnect(typename Bus::Context& context, typename Bus::HandlerNode& handler, typename Bus::BusPtr& busPtr)
+            {
+                if (IPhasedTickScheduler* scheduler = Interface<IPhasedTickScheduler>::Get())
+                {
+                    scheduler->OnPhasedHandlerDisconnected(handler);
+                }
+                EBusConnectionPolicy<Bus>::Disconnect(context, handler, busPtr);
+            }
+        };
+        template<typename Bus>
+        using ConnectionPolicy = PhasedTickConnectionPolicy<Bus>;
+        //////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Signals that the application has issued a tick. May be called from any job worker thread,
+         * unless DeclareTickResources() requires the main thread.
+         * @param deltaTime The delta (in seconds) from the previous tick and the current time.
+         * @param time The current time.
+         */
+        virtual void OnPhasedTick(float deltaTime, ScriptTimePoint time) = 0;
+
+        /**
+         * The phase this handler is ticked in. Phases share the ordering of TickEvents::GetTickOrder(),
+         * see the ComponentTickBus enum for recommended values.
+         * This value should not change while the handler is connected.
+         */
+        virtual int GetTickPhase() { return TICK_DEFAULT; }
+
+        /**
+         * Declares the resources OnPhasedTick reads and writes. The default implementation requires
+         * the main thread, override it to allow the handler to be ticked in parallel.
+         * Called when the scheduler rebuilds its handler set, not every tick.
+         */
+        virtual void DeclareTickResources(PhasedTickResources& resources) { resources.RequireMainThread(); }
+    };
+
+    /**
+     * The EBus for phased tick notification events.
+     * The events are defined in the AZ::PhasedTickEvents class.
+     */
+    typedef AZ::EBus<PhasedTickEvents> PhasedTickBus;
+}
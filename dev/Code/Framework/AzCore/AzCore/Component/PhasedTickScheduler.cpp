@@ -0,0 +1,328 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Component/PhasedTickScheduler.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    //=========================================================================
+    // PhaseTicker
+    //=========================================================================
+    PhasedTickScheduler::PhaseTicker::PhaseTicker(PhasedTickScheduler& scheduler, int phase)
+        : m_scheduler(scheduler)
+        , m_phase(phase)
+    {
+        TickBus::Handler::BusConnect();
+    }
+
+    PhasedTickScheduler::PhaseTicker::~PhaseTicker()
+    {
+        TickBus::Handler::BusDisconnect();
+    }
+
+    void PhasedTickScheduler::PhaseTicker::OnTick(float deltaTime, ScriptTimePoint time)
+    {
+        m_scheduler.TickPhase(m_phase, deltaTime, time);
+    }
+
+    //=========================================================================
+    // PhasedTickScheduler
+    //=========================================================================
+    PhasedTickScheduler::PhasedTickScheduler(JobContext* jobContext)
+        : m_jobContext(jobContext)
+        , m_isDirty(true)
+        , m_isTicking(false)
+    {
+        TickBus::Handler::BusConnect();
+    }
+
+    PhasedTickScheduler::~PhasedTickScheduler()
+    {
+        TickBus::Handler::BusDisconnect();
+        m_phases.clear();
+    }
+
+    void PhasedTickScheduler::OnPhasedHandlerConnected(PhasedTickEvents* handler)
+    {
+        (void)handler;
+        m_isDirty = true;
+    }
+
+    void PhasedTickScheduler::OnPhasedHandlerDisconnected(PhasedTickEvents* handler)
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+        auto locationIt = m_handlerLocations.find(handler);
+        if (locationIt != m_handlerLocations.end())
+        {
+            // Only clear the node, the waves are rebuilt next frame. This keeps the node indices valid
+            // when a handler disconnects itself while its phase is running.
+            NodeLocation& location = locationIt->second;
+            location.first->m_nodes[location.second].m_handler = nullptr;
+            m_handlerLocations.erase(locationIt);
+        }
+        m_isDirty = true;
+    }
+
+    void PhasedTickScheduler::InvalidatePhasedHandlers()
+    {
+        m_isDirty = true;
+    }
+
+    bool PhasedTickScheduler::GetHandlerStats(const PhasedTickEvents* handler, PhasedTickStats& stats) const
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+        auto locationIt = m_handlerLocations.find(handler);
+        if (locationIt == m_handlerLocations.end())
+        {
+            return false;
+        }
+        const NodeLocation& location = locationIt->second;
+        stats = location.first->m_nodes[location.second].m_stats;
+        return true;
+    }
+
+    void PhasedTickScheduler::ResetStats()
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+        for (auto& phaseIt : m_phases)
+        {
+            for (HandlerNode& node : phaseIt.second->m_nodes)
+            {
+                node.m_stats = PhasedTickStats();
+            }
+        }
+    }
+
+    void PhasedTickScheduler::OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/)
+    {
+        RebuildIfNeeded();
+    }
+
+    void PhasedTickScheduler::RebuildIfNeeded()
+    {
+        AZ_Assert(!m_isTicking, "Phased tick handlers can't be rebuilt while a phase is ticking.");
+        if (m_isDirty.exchange(false))
+        {
+            Rebuild();
+        }
+    }
+
+    void PhasedTickScheduler::Rebuild()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        struct PendingNode
+        {
+            PhasedTickEvents* m_handler;
+            int m_wave;
+            bool m_isMainThreadOnly;
+        };
+
+        struct PhaseBuilder
+        {
+            AZStd::vector<PendingNode> m_nodes;
+            AZStd::unordered_map<AZ::u32, int> m_lastReadWave;
+            AZStd::unordered_map<AZ::u32, int> m_lastWriteWave;
+            int m_barrierWave = -1;     ///< Wave of the last main thread handler, nothing may be scheduled before it.
+            int m_lastWave = -1;
+        };
+
+        // Assign each handler to the earliest wave after every earlier handler it conflicts with. The handlers are
+        // visited in connection order so handlers that don't declare resources keep their relative order.
+        // This runs with the bus locked but without m_mutex, handlers may connect from other threads.
+        AZStd::map<int, PhaseBuilder> builders;
+        PhasedTickResources resources;
+        PhasedTickBus::EnumerateHandlers([&builders, &resources](PhasedTickEvents* handler)
+        {
+            PhaseBuilder& builder = builders[handler->GetTickPhase()];
+
+            resources.Clear();
+            handler->DeclareTickResources(resources);
+
+            int wave = builder.m_barrierWave + 1;
+            if (resources.IsMainThreadOnly())
+            {
+                wave = builder.m_lastWave + 1;
+                builder.m_barrierWave = wave;
+            }
+            else
+            {
+                for (Crc32 tag : resources.GetReads())
+                {
+                    auto writeIt = builder.m_lastWriteWave.find(tag);
+                    if (writeIt != builder.m_lastWriteWave.end())
+                    {
+                        wave = AZStd::GetMax(wave, writeIt->second + 1);
+                    }
+                }
+                for (Crc32 tag : resources.GetWrites())
+                {
+                    auto writeIt = builder.m_lastWriteWave.find(tag);
+                    if (writeIt != builder.m_lastWriteWave.end())
+                    {
+                        wave = AZStd::GetMax(wave, writeIt->second + 1);
+                    }
+                    auto readIt = builder.m_lastReadWave.find(tag);
+                    if (readIt != builder.m_lastReadWave.end())
+                    {
+                        wave = AZStd::GetMax(wave, readIt->second + 1);
+                    }
+                }
+                for (Crc32 tag : resources.GetReads())
+                {
+                    int& lastRead = builder.m_lastReadWave.insert(AZStd::make_pair(static_cast<AZ::u32>(tag), wave)).first->second;
+                    lastRead = AZStd::GetMax(lastRead, wave);
+                }
+                for (Crc32 tag : resources.GetWrites())
+                {
+                    builder.m_lastWriteWave[tag] = wave;
+                }
+            }
+
+            builder.m_lastWave = AZStd::GetMax(builder.m_lastWave, wave);
+            builder.m_nodes.push_back({ handler, wave, resources.IsMainThreadOnly() });
+            return true;
+        });
+
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+
+        // Keep the stats of handlers that survive the rebuild.
+        AZStd::unordered_map<const PhasedTickEvents*, PhasedTickStats> previousStats;
+        previousStats.reserve(m_handlerLocations.size());
+        for (const auto& locationIt : m_handlerLocations)
+        {
+            previousStats.emplace(locationIt.first, locationIt.second.first->m_nodes[locationIt.second.second].m_stats);
+        }
+        m_handlerLocations.clear();
+
+        // Drop phases that no longer have handlers.
+        for (auto phaseIt = m_phases.begin(); phaseIt != m_phases.end();)
+        {
+            if (builders.find(phaseIt->first) == builders.end())
+            {
+                phaseIt = m_phases.erase(phaseIt);
+            }
+            else
+            {
+                ++phaseIt;
+            }
+        }
+
+        for (auto& builderIt : builders)
+        {
+            PhaseBuilder& builder = builderIt.second;
+            AZStd::stable_sort(builder.m_nodes.begin(), builder.m_nodes.end(), [](const PendingNode& lhs, const PendingNode& rhs)
+            {
+                return lhs.m_wave < rhs.m_wave;
+            });
+
+            AZStd::unique_ptr<Phase>& phase = m_phases[builderIt.first];
+            if (!phase)
+            {
+                phase.reset(aznew Phase());
+                phase->m_ticker.reset(aznew PhaseTicker(*this, builderIt.first));
+            }
+
+            phase->m_nodes.clear();
+            phase->m_waves.clear();
+            phase->m_nodes.reserve(builder.m_nodes.size());
+            int currentWave = -1;
+            for (const PendingNode& pending : builder.m_nodes)
+            {
+                if (pending.m_wave != currentWave)
+                {
+                    currentWave = pending.m_wave;
+                    Wave wave;
+                    wave.m_first = phase->m_nodes.size();
+                    wave.m_isMainThreadOnly = pending.m_isMainThreadOnly;
+                    phase->m_waves.push_back(wave);
+                }
+                ++phase->m_waves.back().m_count;
+
+                HandlerNode node;
+                node.m_handler = pending.m_handler;
+                auto statsIt = previousStats.find(pending.m_handler);
+                if (statsIt != previousStats.end())
+                {
+                    node.m_stats = statsIt->second;
+                }
+                m_handlerLocations[pending.m_handler] = NodeLocation(phase.get(), phase->m_nodes.size());
+                phase->m_nodes.push_back(node);
+            }
+        }
+    }
+
+    void PhasedTickScheduler::TickPhase(int phase, float deltaTime, ScriptTimePoint time)
+    {
+        auto phaseIt = m_phases.find(phase);
+        if (phaseIt == m_phases.end())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        JobContext* jobContext = m_jobContext ? m_jobContext : JobContext::GetGlobalContext();
+        Phase& phaseData = *phaseIt->second;
+
+        m_isTicking = true;
+        for (const Wave& wave : phaseData.m_waves)
+        {
+            HandlerNode* nodes = phaseData.m_nodes.data() + wave.m_first;
+            if (wave.m_isMainThreadOnly || wave.m_count == 1 || !jobContext)
+            {
+                for (size_t i = 0; i < wave.m_count; ++i)
+                {
+                    TickNode(nodes[i], deltaTime, time);
+                }
+            }
+            else
+            {
+                parallel_for(0, static_cast<int>(wave.m_count), [this, nodes, deltaTime, &time](int i)
+                {
+                    TickNode(nodes[i], deltaTime, time);
+                }, jobContext);
+            }
+        }
+        m_isTicking = false;
+    }
+
+    void PhasedTickScheduler::TickNode(HandlerNode& node, float deltaTime, ScriptTimePoint time)
+    {
+        PhasedTickEvents* handler = node.m_handler;
+        if (!handler)
+        {
+            return;
+        }
+
+        const AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+        handler->OnPhasedTick(deltaTime, time);
+        const AZStd::sys_time_t elapsed = AZStd::GetTimeNowMicroSecond() - startTime;
+
+        // Each node is ticked by a single thread, the handler itself may be gone by now but the node is still ours.
+        PhasedTickStats& stats = node.m_stats;
+        ++stats.m_tickCount;
+        stats.m_lastTimeUs = elapsed;
+        stats.m_totalTimeUs += elapsed;
+        stats.m_peakTimeUs = AZStd::GetMax(stats.m_peakTimeUs, elapsed);
+    }
+
+    size_t PhasedTickScheduler::GetNumWaves(int phase) const
+    {
+        auto phaseIt = m_phases.find(phase);
+        return phaseIt != m_phases.end() ? phaseIt->second->m_waves.size() : 0;
+    }
+}
@@ -0,0 +1,119 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Component/PhasedTickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class JobContext;
+
+    /**
+     * Ticks the handlers of the PhasedTickBus.
+     * For every phase in use, the scheduler connects a proxy handler to the TickBus with the phase as its tick order,
+     * so phases interleave with regular TickBus handlers exactly as if the phased handlers were on the TickBus.
+     * Handlers of a phase are split in waves from their declared resources; the handlers of a wave don't conflict
+     * with each other and are ticked in parallel on the job context, waves run one after the other.
+     * The handler set is rebuilt at the start of the frame (TICK_FIRST) after handlers connect or disconnect.
+     */
+    class PhasedTickScheduler
+        : public Interface<IPhasedTickScheduler>::Registrar
+        , public TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhasedTickScheduler, SystemAllocator, 0);
+
+        /// @param jobContext Context used to tick handlers in parallel, if null the global job context is used.
+        explicit PhasedTickScheduler(JobContext* jobContext = nullptr);
+        ~PhasedTickScheduler() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IPhasedTickScheduler
+        void OnPhasedHandlerConnected(PhasedTickEvents* handler) override;
+        void OnPhasedHandlerDisconnected(PhasedTickEvents* handler) override;
+        void InvalidatePhasedHandlers() override;
+        bool GetHandlerStats(const PhasedTickEvents* handler, PhasedTickStats& stats) const override;
+        void ResetStats() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Rebuilds phases and waves if the handler set changed since the last rebuild.
+        void RebuildIfNeeded();
+
+        /// Ticks all handlers of a phase, blocking until they are done. Called by the phase proxies.
+        void TickPhase(int phase, float deltaTime, ScriptTimePoint time);
+
+        /// Number of waves in a phase, handlers in the same wave are ticked in parallel.
+        size_t GetNumWaves(int phase) const;
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        void OnTick(float deltaTime, ScriptTimePoint time) override;
+        int GetTickOrder() override { return TICK_FIRST; }
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Proxy connected to the TickBus at the order of its phase.
+        class PhaseTicker
+            : public TickBus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PhaseTicker, SystemAllocator, 0);
+
+            PhaseTicker(PhasedTickScheduler& scheduler, int phase);
+            ~PhaseTicker() override;
+
+            void OnTick(float deltaTime, ScriptTimePoint time) override;
+            int GetTickOrder() override { return m_phase; }
+
+        private:
+            PhasedTickScheduler& m_scheduler;
+            int m_phase;
+        };
+
+        struct HandlerNode
+        {
+            PhasedTickEvents* m_handler = nullptr;  ///< Null once the handler disconnected.
+            PhasedTickStats m_stats;
+        };
+
+        struct Wave
+        {
+            size_t m_first = 0;
+            size_t m_count = 0;
+            bool m_isMainThreadOnly = false;
+        };
+
+        struct Phase
+        {
+            AZStd::vector<HandlerNode> m_nodes;     ///< Sorted by wave.
+            AZStd::vector<Wave> m_waves;
+            AZStd::unique_ptr<PhaseTicker> m_ticker;
+        };
+
+        using NodeLocation = AZStd::pair<Phase*, size_t>;
+
+        void Rebuild();
+        void TickNode(HandlerNode& node, float deltaTime, ScriptTimePoint time);
+
+        JobContext* m_jobContext;
+        AZStd::map<int, AZStd::unique_ptr<Phase>> m_phases;
+        AZStd::unordered_map<const PhasedTickEvents*, NodeLocation> m_handlerLocations;
+        mutable AZStd::recursive_mutex m_mutex;     ///< Guards m_handlerLocations, handlers connect from any thread.
+        AZStd::atomic_bool m_isDirty;
+        AZStd::atomic_bool m_isTicking;
+    };
+}
@@ -46,6 +46,13 @@ namespace AZ
 
         typedef AZ::u16 Header;     ///< Typedef for the 2 byte zlib header.
 
+        enum DecompressResult
+        {
+            DR_OK = 0,          ///< More of the stream is left to decompress.
+            DR_STREAM_END,      ///< The end of the stream has been decompressed.
+            DR_CORRUPTED,       ///< The compressed data is invalid, the decompressor has to be reset before it's used again.
+        };
+
         /// Must be called before we can compress. Compression level can vary from [0 - no compression to 9 - best compression]. Default is 9.
         /// Compression level results from a test input stream of ~26MB comprised of a mix of string and binary data:
         ///     Level   Compressed Size     Time(ms)
@@ -59,12 +66,16 @@ namespace AZ
         ///     8       ~1.4MB              827ms
         ///     9       ~1.4MB              858ms
         void StartCompressor(unsigned int compressionLevel = 9);
+        /// Same as StartCompressor, but writes a raw deflate stream without the zlib header and checksum, as stored in zip archives.
+        void StartRawCompressor(unsigned int compressionLevel = 9);
         bool IsCompressorStarted() const        { return m_strDeflate != 0; }
         void StopCompressor();
         void ResetCompressor();
 
         /// Must be called before we can decompress. Hdr is optional hdr structure that is stored at the begin of the stream and should be passed to the ResetDecompresor.
         void StartDecompressor(Header* hdr = NULL);
+        /// Must be called before we can decompress a raw deflate stream, which has no header or checksum. Reset with ResetDecompressor().
+        void StartRawDecompressor();
         bool IsDecompressorStarted() const      { return m_strInflate != 0; }
         void StopDecompressor();
         /// If you will use seek/sync points we require that you pass the header since the reset will reset all states and you can't really continue (unless from the start).
@@ -85,6 +96,11 @@ namespace AZ
         //////////////////////////////////////////////////////////////////////////
         // Decompressor
         unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* data, unsigned int& dataSize, FlushType flushType = FT_NO_FLUSH);
+        /**
+         * Same as Decompress, but invalid data is reported instead of asserted on, for streams read from files which can't be trusted.
+         * compressedDataSize is set to the size of the compressed data left unprocessed and dataSize to the space left in data.
+         */
+        DecompressResult DecompressChecked(const void* compressedData, unsigned int& compressedDataSize, void* data, unsigned int& dataSize);
         //////////////////////////////////////////////////////////////////////////
     private:
         static void* AllocateMem(void* userData, unsigned int items, unsigned int size);
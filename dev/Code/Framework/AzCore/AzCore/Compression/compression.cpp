@@ -89,6 +89,22 @@ void ZLib::StartCompressor(unsigned int compressionLevel)
     AZ_Assert(r == Z_OK, "ZLib internal error - deflateInit() failed !!!\n");
 }
 
+//=========================================================================
+// StartRawCompressor
+//=========================================================================
+void ZLib::StartRawCompressor(unsigned int compressionLevel)
+{
+    AZ_Assert(m_strDeflate == NULL, "Compressor already started!");
+    m_strDeflate = reinterpret_cast< z_stream* >(AllocateMem(m_workMemoryAllocator, 1, sizeof(z_stream)));
+    m_strDeflate->zalloc = &ZLib::AllocateMem;
+    m_strDeflate->zfree = &ZLib::FreeMem;
+    m_strDeflate->opaque = m_workMemoryAllocator;
+    // Negative window bits select a raw deflate stream, 8 is the default memory level of deflateInit()
+    int r = deflateInit2(m_strDeflate, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    (void)r;
+    AZ_Assert(r == Z_OK, "ZLib internal error - deflateInit2() failed !!!\n");
+}
+
 //=========================================================================
 // StopCompressor
 // [3/21/2011]
@@ -186,6 +202,21 @@ void ZLib::StartDecompressor(Header* header)
     }
 }
 
+//=========================================================================
+// StartRawDecompressor
+//=========================================================================
+void ZLib::StartRawDecompressor()
+{
+    AZ_Assert(m_strInflate == NULL, "Decompressor already started!");
+    m_strInflate = reinterpret_cast< z_stream* >(AllocateMem(m_workMemoryAllocator, 1, sizeof(z_stream)));
+    m_strInflate->zalloc = &ZLib::AllocateMem;
+    m_strInflate->zfree = &ZLib::FreeMem;
+    m_strInflate->opaque = m_workMemoryAllocator;
+    int r = inflateInit2(m_strInflate, -MAX_WBITS);
+    (void)r;
+    AZ_Assert(r == Z_OK, "ZLib internal error - inflateInit2() failed !!!\n");
+}
+
 //=========================================================================
 // StopDecompressor
 // [3/21/2011]
@@ -290,6 +321,29 @@ unsigned int ZLib::Decompress(const void* compressedData, unsigned int compresse
     //  inflateEnd(m_strm);
     return processedCompressedData;
 }
+
+//=========================================================================
+// DecompressChecked
+//=========================================================================
+ZLib::DecompressResult ZLib::DecompressChecked(const void* compressedData, unsigned int& compressedDataSize, void* data, unsigned int& dataSize)
+{
+    AZ_Assert(m_strInflate != NULL, "Decompressor not started!");
+    m_strInflate->avail_in = compressedDataSize;
+    m_strInflate->next_in = (unsigned char*)compressedData;
+    m_strInflate->avail_out = dataSize;
+    m_strInflate->next_out = reinterpret_cast<unsigned char*>(data);
+    int r = inflate(m_strInflate, Z_NO_FLUSH);
+    AZ_Assert(r != Z_STREAM_ERROR, "ZLib decompress internal error %d", r);
+    compressedDataSize = m_strInflate->avail_in;
+    dataSize = m_strInflate->avail_out;
+
+    // Z_BUF_ERROR only means no progress could be made with the buffers given
+    if (r == Z_STREAM_END)
+    {
+        return DR_STREAM_END;
+    }
+    return (r == Z_OK || r == Z_BUF_ERROR) ? DR_OK : DR_CORRUPTED;
+}
 //////////////////////////////////////////////////////////////////////////
 
 #endif // #if !defined(AZCORE_EXCLUDE_ZLIB)
@@ -14,10 +14,19 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
 #include <limits>
 
 #include <AzCore/Compression/zstd_compression.h>
 
+#include <zdict.h>
+#include <zstd_errors.h>
+
 using namespace AZ;
 
 ZStd::ZStd(IAllocatorAllocate* workMemAllocator)
@@ -178,6 +187,442 @@ bool ZStd::IsDecompressorStarted() const
     return m_streamDecompression != nullptr;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// ZStdDictionary
+
+ZStdDictionary::~ZStdDictionary()
+{
+    Unload();
+}
+
+bool ZStdDictionary::Train(const void* sampleData, const size_t* sampleSizes, unsigned int numSamples, size_t maxDictionarySize, AZStd::vector<AZ::u8>& dictionary)
+{
+    dictionary.resize_no_construct(maxDictionarySize);
+    size_t result = ZDICT_trainFromBuffer(dictionary.data(), maxDictionarySize, sampleData, sampleSizes, numSamples);
+    if (ZDICT_isError(result))
+    {
+        AZ_Warning("ZStd", false, "Failed to train a dictionary from %u samples: %s", numSamples, ZDICT_getErrorName(result));
+        dictionary.clear();
+        return false;
+    }
+    dictionary.resize(result);
+    return true;
+}
+
+bool ZStdDictionary::Load(const void* dictionary, size_t dictionarySize, int compressionLevel)
+{
+    Unload();
+
+    m_compressionDictionary = ZSTD_createCDict(dictionary, dictionarySize, compressionLevel);
+    m_decompressionDictionary = ZSTD_createDDict(dictionary, dictionarySize);
+    if (!m_compressionDictionary || !m_decompressionDictionary)
+    {
+        AZ_Error("ZStd", false, "Failed to load a dictionary of %zu bytes.", dictionarySize);
+        Unload();
+        return false;
+    }
+    m_id = ZSTD_getDictID_fromDict(dictionary, dictionarySize);
+    return true;
+}
+
+void ZStdDictionary::Unload()
+{
+    ZSTD_freeCDict(m_compressionDictionary);
+    m_compressionDictionary = nullptr;
+    ZSTD_freeDDict(m_decompressionDictionary);
+    m_decompressionDictionary = nullptr;
+    m_id = 0;
+}
+
+bool ZStdDictionary::IsLoaded() const
+{
+    return m_compressionDictionary != nullptr;
+}
+
+AZ::u32 ZStdDictionary::GetId() const
+{
+    return m_id;
+}
+
+const ZSTD_CDict* ZStdDictionary::GetCompressionDictionary() const
+{
+    return m_compressionDictionary;
+}
+
+const ZSTD_DDict* ZStdDictionary::GetDecompressionDictionary() const
+{
+    return m_decompressionDictionary;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ZStdSeekableCompressor
+
+namespace
+{
+    void* SeekableAllocateMem(void* userData, size_t size)
+    {
+        IAllocatorAllocate* allocator = reinterpret_cast<IAllocatorAllocate*>(userData);
+        return allocator->Allocate(size, 4, 0, "ZStandard", __FILE__, __LINE__);
+    }
+
+    void SeekableFreeMem(void* userData, void* address)
+    {
+        if (address)
+        {
+            IAllocatorAllocate* allocator = reinterpret_cast<IAllocatorAllocate*>(userData);
+            allocator->DeAllocate(address);
+        }
+    }
+
+    ZSTD_customMem GetCustomMem(IAllocatorAllocate* allocator)
+    {
+        ZSTD_customMem customAlloc;
+        customAlloc.customAlloc = &SeekableAllocateMem;
+        customAlloc.customFree = &SeekableFreeMem;
+        customAlloc.opaque = allocator;
+        return customAlloc;
+    }
+
+    void WriteU32(AZ::u8* output, AZ::u32 value)
+    {
+        memcpy(output, &value, sizeof(value));
+    }
+
+    AZ::u32 ReadU32(const AZ::u8* input)
+    {
+        AZ::u32 value;
+        memcpy(&value, input, sizeof(value));
+        return value;
+    }
+}
+
+ZStdSeekableCompressor::ZStdSeekableCompressor(IAllocatorAllocate* workMemAllocator)
+{
+    m_workMemoryAllocator = workMemAllocator;
+    if (!m_workMemoryAllocator)
+    {
+        m_workMemoryAllocator = &AllocatorInstance<SystemAllocator>::Get();
+    }
+}
+
+void ZStdSeekableCompressor::SetCompressionLevel(int compressionLevel)
+{
+    m_compressionLevel = compressionLevel;
+}
+
+void ZStdSeekableCompressor::SetFrameSize(size_t frameSize)
+{
+    AZ_Assert(frameSize > 0 && frameSize <= std::numeric_limits<AZ::u32>::max(), "Frame size %zu is out of range.", frameSize);
+    m_frameSize = frameSize;
+}
+
+void ZStdSeekableCompressor::SetDictionary(const ZStdDictionary* dictionary)
+{
+    AZ_Assert(!dictionary || dictionary->IsLoaded(), "Dictionary is not loaded.");
+    m_dictionary = dictionary;
+}
+
+void ZStdSeekableCompressor::CompressFrames(const AZ::u8* data, size_t dataSize, size_t firstFrame, size_t endFrame, AZ::u8* output, size_t slotSize, size_t* frameSizes) const
+{
+    ZSTD_CCtx* context = ZSTD_createCCtx_advanced(GetCustomMem(m_workMemoryAllocator));
+    for (size_t frame = firstFrame; frame < endFrame; ++frame)
+    {
+        const size_t offset = frame * m_frameSize;
+        const size_t size = AZStd::GetMin(m_frameSize, dataSize - offset);
+        if (!context)
+        {
+            frameSizes[frame] = static_cast<size_t>(-ZSTD_error_memory_allocation);
+        }
+        else if (m_dictionary)
+        {
+            frameSizes[frame] = ZSTD_compress_usingCDict(context, output + frame * slotSize, slotSize, data + offset, size, m_dictionary->GetCompressionDictionary());
+        }
+        else
+        {
+            frameSizes[frame] = ZSTD_compressCCtx(context, output + frame * slotSize, slotSize, data + offset, size, m_compressionLevel);
+        }
+    }
+    ZSTD_freeCCtx(context);
+}
+
+bool ZStdSeekableCompressor::Compress(const void* data, size_t dataSize, AZStd::vector<AZ::u8>& compressedData, JobContext* jobContext) const
+{
+    using namespace ZStdSeekable;
+
+    const size_t numFrames = (dataSize + m_frameSize - 1) / m_frameSize;
+    if (numFrames > std::numeric_limits<AZ::u32>::max())
+    {
+        AZ_Error("ZStd", false, "Too many frames (%zu) for the seekable format, use a bigger frame size.", numFrames);
+        return false;
+    }
+
+    // Every frame is compressed into a slot of the worst case size, then the frames are packed towards the start.
+    const size_t slotSize = ZSTD_compressBound(m_frameSize);
+    AZStd::vector<size_t> frameSizes(numFrames, 0);
+    compressedData.resize_no_construct(numFrames * slotSize);
+    const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+
+    const size_t numJobs = jobContext ? AZStd::GetMin<size_t>(numFrames, jobContext->GetJobManager().GetNumWorkerThreads()) : 0;
+    if (numJobs > 1)
+    {
+        // Consecutive runs of frames per job, so each job creates one compression context
+        JobCompletion completion(jobContext);
+        for (size_t job = 0; job < numJobs; ++job)
+        {
+            const size_t firstFrame = numFrames * job / numJobs;
+            const size_t endFrame = numFrames * (job + 1) / numJobs;
+            Job* compressJob = CreateJobFunction([this, bytes, dataSize, firstFrame, endFrame, &compressedData, slotSize, &frameSizes]()
+                {
+                    CompressFrames(bytes, dataSize, firstFrame, endFrame, compressedData.data(), slotSize, frameSizes.data());
+                }, true, jobContext);
+            compressJob->SetDependent(&completion);
+            compressJob->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+    else
+    {
+        CompressFrames(bytes, dataSize, 0, numFrames, compressedData.data(), slotSize, frameSizes.data());
+    }
+
+    size_t compressedSize = 0;
+    for (size_t frame = 0; frame < numFrames; ++frame)
+    {
+        if (ZSTD_isError(frameSizes[frame]))
+        {
+            AZ_Error("ZStd", false, "Failed to compress frame %zu: %s", frame, ZSTD_getErrorName(frameSizes[frame]));
+            compressedData.clear();
+            return false;
+        }
+        // Slots only move towards the start, so the copy never overwrites a frame that hasn't been moved yet
+        memmove(compressedData.data() + compressedSize, compressedData.data() + frame * slotSize, frameSizes[frame]);
+        compressedSize += frameSizes[frame];
+    }
+
+    const size_t entrySize = 2 * sizeof(AZ::u32);
+    const size_t indexSize = SkippableHeaderSize + numFrames * entrySize + FooterSize;
+    compressedData.resize_no_construct(compressedSize + indexSize);
+
+    AZ::u8* index = compressedData.data() + compressedSize;
+    WriteU32(index, SkippableFrameMagic);
+    WriteU32(index + 4, aznumeric_cast<AZ::u32>(indexSize - SkippableHeaderSize));
+    index += SkippableHeaderSize;
+    for (size_t frame = 0; frame < numFrames; ++frame)
+    {
+        const size_t decompressedSize = AZStd::GetMin(m_frameSize, dataSize - frame * m_frameSize);
+        WriteU32(index, aznumeric_cast<AZ::u32>(frameSizes[frame]));
+        WriteU32(index + 4, aznumeric_cast<AZ::u32>(decompressedSize));
+        index += entrySize;
+    }
+    WriteU32(index, aznumeric_cast<AZ::u32>(numFrames));
+    index[4] = 0; // descriptor, no checksums
+    WriteU32(index + 5, SeekableMagic);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ZStdSeekableDecompressor
+
+ZStdSeekableDecompressor::ZStdSeekableDecompressor(IAllocatorAllocate* workMemAllocator)
+{
+    m_workMemoryAllocator = workMemAllocator;
+    if (!m_workMemoryAllocator)
+    {
+        m_workMemoryAllocator = &AllocatorInstance<SystemAllocator>::Get();
+    }
+}
+
+ZStdSeekableDecompressor::~ZStdSeekableDecompressor()
+{
+    Close();
+}
+
+bool ZStdSeekableDecompressor::Open(const void* compressedData, size_t compressedDataSize, const ZStdDictionary* dictionary)
+{
+    using namespace ZStdSeekable;
+
+    Close();
+
+    const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(compressedData);
+    if (compressedDataSize < SkippableHeaderSize + FooterSize)
+    {
+        AZ_Error("ZStd", false, "Data is too small (%zu bytes) to have a seekable frame index.", compressedDataSize);
+        return false;
+    }
+
+    const AZ::u8* footer = bytes + compressedDataSize - FooterSize;
+    const AZ::u32 numFrames = ReadU32(footer);
+    const AZ::u8 descriptor = footer[4];
+    if (ReadU32(footer + 5) != SeekableMagic)
+    {
+        AZ_Error("ZStd", false, "Data doesn't end with a seekable frame index.");
+        return false;
+    }
+
+    // Indices written with checksums have one more u32 per frame, we don't verify them
+    const size_t entrySize = (descriptor & ChecksumFlag) ? 3 * sizeof(AZ::u32) : 2 * sizeof(AZ::u32);
+    const AZ::u64 indexSize = SkippableHeaderSize + static_cast<AZ::u64>(numFrames) * entrySize + FooterSize;
+    if (indexSize > compressedDataSize)
+    {
+        AZ_Error("ZStd", false, "Seekable frame index of %u frames doesn't fit in %zu bytes.", numFrames, compressedDataSize);
+        return false;
+    }
+
+    const size_t framesSize = compressedDataSize - static_cast<size_t>(indexSize);
+    const AZ::u8* index = bytes + framesSize;
+    if (ReadU32(index) != SkippableFrameMagic || ReadU32(index + 4) != indexSize - SkippableHeaderSize)
+    {
+        AZ_Error("ZStd", false, "Seekable frame index has an invalid header.");
+        return false;
+    }
+    index += SkippableHeaderSize;
+
+    m_frames.reserve(numFrames);
+    AZ::u64 compressedOffset = 0;
+    AZ::u64 decompressedOffset = 0;
+    for (AZ::u32 i = 0; i < numFrames; ++i)
+    {
+        Frame frame;
+        frame.m_compressedOffset = compressedOffset;
+        frame.m_decompressedOffset = decompressedOffset;
+        frame.m_compressedSize = ReadU32(index);
+        frame.m_decompressedSize = ReadU32(index + 4);
+        m_frames.push_back(frame);
+
+        compressedOffset += frame.m_compressedSize;
+        decompressedOffset += frame.m_decompressedSize;
+        index += entrySize;
+    }
+
+    if (compressedOffset != framesSize)
+    {
+        AZ_Error("ZStd", false, "Seekable frame index covers %llu bytes but there are %zu bytes of frames.", static_cast<unsigned long long>(compressedOffset), framesSize);
+        m_frames.clear();
+        return false;
+    }
+
+    m_context = ZSTD_createDCtx_advanced(GetCustomMem(m_workMemoryAllocator));
+    if (!m_context)
+    {
+        AZ_Error("ZStd", false, "ZStandard internal error - failed to create decompression context");
+        m_frames.clear();
+        return false;
+    }
+
+    m_compressedData = bytes;
+    m_dictionary = dictionary;
+    m_decompressedSize = decompressedOffset;
+    return true;
+}
+
+void ZStdSeekableDecompressor::Close()
+{
+    if (m_context)
+    {
+        ZSTD_freeDCtx(m_context);
+        m_context = nullptr;
+    }
+    m_frames.clear();
+    m_frameCache.clear();
+    m_cachedFrame = static_cast<size_t>(-1);
+    m_compressedData = nullptr;
+    m_dictionary = nullptr;
+    m_decompressedSize = 0;
+}
+
+bool ZStdSeekableDecompressor::IsOpen() const
+{
+    return m_context != nullptr;
+}
+
+size_t ZStdSeekableDecompressor::GetNumFrames() const
+{
+    return m_frames.size();
+}
+
+AZ::u64 ZStdSeekableDecompressor::GetDecompressedSize() const
+{
+    return m_decompressedSize;
+}
+
+bool ZStdSeekableDecompressor::DecompressFrame(const Frame& frame, void* outputData)
+{
+    const AZ::u8* source = m_compressedData + frame.m_compressedOffset;
+    size_t result;
+    if (m_dictionary)
+    {
+        result = ZSTD_decompress_usingDDict(m_context, outputData, frame.m_decompressedSize, source, frame.m_compressedSize, m_dictionary->GetDecompressionDictionary());
+    }
+    else
+    {
+        result = ZSTD_decompressDCtx(m_context, outputData, frame.m_decompressedSize, source, frame.m_compressedSize);
+    }
+
+    if (ZSTD_isError(result))
+    {
+        AZ_Error("ZStd", false, "Failed to decompress the frame at %llu: %s", static_cast<unsigned long long>(frame.m_compressedOffset), ZSTD_getErrorName(result));
+        return false;
+    }
+    if (result != frame.m_decompressedSize)
+    {
+        AZ_Error("ZStd", false, "Frame at %llu decompressed to %zu bytes, the index says %u.", static_cast<unsigned long long>(frame.m_compressedOffset), result, frame.m_decompressedSize);
+        return false;
+    }
+    return true;
+}
+
+size_t ZStdSeekableDecompressor::Decompress(AZ::u64 offset, void* outputData, size_t outputDataSize)
+{
+    AZ_Assert(m_context, "Decompressor not opened!");
+    if (offset >= m_decompressedSize)
+    {
+        return 0;
+    }
+
+    // Last frame starting at or before the offset
+    auto frameIt = AZStd::upper_bound(m_frames.begin(), m_frames.end(), offset,
+        [](AZ::u64 value, const Frame& frame) { return value < frame.m_decompressedOffset; });
+    size_t frameIndex = static_cast<size_t>(frameIt - m_frames.begin()) - 1;
+
+    AZ::u8* output = reinterpret_cast<AZ::u8*>(outputData);
+    size_t numDecompressed = 0;
+    while (numDecompressed < outputDataSize && frameIndex < m_frames.size())
+    {
+        const Frame& frame = m_frames[frameIndex];
+        const size_t offsetInFrame = static_cast<size_t>(offset - frame.m_decompressedOffset);
+        const size_t toCopy = AZStd::GetMin<size_t>(outputDataSize - numDecompressed, frame.m_decompressedSize - offsetInFrame);
+
+        if (offsetInFrame == 0 && toCopy == frame.m_decompressedSize)
+        {
+            // Whole frame, straight into the output
+            if (!DecompressFrame(frame, output))
+            {
+                return numDecompressed;
+            }
+        }
+        else
+        {
+            if (m_cachedFrame != frameIndex)
+            {
+                m_frameCache.resize_no_construct(frame.m_decompressedSize);
+                if (!DecompressFrame(frame, m_frameCache.data()))
+                {
+                    m_cachedFrame = static_cast<size_t>(-1);
+                    return numDecompressed;
+                }
+                m_cachedFrame = frameIndex;
+            }
+            memcpy(output, m_frameCache.data() + offsetInFrame, toCopy);
+        }
+
+        output += toCopy;
+        offset += toCopy;
+        numDecompressed += toCopy;
+        ++frameIndex;
+    }
+    return numDecompressed;
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 #endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #define ZSTD_STATIC_LINKING_ONLY
@@ -22,6 +23,7 @@ namespace AZ
 {
     class IAllocator;
     class IAllocatorAllocate;
+    class JobContext;
 
     class ZStd
     {
@@ -87,4 +89,138 @@ namespace AZ
         size_t          m_nextBlockSize;
         unsigned int    m_compressedBufferIndex;
     };
+
+    /**
+     * Dictionary for compressing many small buffers of similar content (serialized objects, small assets).
+     * Compressing a few KB on its own leaves ZStd nothing to learn from, a dictionary trained on samples
+     * of the data gives both sides the common content upfront. Decompression needs the dictionary the data
+     * was compressed with, frames store its id.
+     */
+    class ZStdDictionary
+    {
+    public:
+        ZStdDictionary() = default;
+        ~ZStdDictionary();
+
+        ZStdDictionary(const ZStdDictionary&) = delete;
+        ZStdDictionary& operator=(const ZStdDictionary&) = delete;
+
+        /**
+         * Trains a dictionary of up to maxDictionarySize bytes (about 100 times smaller than the samples total is a good start).
+         * \param sampleData all samples back to back.
+         * \param sampleSizes size of each sample in sampleData.
+         * \return false if the samples are not enough to train on.
+         */
+        static bool Train(const void* sampleData, const size_t* sampleSizes, unsigned int numSamples, size_t maxDictionarySize, AZStd::vector<AZ::u8>& dictionary);
+
+        /// Prepares a trained dictionary for compression at compressionLevel and for decompression. The data is copied.
+        bool Load(const void* dictionary, size_t dictionarySize, int compressionLevel = 3);
+        void Unload();
+        bool IsLoaded() const;
+
+        /// Id written in the frames compressed with this dictionary.
+        AZ::u32 GetId() const;
+
+        const ZSTD_CDict* GetCompressionDictionary() const;
+        const ZSTD_DDict* GetDecompressionDictionary() const;
+
+    private:
+        ZSTD_CDict*     m_compressionDictionary = nullptr;
+        ZSTD_DDict*     m_decompressionDictionary = nullptr;
+        AZ::u32         m_id = 0;
+    };
+
+    /**
+     * Seekable format, the data is split in frames which are compressed independently and followed by a frame index:
+     *
+     *   frame 0 | frame 1 | ... | frame N-1 | index
+     *
+     * The index is a skippable frame with the layout of the zstd seekable format, so any zstd decoder can still read the data:
+     *
+     *   u32 skippable magic | u32 index size | N x (u32 compressed size, u32 decompressed size) | u32 N | u8 descriptor | u32 seekable magic
+     *
+     * Independent frames cost some ratio (each starts with an empty history) but they can be compressed in parallel
+     * and any range can be decompressed by only decompressing the frames it overlaps.
+     */
+    namespace ZStdSeekable
+    {
+        static const AZ::u32 SkippableFrameMagic = 0x184D2A5E;
+        static const AZ::u32 SeekableMagic = 0x8F92EAB1;
+        static const AZ::u8 ChecksumFlag = 0x80;
+        static const size_t FooterSize = 9;
+        static const size_t SkippableHeaderSize = 8;
+        static const size_t DefaultFrameSize = 64 * 1024;
+    }
+
+    class ZStdSeekableCompressor
+    {
+    public:
+        ZStdSeekableCompressor(IAllocatorAllocate* workMemAllocator = 0);
+
+        void SetCompressionLevel(int compressionLevel);
+        /// Size of the decompressed data in each frame, smaller frames make random reads cheaper and compress worse.
+        void SetFrameSize(size_t frameSize);
+        /// Compress with a dictionary, it overrides the compression level. It has to stay loaded while compressing.
+        void SetDictionary(const ZStdDictionary* dictionary);
+
+        /**
+         * Compresses data in the seekable format, compressedData is replaced.
+         * With a job context the frames are compressed on the job workers, the output is the same.
+         */
+        bool Compress(const void* data, size_t dataSize, AZStd::vector<AZ::u8>& compressedData, JobContext* jobContext = nullptr) const;
+
+    private:
+        /// Compresses frames [firstFrame, endFrame) each into its own slot of slotSize bytes at output, sizes (or error codes) go in frameSizes.
+        void CompressFrames(const AZ::u8* data, size_t dataSize, size_t firstFrame, size_t endFrame, AZ::u8* output, size_t slotSize, size_t* frameSizes) const;
+
+        IAllocatorAllocate*     m_workMemoryAllocator;
+        const ZStdDictionary*   m_dictionary = nullptr;
+        size_t                  m_frameSize = ZStdSeekable::DefaultFrameSize;
+        int                     m_compressionLevel = 3;
+    };
+
+    class ZStdSeekableDecompressor
+    {
+    public:
+        ZStdSeekableDecompressor(IAllocatorAllocate* workMemAllocator = 0);
+        ~ZStdSeekableDecompressor();
+
+        ZStdSeekableDecompressor(const ZStdSeekableDecompressor&) = delete;
+        ZStdSeekableDecompressor& operator=(const ZStdSeekableDecompressor&) = delete;
+
+        /// Reads the frame index. The compressed data is not copied and has to stay valid until Close.
+        bool Open(const void* compressedData, size_t compressedDataSize, const ZStdDictionary* dictionary = nullptr);
+        void Close();
+        bool IsOpen() const;
+
+        size_t GetNumFrames() const;
+        AZ::u64 GetDecompressedSize() const;
+
+        /**
+         * Decompresses outputDataSize bytes starting at offset in the decompressed data.
+         * The last frame read partially is kept, so reading a frame in small pieces only decompresses it once.
+         * \return number of bytes decompressed, less than asked for past the end or on error.
+         */
+        size_t Decompress(AZ::u64 offset, void* outputData, size_t outputDataSize);
+
+    private:
+        struct Frame
+        {
+            AZ::u64     m_compressedOffset;
+            AZ::u64     m_decompressedOffset;
+            AZ::u32     m_compressedSize;
+            AZ::u32     m_decompressedSize;
+        };
+
+        bool DecompressFrame(const Frame& frame, void* outputData);
+
+        IAllocatorAllocate*     m_workMemoryAllocator;
+        ZSTD_DCtx*              m_context = nullptr;
+        const ZStdDictionary*   m_dictionary = nullptr;
+        const AZ::u8*           m_compressedData = nullptr;
+        AZStd::vector<Frame>    m_frames;
+        AZStd::vector<AZ::u8>   m_frameCache;               ///< Decompressed data of the last partially read frame.
+        size_t                  m_cachedFrame = static_cast<size_t>(-1);
+        AZ::u64                 m_decompressedSize = 0;
+    };
 };
\ No newline at end of file
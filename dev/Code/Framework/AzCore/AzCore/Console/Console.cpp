@@ -15,6 +15,8 @@
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/sort.h>
 
 
 namespace AZ
@@ -38,6 +40,7 @@ namespace AZ
     Console::Console()
         : m_head(nullptr)
     {
+        memset(m_commandBuckets, 0, sizeof(m_commandBuckets));
         AZ::Interface<IConsole>::Register(this);
     }
 
@@ -45,10 +48,21 @@ namespace AZ
     Console::~Console()
     {
         // Unlink everything first
-        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        ConsoleFunctorBase* curr = m_head;
+        while (curr != nullptr)
         {
+            ConsoleFunctorBase* next = curr->m_next;
             curr->Unlink(m_head);
+            curr->m_nextInBucket = nullptr;
             curr->m_console = nullptr;
+            curr = next;
+        }
+        memset(m_commandBuckets, 0, sizeof(m_commandBuckets));
+
+        if (m_sortedFunctors != nullptr)
+        {
+            AZ_OS_FREE(m_sortedFunctors);
+            m_sortedFunctors = nullptr;
         }
 
         // If we are shutting down, make sure that we mark the head as nullptr so that we don't try to unlink functors after the fact
@@ -130,9 +144,15 @@ namespace AZ
     ConsoleFunctorBase* Console::FindCommand(const char* command)
     {
         const size_t commandLength = strlen(command);
+        const uint32_t commandHash = HashCommandName(command);
 
-        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        for (ConsoleFunctorBase* curr = GetCommandBucket(commandHash); curr != nullptr; curr = curr->m_nextInBucket)
         {
+            if (curr->m_nameHash != commandHash)
+            {
+                continue;
+            }
+
             if ((curr->GetFlags() & ConsoleFunctorFlags::IsInvisible) == ConsoleFunctorFlags::IsInvisible)
             {
                 // Filter functors marked as invisible
@@ -160,19 +180,33 @@ namespace AZ
 
         StringSet commandSubset;
 
-        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        UpdateSortedFunctors();
+
+        // Functors are sorted by case insensitive name, so the ones starting with the command are contiguous
+        ConsoleFunctorBase** sortedEnd = m_sortedFunctors + m_sortedFunctorCount;
+        ConsoleFunctorBase** first = AZStd::lower_bound(m_sortedFunctors, sortedEnd, command,
+            [commandLength](const ConsoleFunctorBase* functor, const char* prefix)
+            {
+                return azstrnicmp(functor->m_name, prefix, commandLength) < 0;
+            });
+
+        for (ConsoleFunctorBase** iter = first; iter != sortedEnd; ++iter)
         {
+            ConsoleFunctorBase* curr = *iter;
+
+            if (!StringFunc::Equal(curr->m_name, command, false, commandLength))
+            {
+                break;
+            }
+
             if ((curr->GetFlags() & ConsoleFunctorFlags::IsInvisible) == ConsoleFunctorFlags::IsInvisible)
             {
                 // Filter functors marked as invisible
                 continue;
             }
 
-            if (StringFunc::Equal(curr->m_name, command, false, commandLength))
-            {
-                AZ_TracePrintf("Az Console", "- %s : %s\n", curr->m_name, curr->m_desc);
-                commandSubset.push_back(curr->m_name);
-            }
+            AZ_TracePrintf("Az Console", "- %s : %s\n", curr->m_name, curr->m_desc);
+            commandSubset.push_back(curr->m_name);
         }
 
         AZStd::string largestSubstring = command;
@@ -223,7 +257,7 @@ namespace AZ
             ConsoleFunctorBase* next = curr->m_next;
 
             curr->Unlink(deferredHead);
-            curr->Link(m_head);
+            LinkFunctor(curr);
             curr->m_console = this;
             curr->m_isDeferred = false;
 
@@ -234,15 +268,30 @@ namespace AZ
     }
 
 
+    void Console::LinkFunctor(ConsoleFunctorBase* functor)
+    {
+        functor->Link(m_head);
+        AddToCommandIndex(functor);
+    }
+
+
+    void Console::UnlinkFunctor(ConsoleFunctorBase* functor)
+    {
+        RemoveFromCommandIndex(functor);
+        functor->Unlink(m_head);
+    }
+
+
     bool Console::DispatchCommand(const AZStd::string& command, const StringSet& inputs, ConsoleFunctorFlags requiredSet, ConsoleFunctorFlags requiredClear, ConsoleFunctorFlags& outFlags)
     {
         const size_t commandLength = command.size();
+        const uint32_t commandHash = HashCommandName(command.c_str());
 
         bool result = false;
 
-        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        for (ConsoleFunctorBase* curr = GetCommandBucket(commandHash); curr != nullptr; curr = curr->m_nextInBucket)
         {
-            if (StringFunc::Equal(curr->m_name, command.c_str(), false, commandLength + 1)) // + 1 to include the NULL terminator
+            if (curr->m_nameHash == commandHash && StringFunc::Equal(curr->m_name, command.c_str(), false, commandLength + 1)) // + 1 to include the NULL terminator
             {
                 result = true;
 
@@ -286,4 +335,89 @@ namespace AZ
 
         return result;
     }
+
+
+    uint32_t Console::HashCommandName(const char* name)
+    {
+        // FNV-1a over the lower case characters
+        uint32_t hash = 2166136261u;
+        for (const char* iter = name; *iter != '\0'; ++iter)
+        {
+            hash = (hash ^ static_cast<uint32_t>(tolower(static_cast<unsigned char>(*iter)))) * 16777619u;
+        }
+        return hash;
+    }
+
+
+    ConsoleFunctorBase* Console::GetCommandBucket(uint32_t nameHash) const
+    {
+        return m_commandBuckets[nameHash % CommandBucketCount];
+    }
+
+
+    void Console::AddToCommandIndex(ConsoleFunctorBase* functor)
+    {
+        // Functors are pushed at the front of both the functor list and their bucket, so functors with the same name
+        // are found in the same order as when walking the functor list.
+        functor->m_nameHash = HashCommandName(functor->m_name);
+        ConsoleFunctorBase*& bucket = m_commandBuckets[functor->m_nameHash % CommandBucketCount];
+        functor->m_nextInBucket = bucket;
+        bucket = functor;
+        m_sortedFunctorsDirty = true;
+    }
+
+
+    void Console::RemoveFromCommandIndex(ConsoleFunctorBase* functor)
+    {
+        for (ConsoleFunctorBase** iter = &m_commandBuckets[functor->m_nameHash % CommandBucketCount]; *iter != nullptr; iter = &(*iter)->m_nextInBucket)
+        {
+            if (*iter == functor)
+            {
+                *iter = functor->m_nextInBucket;
+                break;
+            }
+        }
+        functor->m_nextInBucket = nullptr;
+        m_sortedFunctorsDirty = true;
+    }
+
+
+    void Console::UpdateSortedFunctors()
+    {
+        if (!m_sortedFunctorsDirty)
+        {
+            return;
+        }
+
+        uint32_t count = 0;
+        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        {
+            ++count;
+        }
+
+        if (count > m_sortedFunctorCapacity)
+        {
+            if (m_sortedFunctors != nullptr)
+            {
+                AZ_OS_FREE(m_sortedFunctors);
+            }
+            m_sortedFunctorCapacity = AZStd::GetMax(count, m_sortedFunctorCapacity * 2);
+            m_sortedFunctors = static_cast<ConsoleFunctorBase**>(AZ_OS_MALLOC(m_sortedFunctorCapacity * sizeof(ConsoleFunctorBase*), alignof(ConsoleFunctorBase*)));
+        }
+
+        m_sortedFunctorCount = 0;
+        for (ConsoleFunctorBase* curr = m_head; curr != nullptr; curr = curr->m_next)
+        {
+            m_sortedFunctors[m_sortedFunctorCount++] = curr;
+        }
+
+        AZStd::sort(m_sortedFunctors, m_sortedFunctors + m_sortedFunctorCount,
+            [](const ConsoleFunctorBase* lhs, const ConsoleFunctorBase* rhs)
+            {
+                const int result = azstricmp(lhs->m_name, rhs->m_name);
+                return (result != 0) ? (result < 0) : (strcmp(lhs->m_name, rhs->m_name) < 0);
+            });
+
+        m_sortedFunctorsDirty = false;
+    }
 }
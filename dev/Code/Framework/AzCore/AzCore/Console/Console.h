@@ -46,6 +46,10 @@ namespace AZ
 
         void LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead) override;
 
+        void LinkFunctor(ConsoleFunctorBase* functor) override;
+
+        void UnlinkFunctor(ConsoleFunctorBase* functor) override;
+
     private:
 
         //! Invokes a single console command, optionally returning the command output.
@@ -59,10 +63,35 @@ namespace AZ
         //! @return boolean true on success, false otherwise
         bool DispatchCommand(const AZStd::string& command, const StringSet& inputs, ConsoleFunctorFlags requiredSet, ConsoleFunctorFlags requiredClear, ConsoleFunctorFlags& outFlags);
 
+        //! Case insensitive hash of a command name, consistent with the case insensitive compare used to match commands.
+        static uint32_t HashCommandName(const char* name);
+
+        //! Returns the first functor in the bucket of the command index that matches the hash.
+        //! Functors with the same name are chained in the same order as in the functor list.
+        ConsoleFunctorBase* GetCommandBucket(uint32_t nameHash) const;
+
+        void AddToCommandIndex(ConsoleFunctorBase* functor);
+        void RemoveFromCommandIndex(ConsoleFunctorBase* functor);
+
+        //! Rebuilds the functors sorted by name for autocomplete, if functors were linked or unlinked since the last time.
+        void UpdateSortedFunctors();
+
         AZ_DISABLE_COPY_MOVE(Console);
 
         ConsoleFunctorBase* m_head;
 
+        //! Command index, functors are chained through ConsoleFunctorBase::m_nextInBucket.
+        //! A fixed bucket array keeps the index usable from static initialization, before any allocator exists.
+        static constexpr uint32_t CommandBucketCount = 4096;
+        ConsoleFunctorBase* m_commandBuckets[CommandBucketCount];
+
+        //! All functors sorted by case insensitive name, commands sharing a prefix are contiguous.
+        //! Allocated with AZ_OS_MALLOC for the same reason as the command index.
+        ConsoleFunctorBase** m_sortedFunctors = nullptr;
+        uint32_t m_sortedFunctorCount = 0;
+        uint32_t m_sortedFunctorCapacity = 0;
+        bool m_sortedFunctorsDirty = true;
+
         friend class ConsoleFunctorBase;
 
     };
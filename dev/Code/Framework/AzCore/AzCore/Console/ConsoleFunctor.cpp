@@ -55,7 +55,7 @@ namespace AZ
         if (s_deferredHeadInvoked)
         {
             m_console = AZ::Interface<IConsole>::Get();
-            Link(m_console->RetrieveHeadElement());
+            m_console->LinkFunctor(this);
             m_isDeferred = false;
         }
         else
@@ -69,7 +69,7 @@ namespace AZ
     {
         if (m_console != nullptr)
         {
-            Unlink(m_console->RetrieveHeadElement());
+            m_console->UnlinkFunctor(this);
         }
         else if (m_isDeferred)
         {
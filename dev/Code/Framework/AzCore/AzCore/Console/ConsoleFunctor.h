@@ -124,6 +124,10 @@ namespace AZ
         ConsoleFunctorBase* m_prev = nullptr;
         ConsoleFunctorBase* m_next = nullptr;
 
+        // Used by the console's command index
+        ConsoleFunctorBase* m_nextInBucket = nullptr;
+        uint32_t m_nameHash = 0;
+
         bool m_isDeferred = true;
 
         static ConsoleFunctorBase* s_deferredHead;
@@ -94,6 +94,16 @@ namespace AZ
         //! Should be invoked for every module that gets loaded.
         virtual void LinkDeferredFunctors(ConsoleFunctorBase*& deferredHead) = 0;
 
+        //! Internal, links a cvar or cfunc to the console when it is constructed.
+        //! 
+        //! @param functor the functor to add to the console
+        virtual void LinkFunctor(ConsoleFunctorBase* functor) = 0;
+
+        //! Internal, unlinks a cvar or cfunc from the console when it is destroyed.
+        //! 
+        //! @param functor the functor to remove from the console
+        virtual void UnlinkFunctor(ConsoleFunctorBase* functor) = 0;
+
         AZ_DISABLE_COPY_MOVE(IConsole);
 
     };
@@ -0,0 +1,421 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#include <AzCore/Driller/AsyncFileStream.h>
+#include <AzCore/Compression/zstd_compression.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        namespace
+        {
+            // Drillers run outside of the engine systems, zstd allocates from the OSAllocator like the rest of the driller streams
+            void* DrillerZStdAllocate(void* userData, size_t size)
+            {
+                (void)userData;
+                return AllocatorInstance<OSAllocator>::Get().Allocate(size, 4, 0, "Driller ZStandard", __FILE__, __LINE__);
+            }
+
+            void DrillerZStdFree(void* userData, void* address)
+            {
+                (void)userData;
+                if (address)
+                {
+                    AllocatorInstance<OSAllocator>::Get().DeAllocate(address);
+                }
+            }
+
+            ZSTD_customMem GetDrillerZStdMem()
+            {
+                ZSTD_customMem customAlloc;
+                customAlloc.customAlloc = &DrillerZStdAllocate;
+                customAlloc.customFree = &DrillerZStdFree;
+                customAlloc.opaque = nullptr;
+                return customAlloc;
+            }
+
+            void WriteU32(unsigned char* output, AZ::u32 value)
+            {
+                memcpy(output, &value, sizeof(value));
+            }
+
+            AZ::u32 ReadU32(const unsigned char* input)
+            {
+                AZ::u32 value;
+                memcpy(&value, input, sizeof(value));
+                return value;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        //////////////////////////////////////////////////////////////////////////
+        // Driller async file output stream
+        //////////////////////////////////////////////////////////////////////////
+        //////////////////////////////////////////////////////////////////////////
+
+        DrillerOutputAsyncFileStream::DrillerOutputAsyncFileStream(unsigned int chunkSize, unsigned int numChunks, int compressionLevel)
+            : m_chunkSize(chunkSize)
+            , m_numChunks(numChunks)
+            , m_compressionLevel(compressionLevel)
+        {
+            AZ_Assert(chunkSize > 0, "Chunk size must be positive.");
+            AZ_Assert(numChunks >= 2, "We need at least 2 chunks, one to fill while the other one is written.");
+        }
+
+        DrillerOutputAsyncFileStream::~DrillerOutputAsyncFileStream()
+        {
+            if (IsOpen())
+            {
+                Close();
+            }
+        }
+
+        bool DrillerOutputAsyncFileStream::Open(const char* fileName, int mode, int platformFlags)
+        {
+            AZ_Assert(!IsOpen(), "Stream is already open.");
+            if (!m_file.Open(fileName, mode, platformFlags))
+            {
+                return false;
+            }
+
+            m_context = ZSTD_createCCtx_advanced(GetDrillerZStdMem());
+            if (!m_context)
+            {
+                AZ_Error("Driller", false, "ZStandard internal error - failed to create compression context");
+                m_file.Close();
+                return false;
+            }
+
+            m_chunks.resize(m_numChunks);
+            for (ChunkType& chunk : m_chunks)
+            {
+                chunk.reserve(m_chunkSize);
+                m_freeChunks.push_back(&chunk);
+            }
+            m_currentChunk = m_freeChunks.back();
+            m_freeChunks.pop_back();
+            m_isClosing = false;
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Driller file writer";
+            m_writerThread = AZStd::thread([this]() { ProcessChunks(); }, &threadDesc);
+            return true;
+        }
+
+        void DrillerOutputAsyncFileStream::Close()
+        {
+            AZ_Assert(IsOpen(), "Stream is not open.");
+            if (!m_currentChunk->empty())
+            {
+                SubmitChunk();
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                m_isClosing = true;
+            }
+            m_queueSignal.notify_all();
+            m_writerThread.join();
+
+            WriteIndex();
+            m_file.Close();
+
+            ZSTD_freeCCtx(m_context);
+            m_context = nullptr;
+            m_currentChunk = nullptr;
+            m_pendingChunks.clear();
+            m_freeChunks.clear();
+            m_chunks.clear();
+            m_compressedChunk.clear();
+            m_index.clear();
+        }
+
+        bool DrillerOutputAsyncFileStream::IsOpen() const
+        {
+            return m_context != nullptr;
+        }
+
+        void DrillerOutputAsyncFileStream::WriteBinary(const void* data, unsigned int dataSize)
+        {
+            // Chunks only grow past the chunk size when a single frame has more data than that
+            m_currentChunk->insert(m_currentChunk->end(), reinterpret_cast<const unsigned char*>(data), reinterpret_cast<const unsigned char*>(data) + dataSize);
+        }
+
+        void DrillerOutputAsyncFileStream::OnEndOfFrame()
+        {
+            if (m_currentChunk->size() >= m_chunkSize)
+            {
+                SubmitChunk();
+            }
+        }
+
+        void DrillerOutputAsyncFileStream::SubmitChunk()
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_queueMutex);
+                m_pendingChunks.push_back(m_currentChunk);
+                m_queueSignal.notify_all();
+
+                m_queueSignal.wait(lock, [this]() { return !m_freeChunks.empty(); });
+                m_currentChunk = m_freeChunks.back();
+                m_freeChunks.pop_back();
+            }
+        }
+
+        void DrillerOutputAsyncFileStream::ProcessChunks()
+        {
+            for (;;)
+            {
+                ChunkType* chunk;
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(m_queueMutex);
+                    m_queueSignal.wait(lock, [this]() { return !m_pendingChunks.empty() || m_isClosing; });
+                    if (m_pendingChunks.empty())
+                    {
+                        return; // closing and everything is written
+                    }
+                    chunk = m_pendingChunks.front();
+                    m_pendingChunks.erase(m_pendingChunks.begin());
+                }
+
+                WriteChunk(*chunk);
+
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                    chunk->clear();
+                    m_freeChunks.push_back(chunk);
+                }
+                m_queueSignal.notify_all();
+            }
+        }
+
+        void DrillerOutputAsyncFileStream::WriteChunk(const ChunkType& chunk)
+        {
+            m_compressedChunk.resize(ZSTD_compressBound(chunk.size()));
+            size_t compressedSize = ZSTD_compressCCtx(m_context, m_compressedChunk.data(), m_compressedChunk.size(), chunk.data(), chunk.size(), m_compressionLevel);
+            if (ZSTD_isError(compressedSize))
+            {
+                AZ_Error("Driller", false, "Failed to compress %zu bytes of driller data: %s", chunk.size(), ZSTD_getErrorName(compressedSize));
+                return;
+            }
+
+            m_file.Write(m_compressedChunk.data(), compressedSize);
+            m_index.push_back(static_cast<AZ::u32>(compressedSize));
+            m_index.push_back(static_cast<AZ::u32>(chunk.size()));
+        }
+
+        void DrillerOutputAsyncFileStream::WriteIndex()
+        {
+            using namespace ZStdSeekable;
+
+            const AZ::u32 numChunks = static_cast<AZ::u32>(m_index.size() / 2);
+            const size_t indexSize = SkippableHeaderSize + m_index.size() * sizeof(AZ::u32) + FooterSize;
+            ChunkType index(indexSize);
+            WriteU32(&index[0], SkippableFrameMagic);
+            WriteU32(&index[4], static_cast<AZ::u32>(indexSize - SkippableHeaderSize));
+            for (size_t i = 0; i < m_index.size(); ++i)
+            {
+                WriteU32(&index[SkippableHeaderSize + i * sizeof(AZ::u32)], m_index[i]);
+            }
+            unsigned char* footer = &index[indexSize - FooterSize];
+            WriteU32(footer, numChunks);
+            footer[4] = 0; // descriptor, no checksums
+            WriteU32(footer + 5, SeekableMagic);
+            m_file.Write(index.data(), index.size());
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        //////////////////////////////////////////////////////////////////////////
+        // Driller indexed file input stream
+        //////////////////////////////////////////////////////////////////////////
+        //////////////////////////////////////////////////////////////////////////
+
+        DrillerInputIndexedFileStream::DrillerInputIndexedFileStream()
+        {
+            m_context = ZSTD_createDCtx_advanced(GetDrillerZStdMem());
+        }
+
+        DrillerInputIndexedFileStream::~DrillerInputIndexedFileStream()
+        {
+            ZSTD_freeDCtx(m_context);
+        }
+
+        bool DrillerInputIndexedFileStream::Open(const char* fileName, int mode, int platformFlags)
+        {
+            if (!IO::SystemFile::Open(fileName, mode, platformFlags))
+            {
+                return false;
+            }
+
+            if (!ReadIndex())
+            {
+                IO::SystemFile::Close();
+                return false;
+            }
+
+            m_nextChunk = 0;
+            m_endChunk = GetNumChunks();
+            m_chunk.clear();
+            m_readOffset = 0;
+            return ReadHeader();
+        }
+
+        void DrillerInputIndexedFileStream::Close()
+        {
+            m_chunkInfos.clear();
+            m_compressedChunk.clear();
+            m_chunk.clear();
+            m_nextChunk = 0;
+            m_endChunk = 0;
+            m_readOffset = 0;
+            IO::SystemFile::Close();
+        }
+
+        unsigned int DrillerInputIndexedFileStream::GetNumChunks() const
+        {
+            return static_cast<unsigned int>(m_chunkInfos.size());
+        }
+
+        bool DrillerInputIndexedFileStream::ReadIndex()
+        {
+            using namespace ZStdSeekable;
+
+            m_chunkInfos.clear();
+            const SizeType fileSize = Length();
+            unsigned char footer[FooterSize];
+            if (fileSize < SkippableHeaderSize + FooterSize)
+            {
+                AZ_Error("Driller", false, "File %s is too small to be an indexed driller stream.", Name());
+                return false;
+            }
+            Seek(fileSize - FooterSize, SF_SEEK_BEGIN);
+            if (Read(FooterSize, footer) != FooterSize || ReadU32(footer + 5) != SeekableMagic || (footer[4] & ChecksumFlag))
+            {
+                AZ_Error("Driller", false, "File %s doesn't end with a chunk index.", Name());
+                return false;
+            }
+
+            const AZ::u32 numChunks = ReadU32(footer);
+            const SizeType indexSize = SkippableHeaderSize + static_cast<SizeType>(numChunks) * 2 * sizeof(AZ::u32) + FooterSize;
+            if (indexSize > fileSize)
+            {
+                AZ_Error("Driller", false, "File %s has an invalid chunk index.", Name());
+                return false;
+            }
+
+            vector<unsigned char>::type index(static_cast<size_t>(indexSize - FooterSize));
+            Seek(fileSize - indexSize, SF_SEEK_BEGIN);
+            if (Read(index.size(), index.data()) != index.size() || ReadU32(&index[0]) != SkippableFrameMagic || ReadU32(&index[4]) != indexSize - SkippableHeaderSize)
+            {
+                AZ_Error("Driller", false, "File %s has an invalid chunk index.", Name());
+                return false;
+            }
+
+            m_chunkInfos.reserve(numChunks);
+            AZ::u64 offset = 0;
+            const unsigned char* entry = &index[SkippableHeaderSize];
+            for (AZ::u32 i = 0; i < numChunks; ++i, entry += 2 * sizeof(AZ::u32))
+            {
+                ChunkInfo info;
+                info.m_offset = offset;
+                info.m_compressedSize = ReadU32(entry);
+                info.m_size = ReadU32(entry + 4);
+                m_chunkInfos.push_back(info);
+                offset += info.m_compressedSize;
+            }
+
+            if (offset != fileSize - indexSize)
+            {
+                AZ_Error("Driller", false, "File %s has an invalid chunk index.", Name());
+                m_chunkInfos.clear();
+                return false;
+            }
+            return true;
+        }
+
+        bool DrillerInputIndexedFileStream::LoadChunk(unsigned int chunk)
+        {
+            const ChunkInfo& info = m_chunkInfos[chunk];
+            m_compressedChunk.resize(info.m_compressedSize);
+            m_chunk.resize(info.m_size);
+            m_readOffset = 0;
+
+            Seek(info.m_offset, SF_SEEK_BEGIN);
+            if (Read(m_compressedChunk.size(), m_compressedChunk.data()) != m_compressedChunk.size())
+            {
+                AZ_Error("Driller", false, "Failed to read chunk %u of %s.", chunk, Name());
+                m_chunk.clear();
+                return false;
+            }
+
+            size_t result = ZSTD_decompressDCtx(m_context, m_chunk.data(), m_chunk.size(), m_compressedChunk.data(), m_compressedChunk.size());
+            if (ZSTD_isError(result) || result != info.m_size)
+            {
+                AZ_Error("Driller", false, "Failed to decompress chunk %u of %s.", chunk, Name());
+                m_chunk.clear();
+                return false;
+            }
+            return true;
+        }
+
+        bool DrillerInputIndexedFileStream::SeekChunk(unsigned int firstChunk, unsigned int numChunks)
+        {
+            if (firstChunk >= GetNumChunks())
+            {
+                return false;
+            }
+
+            m_nextChunk = firstChunk;
+            m_endChunk = numChunks < GetNumChunks() - firstChunk ? firstChunk + numChunks : GetNumChunks();
+            m_chunk.clear();
+            m_readOffset = 0;
+            if (firstChunk == 0)
+            {
+                // The first chunk starts with the stream header, it was read on Open
+                if (!LoadChunk(m_nextChunk++))
+                {
+                    return false;
+                }
+                m_readOffset = AZStd::GetMin(m_chunk.size(), sizeof(DrillerOutputStream::StreamHeader));
+            }
+            return true;
+        }
+
+        unsigned int DrillerInputIndexedFileStream::ReadBinary(void* data, unsigned int maxDataSize)
+        {
+            unsigned char* output = reinterpret_cast<unsigned char*>(data);
+            unsigned int numRead = 0;
+            while (numRead < maxDataSize)
+            {
+                if (m_readOffset == m_chunk.size())
+                {
+                    if (m_nextChunk >= m_endChunk || !LoadChunk(m_nextChunk++))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                const unsigned int toCopy = static_cast<unsigned int>(AZStd::GetMin<size_t>(maxDataSize - numRead, m_chunk.size() - m_readOffset));
+                memcpy(output + numRead, m_chunk.data() + m_readOffset, toCopy);
+                m_readOffset += toCopy;
+                numRead += toCopy;
+            }
+            return numRead;
+        }
+    } // namespace Debug
+} // namespace AZ
+
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
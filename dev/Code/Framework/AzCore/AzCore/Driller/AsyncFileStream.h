@@ -0,0 +1,139 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Driller/Stream.h>
+
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
+namespace AZ
+{
+    namespace Debug
+    {
+        /**
+         * Outputs driller data to a file, compressing and writing it on a background thread.
+         *
+         * DrillerOutputFileStream compresses and writes on the thread that reports the driller event, while it holds the
+         * driller mutex, which distorts the timings being drilled. Here WriteBinary only copies the data in the current chunk
+         * (drillers already write under the driller mutex, so no other lock is taken). At the end of a driller frame, once the
+         * chunk is over the chunk size, it's handed to the writer thread which compresses it as an independent zstd frame.
+         * If the writer falls behind all chunks of the pool are in flight and the producer waits for one.
+         *
+         * Chunks end at driller frame boundaries and the file ends with an index of the chunks (the zstd seekable format, see
+         * ZStdSeekable in zstd_compression.h), so DrillerInputIndexedFileStream can start parsing at any chunk.
+         */
+        class DrillerOutputAsyncFileStream
+            : public DrillerOutputStream
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(DrillerOutputAsyncFileStream, OSAllocator, 0)
+
+            /**
+             * \param chunkSize size of uncompressed data after which a chunk is compressed, at the end of the current frame.
+             * \param numChunks number of chunk buffers, how many chunks can be waiting for the writer thread plus one being filled.
+             */
+            DrillerOutputAsyncFileStream(unsigned int chunkSize = 256 * 1024, unsigned int numChunks = 4, int compressionLevel = 1);
+            ~DrillerOutputAsyncFileStream() override;
+
+            bool Open(const char* fileName, int mode, int platformFlags = 0);
+            /// Writes the data left, waits for the writer thread and closes the file.
+            void Close();
+            bool IsOpen() const;
+
+            void WriteBinary(const void* data, unsigned int dataSize) override;
+            void OnEndOfFrame() override;
+
+        private:
+            typedef vector<unsigned char>::type ChunkType;
+
+            /// Queues the current chunk for the writer thread and takes a free one, waits if there are none.
+            void SubmitChunk();
+            void ProcessChunks();
+            void WriteChunk(const ChunkType& chunk);
+            void WriteIndex();
+
+            IO::SystemFile              m_file;
+            unsigned int                m_chunkSize;
+            unsigned int                m_numChunks;
+            int                         m_compressionLevel;
+
+            vector<ChunkType>::type     m_chunks;               ///< Chunk pool, allocated once on Open.
+            ChunkType*                  m_currentChunk = nullptr;
+
+            AZStd::mutex                m_queueMutex;
+            AZStd::condition_variable   m_queueSignal;          ///< Signaled when a chunk is queued or freed and when closing.
+            vector<ChunkType*>::type    m_pendingChunks;        ///< Chunks waiting for the writer thread, oldest first.
+            vector<ChunkType*>::type    m_freeChunks;
+            bool                        m_isClosing = false;
+            AZStd::thread               m_writerThread;
+
+            // Writer thread only
+            ZSTD_CCtx_s*                m_context = nullptr;
+            ChunkType                   m_compressedChunk;
+            vector<AZ::u32>::type       m_index;                ///< Compressed and uncompressed size of every chunk written.
+        };
+
+        /**
+         * Reads driller data written by DrillerOutputAsyncFileStream. By default it reads the whole stream like
+         * DrillerInputFileStream, SeekChunk restricts reading to a range of chunks. Every chunk but the first starts
+         * with a "Frame" tag, so a DrillerSAXParser can process any range of chunks on its own.
+         * Streams written with a string pool store strings once, parsing a range only finds the strings it contains
+         * or that are already in the pool.
+         */
+        class DrillerInputIndexedFileStream
+            : public AZ::IO::SystemFile
+            , public DrillerInputStream
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(DrillerInputIndexedFileStream, OSAllocator, 0)
+
+            static const unsigned int AllChunks = static_cast<unsigned int>(-1);
+
+            DrillerInputIndexedFileStream();
+            ~DrillerInputIndexedFileStream() override;
+
+            /// Opens the file, reads the chunk index and the stream header.
+            bool Open(const char* fileName, int mode, int platformFlags = 0);
+            void Close();
+
+            unsigned int GetNumChunks() const;
+            /// Reads numChunks chunks starting at firstChunk, ReadBinary returns 0 at the end of the range.
+            bool SeekChunk(unsigned int firstChunk, unsigned int numChunks = AllChunks);
+
+            unsigned int ReadBinary(void* data, unsigned int maxDataSize) override;
+
+        private:
+            struct ChunkInfo
+            {
+                AZ::u64     m_offset;
+                AZ::u32     m_compressedSize;
+                AZ::u32     m_size;
+            };
+
+            bool ReadIndex();
+            bool LoadChunk(unsigned int chunk);
+
+            ZSTD_DCtx_s*                    m_context = nullptr;
+            vector<ChunkInfo>::type         m_chunkInfos;
+            vector<unsigned char>::type     m_compressedChunk;
+            vector<unsigned char>::type     m_chunk;            ///< Decompressed data of the chunk being read.
+            unsigned int                    m_nextChunk = 0;
+            unsigned int                    m_endChunk = 0;
+            size_t                          m_readOffset = 0;   ///< Read position in m_chunk.
+        };
+    } // namespace Debug
+} // namespace AZ
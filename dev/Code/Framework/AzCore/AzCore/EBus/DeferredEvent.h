@@ -0,0 +1,110 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/EBus/Event.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ
+{
+    //! An Event that can be signaled from any thread, the signals are delivered later on the thread that owns the handlers
+    //! QueueSignal() copies the parameters into a per event buffer without taking locks, DispatchQueuedSignals() must be called
+    //! at a sync point of the owning thread (for example once per tick) and signals the handlers with every queued payload.
+    //! Signals queued by one thread are delivered in the order they were queued, signals queued during a dispatch are
+    //! delivered by the next dispatch, so all handlers see the same signals in the same frame.
+    //! The buffer holds QueueCapacity payloads per dispatch, payloads are stored in place so queuing trivially copyable
+    //! parameters never allocates. When the buffer is full the extra payloads are stored in an overflow vector.
+    //! Handlers must connect, disconnect and dispatch on the owning thread, like with Event.
+    //! Parameters are stored by value, references and pointers must stay valid until the signal is dispatched.
+    //! Example Usage:
+    //! @code{.cpp}
+    //!      {
+    //!          DeferredEvent<int32_t> event;
+    //!          DeferredEvent<int32_t>::Handler handler([](int32_t value) { DO_SOMETHING_WITH_VALUE(value); });
+    //!          event.Connect(handler);
+    //!          AZ::Job* job = AZ::CreateJobFunction([&event]() { event.QueueSignal(1); }, true); // Signal from a job
+    //!          ...
+    //!          event.DispatchQueuedSignals(); // Our handlers lambda is invoked with the value 1 on the owning thread
+    //!      };
+    //! @endcode
+    template <typename... Params>
+    class DeferredEvent final
+    {
+    public:
+        static constexpr size_t QueueCapacity = 64;
+
+        using Handler = typename Event<Params...>::Handler;
+        using Payload = AZStd::tuple<AZStd::decay_t<Params>...>;
+
+        DeferredEvent();
+        DeferredEvent(const DeferredEvent& rhs) = delete;
+        DeferredEvent& operator=(const DeferredEvent& rhs) = delete;
+
+        //! Destroys the signals that were not dispatched, no thread may be queuing signals.
+        ~DeferredEvent();
+
+        //! Connects a handler, must be called on the owning thread.
+        void Connect(Handler& handler);
+
+        //! Returns true if at least one handler is connected to this event.
+        bool HasHandlerConnected() const;
+
+        //! Disconnects all connected handlers.
+        void DisconnectAllHandlers();
+
+        //! Signals the handlers immediately, must be called on the owning thread.
+        void Signal(Params&&... params) const;
+
+        //! Queues a signal, it is delivered by the next DispatchQueuedSignals(). Thread safe and lock free unless the buffer is full.
+        template <typename... Args>
+        void QueueSignal(Args&&... args);
+
+        //! Signals the handlers with all the queued signals, must be called on the owning thread.
+        //! @return the number of signals dispatched
+        size_t DispatchQueuedSignals();
+
+    private:
+        using PayloadStorage = AZStd::aligned_storage_t<sizeof(Payload), alignof(Payload)>;
+
+        //! The signals queued between two dispatches, the pages are swapped by each dispatch.
+        struct Page
+        {
+            PayloadStorage m_payloads[QueueCapacity];
+            AZStd::atomic<AZ::u32> m_committed{ 0 }; //< Number of signals whose payload is fully written
+            AZStd::spin_mutex m_overflowMutex;
+            AZStd::vector<Payload> m_overflow; //< Signals queued when the payloads were full
+        };
+
+        // The low 32 bits count the signals queued to the active page, the next bit is the index of the active page.
+        // Keeping both in one atomic lets a signal reserve its slot and learn its page in one operation.
+        static constexpr AZ::u64 ActivePageBit = AZ::u64(1) << 32;
+        static constexpr AZ::u64 CountMask = ActivePageBit - 1;
+
+        template <size_t... Indices>
+        void SignalPayload(Payload& payload, AZStd::index_sequence<Indices...>);
+
+        void DestroyPayloads(Page& page, size_t count);
+
+        Event<Params...> m_event;
+        Page m_pages[2];
+        AZStd::atomic<AZ::u64> m_queueState{ 0 };
+        bool m_dispatching = false; //< Raised during DispatchQueuedSignals(), nested dispatches are not supported
+    };
+}
+
+#include <AzCore/EBus/DeferredEvent.inl>
@@ -0,0 +1,148 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    template <typename... Params>
+    DeferredEvent<Params...>::DeferredEvent()
+    {
+        ;
+    }
+
+
+    template <typename... Params>
+    DeferredEvent<Params...>::~DeferredEvent()
+    {
+        // The inactive page is always empty outside of a dispatch, only the active one can hold signals
+        const AZ::u64 queueState = m_queueState.load(AZStd::memory_order_acquire);
+        Page& page = m_pages[(queueState & ActivePageBit) ? 1 : 0];
+        AZ_Assert(page.m_committed.load(AZStd::memory_order_acquire) == (queueState & CountMask), "A signal is being queued while the event is destroyed");
+        DestroyPayloads(page, static_cast<size_t>(queueState & CountMask));
+    }
+
+
+    template <typename... Params>
+    void DeferredEvent<Params...>::Connect(Handler& handler)
+    {
+        handler.Connect(m_event);
+    }
+
+
+    template <typename... Params>
+    bool DeferredEvent<Params...>::HasHandlerConnected() const
+    {
+        return m_event.HasHandlerConnected();
+    }
+
+
+    template <typename... Params>
+    void DeferredEvent<Params...>::DisconnectAllHandlers()
+    {
+        m_event.DisconnectAllHandlers();
+    }
+
+
+    template <typename... Params>
+    void DeferredEvent<Params...>::Signal(Params&&... params) const
+    {
+        m_event.Signal(AZStd::forward<Params>(params)...);
+    }
+
+
+    template <typename... Params>
+    template <typename... Args>
+    void DeferredEvent<Params...>::QueueSignal(Args&&... args)
+    {
+        // Reserve a slot, the dispatch can't swap the page from under us since the page comes with the reservation
+        const AZ::u64 queueState = m_queueState.fetch_add(1, AZStd::memory_order_acq_rel);
+        Page& page = m_pages[(queueState & ActivePageBit) ? 1 : 0];
+        const AZ::u64 index = queueState & CountMask;
+
+        if (index < QueueCapacity)
+        {
+            new(&page.m_payloads[index]) Payload(AZStd::forward<Args>(args)...);
+        }
+        else
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(page.m_overflowMutex);
+            page.m_overflow.emplace_back(AZStd::forward<Args>(args)...);
+        }
+
+        // Publish the payload, the dispatch waits for all reserved slots to be committed
+        page.m_committed.fetch_add(1, AZStd::memory_order_release);
+    }
+
+
+    template <typename... Params>
+    size_t DeferredEvent<Params...>::DispatchQueuedSignals()
+    {
+        AZ_Assert(!m_dispatching, "DispatchQueuedSignals can't be called from a handler of the same event");
+        m_dispatching = true;
+
+        // Activate the other page, signals queued from now on (including by our handlers) go to the next dispatch
+        AZ::u64 queueState = m_queueState.load(AZStd::memory_order_relaxed);
+        const AZ::u64 nextState = (queueState & ActivePageBit) ^ ActivePageBit;
+        queueState = m_queueState.exchange(nextState, AZStd::memory_order_acq_rel);
+
+        Page& page = m_pages[(queueState & ActivePageBit) ? 1 : 0];
+        const AZ::u32 count = static_cast<AZ::u32>(queueState & CountMask);
+
+        // Wait for the threads that reserved a slot before the swap to finish writing their payload
+        while (page.m_committed.load(AZStd::memory_order_acquire) != count)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        const size_t numPayloads = AZStd::GetMin<size_t>(count, QueueCapacity);
+        for (size_t index = 0; index < numPayloads; ++index)
+        {
+            SignalPayload(*reinterpret_cast<Payload*>(&page.m_payloads[index]), AZStd::make_index_sequence<sizeof...(Params)>{});
+        }
+        for (Payload& payload : page.m_overflow)
+        {
+            SignalPayload(payload, AZStd::make_index_sequence<sizeof...(Params)>{});
+        }
+
+        // Empty the page before the next dispatch makes it active again
+        DestroyPayloads(page, count);
+        page.m_committed.store(0, AZStd::memory_order_relaxed);
+
+        m_dispatching = false;
+        return count;
+    }
+
+
+    template <typename... Params>
+    template <size_t... Indices>
+    inline void DeferredEvent<Params...>::SignalPayload(Payload& payload, AZStd::index_sequence<Indices...>)
+    {
+        // Forward the stored values the way Signal() expects them, by value parameters are moved out of the payload
+        m_event.Signal(static_cast<Params&&>(AZStd::get<Indices>(payload))...);
+    }
+
+
+    template <typename... Params>
+    inline void DeferredEvent<Params...>::DestroyPayloads(Page& page, size_t count)
+    {
+        const size_t numPayloads = AZStd::GetMin<size_t>(count, QueueCapacity);
+        for (size_t index = 0; index < numPayloads; ++index)
+        {
+            reinterpret_cast<Payload*>(&page.m_payloads[index])->~Payload();
+        }
+        page.m_overflow.clear();
+    }
+}
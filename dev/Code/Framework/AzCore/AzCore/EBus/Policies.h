@@ -20,6 +20,7 @@
 // Includes for the event queue.
 #include <AzCore/std/functional.h>
 #include <AzCore/std/function/invoke.h>
+#include <AzCore/std/function/move_only_function.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -225,7 +226,8 @@ namespace AZ
     template <class Bus, class MutexType>
     struct EBusQueuePolicy<true, Bus, MutexType>
     {
-        typedef AZStd::function<void()> BusMessageCall;
+        /// Queued calls are moved into the queue and never copied, most of them fit in the inline storage and don't allocate.
+        typedef AZStd::move_only_function<void()> BusMessageCall;
 
         typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
         typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
@@ -252,7 +254,7 @@ namespace AZ
                     {
                         break;
                     }
-                    AZStd::swap(invoke, m_messages.front());
+                    invoke = AZStd::move(m_messages.front());
                     m_messages.pop();
                     if (numMessages == 1)
                     {
@@ -271,10 +271,10 @@ Streamer::Read(const char* fileName, SizeType byteOffset, SizeType byteSize, voi
     return 0;
 }
 
-bool Streamer::ReadAsync(const char* filename, SizeType byteOffset, SizeType byteSize, void* dataBuffer, const Request::RequestDoneCB& callback, 
+bool Streamer::ReadAsync(const char* filename, SizeType byteOffset, SizeType byteSize, void* dataBuffer, Request::RequestDoneCB callback, 
     AZStd::chrono::microseconds deadline, Request::PriorityType priority, const char* debugName, bool deferCallback)
 {
-    AZStd::shared_ptr<Request> request = CreateAsyncRead(filename, byteOffset, byteSize, dataBuffer, callback, deadline, priority, debugName, deferCallback);
+    AZStd::shared_ptr<Request> request = CreateAsyncRead(filename, byteOffset, byteSize, dataBuffer, AZStd::move(callback), deadline, priority, debugName, deferCallback);
     if (request)
     {
         return QueueRequest(AZStd::move(request));
@@ -282,7 +282,7 @@ bool Streamer::ReadAsync(const char* filename, SizeType byteOffset, SizeType byt
     return false;
 }
 
-AZStd::shared_ptr<Request> Streamer::CreateAsyncRead(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, const Request::RequestDoneCB& callback,
+AZStd::shared_ptr<Request> Streamer::CreateAsyncRead(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, Request::RequestDoneCB callback,
     AZStd::chrono::microseconds deadline, Request::PriorityType priority, const char* debugName, bool deferCallback)
 {
     AZ_Assert(fileName, "No file name provided for reading through AZ::IO::Streamer.");
@@ -334,7 +334,7 @@ AZStd::shared_ptr<Request> Streamer::CreateAsyncRead(const char* fileName, SizeT
     if (device)
     {
         request = AZStd::make_shared<Request>(device, AZStd::move(path), byteOffset, byteSize, dataBuffer,
-            callback, deferCallback, priority, operation, debugName);
+            AZStd::move(callback), deferCallback, priority, operation, debugName);
         request->SetDeadline(deadline);
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         request->m_originalFilename = fileName;
@@ -94,13 +94,13 @@ namespace AZ
             //! @debugName A name to help identify the purpose of the request during debugging.
             //! @deferCallback Whether or not the callback is delayed and called from the main thread instead.
             //! @return Whether or not the read request was successfully created and queued.
-            bool ReadAsync(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, const Request::RequestDoneCB& callback, 
+            bool ReadAsync(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, Request::RequestDoneCB callback, 
                 AZStd::chrono::microseconds deadline = ExecuteWhenIdle, Request::PriorityType priority = Request::PriorityType::DR_PRIORITY_NORMAL, 
                 const char* debugName = nullptr, bool deferCallback = false);
             
             //! Creates a read request, but doesn't queue the request for processing. This can be useful if the returned handle is used in the callback or
             //! needs to be stored before the request can complete. See ReadAsync for arguments.
-            AZStd::shared_ptr<Request> CreateAsyncRead(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, const Request::RequestDoneCB& callback,
+            AZStd::shared_ptr<Request> CreateAsyncRead(const char* fileName, SizeType byteOffset, SizeType byteSize, void* dataBuffer, Request::RequestDoneCB callback,
                 AZStd::chrono::microseconds deadline = ExecuteWhenIdle, Request::PriorityType priority = Request::PriorityType::DR_PRIORITY_NORMAL,
                 const char* debugName = nullptr, bool deferCallback = false);
             //! Queue a previously created request for processing. This only applies to the Create* functions, other functions will automatically queue.
@@ -20,7 +20,7 @@ namespace IO
     const AZStd::chrono::microseconds ExecuteWhenIdle = AZStd::chrono::microseconds::max();
 
     //Request
-    Request::Request(Device* device, RequestPath filename, SizeType byteOffset, SizeType byteSize, void* buffer, const RequestDoneCB& cb, 
+    Request::Request(Device* device, RequestPath filename, SizeType byteOffset, SizeType byteSize, void* buffer, RequestDoneCB&& cb, 
         bool isDeferredCB, PriorityType priority, OperationType op, const char* debugName)
         : m_filename(AZStd::move(filename))
         , m_device(device)
@@ -30,7 +30,7 @@ namespace IO
         , m_bytesProcessedStart(0)
         , m_bytesProcessedEnd(0)
         , m_currentSeekPos(byteOffset)
-        , m_callback(cb)
+        , m_callback(AZStd::move(cb))
         , m_isDeferredCB(isDeferredCB)
         , m_state(StateType::ST_PENDING)
         , m_priority(priority)
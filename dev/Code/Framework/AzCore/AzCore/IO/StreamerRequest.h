@@ -15,6 +15,7 @@
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/function/move_only_function.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -35,7 +36,8 @@ namespace IO
         AZ_CLASS_ALLOCATOR(Request, ThreadPoolAllocator, 0)
         enum class StateType : u8;
         using SizeType = u64;
-        using RequestDoneCB = ::AZStd::function<void(const AZStd::shared_ptr<class Request>& /*request handle*/, SizeType /* num bytes read */, void* /*buffer*/, StateType /* request state */)>;
+        //! Callbacks are moved into the request and never copied, so they don't need to be copyable and small ones don't allocate.
+        using RequestDoneCB = ::AZStd::move_only_function<void(const AZStd::shared_ptr<class Request>& /*request handle*/, SizeType /* num bytes read */, void* /*buffer*/, StateType /* request state */)>;
 
         enum class OperationType : u8
         {
@@ -68,7 +70,7 @@ namespace IO
             DR_PRIORITY_BELOW_NORMAL,
         };
 
-        Request(Device* device, RequestPath filename, SizeType byteOffset, SizeType byteSize, void* buffer, const RequestDoneCB& cb,
+        Request(Device* device, RequestPath filename, SizeType byteOffset, SizeType byteSize, void* buffer, RequestDoneCB&& cb,
             bool isDeferredCB, PriorityType priority, OperationType op, const char* debugName);
         ~Request() = default;
 
@@ -37,7 +37,6 @@ namespace AZ
                 , m_numToComplete(0)
                 , m_readFailed(false)
             {
-                m_wrapper = AZStd::bind(&SyncRequestCallback::operator(), this, AZStd::placeholders::_1, AZStd::placeholders::_2, AZStd::placeholders::_3, AZStd::placeholders::_4);
             }
 
             void operator()(const AZStd::shared_ptr<Request>&, Streamer::SizeType bytesTransfered, void*, Request::StateType state)
@@ -58,10 +57,13 @@ namespace AZ
                 m_wait.release();
             }
 
-            operator const Request::RequestDoneCB & ()
+            operator Request::RequestDoneCB()
             {
                 m_numToComplete++;
-                return m_wrapper;
+                return [this](const AZStd::shared_ptr<Request>& request, Streamer::SizeType bytesTransfered, void* buffer, Request::StateType state)
+                {
+                    (*this)(request, bytesTransfered, buffer, state);
+                };
             }
 
             /**
@@ -98,7 +100,6 @@ namespace AZ
 
             AZStd::semaphore        m_wait;
             unsigned int            m_numToComplete;
-            Request::RequestDoneCB m_wrapper;
         };
     }
 }
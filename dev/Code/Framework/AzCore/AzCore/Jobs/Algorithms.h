@@ -14,6 +14,9 @@
 
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/std/allocator_stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/std/parallel/spin_mutex.h>
 
@@ -715,6 +718,390 @@ namespace AZ
         parallel_for_each_start(start, end, function, dependent, auto_partitioner(), jobContext, allocator);
     }
 
+    namespace Internal
+    {
+        /**
+         * Number of contiguous chunks reductions, scans and sorts split [0, numElements) into. It's the partition
+         * chunk count, clamped so that every chunk has at least one element.
+         */
+        template<class Partition>
+        inline ParallelIndexType GetNumChunks(ParallelIndexType numElements, const Partition& partition, JobContext* jobContext)
+        {
+            ParallelIndexType numChunks = partition.GetNumChunks(numElements, jobContext);
+            return AZStd::GetMax(AZStd::GetMin(numChunks, numElements), static_cast<ParallelIndexType>(1));
+        }
+
+        /// Returns the [begin, end) element range of a chunk, when splitting numElements in numChunks chunks.
+        inline void GetChunkRange(ParallelIndexType chunk, ParallelIndexType numChunks, ParallelIndexType numElements, ParallelIndexType& begin, ParallelIndexType& end)
+        {
+            ParallelIndexType numPerChunk = numElements / numChunks;
+            ParallelIndexType remainder = numElements % numChunks;
+            // the first 'remainder' chunks get an extra element
+            begin = chunk * numPerChunk + AZStd::GetMin(chunk, remainder);
+            end = begin + numPerChunk + (chunk < remainder ? 1 : 0);
+        }
+
+        /// Merges two sorted ranges into out, moving the elements. Equal elements from the first range come first.
+        template<class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+        inline void MoveMerge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator out, const Compare& comp)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (comp(*first2, *first1))
+                {
+                    *out = AZStd::move(*first2);
+                    ++first2;
+                }
+                else
+                {
+                    *out = AZStd::move(*first1);
+                    ++first1;
+                }
+                ++out;
+            }
+            for (; first1 != last1; ++first1, ++out)
+            {
+                *out = AZStd::move(*first1);
+            }
+            for (; first2 != last2; ++first2, ++out)
+            {
+                *out = AZStd::move(*first2);
+            }
+        }
+
+        /**
+         * One pass of the bottom up merge in parallel_sort. Merges pairs of adjacent runs of 'runSize' chunks from
+         * source into destination, each pair on its own job.
+         */
+        template<class SourceIterator, class DestIterator, class Compare>
+        inline void ParallelMergePass(SourceIterator source, DestIterator destination, ParallelIndexType runSize, ParallelIndexType numChunks,
+            ParallelIndexType numElements, const Compare& comp, JobContext* jobContext)
+        {
+            ParallelIndexType numPairs = (numChunks + 2 * runSize - 1) / (2 * runSize);
+            parallel_for(0, numPairs, [=, &comp](ParallelIndexType pair)
+            {
+                ParallelIndexType firstChunk = pair * 2 * runSize;
+                ParallelIndexType middleChunk = AZStd::GetMin(firstChunk + runSize, numChunks);
+                ParallelIndexType lastChunk = AZStd::GetMin(firstChunk + 2 * runSize, numChunks);
+
+                ParallelIndexType begin, middle, end, unused;
+                GetChunkRange(firstChunk, numChunks, numElements, begin, unused);
+                if (middleChunk < numChunks)
+                {
+                    GetChunkRange(middleChunk, numChunks, numElements, middle, unused);
+                }
+                else
+                {
+                    middle = numElements;
+                }
+                GetChunkRange(lastChunk - 1, numChunks, numElements, unused, end);
+
+                MoveMerge(source + begin, source + middle, source + middle, source + end, destination + begin, comp);
+            }, jobContext);
+        }
+    }
+
+    /**
+     * Parallel reduction of a random access range. Each chunk of the range is reduced on its own job starting from
+     * 'identity', then the chunk results are combined in order on the calling thread. The operation must be
+     * associative and 'identity' must be its identity element (0 for addition, 1 for multiplication...), the operation
+     * doesn't need to be commutative. Blocks until the reduction is complete.
+     */
+    template<class RandomIterator, class T, class BinaryOperation, class Partition>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T identity, const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements == 0)
+        {
+            return identity;
+        }
+
+        Internal::ParallelIndexType numChunks = Internal::GetNumChunks(numElements, partition, context);
+        AZStd::vector<T> partials(numChunks, identity);
+
+        parallel_for(0, numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+
+            T result = identity;
+            for (Internal::ParallelIndexType i = begin; i < end; ++i)
+            {
+                result = op(result, first[i]);
+            }
+            partials[chunk] = result;
+        }, context);
+
+        T result = identity;
+        for (const T& partial : partials)
+        {
+            result = op(result, partial);
+        }
+        return result;
+    }
+
+    template<class RandomIterator, class T, class BinaryOperation>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T identity, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, identity, op, static_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel sum of a random access range, see \ref parallel_reduce.
+     */
+    template<class RandomIterator, class T>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T identity, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, identity, AZStd::plus<T>(), static_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel inclusive prefix scan, out[i] = in[0] op in[1] op ... op in[i]. The scan is done in 3 steps, each
+     * chunk is reduced in parallel, the chunk totals are scanned on the calling thread, then each chunk is scanned
+     * in parallel starting from the total of the previous chunks. The operation must be associative.
+     * The output may be the input range (in place scan). Blocks until the scan is complete.
+     */
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation, class Partition>
+    void parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements == 0)
+        {
+            return;
+        }
+
+        Internal::ParallelIndexType numChunks = Internal::GetNumChunks(numElements, partition, context);
+        AZStd::vector<value_type> carries(numChunks, first[0]);
+
+        // reduce each chunk except the last, its total is not needed
+        parallel_for(0, numChunks - 1, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+
+            value_type total = first[begin];
+            for (Internal::ParallelIndexType i = begin + 1; i < end; ++i)
+            {
+                total = op(total, first[i]);
+            }
+            carries[chunk + 1] = total;
+        }, context);
+
+        // carries[chunk] is the total of all the chunks before 'chunk'
+        for (Internal::ParallelIndexType chunk = 2; chunk < numChunks; ++chunk)
+        {
+            carries[chunk] = op(carries[chunk - 1], carries[chunk]);
+        }
+
+        parallel_for(0, numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+
+            value_type result = chunk == 0 ? first[begin] : op(carries[chunk], first[begin]);
+            out[begin] = result;
+            for (Internal::ParallelIndexType i = begin + 1; i < end; ++i)
+            {
+                result = op(result, first[i]);
+                out[i] = result;
+            }
+        }, context);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation>
+    void parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        parallel_inclusive_scan(first, last, out, op, static_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator>
+    void parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+        parallel_inclusive_scan(first, last, out, AZStd::plus<value_type>(), static_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel exclusive prefix scan, out[0] = init and out[i] = init op in[0] op ... op in[i - 1].
+     * See \ref parallel_inclusive_scan for details, the output may be the input range.
+     */
+    template<class RandomIterator, class OutputRandomIterator, class T, class BinaryOperation, class Partition>
+    void parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, T init, const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements == 0)
+        {
+            return;
+        }
+
+        Internal::ParallelIndexType numChunks = Internal::GetNumChunks(numElements, partition, context);
+        AZStd::vector<T> carries(numChunks, init);
+
+        parallel_for(0, numChunks - 1, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+
+            T total = first[begin];
+            for (Internal::ParallelIndexType i = begin + 1; i < end; ++i)
+            {
+                total = op(total, first[i]);
+            }
+            carries[chunk + 1] = total;
+        }, context);
+
+        for (Internal::ParallelIndexType chunk = 1; chunk < numChunks; ++chunk)
+        {
+            carries[chunk] = op(carries[chunk - 1], carries[chunk]);
+        }
+
+        parallel_for(0, numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+
+            T result = carries[chunk];
+            for (Internal::ParallelIndexType i = begin; i < end; ++i)
+            {
+                T value = first[i]; // read before writing, the scan can be in place
+                out[i] = result;
+                result = op(result, value);
+            }
+        }, context);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class T, class BinaryOperation>
+    void parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, T init, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        parallel_exclusive_scan(first, last, out, init, op, static_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class T>
+    void parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator out, T init, JobContext* jobContext = nullptr)
+    {
+        parallel_exclusive_scan(first, last, out, init, AZStd::plus<T>(), static_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel sort of a random access range. Each chunk is sorted with AZStd::sort on its own job, then the sorted
+     * chunks are merged pairwise in parallel passes through a temporary buffer. The sort is not stable and the value
+     * type must be default constructible and move assignable. Small ranges are sorted on the calling thread.
+     * Blocks until the sort is complete.
+     */
+    template<class RandomIterator, class Compare, class Partition>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        // Below this number of elements the job overhead outweighs the parallel sort.
+        const Internal::ParallelIndexType minElementsToSortInParallel = 2048;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        Internal::ParallelIndexType numChunks = numElements < minElementsToSortInParallel ? 1 : Internal::GetNumChunks(numElements, partition, context);
+        if (numChunks <= 1)
+        {
+            AZStd::sort(first, last, comp);
+            return;
+        }
+
+        parallel_for(0, numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            Internal::ParallelIndexType begin, end;
+            Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+            AZStd::sort(first + begin, first + end, comp);
+        }, context);
+
+        AZStd::vector<value_type> buffer(numElements);
+        bool isInBuffer = false;
+        for (Internal::ParallelIndexType runSize = 1; runSize < numChunks; runSize *= 2)
+        {
+            if (isInBuffer)
+            {
+                Internal::ParallelMergePass(buffer.begin(), first, runSize, numChunks, numElements, comp, context);
+            }
+            else
+            {
+                Internal::ParallelMergePass(first, buffer.begin(), runSize, numChunks, numElements, comp, context);
+            }
+            isInBuffer = !isInBuffer;
+        }
+
+        if (isInBuffer)
+        {
+            parallel_for(0, numChunks, [&](Internal::ParallelIndexType chunk)
+            {
+                Internal::ParallelIndexType begin, end;
+                Internal::GetChunkRange(chunk, numChunks, numElements, begin, end);
+                for (Internal::ParallelIndexType i = begin; i < end; ++i)
+                {
+                    first[i] = AZStd::move(buffer[i]);
+                }
+            }, context);
+        }
+    }
+
+    template<class RandomIterator, class Compare>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, comp, static_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator>
+    void parallel_sort(RandomIterator first, RandomIterator last, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+        parallel_sort(first, last, AZStd::less<value_type>(), static_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel transform, out[i] = op(in[i]) over random access ranges. Blocks until the transform is complete.
+     */
+    template<class RandomIterator, class OutputRandomIterator, class UnaryOperation, class Partition>
+    void parallel_transform(RandomIterator first, RandomIterator last, OutputRandomIterator out, const UnaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        parallel_for(0, numElements, [&](Internal::ParallelIndexType i)
+        {
+            out[i] = op(first[i]);
+        }, partition, jobContext);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class UnaryOperation>
+    void parallel_transform(RandomIterator first, RandomIterator last, OutputRandomIterator out, const UnaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        parallel_transform(first, last, out, op, auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel binary transform, out[i] = op(in1[i], in2[i]) over random access ranges. Blocks until the transform is complete.
+     * Named apart from \ref parallel_transform, whose calls with a partition would otherwise match both overload sets.
+     */
+    template<class RandomIterator1, class RandomIterator2, class OutputRandomIterator, class BinaryOperation, class Partition>
+    void parallel_transform_binary(RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, OutputRandomIterator out, const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last1 - first1);
+        parallel_for(0, numElements, [&](Internal::ParallelIndexType i)
+        {
+            out[i] = op(first1[i], first2[i]);
+        }, partition, jobContext);
+    }
+
+    template<class RandomIterator1, class RandomIterator2, class OutputRandomIterator, class BinaryOperation>
+    void parallel_transform_binary(RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, OutputRandomIterator out, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        parallel_transform_binary(first1, last1, first2, out, op, auto_partitioner(), jobContext);
+    }
+
     /**
      * Invokes the specified functions in parallel and waits until they are all complete. Overloads for up to 8
      * function parameters are provided.
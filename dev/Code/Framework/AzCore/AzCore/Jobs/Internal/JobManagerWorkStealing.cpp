@@ -16,6 +16,7 @@
 #include <AzCore/Jobs/Internal/JobNotify.h>
 
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/parallel/epoch_domain.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
 
@@ -339,6 +340,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
                 if (shouldSleep)
                 {
+                    //free memory retired by lock free structures while we are idle
+                    AZStd::epoch_domain::reclaim_registered_domains();
+
                     //no available work, so go to sleep (or we have already been signaled by another thread and will acquire the semaphore but not actually sleep)
                     info->m_waitEvent.acquire();
                     AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::JobManagerDetailed, info);
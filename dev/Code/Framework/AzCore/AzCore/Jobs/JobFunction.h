@@ -15,12 +15,14 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/std/typetraits/remove_reference.h>
 #include <AzCore/std/typetraits/remove_cv.h>
+#include <AzCore/std/typetraits/decay.h>
 #include <AzCore/std/typetraits/function_traits.h>
 
 namespace AZ
 {
     /**
-     * A job which uses a templated function (can be AZStd::function, AZStd::delegate, result of AZStd::bind, lambda, reference to a functor, regular function).
+     * A job which uses a templated function (can be AZStd::function, AZStd::move_only_function, AZStd::delegate, result of AZStd::bind, lambda, reference to a functor, regular function).
+     * The function is stored as is, it's moved in when passed as an rvalue so move only functors (e.g. lambdas capturing an AZStd::unique_ptr) can be used.
      * 
      * The function can either take the owning AZ::Job& as its lone parameter or no parameters at all
      */
@@ -32,6 +34,7 @@ namespace AZ
         AZ_CLASS_ALLOCATOR(JobFunction, ThreadPoolAllocator, 0)
 
         typedef const typename AZStd::remove_cv<typename AZStd::remove_reference<Function>::type>::type& FunctionCRef;
+        typedef typename AZStd::remove_cv<typename AZStd::remove_reference<Function>::type>::type&& FunctionRRef;
 
         JobFunction(FunctionCRef processFunction, bool isAutoDelete, JobContext* context)
             : Job(isAutoDelete, context)
@@ -39,6 +42,12 @@ namespace AZ
         {
         }
 
+        JobFunction(FunctionRRef processFunction, bool isAutoDelete, JobContext* context)
+            : Job(isAutoDelete, context)
+            , m_function(AZStd::move(processFunction))
+        {
+        }
+
         void Process() override
         {
             // Use our template argument helper to invoke m_function with either no args or *this
@@ -80,9 +89,9 @@ namespace AZ
 
 	/// Convenience function to create (aznew JobFunction with any function signature). Delete the function with delete (or isAutoDelete set to true)
     template<class Function>
-    inline JobFunction<Function>* CreateJobFunction(const Function& processFunction, bool isAutoDelete, JobContext* context = nullptr)
+    inline JobFunction<AZStd::decay_t<Function>>* CreateJobFunction(Function&& processFunction, bool isAutoDelete, JobContext* context = nullptr)
     {
-        return aznew JobFunction<Function>(processFunction, isAutoDelete, context);
+        return aznew JobFunction<AZStd::decay_t<Function>>(AZStd::forward<Function>(processFunction), isAutoDelete, context);
     }
 
     /// For delete symmetry
@@ -11,9 +11,18 @@
  */
 #include <AzCore/RTTI/ReflectionManager.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Serialization/SerializeContext.h>
 
 namespace AZ
 {
+    namespace
+    {
+        SerializeContext* AsSerializeContext(ReflectContext* context)
+        {
+            return azrtti_cast<SerializeContext*>(context);
+        }
+    }
+
     //=========================================================================
     // ~ReflectionManager
     //=========================================================================
@@ -35,6 +44,10 @@ namespace AZ
 
         // Clear the entry points
         m_entryPoints.clear();
+        m_typedEntryPoints.clear();
+        m_nonTypedEntryPoints.clear();
+        m_deferredTypes.clear();
+        m_numDeferredEntryPoints = 0;
     }
 
     //=========================================================================
@@ -50,12 +63,35 @@ namespace AZ
 
         // Place the reflect function in the collection
         auto entryIt = m_entryPoints.emplace(m_entryPoints.end(), typeId, reflectEntryPoint);
-        m_typedEntryPoints.emplace(typeId, AZStd::move(entryIt));
+        m_typedEntryPoints.emplace(typeId, entryIt);
+
+        // Entry points in the snapshot are reflected to the SerializeContext when one of their classes is looked up
+        if (const AZStd::vector<TypeId>* snapshotTypes = m_snapshot.GetEntryPointTypes(typeId))
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_deferredMutex);
+            entryIt->m_isDeferred = true;
+            ++m_numDeferredEntryPoints;
+            for (const TypeId& snapshotType : *snapshotTypes)
+            {
+                m_deferredTypes.emplace(snapshotType, entryIt);
+            }
+            UpdateClassDataMissPending();
+        }
 
         // Call the new entry point with all known contexts
         for (const auto& context : m_contexts)
         {
-            reflectEntryPoint(context.get());
+            if (AsSerializeContext(context.get()))
+            {
+                if (!entryIt->m_isDeferred)
+                {
+                    ReflectSerializeContext(entryIt, context.get());
+                }
+            }
+            else
+            {
+                reflectEntryPoint(context.get());
+            }
         }
     }
 
@@ -67,9 +103,20 @@ namespace AZ
         auto entryIt = m_typedEntryPoints.find(typeId);
         if (entryIt != m_typedEntryPoints.end())
         {
+            const bool isDeferred = entryIt->second->m_isDeferred;
+            if (isDeferred)
+            {
+                RemoveDeferredTypes(entryIt->second);
+                UpdateClassDataMissPending();
+            }
+
             // Call unreflect on everything in reverse context order
             for (auto contextIt = m_contexts.rbegin(); contextIt != m_contexts.rend(); ++contextIt)
             {
+                if (isDeferred && AsSerializeContext(contextIt->get()))
+                {
+                    continue;
+                }
                 (*contextIt)->EnableRemoveReflection();
                 (*entryIt->second)(contextIt->get());
                 (*contextIt)->DisableRemoveReflection();
@@ -162,11 +209,20 @@ namespace AZ
             return;
         }
 
+        const bool isSerializeContext = AsSerializeContext(context.get()) != nullptr;
         for (const auto& entry : m_entryPoints)
         {
-            entry(context.get());
+            if (!isSerializeContext || !entry.m_isDeferred)
+            {
+                entry(context.get());
+            }
         }
         m_contexts.emplace_back(AZStd::move(context));
+
+        if (isSerializeContext)
+        {
+            UpdateClassDataMissHandler();
+        }
     }
 
     //=========================================================================
@@ -195,11 +251,20 @@ namespace AZ
             ReflectContext* context = contextIt->get();
             if (azrtti_typeid(context) == contextTypeId)
             {
+                SerializeContext* serializeContext = AsSerializeContext(context);
+                if (serializeContext)
+                {
+                    serializeContext->SetClassDataMissHandler(nullptr);
+                }
+
                 // Unreflect everything from the context
                 context->EnableRemoveReflection();
                 for (auto entryIt = m_entryPoints.rbegin(); entryIt != m_entryPoints.rend(); ++entryIt)
                 {
-                    (*entryIt)(context);
+                    if (!serializeContext || !entryIt->m_isDeferred)
+                    {
+                        (*entryIt)(context);
+                    }
                 }
                 context->DisableRemoveReflection();
 
@@ -208,4 +273,159 @@ namespace AZ
             }
         }
     }
-}
\ No newline at end of file
+
+    //=========================================================================
+    // SetSnapshot
+    //=========================================================================
+    void ReflectionManager::SetSnapshot(ReflectionSnapshot&& snapshot)
+    {
+        // Entry points deferred with the previous snapshot can't be found without it
+        ResolveDeferredReflection();
+
+        m_snapshot = AZStd::move(snapshot);
+        UpdateClassDataMissHandler();
+    }
+
+    //=========================================================================
+    // ResolveDeferredReflection
+    //=========================================================================
+    void ReflectionManager::ResolveDeferredReflection()
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_deferredMutex);
+        for (auto entryIt = m_entryPoints.begin(); entryIt != m_entryPoints.end() && m_numDeferredEntryPoints > 0; ++entryIt)
+        {
+            if (entryIt->m_isDeferred)
+            {
+                ResolveDeferredEntryPoint(entryIt);
+            }
+        }
+    }
+
+    //=========================================================================
+    // RecordSnapshot
+    //=========================================================================
+    void ReflectionManager::RecordSnapshot(ReflectionSnapshot* snapshot)
+    {
+        m_recordedSnapshot = snapshot;
+    }
+
+    //=========================================================================
+    // ReflectSerializeContext
+    //=========================================================================
+    void ReflectionManager::ReflectSerializeContext(EntryPointList::iterator entryIt, ReflectContext* serializeContext)
+    {
+        if (!m_recordedSnapshot || entryIt->m_nonTyped)
+        {
+            (*entryIt)(serializeContext);
+            return;
+        }
+
+        // The context reports the classes the entry point adds, enumerating all classes around every entry point made startup quadratic
+        SerializeContext* context = AsSerializeContext(serializeContext);
+        AZStd::vector<TypeId> reflectedTypes;
+        context->SetClassReflectedHandler([&reflectedTypes](const Uuid& typeId) { reflectedTypes.push_back(typeId); });
+        (*entryIt)(serializeContext);
+        context->SetClassReflectedHandler(nullptr);
+
+        m_recordedSnapshot->SetEntryPointTypes(entryIt->m_typeId, AZStd::move(reflectedTypes));
+    }
+
+    //=========================================================================
+    // ResolveDeferredEntryPoint
+    //=========================================================================
+    void ReflectionManager::ResolveDeferredEntryPoint(EntryPointList::iterator entryIt)
+    {
+        // Clear the state first, the entry point can look up its own classes while reflecting them
+        RemoveDeferredTypes(entryIt);
+        if (ReflectContext* serializeContext = GetReflectContext(azrtti_typeid<SerializeContext>()))
+        {
+            (*entryIt)(serializeContext);
+        }
+
+        // Only now, other threads look classes up without the lock when nothing is pending
+        UpdateClassDataMissPending();
+    }
+
+    //=========================================================================
+    // RemoveDeferredTypes
+    //=========================================================================
+    void ReflectionManager::RemoveDeferredTypes(EntryPointList::iterator entryIt)
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_deferredMutex);
+        if (!entryIt->m_isDeferred)
+        {
+            return;
+        }
+        entryIt->m_isDeferred = false;
+        --m_numDeferredEntryPoints;
+
+        if (const AZStd::vector<TypeId>* snapshotTypes = m_snapshot.GetEntryPointTypes(entryIt->m_typeId))
+        {
+            for (const TypeId& snapshotType : *snapshotTypes)
+            {
+                auto deferredIt = m_deferredTypes.find(snapshotType);
+                if (deferredIt != m_deferredTypes.end() && deferredIt->second == entryIt)
+                {
+                    m_deferredTypes.erase(deferredIt);
+                }
+            }
+        }
+    }
+
+    //=========================================================================
+    // OnClassDataMiss
+    //=========================================================================
+    bool ReflectionManager::OnClassDataMiss(const TypeId& classId)
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_deferredMutex);
+        if (m_numDeferredEntryPoints == 0)
+        {
+            return false;
+        }
+
+        if (classId.IsNull())
+        {
+            ResolveDeferredReflection();
+            return true;
+        }
+
+        auto deferredIt = m_deferredTypes.find(classId);
+        if (deferredIt == m_deferredTypes.end())
+        {
+            return false;
+        }
+        ResolveDeferredEntryPoint(deferredIt->second);
+        return true;
+    }
+
+    //=========================================================================
+    // UpdateClassDataMissHandler
+    //=========================================================================
+    void ReflectionManager::UpdateClassDataMissHandler()
+    {
+        if (SerializeContext* serializeContext = AsSerializeContext(GetReflectContext(azrtti_typeid<SerializeContext>())))
+        {
+            if (m_snapshot.IsEmpty())
+            {
+                serializeContext->SetClassDataMissHandler(nullptr);
+            }
+            else
+            {
+                serializeContext->SetClassDataMissHandler([this](const TypeId& classId) { return OnClassDataMiss(classId); }, &m_deferredMutex);
+                UpdateClassDataMissPending();
+            }
+        }
+    }
+
+    //=========================================================================
+    // UpdateClassDataMissPending
+    //=========================================================================
+    void ReflectionManager::UpdateClassDataMissPending()
+    {
+        if (SerializeContext* serializeContext = AsSerializeContext(GetReflectContext(azrtti_typeid<SerializeContext>())))
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_deferredMutex);
+            serializeContext->SetClassDataMissPending(m_numDeferredEntryPoints > 0);
+        }
+    }
+}
@@ -12,9 +12,11 @@
 #pragma once
 
 #include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/RTTI/ReflectionSnapshot.h>
 
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/typetraits/is_same.h>
 
@@ -61,6 +63,23 @@ namespace AZ
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
         void RemoveReflectContext() { RemoveReflectContext(azrtti_typeid<ReflectContextT>()); }
 
+        /**
+         * Defers reflection to the SerializeContext using a snapshot, an empty snapshot stops deferring.
+         * Typed entry points registered from now on that are in the snapshot are reflected to the other contexts right away,
+         * and to the SerializeContext the first time it looks up one of their classes (by id, by name, or to enumerate them).
+         * \note Classes are reflected from inside SerializeContext lookups, which are otherwise read only. While entry points are
+         *       deferred, the lookups hold m_deferredMutex so they can run on any thread, and go back to lock free once all of
+         *       them are reflected.
+         */
+        void SetSnapshot(ReflectionSnapshot&& snapshot);
+        /// Reflects all the deferred entry points to the SerializeContext.
+        void ResolveDeferredReflection();
+        /// Returns the number of entry points not reflected to the SerializeContext yet.
+        size_t GetNumDeferredEntryPoints() const { return m_numDeferredEntryPoints; }
+
+        /// Records in snapshot the classes typed entry points registered from now on reflect to the SerializeContext, nullptr stops recording.
+        void RecordSnapshot(ReflectionSnapshot* snapshot);
+
     protected:
         struct EntryPoint
         {
@@ -68,6 +87,7 @@ namespace AZ
             StaticReflectionFunctionPtr m_nonTyped = nullptr;
             AZ::TypeId m_typeId = AZ::TypeId::CreateNull();
             ReflectionFunction m_typed;
+            bool m_isDeferred = false; // Not reflected to the SerializeContext yet
 
             EntryPoint(StaticReflectionFunctionPtr staticEntry);
             EntryPoint(AZ::TypeId typeId, const ReflectionFunction& entry);
@@ -84,8 +104,22 @@ namespace AZ
         AZStd::unordered_map<TypeId, EntryPointList::iterator> m_typedEntryPoints;
         AZStd::unordered_map<StaticReflectionFunctionPtr, EntryPointList::iterator> m_nonTypedEntryPoints;
 
+        // Deferred reflection, see SetSnapshot
+        ReflectionSnapshot m_snapshot;
+        AZStd::unordered_map<TypeId, EntryPointList::iterator> m_deferredTypes; // Class reflected by a deferred entry point
+        size_t m_numDeferredEntryPoints = 0;
+        AZStd::recursive_mutex m_deferredMutex;
+        ReflectionSnapshot* m_recordedSnapshot = nullptr;
+
         void AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context);
         ReflectContext* GetReflectContext(AZ::TypeId contextTypeId);
         void RemoveReflectContext(AZ::TypeId contextTypeId);
+
+        void ReflectSerializeContext(EntryPointList::iterator entryIt, ReflectContext* serializeContext);
+        void ResolveDeferredEntryPoint(EntryPointList::iterator entryIt);
+        void RemoveDeferredTypes(EntryPointList::iterator entryIt);
+        bool OnClassDataMiss(const TypeId& classId);
+        void UpdateClassDataMissHandler();
+        void UpdateClassDataMissPending();
     };
 }
@@ -0,0 +1,177 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <AzCore/RTTI/ReflectionSnapshot.h>
+#include <AzCore/IO/SystemFile.h>
+
+namespace AZ
+{
+    namespace
+    {
+        const u32 SnapshotMagic = 0x53525A41; // "AZRS"
+
+        struct SnapshotHeader
+        {
+            u32 m_magic;
+            u32 m_version;
+            u64 m_key;
+            u32 m_numEntryPoints;
+            u32 m_numTypes;
+        };
+
+        void HashBytes(u64& hash, const void* data, size_t size)
+        {
+            // 64 bit FNV-1a, the key must not depend on the platform hash
+            const u8* bytes = reinterpret_cast<const u8*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ull;
+            }
+        }
+    }
+
+    //=========================================================================
+    // ComputeKey
+    //=========================================================================
+    u64 ReflectionSnapshot::ComputeKey(const char* buildId, const AZStd::vector<AZStd::string>& moduleNames)
+    {
+        u64 hash = 0xcbf29ce484222325ull;
+        HashBytes(hash, &Version, sizeof(Version));
+        if (buildId)
+        {
+            HashBytes(hash, buildId, strlen(buildId));
+        }
+        for (const AZStd::string& moduleName : moduleNames)
+        {
+            // hash the terminator too so {"ab", "c"} and {"a", "bc"} differ
+            HashBytes(hash, moduleName.c_str(), moduleName.size() + 1);
+        }
+        return hash;
+    }
+
+    ReflectionSnapshot::ReflectionSnapshot(u64 key)
+        : m_key(key)
+    {
+    }
+
+    void ReflectionSnapshot::Clear()
+    {
+        m_entryPoints.clear();
+    }
+
+    void ReflectionSnapshot::SetEntryPointTypes(const TypeId& entryPoint, AZStd::vector<TypeId> typeIds)
+    {
+        m_entryPoints[entryPoint] = AZStd::move(typeIds);
+    }
+
+    const AZStd::vector<TypeId>* ReflectionSnapshot::GetEntryPointTypes(const TypeId& entryPoint) const
+    {
+        auto entryIt = m_entryPoints.find(entryPoint);
+        return entryIt != m_entryPoints.end() ? &entryIt->second : nullptr;
+    }
+
+    //=========================================================================
+    // Save
+    //=========================================================================
+    bool ReflectionSnapshot::Save(const char* fileName) const
+    {
+        // Layout: header, then per entry point its id and number of types, then all the type ids
+        SnapshotHeader header;
+        header.m_magic = SnapshotMagic;
+        header.m_version = Version;
+        header.m_key = m_key;
+        header.m_numEntryPoints = static_cast<u32>(m_entryPoints.size());
+        header.m_numTypes = 0;
+
+        AZStd::vector<u8> data;
+        data.reserve(sizeof(header) + m_entryPoints.size() * (sizeof(TypeId) + sizeof(u32)));
+        data.insert(data.end(), reinterpret_cast<const u8*>(&header), reinterpret_cast<const u8*>(&header) + sizeof(header));
+        for (const auto& entryPoint : m_entryPoints)
+        {
+            const u32 numTypes = static_cast<u32>(entryPoint.second.size());
+            data.insert(data.end(), reinterpret_cast<const u8*>(&entryPoint.first), reinterpret_cast<const u8*>(&entryPoint.first) + sizeof(TypeId));
+            data.insert(data.end(), reinterpret_cast<const u8*>(&numTypes), reinterpret_cast<const u8*>(&numTypes) + sizeof(numTypes));
+            header.m_numTypes += numTypes;
+        }
+        for (const auto& entryPoint : m_entryPoints)
+        {
+            const u8* types = reinterpret_cast<const u8*>(entryPoint.second.data());
+            data.insert(data.end(), types, types + entryPoint.second.size() * sizeof(TypeId));
+        }
+        memcpy(data.data(), &header, sizeof(header));
+
+        IO::SystemFile file;
+        if (!file.Open(fileName, IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("ReflectionSnapshot", false, "Failed to open reflection snapshot %s for writing.", fileName);
+            return false;
+        }
+        return file.Write(data.data(), data.size()) == data.size();
+    }
+
+    //=========================================================================
+    // Load
+    //=========================================================================
+    bool ReflectionSnapshot::Load(const char* fileName, u64 expectedKey)
+    {
+        Clear();
+        m_key = expectedKey;
+
+        IO::SystemFile file;
+        if (!file.Open(fileName, IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+        AZStd::vector<u8> data(static_cast<size_t>(file.Length()));
+        if (data.size() < sizeof(SnapshotHeader) || file.Read(data.size(), data.data()) != data.size())
+        {
+            return false;
+        }
+
+        SnapshotHeader header;
+        memcpy(&header, data.data(), sizeof(header));
+        if (header.m_magic != SnapshotMagic || header.m_version != Version || header.m_key != expectedKey)
+        {
+            return false;
+        }
+
+        const size_t entryPointSize = sizeof(TypeId) + sizeof(u32);
+        if (data.size() != sizeof(header) + header.m_numEntryPoints * entryPointSize + static_cast<size_t>(header.m_numTypes) * sizeof(TypeId))
+        {
+            AZ_Warning("ReflectionSnapshot", false, "Reflection snapshot %s is corrupt, it will be recorded again.", fileName);
+            return false;
+        }
+
+        const u8* entryPointData = data.data() + sizeof(header);
+        const u8* typeData = entryPointData + header.m_numEntryPoints * entryPointSize;
+        const u8* typeDataEnd = data.data() + data.size();
+        for (u32 i = 0; i < header.m_numEntryPoints; ++i, entryPointData += entryPointSize)
+        {
+            TypeId entryPoint;
+            u32 numTypes;
+            memcpy(&entryPoint, entryPointData, sizeof(TypeId));
+            memcpy(&numTypes, entryPointData + sizeof(TypeId), sizeof(u32));
+            if (static_cast<size_t>(typeDataEnd - typeData) < numTypes * sizeof(TypeId))
+            {
+                AZ_Warning("ReflectionSnapshot", false, "Reflection snapshot %s is corrupt, it will be recorded again.", fileName);
+                Clear();
+                return false;
+            }
+
+            AZStd::vector<TypeId>& types = m_entryPoints[entryPoint];
+            types.resize(numTypes);
+            memcpy(types.data(), typeData, numTypes * sizeof(TypeId));
+            typeData += numTypes * sizeof(TypeId);
+        }
+        return true;
+    }
+}
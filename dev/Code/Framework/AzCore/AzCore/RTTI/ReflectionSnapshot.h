@@ -0,0 +1,61 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    /**
+     * Records the classes every typed reflection entry point (component descriptors, the application...) reflects to the
+     * SerializeContext. A ReflectionManager with a snapshot doesn't reflect those entry points to the SerializeContext when
+     * they are registered, only when one of their classes is first needed, see \ref ReflectionManager::SetSnapshot.
+     *
+     * Class data holds factories, serializers and attributes, which are code, so only the type ids are stored. A snapshot
+     * is only valid for the binaries that recorded it: the key identifies them and Load rejects a snapshot with another key.
+     */
+    class ReflectionSnapshot
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ReflectionSnapshot, SystemAllocator, 0);
+
+        static const u32 Version = 1;
+
+        /// Hashes the build id and the names of the modules loaded, in order.
+        static u64 ComputeKey(const char* buildId, const AZStd::vector<AZStd::string>& moduleNames);
+
+        explicit ReflectionSnapshot(u64 key = 0);
+
+        u64 GetKey() const { return m_key; }
+        bool IsEmpty() const { return m_entryPoints.empty(); }
+        size_t GetNumEntryPoints() const { return m_entryPoints.size(); }
+        void Clear();
+
+        /// Sets the classes an entry point reflects, replacing the ones recorded before.
+        void SetEntryPointTypes(const TypeId& entryPoint, AZStd::vector<TypeId> typeIds);
+        /// Returns the classes recorded for an entry point, nullptr if the entry point isn't in the snapshot.
+        const AZStd::vector<TypeId>* GetEntryPointTypes(const TypeId& entryPoint) const;
+
+        bool Save(const char* fileName) const;
+        /// Returns false, and leaves the snapshot empty, if the file is missing or invalid or has another version or key.
+        bool Load(const char* fileName, u64 expectedKey);
+
+    private:
+        u64 m_key;
+        AZStd::unordered_map<TypeId, AZStd::vector<TypeId>> m_entryPoints;
+    };
+}
@@ -554,6 +554,11 @@ namespace AZ
         cd.m_editData = nullptr;
 
         m_classNameToUuid.emplace(AZ::Crc32(name), typeUuid);
+
+        if (m_classReflectedHandler)
+        {
+            m_classReflectedHandler(typeUuid);
+        }
     }
 
     //=========================================================================
@@ -562,7 +567,13 @@ namespace AZ
     //=========================================================================
     AZStd::vector<AZ::Uuid> SerializeContext::FindClassId(const AZ::Crc32& classNameCrc) const
     {
+        AZStd::unique_lock<AZStd::recursive_mutex> missLock = LockClassDataMisses();
         auto&& findResult = m_classNameToUuid.equal_range(classNameCrc);
+        if (findResult.first == findResult.second && missLock.owns_lock() && m_classDataMissHandler(Uuid::CreateNull()))
+        {
+            // the class may be one that isn't reflected yet, the snapshot only knows ids, reflect them all
+            findResult = m_classNameToUuid.equal_range(classNameCrc);
+        }
         AZStd::vector<AZ::Uuid> retVal;
         for (auto&& currentIter = findResult.first; currentIter != findResult.second; ++currentIter)
         {
@@ -578,6 +589,7 @@ namespace AZ
     const SerializeContext::ClassData*
     SerializeContext::FindClassData(const Uuid& classId, const SerializeContext::ClassData* parent, u32 elementNameCrc) const
     {
+        AZStd::unique_lock<AZStd::recursive_mutex> missLock = LockClassDataMisses();
         SerializeContext::UuidToClassMap::const_iterator it = m_uuidMap.find(classId);
         const SerializeContext::ClassData* cd = it != m_uuidMap.end() ? &it->second : nullptr;
 
@@ -639,6 +651,11 @@ namespace AZ
                     cd = underlyingTypeIter != m_uuidMap.end() ? &underlyingTypeIter->second : nullptr;
                 }
             }
+
+            if (!cd && missLock.owns_lock() && m_classDataMissHandler(classId))
+            {
+                return FindClassData(classId, parent, elementNameCrc);
+            }
         }
 
         return cd;
@@ -703,13 +720,23 @@ namespace AZ
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
                 m_legacySpecializeTypeIdToTypeIdMap.emplace(genericClassInfo->GetLegacySpecializedTypeId(), classId);
+
+                if (m_classReflectedHandler)
+                {
+                    m_classReflectedHandler(classId);
+                }
             }
         }
     }
 
     AZStd::any SerializeContext::CreateAny(const Uuid& classId)
     {
+        AZStd::unique_lock<AZStd::recursive_mutex> missLock = LockClassDataMisses();
         auto anyCreationIt = m_uuidAnyCreationMap.find(classId);
+        if (anyCreationIt == m_uuidAnyCreationMap.end() && missLock.owns_lock() && m_classDataMissHandler(classId))
+        {
+            anyCreationIt = m_uuidAnyCreationMap.find(classId);
+        }
         return anyCreationIt != m_uuidAnyCreationMap.end() ? anyCreationIt->second(this) : AZStd::any();
     }
 
@@ -2436,6 +2463,12 @@ namespace AZ
     //=========================================================================
     void SerializeContext::EnumerateDerived(const TypeInfoCB& callback, const Uuid& classId, const Uuid& typeId)
     {
+        AZStd::unique_lock<AZStd::recursive_mutex> missLock = LockClassDataMisses();
+        if (missLock.owns_lock())
+        {
+            m_classDataMissHandler(Uuid::CreateNull());
+        }
+
         // right now this function is SLOW, traverses all serialized types. If we need faster
         // we will need to cache/store derived type in the base type.
         for (SerializeContext::UuidToClassMap::const_iterator it = m_uuidMap.begin(); it != m_uuidMap.end(); ++it)
@@ -2520,6 +2553,12 @@ namespace AZ
     //=========================================================================
     void SerializeContext::EnumerateAll(const TypeInfoCB& callback, bool includeGenerics) const
     {
+        AZStd::unique_lock<AZStd::recursive_mutex> missLock = LockClassDataMisses();
+        if (missLock.owns_lock())
+        {
+            m_classDataMissHandler(Uuid::CreateNull());
+        }
+
         for (auto& uuidToClassPair : m_uuidMap)
         {
             const ClassData& classData = uuidToClassPair.second;
@@ -2545,6 +2584,54 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // SetClassDataMissHandler
+    //=========================================================================
+    void SerializeContext::SetClassDataMissHandler(const ClassDataMissHandler& handler, AZStd::recursive_mutex* mutex)
+    {
+        m_classDataMissHandler = handler;
+        m_classDataMissMutex = mutex;
+        if (!handler)
+        {
+            m_isClassDataMissPending = false;
+        }
+    }
+
+    //=========================================================================
+    // SetClassDataMissPending
+    //=========================================================================
+    void SerializeContext::SetClassDataMissPending(bool isPending)
+    {
+        m_isClassDataMissPending = isPending && m_classDataMissHandler && m_classDataMissMutex;
+    }
+
+    //=========================================================================
+    // LockClassDataMisses
+    //=========================================================================
+    AZStd::unique_lock<AZStd::recursive_mutex> SerializeContext::LockClassDataMisses() const
+    {
+        if (!m_isClassDataMissPending.load(AZStd::memory_order_acquire))
+        {
+            return AZStd::unique_lock<AZStd::recursive_mutex>();
+        }
+
+        AZStd::unique_lock<AZStd::recursive_mutex> lock(*m_classDataMissMutex);
+        if (!m_isClassDataMissPending.load(AZStd::memory_order_relaxed))
+        {
+            // Another thread reflected the last pending classes while this one waited
+            lock.unlock();
+        }
+        return lock;
+    }
+
+    //=========================================================================
+    // SetClassReflectedHandler
+    //=========================================================================
+    void SerializeContext::SetClassReflectedHandler(const ClassReflectedHandler& handler)
+    {
+        m_classReflectedHandler = handler;
+    }
+
     void SerializeContext::RegisterDataContainer(AZStd::unique_ptr<IDataContainer> dataContainer)
     {
         m_dataContainers.push_back(AZStd::move(dataContainer));
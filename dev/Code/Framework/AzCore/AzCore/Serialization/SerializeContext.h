@@ -35,6 +35,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -301,6 +302,9 @@ namespace AZ
         void EnumerateAll(const TypeInfoCB& callback, bool includeGenerics=false) const;
         // @}
 
+        /// Returns the number of classes reflected so far, unlike EnumerateAll it doesn't reflect the classes deferred by the miss handler.
+        size_t GetNumReflectedClasses() const { return m_uuidMap.size(); }
+
         /// Makes a copy of obj. The behavior is the same as if obj was first serialized out and the copy was then created from the serialized data.
         template<class T>
         T* CloneObject(const T* obj);
@@ -1049,6 +1053,21 @@ namespace AZ
         /// Creates an AZStd::any based on the provided class Uuid, or returns an empty AZStd::any if no class data is found or the class is virtual
         AZStd::any CreateAny(const Uuid& classId);
 
+        /**
+         * Called when FindClassData, FindClassId or CreateAny don't find a class, and with a null id before all classes are enumerated,
+         * so classes can be reflected on demand (see \ref ReflectionManager::SetSnapshot). Returns true if it reflected anything.
+         * Reflecting changes the context, so while classes are pending (see \ref SetClassDataMissPending) the lookups hold mutex,
+         * which the handler must lock as well.
+         */
+        using ClassDataMissHandler = AZStd::function<bool(const Uuid& classId)>;
+        void SetClassDataMissHandler(const ClassDataMissHandler& handler, AZStd::recursive_mutex* mutex = nullptr);
+        /// Set while the miss handler has classes to reflect, lookups don't call it or lock its mutex otherwise.
+        void SetClassDataMissPending(bool isPending);
+
+        /// Called with the id of every class and generic type added to the context, e.g. to record the classes a reflection function reflects.
+        using ClassReflectedHandler = AZStd::function<void(const Uuid& classId)>;
+        void SetClassReflectedHandler(const ClassReflectedHandler& handler);
+
         /// Register GenericClassInfo with the SerializeContext
         using CreateAnyFunc = AZStd::any(*)(SerializeContext*);
         void RegisterGenericClassInfo(const AZ::Uuid& typeId, GenericClassInfo* genericClassInfo, const CreateAnyFunc& createAnyFunc);
@@ -1095,6 +1114,9 @@ namespace AZ
         /// Enumerate function called to enumerate an azrtti hierarchy
         static void EnumerateBaseRTTIEnumCallback(const Uuid& id, void* userData);
 
+        /// Locks the miss handler's mutex while it has classes to reflect, the lookups calling it hold the lock.
+        AZStd::unique_lock<AZStd::recursive_mutex> LockClassDataMisses() const;
+
         /// Remove class data
         void RemoveClassData(ClassData* classData);
         /// Removes the GenericClassInfo from the GenericClassInfoMap
@@ -1330,6 +1352,10 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        ClassDataMissHandler m_classDataMissHandler; ///< Optional, reflects classes that are looked up but not reflected yet
+        AZStd::recursive_mutex* m_classDataMissMutex = nullptr; ///< Held by the lookups while the miss handler has classes to reflect
+        AZStd::atomic_bool m_isClassDataMissPending{ false };
+        ClassReflectedHandler m_classReflectedHandler; ///< Optional, notified of the classes added to the context
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
@@ -1872,6 +1898,11 @@ namespace AZ
 
             AddClassData<T, TBaseClasses...>(&result.first->second);
 
+            if (m_classReflectedHandler)
+            {
+                m_classReflectedHandler(typeUuid);
+            }
+
             return ClassBuilder(this, result.first);
         }
     }
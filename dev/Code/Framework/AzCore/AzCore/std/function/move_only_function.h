@@ -0,0 +1,323 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_constructible.h>
+#include <AzCore/std/typetraits/is_member_pointer.h>
+#include <AzCore/std/typetraits/is_pointer.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /// Default inline capacity, fits a lambda capturing half a dozen pointers, or a bound member function with a few arguments.
+        constexpr size_t small_function_default_capacity = 6 * sizeof(void*);
+        constexpr size_t small_function_alignment = 16;
+
+        template<typename Functor, size_t Capacity>
+        struct small_function_fits_inline
+        {
+            static constexpr bool value = sizeof(Functor) <= Capacity && alignment_of<Functor>::value <= small_function_alignment;
+        };
+
+        /**
+         * Type erased, move only callable shared by move_only_function and inplace_function.
+         * Functors that fit in Capacity bytes are stored inline, larger ones are stored in a block allocated
+         * with the allocator passed to the constructor (only when AllowHeap is true).
+         */
+        template<size_t Capacity, bool AllowHeap, typename R, typename... Args>
+        class small_function_base
+        {
+            static_assert(Capacity >= sizeof(void*), "The inline capacity must at least fit a pointer");
+            typedef small_function_base<Capacity, AllowHeap, R, Args...> this_type;
+
+        public:
+            typedef R result_type;
+
+            small_function_base() = default;
+
+            small_function_base(this_type&& rhs)
+            {
+                MoveFrom(rhs);
+            }
+
+            ~small_function_base()
+            {
+                clear();
+            }
+
+            small_function_base(const this_type&) = delete;
+            this_type& operator=(const this_type&) = delete;
+
+            this_type& operator=(this_type&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    MoveFrom(rhs);
+                }
+                return *this;
+            }
+
+            void swap(this_type& rhs)
+            {
+                this_type temp(AZStd::move(rhs));
+                rhs = AZStd::move(*this);
+                *this = AZStd::move(temp);
+            }
+
+            void clear()
+            {
+                if (m_operations)
+                {
+                    m_operations->m_destroy(&m_storage);
+                    m_operations = nullptr;
+                }
+            }
+
+            bool empty() const              { return m_operations == nullptr; }
+            explicit operator bool() const  { return m_operations != nullptr; }
+
+            /// Returns true when the functor is stored inline, false when it was allocated or when the function is empty.
+            bool is_inline() const          { return m_operations && m_operations->m_isInline; }
+
+            R operator()(Args... args) const
+            {
+                AZ_Assert(m_operations, "Calling an empty function!");
+                return m_operations->m_invoke(&m_storage, AZStd::forward<Args>(args)...);
+            }
+
+        protected:
+            typedef aligned_storage_t<Capacity, small_function_alignment> storage_type;
+
+            struct Operations
+            {
+                R (*m_invoke)(void* storage, Args&&... args);
+                void (*m_move)(void* from, void* to);   ///< Move constructs the functor in to and destroys it in from.
+                void (*m_destroy)(void* storage);
+                bool m_isInline;
+            };
+
+            template<typename Functor>
+            struct InlineOperations
+            {
+                static R Invoke(void* storage, Args&&... args)
+                {
+                    return static_cast<R>(AZStd::invoke(*reinterpret_cast<Functor*>(storage), AZStd::forward<Args>(args)...));
+                }
+                static void Move(void* from, void* to)
+                {
+                    Functor* functor = reinterpret_cast<Functor*>(from);
+                    new(to) Functor(AZStd::move(*functor));
+                    functor->~Functor();
+                }
+                static void Destroy(void* storage)
+                {
+                    reinterpret_cast<Functor*>(storage)->~Functor();
+                }
+                static constexpr Operations s_operations = { &Invoke, &Move, &Destroy, true };
+            };
+
+            template<typename Functor, typename Allocator>
+            struct HeapFunctor
+            {
+                template<typename FunctorArg>
+                HeapFunctor(FunctorArg&& functor, const Allocator& allocator)
+                    : m_functor(AZStd::forward<FunctorArg>(functor))
+                    , m_allocator(allocator)
+                {
+                }
+
+                Functor m_functor;
+                Allocator m_allocator;
+            };
+
+            template<typename Functor, typename Allocator>
+            struct HeapOperations
+            {
+                typedef HeapFunctor<Functor, Allocator> block_type;
+
+                static block_type* Block(void* storage)
+                {
+                    return *reinterpret_cast<block_type**>(storage);
+                }
+                static R Invoke(void* storage, Args&&... args)
+                {
+                    return static_cast<R>(AZStd::invoke(Block(storage)->m_functor, AZStd::forward<Args>(args)...));
+                }
+                static void Move(void* from, void* to)
+                {
+                    *reinterpret_cast<block_type**>(to) = Block(from);
+                }
+                static void Destroy(void* storage)
+                {
+                    block_type* block = Block(storage);
+                    Allocator allocator = block->m_allocator;
+                    block->~block_type();
+                    allocator.deallocate(block, sizeof(block_type), alignment_of<block_type>::value);
+                }
+                static constexpr Operations s_operations = { &Invoke, &Move, &Destroy, false };
+            };
+
+            template<typename Functor, typename Allocator>
+            void Assign(Functor&& functor, const Allocator& allocator)
+            {
+                typedef decay_t<Functor> functor_type;
+                static_assert(is_invocable_r<R, functor_type&, Args...>::value, "The functor can't be called with the arguments of the function signature");
+                static_assert(AllowHeap || small_function_fits_inline<functor_type, Capacity>::value,
+                    "The functor is too large for the inplace_function, increase its capacity");
+
+                if constexpr (is_pointer<functor_type>::value || is_member_pointer<functor_type>::value)
+                {
+                    if (functor == nullptr)
+                    {
+                        return; // null function pointers make an empty function, like with AZStd::function
+                    }
+                }
+
+                if constexpr (small_function_fits_inline<functor_type, Capacity>::value)
+                {
+                    (void)allocator;
+                    new(&m_storage) functor_type(AZStd::forward<Functor>(functor));
+                    m_operations = &InlineOperations<functor_type>::s_operations;
+                }
+                else
+                {
+                    typedef HeapFunctor<functor_type, Allocator> block_type;
+                    Allocator blockAllocator(allocator);
+                    void* memory = blockAllocator.allocate(sizeof(block_type), alignment_of<block_type>::value);
+                    *reinterpret_cast<block_type**>(&m_storage) = new(memory) block_type(AZStd::forward<Functor>(functor), allocator);
+                    m_operations = &HeapOperations<functor_type, Allocator>::s_operations;
+                }
+            }
+
+            void MoveFrom(this_type& rhs)
+            {
+                if (rhs.m_operations)
+                {
+                    rhs.m_operations->m_move(&rhs.m_storage, &m_storage);
+                    m_operations = rhs.m_operations;
+                    rhs.m_operations = nullptr;
+                }
+            }
+
+            mutable storage_type m_storage;
+            const Operations* m_operations = nullptr;
+        };
+
+        template<typename Functor, typename Self>
+        using enable_if_small_function_functor_t = enable_if_t<!is_same<decay_t<Functor>, Self>::value && !is_same<decay_t<Functor>, nullptr_t>::value
+            && is_constructible<decay_t<Functor>, Functor>::value, int>;
+    } // namespace Internal
+
+    /**
+     * Function wrapper for callbacks that are moved around but never copied, like queued events, jobs and completion callbacks.
+     * Unlike AZStd::function the functor doesn't need to be copyable, and functors up to InlineCapacity bytes are stored
+     * in the object itself, larger ones are allocated with the allocator passed to the constructor.
+     */
+    template<typename Signature, size_t InlineCapacity = Internal::small_function_default_capacity>
+    class move_only_function;
+
+    template<typename R, typename... Args, size_t InlineCapacity>
+    class move_only_function<R(Args...), InlineCapacity>
+        : public Internal::small_function_base<InlineCapacity, true, R, Args...>
+    {
+        typedef Internal::small_function_base<InlineCapacity, true, R, Args...> base_type;
+        typedef move_only_function<R(Args...), InlineCapacity> this_type;
+    public:
+        move_only_function() = default;
+        move_only_function(nullptr_t) {}
+        move_only_function(this_type&& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+
+        template<typename Functor, Internal::enable_if_small_function_functor_t<Functor, this_type> = 0>
+        move_only_function(Functor&& functor)
+        {
+            this->Assign(AZStd::forward<Functor>(functor), AZStd::allocator());
+        }
+
+        template<typename Functor, typename Allocator, Internal::enable_if_small_function_functor_t<Functor, this_type> = 0>
+        move_only_function(Functor&& functor, const Allocator& allocator)
+        {
+            this->Assign(AZStd::forward<Functor>(functor), allocator);
+        }
+
+        this_type& operator=(nullptr_t)
+        {
+            this->clear();
+            return *this;
+        }
+
+        template<typename Functor, Internal::enable_if_small_function_functor_t<Functor, this_type> = 0>
+        this_type& operator=(Functor&& functor)
+        {
+            this_type(AZStd::forward<Functor>(functor)).swap(*this);
+            return *this;
+        }
+    };
+
+    /**
+     * Move only function wrapper that never allocates, the functor must fit in Capacity bytes (checked at compile time).
+     */
+    template<typename Signature, size_t Capacity = Internal::small_function_default_capacity>
+    class inplace_function;
+
+    template<typename R, typename... Args, size_t Capacity>
+    class inplace_function<R(Args...), Capacity>
+        : public Internal::small_function_base<Capacity, false, R, Args...>
+    {
+        typedef Internal::small_function_base<Capacity, false, R, Args...> base_type;
+        typedef inplace_function<R(Args...), Capacity> this_type;
+    public:
+        inplace_function() = default;
+        inplace_function(nullptr_t) {}
+        inplace_function(this_type&& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+
+        template<typename Functor, Internal::enable_if_small_function_functor_t<Functor, this_type> = 0>
+        inplace_function(Functor&& functor)
+        {
+            this->Assign(AZStd::forward<Functor>(functor), AZStd::allocator());
+        }
+
+        this_type& operator=(nullptr_t)
+        {
+            this->clear();
+            return *this;
+        }
+
+        template<typename Functor, Internal::enable_if_small_function_functor_t<Functor, this_type> = 0>
+        this_type& operator=(Functor&& functor)
+        {
+            this_type(AZStd::forward<Functor>(functor)).swap(*this);
+            return *this;
+        }
+    };
+
+    template<typename Signature, size_t InlineCapacity>
+    inline void swap(move_only_function<Signature, InlineCapacity>& lhs, move_only_function<Signature, InlineCapacity>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template<typename Signature, size_t Capacity>
+    inline void swap(inplace_function<Signature, Capacity>& lhs, inplace_function<Signature, Capacity>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
@@ -0,0 +1,440 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/epoch_domain.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZStd
+{
+    /**
+     * Concurrent unordered map with lock free lookups, for data that is read a lot more than it is written.
+     * Elements are stored in immutable nodes, referenced from an open addressed table of atomic slots (linear probing).
+     * find() and visit() never lock and only write to the reader count of their epoch_domain shard, so readers don't
+     * contend with each other or with writers. insert(), insert_or_assign() and erase() claim or swap slots with compare
+     * and swap and run concurrently with each other, they only wait when the table is full and has to be rehashed, which
+     * takes an exclusive lock.
+     *
+     * Replaced and erased nodes as well as old tables may still be used by readers, they are retired to the epoch domain
+     * of the map and freed once no reader can reach them anymore. Values are returned by copy, mapped types should be
+     * cheap to copy, and visitors should be short as they hold back reclamation while they run.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class concurrent_flat_unordered_map
+    {
+        typedef concurrent_flat_unordered_map<Key, MappedType, Hasher, EqualKey, Allocator> this_type;
+    public:
+        typedef Key                             key_type;
+        typedef MappedType                      mapped_type;
+        typedef AZStd::pair<Key, MappedType>    value_type;
+        typedef Hasher                          hasher;
+        typedef EqualKey                        key_eq;
+        typedef Allocator                       allocator_type;
+        typedef AZStd::size_t                   size_type;
+
+        explicit concurrent_flat_unordered_map(size_type numElementsHint = 0, const hasher& hash = hasher(),
+            const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+            , m_size(0)
+            , m_epoch(this)
+        {
+            m_table.store(CreateTable(CapacityForSize(numElementsHint)), memory_order_release);
+        }
+
+        ~concurrent_flat_unordered_map()
+        {
+            // the reclaim functions free through the allocator of the map, idle workers must not reach them anymore
+            m_epoch.unregister();
+            m_epoch.reclaim_all();
+            Table* table = m_table.load(memory_order_acquire);
+            DestroyNodes(table);
+            DestroyTable(table);
+        }
+
+        concurrent_flat_unordered_map(const this_type&) = delete;
+        this_type& operator=(const this_type&) = delete;
+
+        /// Returns true if the value was inserted, false if the key was already in the map.
+        bool insert(const value_type& value)
+        {
+            return InsertNode(CreateNode(value.first, value.second), false);
+        }
+
+        /// Returns true if the value was inserted, false if the key was already in the map.
+        bool insert(const key_type& key, const mapped_type& mapped)
+        {
+            return InsertNode(CreateNode(key, mapped), false);
+        }
+
+        /// Inserts the value or replaces the value of the key. Returns true if the value was inserted.
+        bool insert_or_assign(const key_type& key, const mapped_type& mapped)
+        {
+            return InsertNode(CreateNode(key, mapped), true);
+        }
+
+        /// Returns the number of erased elements (0 or 1).
+        size_type erase(const key_type& key)
+        {
+            const size_type hash = m_hasher(key);
+
+            epoch_domain::guard guard(m_epoch);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_rehashMutex);
+            Table* table = m_table.load(memory_order_acquire);
+            for (size_type probe = 0, index = StartIndex(table, hash); probe < table->m_capacity; ++probe, index = (index + 1) & table->m_mask)
+            {
+                atomic<Node*>& slot = table->m_slots[index];
+                Node* current = slot.load(memory_order_acquire);
+                for (;;)
+                {
+                    if (!current)
+                    {
+                        return 0;
+                    }
+                    if (current == Tombstone() || !IsKey(current, hash, key))
+                    {
+                        break;
+                    }
+                    if (slot.compare_exchange_strong(current, Tombstone(), memory_order_acq_rel, memory_order_acquire))
+                    {
+                        m_size.fetch_sub(1, memory_order_relaxed);
+                        RetireNode(current);
+                        return 1;
+                    }
+                    // the slot was erased or assigned in the meantime, look at it again
+                }
+            }
+            return 0;
+        }
+
+        bool find(const key_type& key) const
+        {
+            epoch_domain::guard guard(m_epoch);
+            return FindNode(key) != nullptr;
+        }
+
+        bool find(const key_type& key, mapped_type* mappedOut) const
+        {
+            epoch_domain::guard guard(m_epoch);
+            if (const Node* node = FindNode(key))
+            {
+                *mappedOut = node->m_value.second;
+                return true;
+            }
+            return false;
+        }
+
+        /// Calls the visitor with every element, elements inserted or erased during the visit may or may not be visited.
+        template<class Visitor>
+        void visit(Visitor&& visitor) const
+        {
+            epoch_domain::guard guard(m_epoch);
+            const Table* table = m_table.load(memory_order_acquire);
+            for (size_type index = 0; index < table->m_capacity; ++index)
+            {
+                const Node* node = table->m_slots[index].load(memory_order_acquire);
+                if (node && node != Tombstone())
+                {
+                    visitor(node->m_value);
+                }
+            }
+        }
+
+        size_type size() const  { return m_size.load(memory_order_acquire); }
+        bool empty() const      { return size() == 0; }
+
+        /// Erases all elements and frees all memory not in use. Not thread safe.
+        void clear()
+        {
+            Table* table = m_table.load(memory_order_acquire);
+            DestroyNodes(table);
+            DestroyTable(table);
+            m_table.store(CreateTable(CapacityForSize(0)), memory_order_release);
+            m_size.store(0, memory_order_release);
+            m_epoch.reclaim_all();
+        }
+
+        /// Frees the replaced and erased nodes and old tables no reader can use anymore. Thread safe, writers also
+        /// free them as they go, this is only needed to release memory early (e.g. at the end of a frame).
+        void reclaim()
+        {
+            m_epoch.reclaim();
+        }
+
+    private:
+        struct Node
+            : public epoch_retired
+        {
+            Node(size_type hash, const key_type& key, const mapped_type& mapped)
+                : m_value(key, mapped)
+                , m_hash(hash)
+            {
+            }
+
+            value_type m_value;
+            size_type m_hash;
+        };
+
+        struct Table
+            : public epoch_retired
+        {
+            atomic<Node*>* m_slots;
+            size_type m_capacity;       ///< Always a power of 2.
+            size_type m_mask;
+            size_type m_maxUsed;        ///< The table is rehashed when more slots are used, erased slots count as used.
+            unsigned int m_shift;       ///< Shift applied to the scrambled hash to get the first slot to probe.
+            atomic<size_type> m_used;
+        };
+
+        enum class InsertResult
+        {
+            Inserted,
+            Assigned,
+            Found,
+            Full
+        };
+
+        static const size_type s_minCapacity = 16;
+
+        /// Marks erased slots, erased slots are never reused so concurrent inserts of the same key always meet.
+        static Node* Tombstone() { return reinterpret_cast<Node*>(static_cast<size_t>(1)); }
+
+        static size_type CapacityForSize(size_type size)
+        {
+            // keep the table at most half full after a rehash
+            size_type capacity = s_minCapacity;
+            while (capacity < size * 2)
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+        static size_type StartIndex(const Table* table, size_type hash)
+        {
+            // fibonacci hashing scrambles hashes with few meaningful low bits, like pointers
+            return static_cast<size_type>((static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull) >> table->m_shift);
+        }
+
+        bool IsKey(const Node* node, size_type hash, const key_type& key) const
+        {
+            return node->m_hash == hash && m_keyEqual(node->m_value.first, key);
+        }
+
+        const Node* FindNode(const key_type& key) const
+        {
+            const size_type hash = m_hasher(key);
+            const Table* table = m_table.load(memory_order_acquire);
+            for (size_type probe = 0, index = StartIndex(table, hash); probe < table->m_capacity; ++probe, index = (index + 1) & table->m_mask)
+            {
+                const Node* node = table->m_slots[index].load(memory_order_acquire);
+                if (!node)
+                {
+                    return nullptr;
+                }
+                if (node != Tombstone() && IsKey(node, hash, key))
+                {
+                    return node;
+                }
+            }
+            return nullptr;
+        }
+
+        bool InsertNode(Node* node, bool assign)
+        {
+            epoch_domain::guard guard(m_epoch);
+            for (;;)
+            {
+                Table* table;
+                {
+                    AZStd::shared_lock<AZStd::shared_mutex> lock(m_rehashMutex);
+                    table = m_table.load(memory_order_acquire);
+                    Node* replaced = nullptr;
+                    switch (TryInsert(table, node, assign, replaced))
+                    {
+                    case InsertResult::Inserted:
+                        m_size.fetch_add(1, memory_order_relaxed);
+                        return true;
+                    case InsertResult::Assigned:
+                        RetireNode(replaced);
+                        return false;
+                    case InsertResult::Found:
+                        DestroyNode(node);
+                        return false;
+                    case InsertResult::Full:
+                        break;
+                    }
+                }
+                Rehash(table);
+            }
+        }
+
+        InsertResult TryInsert(Table* table, Node* node, bool assign, Node*& replaced)
+        {
+            for (size_type probe = 0, index = StartIndex(table, node->m_hash); probe < table->m_capacity; ++probe, index = (index + 1) & table->m_mask)
+            {
+                atomic<Node*>& slot = table->m_slots[index];
+                Node* current = slot.load(memory_order_acquire);
+                for (;;)
+                {
+                    if (!current)
+                    {
+                        if (table->m_used.fetch_add(1, memory_order_relaxed) >= table->m_maxUsed)
+                        {
+                            table->m_used.fetch_sub(1, memory_order_relaxed);
+                            return InsertResult::Full;
+                        }
+                        if (slot.compare_exchange_strong(current, node, memory_order_acq_rel, memory_order_acquire))
+                        {
+                            return InsertResult::Inserted;
+                        }
+                        // another thread claimed the slot first, it may have inserted the same key
+                        table->m_used.fetch_sub(1, memory_order_relaxed);
+                        continue;
+                    }
+                    if (current == Tombstone() || !IsKey(current, node->m_hash, node->m_value.first))
+                    {
+                        break;
+                    }
+                    if (!assign)
+                    {
+                        return InsertResult::Found;
+                    }
+                    if (slot.compare_exchange_strong(current, node, memory_order_acq_rel, memory_order_acquire))
+                    {
+                        replaced = current;
+                        return InsertResult::Assigned;
+                    }
+                    // the slot was erased or assigned in the meantime, look at it again
+                }
+            }
+            return InsertResult::Full;
+        }
+
+        void Rehash(Table* fullTable)
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_rehashMutex);
+            if (m_table.load(memory_order_acquire) != fullTable)
+            {
+                return; // another thread already rehashed
+            }
+
+            // when most used slots are erased the table is rehashed at the same size to get rid of them
+            const size_type size = m_size.load(memory_order_acquire);
+            Table* table = CreateTable(AZStd::GetMax(CapacityForSize(size + 1), size * 2 >= fullTable->m_maxUsed ? fullTable->m_capacity * 2 : fullTable->m_capacity));
+            for (size_type oldIndex = 0; oldIndex < fullTable->m_capacity; ++oldIndex)
+            {
+                Node* node = fullTable->m_slots[oldIndex].load(memory_order_acquire);
+                if (!node || node == Tombstone())
+                {
+                    continue;
+                }
+                size_type index = StartIndex(table, node->m_hash);
+                while (table->m_slots[index].load(memory_order_relaxed))
+                {
+                    index = (index + 1) & table->m_mask;
+                }
+                table->m_slots[index].store(node, memory_order_relaxed);
+                table->m_used.fetch_add(1, memory_order_relaxed);
+            }
+
+            // readers that still look at the old table see the elements as they were before the rehash
+            m_table.store(table, memory_order_release);
+            RetireTable(fullTable);
+        }
+
+        Node* CreateNode(const key_type& key, const mapped_type& mapped)
+        {
+            Node* node = static_cast<Node*>(m_allocator.allocate(sizeof(Node), alignment_of<Node>::value));
+            return new(node) Node(m_hasher(key), key, mapped);
+        }
+
+        void DestroyNode(Node* node)
+        {
+            node->~Node();
+            m_allocator.deallocate(node, sizeof(Node), alignment_of<Node>::value);
+        }
+
+        void RetireNode(Node* node)
+        {
+            m_epoch.retire(node, [](epoch_retired* retired, void* map)
+            {
+                static_cast<this_type*>(map)->DestroyNode(static_cast<Node*>(retired));
+            });
+        }
+
+        Table* CreateTable(size_type capacity)
+        {
+            Table* table = new(m_allocator.allocate(sizeof(Table), alignment_of<Table>::value)) Table;
+            table->m_slots = static_cast<atomic<Node*>*>(m_allocator.allocate(sizeof(atomic<Node*>) * capacity, alignment_of<atomic<Node*>>::value));
+            for (size_type index = 0; index < capacity; ++index)
+            {
+                new(&table->m_slots[index]) atomic<Node*>(nullptr);
+            }
+            table->m_capacity = capacity;
+            table->m_mask = capacity - 1;
+            table->m_maxUsed = capacity - capacity / 4;
+            table->m_shift = 64;
+            for (size_type bits = capacity; bits > 1; bits >>= 1)
+            {
+                --table->m_shift;
+            }
+            table->m_used.store(0, memory_order_relaxed);
+            return table;
+        }
+
+        void DestroyTable(Table* table)
+        {
+            m_allocator.deallocate(table->m_slots, sizeof(atomic<Node*>) * table->m_capacity, alignment_of<atomic<Node*>>::value);
+            table->~Table();
+            m_allocator.deallocate(table, sizeof(Table), alignment_of<Table>::value);
+        }
+
+        void RetireTable(Table* table)
+        {
+            m_epoch.retire(table, [](epoch_retired* retired, void* map)
+            {
+                static_cast<this_type*>(map)->DestroyTable(static_cast<Table*>(retired));
+            });
+        }
+
+        void DestroyNodes(Table* table)
+        {
+            for (size_type index = 0; index < table->m_capacity; ++index)
+            {
+                Node* node = table->m_slots[index].load(memory_order_acquire);
+                if (node && node != Tombstone())
+                {
+                    DestroyNode(node);
+                }
+            }
+        }
+
+        hasher m_hasher;
+        key_eq m_keyEqual;
+        allocator_type m_allocator;
+        atomic<Table*> m_table;
+        atomic<size_type> m_size;
+        AZStd::shared_mutex m_rehashMutex;  ///< Shared by writers, exclusive while rehashing.
+        mutable epoch_domain m_epoch;       ///< Replaced and erased nodes and old tables are retired to it.
+    };
+} // namespace AZStd
@@ -13,88 +13,174 @@
 #define AZSTD_PARALLEL_CONTAINERS_CONCURRENT_VECTOR_H 1
 
 #include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/alignment_of.h>
 
 namespace AZStd
 {
     /**
-     * This container is lock free, provides indexed access and is dynamically resizable.
-     * It will not free up memory unless clear() is explicitly called.
+     * Segmented vector that can be pushed to and read from concurrently.
+     * Elements are stored in chunks, each twice the size of the previous one. Chunks are never moved or freed
+     * while the vector is alive, so references and pointers to elements stay valid as the vector grows.
      *
-     * WARNING 1: concurrent_vector IS NOT THREADSAFE!
-     * The size of the vector is changed atomically, and memory allocations are atomic, but
-     * elements are not pushed onto the list atomically when the size changes. If you just
-     * want a list that dynamically grows, doesn't free up and reallocate existing pointers,
-     * and can be read from in a thread-safe way, then use this.
-     * Otherwise, use something else (like an AZStd::list with a mutex).
+     * push_back/emplace_back are lock free and can be called from any number of threads. A slot is claimed with a
+     * single atomic increment and the element is constructed in place. size() only counts elements below the first
+     * slot still being constructed, so every element below size() can be read from any thread without locking.
+     * A push that completes after later ones advances size() past them, nobody waits for anybody.
+     * The index returned by push_back can be used right away, even while it is still above size().
      *
-     * WARNING 2: constructors and destructors on elements created by this will
-     * not be called. Best to use with structs and simple data types (ints, floats, etc)
+     * Modifying an element that other threads are reading, clear() and resize() are NOT thread safe.
      */
     template<typename T, typename Allocator = AZStd::allocator,
         unsigned int INITIAL_CAPACITY_LOG = 5, unsigned int MAX_CAPACITY_LOG = 32>
     class concurrent_vector
     {
+        typedef concurrent_vector<T, Allocator, INITIAL_CAPACITY_LOG, MAX_CAPACITY_LOG> this_type;
     public:
+        typedef T                   value_type;
+        typedef T&                  reference;
+        typedef const T&            const_reference;
+        typedef unsigned int        size_type;
+        typedef Allocator           allocator_type;
+
         concurrent_vector()
         {
             m_size.store(0, memory_order_release);
+            m_reservedSize.store(0, memory_order_release);
             for (unsigned int i = 0; i < MAX_NUM_CHUNKS; ++i)
             {
-                m_chunks[i].store(NULL, memory_order_release);
+                m_chunks[i].store(nullptr, memory_order_release);
             }
         }
 
         ~concurrent_vector()
         {
+            clear();
             for (unsigned int i = 0; i < MAX_NUM_CHUNKS; ++i)
             {
-                T* chunk = m_chunks[i].load(memory_order_acquire);
+                Slot* chunk = m_chunks[i].load(memory_order_acquire);
                 if (chunk)
                 {
                     unsigned int chunkSize = GetChunkSize(i);
-                    m_alloc.deallocate(chunk, chunkSize * sizeof(T), alignment_of<T>::value);
+                    m_alloc.deallocate(chunk, chunkSize * sizeof(Slot), alignment_of<Slot>::value);
                 }
             }
         }
 
-        const T& operator[](unsigned int i) const
+        const T& operator[](size_type i) const
         {
-            return (*const_cast<concurrent_vector<T, Allocator, INITIAL_CAPACITY_LOG, MAX_CAPACITY_LOG>*>(this))[i];
+            return const_cast<this_type&>(*this)[i];
         }
 
-        T& operator[](unsigned int i)
+        T& operator[](size_type i)
         {
-            AZ_Assert(i < m_size, ("Index out of range"));
-            unsigned int chunkIndex = GetChunkForIndex(i);
-            unsigned int chunkSize = GetChunkSize(chunkIndex);
-            T* chunk = GetChunk(chunkIndex);
-            return chunk[i & (chunkSize - 1)];
+            AZ_Assert(i < m_reservedSize.load(memory_order_acquire) && GetSlot(i).m_isConstructed.load(memory_order_acquire),
+                ("Index out of range or element still being constructed"));
+            return GetSlot(i).Value();
         }
 
         ///Returns index of element that was added
-        unsigned int push_back(const T& v)
+        size_type push_back(const T& v)
         {
-            unsigned int index = m_size.fetch_add(1, memory_order_acq_rel);
-            (*this)[index] = v;
-            return index;
+            return ConstructBack(v);
+        }
+
+        ///Returns index of element that was added
+        size_type push_back(T&& v)
+        {
+            return ConstructBack(AZStd::move(v));
+        }
+
+        ///Returns the element that was added, the reference stays valid until the element is destroyed
+        template<class ... Args>
+        T& emplace_back(Args&& ... args)
+        {
+            return GetSlot(ConstructBack(AZStd::forward<Args>(args) ...)).Value();
         }
 
         bool empty() const        { return (m_size.load(memory_order_acquire) == 0); }
 
-        unsigned int size() const { return m_size.load(memory_order_acquire); }
+        size_type size() const    { return m_size.load(memory_order_acquire); }
 
+        ///Destroys all elements, the memory of the chunks is kept for reuse. Not thread safe.
         void clear()
         {
-            m_size.store(0, memory_order_release);
+            DestroyFrom(0);
         }
 
-        void resize(unsigned int newSize)
+        ///Destroys the elements past newSize or default constructs the missing ones. Not thread safe.
+        void resize(size_type newSize)
         {
-            m_size.store(newSize, memory_order_release);
+            const size_type oldSize = DestroyFrom(newSize);
+            for (size_type i = oldSize; i < newSize; ++i)
+            {
+                Slot& slot = GetSlot(i);
+                Internal::construct<T*>::single(&slot.Value());
+                slot.m_isConstructed.store(true, memory_order_relaxed);
+            }
+            if (newSize > oldSize)
+            {
+                m_reservedSize.store(newSize, memory_order_release);
+                m_size.store(newSize, memory_order_release);
+            }
         }
 
     private:
+        struct Slot
+        {
+            T& Value() { return *reinterpret_cast<T*>(&m_storage); }
+
+            typename aligned_storage<sizeof(T), alignment_of<T>::value>::type m_storage;
+            atomic<bool> m_isConstructed;
+        };
+
+        template<class ... Args>
+        size_type ConstructBack(Args&& ... args)
+        {
+            const size_type index = m_reservedSize.fetch_add(1, memory_order_relaxed);
+            Slot& slot = GetSlot(index);
+            Internal::construct<T*>::single(&slot.Value(), AZStd::forward<Args>(args) ...);
+            slot.m_isConstructed.store(true, memory_order_seq_cst);
+
+            // advance the size over every constructed element, including the ones pushed after this one that
+            // completed first. If an earlier element is still being constructed, its push advances the size later.
+            size_type size = m_size.load(memory_order_seq_cst);
+            while (size < m_reservedSize.load(memory_order_acquire) && GetSlot(size).m_isConstructed.load(memory_order_seq_cst))
+            {
+                m_size.compare_exchange_weak(size, size + 1, memory_order_seq_cst);
+            }
+            return index;
+        }
+
+        ///Destroys the elements past newSize and returns the previous size.
+        size_type DestroyFrom(size_type newSize)
+        {
+            const size_type oldSize = m_size.load(memory_order_acquire);
+            AZ_Assert(oldSize == m_reservedSize.load(memory_order_acquire), ("Vector resized while elements are being pushed"));
+            for (size_type i = newSize; i < oldSize; ++i)
+            {
+                Slot& slot = GetSlot(i);
+                Internal::destroy<T*>::single(&slot.Value());
+                slot.m_isConstructed.store(false, memory_order_relaxed);
+            }
+            if (newSize < oldSize)
+            {
+                m_reservedSize.store(newSize, memory_order_release);
+                m_size.store(newSize, memory_order_release);
+            }
+            return oldSize;
+        }
+
+        Slot& GetSlot(size_type index)
+        {
+            unsigned int chunkIndex = GetChunkForIndex(index);
+            unsigned int chunkSize = GetChunkSize(chunkIndex);
+            Slot* chunk = GetChunk(chunkIndex);
+            return chunk[index & (chunkSize - 1)];
+        }
+
         unsigned int GetChunkForIndex(unsigned int index) const
         {
             //find highest set bit in the bucket index
@@ -125,9 +211,9 @@ namespace AZStd
             }
         }
 
-        T* GetChunk(unsigned int chunkIndex)
+        Slot* GetChunk(unsigned int chunkIndex)
         {
-            T* chunk = m_chunks[chunkIndex].load(memory_order_acquire);
+            Slot* chunk = m_chunks[chunkIndex].load(memory_order_acquire);
             if (!chunk)
             {
                 return AllocateChunk(chunkIndex);
@@ -135,25 +221,30 @@ namespace AZStd
             return chunk;
         }
 
-        T* AllocateChunk(unsigned int chunkIndex)
+        Slot* AllocateChunk(unsigned int chunkIndex)
         {
             //allocate a new chunk, and attempt to assign it atomically with a compareAndSwap
             unsigned int chunkSize = GetChunkSize(chunkIndex);
-            T* newChunk = static_cast<T*>(m_alloc.allocate(chunkSize * sizeof(T), alignment_of<T>::value));
-            T* oldChunk = NULL;
+            Slot* newChunk = static_cast<Slot*>(m_alloc.allocate(chunkSize * sizeof(Slot), alignment_of<Slot>::value));
+            for (unsigned int i = 0; i < chunkSize; ++i)
+            {
+                new(&newChunk[i].m_isConstructed) atomic<bool>(false);
+            }
+            Slot* oldChunk = nullptr;
             if (!m_chunks[chunkIndex].compare_exchange_strong(oldChunk, newChunk, memory_order_acq_rel, memory_order_acquire))
             {
                 //somebody beat us to it, that's ok, use their chunk and free our attempted allocation
-                m_alloc.deallocate(newChunk, chunkSize * sizeof(T), alignment_of<T>::value);
+                m_alloc.deallocate(newChunk, chunkSize * sizeof(Slot), alignment_of<Slot>::value);
                 return oldChunk;
             }
             return newChunk;
         }
 
         static const unsigned int MAX_NUM_CHUNKS = MAX_CAPACITY_LOG - (INITIAL_CAPACITY_LOG - 1);
-        atomic<T*> m_chunks[MAX_NUM_CHUNKS];
+        atomic<Slot*> m_chunks[MAX_NUM_CHUNKS];
 
-        atomic<unsigned int> m_size;
+        atomic<size_type> m_size;          ///< Number of elements before the first one still being constructed.
+        atomic<size_type> m_reservedSize;  ///< Number of slots claimed by push_back.
         Allocator m_alloc;
     };
 }
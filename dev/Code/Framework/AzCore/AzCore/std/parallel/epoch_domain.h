@@ -0,0 +1,334 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+
+namespace AZStd
+{
+    /**
+     * Intrusive hook for objects retired to an epoch_domain, lock free structures derive their nodes from it.
+     */
+    struct epoch_retired
+    {
+        typedef void (*reclaim_function)(epoch_retired* retired, void* userData);
+
+        epoch_retired*      m_nextRetired = nullptr;
+        reclaim_function    m_reclaim = nullptr;
+    };
+
+    /**
+     * Epoch based memory reclamation for lock free structures.
+     * Readers wrap every access to shared nodes in an epoch_domain::guard. Writers unlink a node so no new reader can
+     * reach it and then retire() it, the node is reclaimed once every guard that could have seen it has been released.
+     *
+     * Threads don't register with the domain, any thread (AZStd::thread, job workers or native threads) can take a guard.
+     * Each thread is assigned a shard of the domain that holds its reader counts and its retire lists, so threads only
+     * share cache lines when there are more threads than shards. Retired objects are reclaimed by the thread that retires
+     * them once its retire list grows large enough, by reclaim(), and by the job manager workers before they go to sleep.
+     *
+     * Guards are cheap and may be nested but should be short lived, a guard that is held prevents all reclamation.
+     */
+    class epoch_domain
+    {
+        struct Shard;
+    public:
+        /// Read side critical section, retired objects can't be reclaimed while it is alive.
+        class guard
+        {
+        public:
+            explicit guard(epoch_domain& domain)
+                : m_readers(domain.Enter())
+            {
+            }
+
+            ~guard()
+            {
+                m_readers->fetch_sub(1, memory_order_release);
+            }
+
+            guard(const guard&) = delete;
+            guard& operator=(const guard&) = delete;
+
+        private:
+            atomic<unsigned int>* m_readers;
+        };
+
+        /// @param userData Passed to the reclaim functions of the retired objects, e.g. the structure that owns them.
+        explicit epoch_domain(void* userData = nullptr)
+            : m_userData(userData)
+            , m_epoch(0)
+            , m_nextRegistered(nullptr)
+            , m_isRegistered(true)
+        {
+            for (unsigned int index = 0; index < s_numShards; ++index)
+            {
+                Shard& shard = m_shards[index];
+                shard.m_readers[0].store(0, memory_order_relaxed);
+                shard.m_readers[1].store(0, memory_order_relaxed);
+                for (unsigned int bag = 0; bag < s_numBags; ++bag)
+                {
+                    shard.m_retired[bag] = nullptr;
+                    shard.m_retiredEpoch[bag] = 0;
+                }
+                shard.m_retiredCount = 0;
+            }
+
+            AZStd::lock_guard<AZStd::spin_mutex> lock(GetRegistryMutex());
+            m_nextRegistered = GetRegistry();
+            GetRegistry() = this;
+        }
+
+        /// Reclaims all retired objects, no guard may be alive.
+        ~epoch_domain()
+        {
+            unregister();
+            reclaim_all();
+        }
+
+        epoch_domain(const epoch_domain&) = delete;
+        epoch_domain& operator=(const epoch_domain&) = delete;
+
+        /// Retires an object that has been unlinked from the structure, reclaim is called once no reader can use it.
+        void retire(epoch_retired* retired, epoch_retired::reclaim_function reclaim)
+        {
+            retired->m_reclaim = reclaim;
+
+            // the object is already unlinked, any reader that enters a later epoch can't find it
+            atomic_thread_fence(memory_order_seq_cst);
+            const size_t epoch = m_epoch.load(memory_order_acquire);
+
+            Shard& shard = GetShard();
+            epoch_retired* expired = nullptr;
+            bool isReclaimDue;
+            {
+                AZStd::lock_guard<AZStd::spin_mutex> lock(shard.m_retiredMutex);
+                const unsigned int bag = static_cast<unsigned int>(epoch % s_numBags);
+                if (shard.m_retiredEpoch[bag] < epoch)
+                {
+                    // the bag holds objects from 3 or more epochs ago, they can be reclaimed. When another thread of
+                    // the shard already moved the bag to a later epoch the object is kept with it, a bit longer than needed
+                    expired = TakeBag(shard, bag);
+                    shard.m_retiredEpoch[bag] = epoch;
+                }
+                retired->m_nextRetired = shard.m_retired[bag];
+                shard.m_retired[bag] = retired;
+                isReclaimDue = ++shard.m_retiredCount >= s_reclaimThreshold;
+            }
+            Reclaim(expired);
+
+            if (isReclaimDue)
+            {
+                TryAdvance();
+                ReclaimShard(shard);
+            }
+        }
+
+        /// Reclaims the retired objects no reader can use anymore. Thread safe.
+        /// When no guard is alive, all objects retired before the call are reclaimed.
+        void reclaim()
+        {
+            // objects need the epoch to advance twice past the epoch they were retired in
+            TryAdvance();
+            TryAdvance();
+            for (unsigned int index = 0; index < s_numShards; ++index)
+            {
+                ReclaimShard(m_shards[index]);
+            }
+        }
+
+        /// Reclaims all retired objects, no guard may be alive. Idle job manager workers may still reclaim the domain
+        /// concurrently, unless it was unregistered.
+        void reclaim_all()
+        {
+            for (unsigned int index = 0; index < s_numShards; ++index)
+            {
+                Shard& shard = m_shards[index];
+                AZ_Assert(shard.m_readers[0].load(memory_order_acquire) == 0 && shard.m_readers[1].load(memory_order_acquire) == 0,
+                    "Retired objects can't be reclaimed while a guard is alive!");
+                for (unsigned int bag = 0; bag < s_numBags; ++bag)
+                {
+                    epoch_retired* retired;
+                    {
+                        AZStd::lock_guard<AZStd::spin_mutex> lock(shard.m_retiredMutex);
+                        retired = TakeBag(shard, bag);
+                    }
+                    Reclaim(retired);
+                }
+            }
+        }
+
+        /// Removes the domain from reclaim_registered_domains(), waiting for a worker that is reclaiming it.
+        /// Owners whose reclaim functions use their own members call it first thing in their destructor, so no worker
+        /// reclaims the domain of a partly destroyed owner. Called by the destructor, does nothing when called again.
+        void unregister()
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(GetRegistryMutex());
+            if (!m_isRegistered)
+            {
+                return;
+            }
+            epoch_domain** link = &GetRegistry();
+            while (*link != this)
+            {
+                link = &(*link)->m_nextRegistered;
+            }
+            *link = m_nextRegistered;
+            m_nextRegistered = nullptr;
+            m_isRegistered = false;
+        }
+
+        /// Calls reclaim() on every domain of this module, job manager workers call it before they go to sleep.
+        /// Does nothing when another thread is already doing it. Reclaim functions must not create or destroy domains.
+        static void reclaim_registered_domains()
+        {
+            if (!GetRegistryMutex().try_lock())
+            {
+                return;
+            }
+            AZStd::lock_guard<AZStd::spin_mutex> lock(GetRegistryMutex(), AZStd::adopt_lock_t());
+            for (epoch_domain* domain = GetRegistry(); domain; domain = domain->m_nextRegistered)
+            {
+                domain->reclaim();
+            }
+        }
+
+    private:
+        static const unsigned int s_numShards = 32;
+        static const unsigned int s_numBags = 3;
+        static const size_t s_reclaimThreshold = 64;
+
+        struct Shard
+        {
+            atomic<unsigned int> m_readers[2];      ///< Guards alive in even and odd epochs.
+            AZStd::spin_mutex m_retiredMutex;
+            epoch_retired* m_retired[s_numBags];    ///< Retire lists of the last 3 epochs.
+            size_t m_retiredEpoch[s_numBags];
+            size_t m_retiredCount;
+            char m_padding[64];                     ///< Keeps the reader counts of the shards on different cache lines.
+        };
+
+        atomic<unsigned int>* Enter()
+        {
+            Shard& shard = GetShard();
+            for (;;)
+            {
+                const size_t epoch = m_epoch.load(memory_order_relaxed);
+                atomic<unsigned int>& readers = shard.m_readers[epoch & 1];
+                readers.fetch_add(1, memory_order_relaxed);
+                atomic_thread_fence(memory_order_seq_cst);
+                // if the epoch moved on, TryAdvance() may have missed us, count ourselves in the new epoch instead
+                if (m_epoch.load(memory_order_relaxed) == epoch)
+                {
+                    return &readers;
+                }
+                readers.fetch_sub(1, memory_order_release);
+            }
+        }
+
+        /// Moves to the next epoch when no guard is alive in the previous one, the guards of the current epoch may
+        /// still reach objects retired in the previous one.
+        void TryAdvance()
+        {
+            size_t epoch = m_epoch.load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            const unsigned int previous = static_cast<unsigned int>((epoch + 1) & 1);
+            for (unsigned int index = 0; index < s_numShards; ++index)
+            {
+                // acquire the accesses of the guards released in the previous epoch before the objects they used are reclaimed
+                if (m_shards[index].m_readers[previous].load(memory_order_acquire) != 0)
+                {
+                    return;
+                }
+            }
+            m_epoch.compare_exchange_strong(epoch, epoch + 1, memory_order_acq_rel, memory_order_relaxed);
+        }
+
+        void ReclaimShard(Shard& shard)
+        {
+            const size_t epoch = m_epoch.load(memory_order_acquire);
+            epoch_retired* expired = nullptr;
+            {
+                AZStd::lock_guard<AZStd::spin_mutex> lock(shard.m_retiredMutex);
+                for (unsigned int bag = 0; bag < s_numBags; ++bag)
+                {
+                    if (shard.m_retired[bag] && shard.m_retiredEpoch[bag] + 2 <= epoch)
+                    {
+                        epoch_retired* retired = TakeBag(shard, bag);
+                        epoch_retired* last = retired;
+                        while (last->m_nextRetired)
+                        {
+                            last = last->m_nextRetired;
+                        }
+                        last->m_nextRetired = expired;
+                        expired = retired;
+                    }
+                }
+            }
+            Reclaim(expired);
+        }
+
+        /// Detaches a retire list from its shard, the shard mutex must be held.
+        static epoch_retired* TakeBag(Shard& shard, unsigned int bag)
+        {
+            epoch_retired* retired = shard.m_retired[bag];
+            shard.m_retired[bag] = nullptr;
+            for (epoch_retired* counted = retired; counted; counted = counted->m_nextRetired)
+            {
+                --shard.m_retiredCount;
+            }
+            return retired;
+        }
+
+        void Reclaim(epoch_retired* retired)
+        {
+            while (retired)
+            {
+                epoch_retired* next = retired->m_nextRetired;
+                retired->m_reclaim(retired, m_userData);
+                retired = next;
+            }
+        }
+
+        Shard& GetShard()
+        {
+            // threads are spread over the shards round robin, a thread always uses the same shard
+            static AZStd::atomic<unsigned int> s_nextShard(0);
+            static AZ_THREAD_LOCAL unsigned int s_shard = 0;
+            if (s_shard == 0)
+            {
+                s_shard = s_nextShard.fetch_add(1, memory_order_relaxed) % s_numShards + 1;
+            }
+            return m_shards[s_shard - 1];
+        }
+
+        static epoch_domain*& GetRegistry()
+        {
+            static epoch_domain* s_registry = nullptr;
+            return s_registry;
+        }
+
+        static AZStd::spin_mutex& GetRegistryMutex()
+        {
+            static AZStd::spin_mutex s_registryMutex;
+            return s_registryMutex;
+        }
+
+        Shard m_shards[s_numShards];
+        void* m_userData;
+        atomic<size_t> m_epoch;
+        epoch_domain* m_nextRegistered;     ///< Next domain of this module, for reclaim_registered_domains().
+        bool m_isRegistered;                ///< Protected by the registry mutex.
+    };
+} // namespace AZStd
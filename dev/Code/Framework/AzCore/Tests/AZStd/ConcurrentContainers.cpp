@@ -14,6 +14,7 @@
 
 #include <AzCore/std/parallel/containers/concurrent_fixed_unordered_set.h>
 #include <AzCore/std/parallel/containers/concurrent_fixed_unordered_map.h>
+#include <AzCore/std/parallel/containers/concurrent_flat_unordered_map.h>
 #include <AzCore/std/parallel/containers/concurrent_unordered_map.h>
 #include <AzCore/std/parallel/containers/concurrent_unordered_set.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
@@ -21,6 +22,12 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 using namespace AZStd;
 using namespace UnitTestInternal;
 
@@ -713,4 +720,547 @@ namespace UnitTest
     {
         run();
     }
+
+    struct ConcurrentVectorCountedElement
+    {
+        ConcurrentVectorCountedElement(int value)
+            : m_value(value)
+            , m_check(~value)
+        {
+            ++s_constructed;
+        }
+        ConcurrentVectorCountedElement(const ConcurrentVectorCountedElement& rhs)
+            : m_value(rhs.m_value)
+            , m_check(rhs.m_check)
+        {
+            ++s_constructed;
+        }
+        ~ConcurrentVectorCountedElement()
+        {
+            ++s_destroyed;
+        }
+
+        int m_value;
+        int m_check; ///< Complement of the value, to detect elements read before they are constructed.
+
+        static atomic<int> s_constructed;
+        static atomic<int> s_destroyed;
+    };
+
+    atomic<int> ConcurrentVectorCountedElement::s_constructed;
+    atomic<int> ConcurrentVectorCountedElement::s_destroyed;
+
+    TEST_F(ConcurrentVectorTest, Elements_ConstructedAndDestroyedOnce)
+    {
+        ConcurrentVectorCountedElement::s_constructed = 0;
+        ConcurrentVectorCountedElement::s_destroyed = 0;
+        {
+            concurrent_vector<ConcurrentVectorCountedElement> vector;
+            for (int i = 0; i < 100; ++i)
+            {
+                vector.emplace_back(i);
+            }
+            EXPECT_EQ(100, ConcurrentVectorCountedElement::s_constructed);
+
+            vector.clear();
+            EXPECT_EQ(100, ConcurrentVectorCountedElement::s_destroyed);
+            EXPECT_TRUE(vector.empty());
+
+            for (int i = 0; i < 10; ++i)
+            {
+                vector.push_back(ConcurrentVectorCountedElement(i));
+            }
+        }
+        EXPECT_EQ(ConcurrentVectorCountedElement::s_constructed, ConcurrentVectorCountedElement::s_destroyed);
+    }
+
+    TEST_F(ConcurrentVectorTest, References_StayValidWhileGrowing)
+    {
+        concurrent_vector<int> vector;
+        int& first = vector.emplace_back(1);
+        const int* firstAddress = &first;
+        for (int i = 0; i < 10000; ++i)
+        {
+            vector.push_back(i);
+        }
+        EXPECT_EQ(firstAddress, &vector[0]);
+        EXPECT_EQ(1, first);
+    }
+
+    TEST_F(ConcurrentVectorTest, ConcurrentReaders_SeeOnlyConstructedElements)
+    {
+        constexpr int numPushThreads = 4;
+        constexpr int numReadThreads = 2;
+        constexpr int numPushes = 20000;
+
+        concurrent_vector<ConcurrentVectorCountedElement> vector;
+        atomic<int> pushThreadsDone(0);
+        atomic<int> failures(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < numPushThreads; ++threadIndex)
+        {
+            threads.emplace_back([&vector, &pushThreadsDone, threadIndex]()
+            {
+                for (int i = 0; i < numPushes; ++i)
+                {
+                    vector.emplace_back(threadIndex * numPushes + i);
+                }
+                ++pushThreadsDone;
+            });
+        }
+        for (int threadIndex = 0; threadIndex < numReadThreads; ++threadIndex)
+        {
+            threads.emplace_back([&vector, &pushThreadsDone, &failures]()
+            {
+                unsigned int checked = 0;
+                while (pushThreadsDone < numPushThreads || checked < vector.size())
+                {
+                    const unsigned int size = vector.size();
+                    for (; checked < size; ++checked)
+                    {
+                        const ConcurrentVectorCountedElement& element = vector[checked];
+                        if (element.m_check != ~element.m_value)
+                        {
+                            ++failures;
+                        }
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        ASSERT_EQ(numPushThreads * numPushes, vector.size());
+
+        AZStd::vector<bool> found(numPushThreads * numPushes, false);
+        for (unsigned int i = 0; i < vector.size(); ++i)
+        {
+            found[vector[i].m_value] = true;
+        }
+        EXPECT_TRUE(AZStd::find(found.begin(), found.end(), false) == found.end());
+    }
+
+    TEST_F(ConcurrentVectorTest, ConcurrentPushes_ReturnedIndexReadableBeforeSize)
+    {
+        // An element is readable through the index its push returned even if an earlier push by another
+        // thread is still constructing its element and holds size() back.
+        constexpr int numPushThreads = 4;
+        constexpr int numPushes = 20000;
+
+        concurrent_vector<ConcurrentVectorCountedElement> vector;
+        atomic<int> failures(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < numPushThreads; ++threadIndex)
+        {
+            threads.emplace_back([&vector, &failures, threadIndex]()
+            {
+                for (int i = 0; i < numPushes; ++i)
+                {
+                    const int value = threadIndex * numPushes + i;
+                    const ConcurrentVectorCountedElement& element = vector[vector.push_back(ConcurrentVectorCountedElement(value))];
+                    if (element.m_value != value || element.m_check != ~value)
+                    {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        EXPECT_EQ(numPushThreads * numPushes, vector.size());
+    }
+
+    class ConcurrentFlatUnorderedMapTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        using Map = concurrent_flat_unordered_map<int, int>;
+
+#ifdef _DEBUG
+        static const int NUM_VALUES = 2000;
+#else
+        static const int NUM_VALUES = 20000;
+#endif
+    };
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, SingleThreaded_InsertFindErase)
+    {
+        Map map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_TRUE(map.insert(10, 11));
+        EXPECT_TRUE(map.insert(AZStd::make_pair(20, 21)));
+        EXPECT_FALSE(map.insert(10, 12));
+        EXPECT_EQ(2, map.size());
+
+        int value = 0;
+        EXPECT_TRUE(map.find(10, &value));
+        EXPECT_EQ(11, value);
+        EXPECT_FALSE(map.find(30));
+
+        EXPECT_FALSE(map.insert_or_assign(10, 13));
+        EXPECT_TRUE(map.find(10, &value));
+        EXPECT_EQ(13, value);
+        EXPECT_TRUE(map.insert_or_assign(30, 31));
+        EXPECT_EQ(3, map.size());
+
+        EXPECT_EQ(1, map.erase(20));
+        EXPECT_EQ(0, map.erase(20));
+        EXPECT_FALSE(map.find(20));
+        EXPECT_EQ(2, map.size());
+
+        int sum = 0;
+        map.visit([&sum](const Map::value_type& element) { sum += element.second; });
+        EXPECT_EQ(13 + 31, sum);
+
+        map.reclaim();
+        EXPECT_TRUE(map.find(10));
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.find(10));
+    }
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, SingleThreaded_GrowAndChurn)
+    {
+        Map map;
+        for (int i = 0; i < NUM_VALUES; ++i)
+        {
+            EXPECT_TRUE(map.insert(i, i + 1));
+        }
+        EXPECT_EQ(NUM_VALUES, map.size());
+
+        // erased slots are only dropped by a rehash, keep erasing and inserting to force a few
+        for (int i = 0; i < NUM_VALUES; ++i)
+        {
+            EXPECT_EQ(1, map.erase(i));
+            EXPECT_TRUE(map.insert(i + NUM_VALUES, i));
+        }
+        map.reclaim();
+        EXPECT_EQ(NUM_VALUES, map.size());
+
+        for (int i = 0; i < NUM_VALUES; ++i)
+        {
+            int value = -1;
+            EXPECT_FALSE(map.find(i));
+            EXPECT_TRUE(map.find(i + NUM_VALUES, &value));
+            EXPECT_EQ(i, value);
+        }
+    }
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, MultiThreaded_InsertFindErase)
+    {
+        Map map;
+        atomic<int> failures(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&map, &failures, threadIndex]()
+            {
+                const int first = threadIndex * NUM_VALUES;
+                for (int i = first; i < first + NUM_VALUES; ++i)
+                {
+                    failures += map.insert(i, i + 1) ? 0 : 1;
+                }
+                for (int i = first; i < first + NUM_VALUES; ++i)
+                {
+                    int value = 0;
+                    failures += map.find(i, &value) && value == i + 1 ? 0 : 1;
+                }
+                for (int i = first; i < first + NUM_VALUES; i += 2)
+                {
+                    failures += map.erase(i) == 1 ? 0 : 1;
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        EXPECT_EQ(2 * NUM_VALUES, map.size());
+        for (int i = 0; i < 4 * NUM_VALUES; ++i)
+        {
+            EXPECT_EQ(i % 2 == 1, map.find(i));
+        }
+    }
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, MultiThreaded_SameKeysInsertedOnce)
+    {
+        Map map;
+        atomic<int> inserted(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&map, &inserted]()
+            {
+                for (int i = 0; i < NUM_VALUES; ++i)
+                {
+                    inserted += map.insert(i, i) ? 1 : 0;
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(NUM_VALUES, inserted);
+        EXPECT_EQ(NUM_VALUES, map.size());
+        int visited = 0;
+        map.visit([&visited](const Map::value_type&) { ++visited; });
+        EXPECT_EQ(NUM_VALUES, visited);
+    }
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, MultiThreaded_ReadersAlwaysFindStableKeys)
+    {
+        // keys below NUM_VALUES are never erased, readers must always find them with their value,
+        // while writers assign them, grow, churn and rehash the table with the keys above and reclaim what they retired
+        Map map;
+        for (int i = 0; i < NUM_VALUES; ++i)
+        {
+            map.insert(i, i * 2);
+        }
+
+        atomic<int> writersDone(0);
+        atomic<int> failures(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < 2; ++threadIndex)
+        {
+            threads.emplace_back([&map, &writersDone, threadIndex]()
+            {
+                const int first = (threadIndex + 1) * NUM_VALUES;
+                for (int i = first; i < first + NUM_VALUES; ++i)
+                {
+                    map.insert_or_assign(i, i);
+                    map.insert_or_assign(i - first, (i - first) * 2);
+                }
+                for (int i = first; i < first + NUM_VALUES; ++i)
+                {
+                    map.erase(i);
+                    if ((i & 255) == 0)
+                    {
+                        map.reclaim();
+                    }
+                }
+                ++writersDone;
+            });
+        }
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&map, &writersDone, &failures]()
+            {
+                while (writersDone < 2)
+                {
+                    for (int i = 0; i < NUM_VALUES; ++i)
+                    {
+                        int value = -1;
+                        failures += map.find(i, &value) && value == i * 2 ? 0 : 1;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        EXPECT_EQ(NUM_VALUES, map.size());
+    }
+
+    TEST_F(ConcurrentFlatUnorderedMapTest, Reclaim_FreesReplacedAndErasedNodes)
+    {
+        using CountedMap = concurrent_flat_unordered_map<int, ConcurrentVectorCountedElement>;
+        ConcurrentVectorCountedElement::s_constructed = 0;
+        ConcurrentVectorCountedElement::s_destroyed = 0;
+        {
+            CountedMap map;
+            for (int i = 0; i < 100; ++i)
+            {
+                map.insert_or_assign(i, ConcurrentVectorCountedElement(i));
+            }
+            for (int i = 0; i < 100; ++i)
+            {
+                map.insert_or_assign(i, ConcurrentVectorCountedElement(i + 1));
+            }
+            for (int i = 0; i < 50; ++i)
+            {
+                map.erase(i);
+            }
+
+            map.reclaim();
+            EXPECT_EQ(50, ConcurrentVectorCountedElement::s_constructed - ConcurrentVectorCountedElement::s_destroyed);
+        }
+        EXPECT_EQ(ConcurrentVectorCountedElement::s_constructed, ConcurrentVectorCountedElement::s_destroyed);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    namespace ConcurrentMapBenchmark
+    {
+        static const int s_numKeys = 4096;
+
+        template<typename Map>
+        struct Environment
+        {
+            Environment()
+            {
+                if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                    m_ownsSystemAllocator = true;
+                }
+                m_map = AZStd::make_unique<Map>();
+                for (int i = 0; i < s_numKeys; ++i)
+                {
+                    m_map->insert(AZStd::make_pair(i, i));
+                }
+            }
+
+            ~Environment()
+            {
+                m_map.reset();
+                if (m_ownsSystemAllocator)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                }
+            }
+
+            AZStd::unique_ptr<Map> m_map;
+            bool m_ownsSystemAllocator = false;
+        };
+
+        template<typename Map>
+        static Environment<Map>* s_environment = nullptr;
+
+        static void Assign(concurrent_unordered_map<int, int>& map, int key, int value)
+        {
+            map.erase(key);
+            map.insert(AZStd::make_pair(key, value));
+        }
+
+        static void Assign(concurrent_flat_unordered_map<int, int>& map, int key, int value)
+        {
+            map.insert_or_assign(key, value);
+        }
+
+        /// Every thread looks up keys, one write for every writeInterval reads when writeInterval isn't 0.
+        template<typename Map>
+        static void FindAndWrite(::benchmark::State& state, int writeInterval)
+        {
+            if (state.thread_index == 0)
+            {
+                s_environment<Map> = new Environment<Map>();
+            }
+
+            AZ::SimpleLcgRandom random(state.thread_index + 1);
+            int operations = 0;
+            int found = 0;
+            while (state.KeepRunning())
+            {
+                Map& map = *s_environment<Map>->m_map;
+                const int key = static_cast<int>(random.GetRandom() % s_numKeys);
+                if (writeInterval && ++operations % writeInterval == 0)
+                {
+                    Assign(map, key, operations);
+                }
+                else
+                {
+                    int value = 0;
+                    found += map.find(key, &value) ? 1 : 0;
+                }
+            }
+            ::benchmark::DoNotOptimize(found);
+
+            if (state.thread_index == 0)
+            {
+                delete s_environment<Map>;
+                s_environment<Map> = nullptr;
+            }
+        }
+
+        using LockStripedMap = concurrent_unordered_map<int, int>;
+        using FlatMap = concurrent_flat_unordered_map<int, int>;
+    }
+
+    static void BM_ConcurrentUnorderedMap_Find(::benchmark::State& state)
+    {
+        ConcurrentMapBenchmark::FindAndWrite<ConcurrentMapBenchmark::LockStripedMap>(state, 0);
+    }
+    BENCHMARK(BM_ConcurrentUnorderedMap_Find)->ThreadRange(1, 8);
+
+    static void BM_ConcurrentFlatUnorderedMap_Find(::benchmark::State& state)
+    {
+        ConcurrentMapBenchmark::FindAndWrite<ConcurrentMapBenchmark::FlatMap>(state, 0);
+    }
+    BENCHMARK(BM_ConcurrentFlatUnorderedMap_Find)->ThreadRange(1, 8);
+
+    static void BM_ConcurrentUnorderedMap_FindMostly(::benchmark::State& state)
+    {
+        ConcurrentMapBenchmark::FindAndWrite<ConcurrentMapBenchmark::LockStripedMap>(state, 10);
+    }
+    BENCHMARK(BM_ConcurrentUnorderedMap_FindMostly)->ThreadRange(1, 8);
+
+    static void BM_ConcurrentFlatUnorderedMap_FindMostly(::benchmark::State& state)
+    {
+        ConcurrentMapBenchmark::FindAndWrite<ConcurrentMapBenchmark::FlatMap>(state, 10);
+    }
+    BENCHMARK(BM_ConcurrentFlatUnorderedMap_FindMostly)->ThreadRange(1, 8);
+
+    template<typename Vector>
+    static void ConcurrentVectorPushBack(::benchmark::State& state, Vector*& vector, AZStd::mutex* mutex)
+    {
+        if (state.thread_index == 0)
+        {
+            vector = new Vector();
+        }
+
+        int value = 0;
+        while (state.KeepRunning())
+        {
+            if (mutex)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(*mutex);
+                vector->push_back(++value);
+            }
+            else
+            {
+                vector->push_back(++value);
+            }
+        }
+
+        if (state.thread_index == 0)
+        {
+            delete vector;
+            vector = nullptr;
+        }
+    }
+
+    static void BM_ConcurrentVector_PushBack(::benchmark::State& state)
+    {
+        static concurrent_vector<int, AZ::OSStdAllocator>* s_vector = nullptr;
+        ConcurrentVectorPushBack(state, s_vector, nullptr);
+    }
+    BENCHMARK(BM_ConcurrentVector_PushBack)->ThreadRange(1, 8);
+
+    static void BM_LockedVector_PushBack(::benchmark::State& state)
+    {
+        static AZStd::vector<int, AZ::OSStdAllocator>* s_vector = nullptr;
+        static AZStd::mutex s_mutex;
+        ConcurrentVectorPushBack(state, s_vector, &s_mutex);
+    }
+    BENCHMARK(BM_LockedVector_PushBack)->ThreadRange(1, 8);
+#endif // HAVE_BENCHMARK
 }
@@ -0,0 +1,231 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "UserTypes.h"
+
+#include <AzCore/std/parallel/epoch_domain.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace AZStd;
+using namespace UnitTestInternal;
+
+namespace UnitTest
+{
+    class EpochDomainTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+#ifdef _DEBUG
+        static const int NUM_ITERATIONS = 5000;
+#else
+        static const int NUM_ITERATIONS = 50000;
+#endif
+
+        struct Object
+            : public epoch_retired
+        {
+            explicit Object(int value)
+                : m_value(value)
+                , m_check(value)
+            {
+            }
+
+            int m_value;
+            int m_check;    ///< Always equal to m_value while the object is alive.
+        };
+
+        static void CountReclaimed(epoch_retired* retired, void* reclaimed)
+        {
+            ++*static_cast<atomic<int>*>(reclaimed);
+            delete static_cast<Object*>(retired);
+        }
+
+        static void PoisonAndDelete(epoch_retired* retired, void* reclaimed)
+        {
+            Object* object = static_cast<Object*>(retired);
+            object->m_check = -1;
+            ++*static_cast<atomic<int>*>(reclaimed);
+            delete object;
+        }
+    };
+
+    TEST_F(EpochDomainTest, Reclaim_NoGuards_ReclaimsEverything)
+    {
+        atomic<int> reclaimed(0);
+        epoch_domain domain(&reclaimed);
+        for (int i = 0; i < 10; ++i)
+        {
+            domain.retire(new Object(i), &CountReclaimed);
+        }
+        domain.reclaim();
+        EXPECT_EQ(10, reclaimed);
+    }
+
+    TEST_F(EpochDomainTest, Reclaim_GuardAlive_KeepsRetiredObjects)
+    {
+        atomic<int> reclaimed(0);
+        epoch_domain domain(&reclaimed);
+        {
+            epoch_domain::guard guard(domain);
+            domain.retire(new Object(1), &CountReclaimed);
+            domain.reclaim();
+            EXPECT_EQ(0, reclaimed);
+
+            // objects retired while the guard is alive stay around, no matter how much is retired
+            for (int i = 0; i < 1000; ++i)
+            {
+                domain.retire(new Object(i), &CountReclaimed);
+            }
+            EXPECT_EQ(0, reclaimed);
+        }
+        domain.reclaim();
+        EXPECT_EQ(1001, reclaimed);
+    }
+
+    TEST_F(EpochDomainTest, Reclaim_GuardOnOtherThread_KeepsRetiredObjects)
+    {
+        atomic<int> reclaimed(0);
+        atomic<int> state(0);
+        epoch_domain domain(&reclaimed);
+
+        AZStd::thread reader([&domain, &state]()
+        {
+            epoch_domain::guard guard(domain);
+            state = 1;
+            while (state != 2)
+            {
+                AZStd::this_thread::yield();
+            }
+        });
+        while (state != 1)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        domain.retire(new Object(1), &CountReclaimed);
+        domain.reclaim();
+        EXPECT_EQ(0, reclaimed);
+
+        state = 2;
+        reader.join();
+        domain.reclaim();
+        EXPECT_EQ(1, reclaimed);
+    }
+
+    TEST_F(EpochDomainTest, Destroy_ReclaimsEverything)
+    {
+        atomic<int> reclaimed(0);
+        {
+            epoch_domain domain(&reclaimed);
+            for (int i = 0; i < 10; ++i)
+            {
+                domain.retire(new Object(i), &CountReclaimed);
+            }
+        }
+        EXPECT_EQ(10, reclaimed);
+    }
+
+    TEST_F(EpochDomainTest, MultiThreaded_ReadersNeverSeeReclaimedObjects)
+    {
+        // writers keep replacing the shared object and retiring the old one, readers check the object they
+        // loaded is still alive for as long as they hold their guard
+        atomic<int> reclaimed(0);
+        atomic<int> failures(0);
+        atomic<int> writersDone(0);
+        epoch_domain domain(&reclaimed);
+        atomic<Object*> shared(new Object(0));
+
+        const int numWriters = 2;
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < numWriters; ++threadIndex)
+        {
+            threads.emplace_back([&domain, &shared, &writersDone]()
+            {
+                for (int i = 1; i <= NUM_ITERATIONS; ++i)
+                {
+                    Object* previous = shared.exchange(new Object(i), memory_order_acq_rel);
+                    domain.retire(previous, &PoisonAndDelete);
+                    if ((i & 1023) == 0)
+                    {
+                        domain.reclaim();
+                    }
+                }
+                ++writersDone;
+            });
+        }
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.emplace_back([&domain, &shared, &writersDone, &failures]()
+            {
+                while (writersDone < numWriters)
+                {
+                    epoch_domain::guard guard(domain);
+                    const Object* object = shared.load(memory_order_acquire);
+                    for (int spin = 0; spin < 16; ++spin)
+                    {
+                        failures += object->m_value == object->m_check ? 0 : 1;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        domain.reclaim();
+        EXPECT_EQ(numWriters * NUM_ITERATIONS, reclaimed);
+        delete shared.load();
+    }
+
+    TEST_F(EpochDomainTest, MultiThreaded_NestedGuards)
+    {
+        atomic<int> reclaimed(0);
+        atomic<int> failures(0);
+        atomic<bool> done(false);
+        epoch_domain domain(&reclaimed);
+        atomic<Object*> shared(new Object(0));
+
+        AZStd::thread writer([&domain, &shared, &done]()
+        {
+            for (int i = 1; i <= NUM_ITERATIONS; ++i)
+            {
+                domain.retire(shared.exchange(new Object(i), memory_order_acq_rel), &PoisonAndDelete);
+            }
+            done = true;
+        });
+        AZStd::thread reader([&domain, &shared, &done, &failures]()
+        {
+            while (!done)
+            {
+                epoch_domain::guard outer(domain);
+                const Object* first = shared.load(memory_order_acquire);
+                {
+                    epoch_domain::guard inner(domain);
+                    const Object* second = shared.load(memory_order_acquire);
+                    failures += second->m_value == second->m_check ? 0 : 1;
+                }
+                // the inner guard is gone, the outer one still protects the first object
+                failures += first->m_value == first->m_check ? 0 : 1;
+            }
+        });
+        writer.join();
+        reader.join();
+
+        EXPECT_EQ(0, failures);
+        domain.reclaim();
+        EXPECT_EQ(NUM_ITERATIONS, reclaimed);
+        delete shared.load();
+    }
+}
@@ -0,0 +1,254 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "UserTypes.h"
+
+#include <AzCore/std/function/move_only_function.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+using namespace AZStd;
+using namespace UnitTestInternal;
+
+namespace UnitTest
+{
+    /// Counts the allocations made through it, to check which functors end up on the heap.
+    class CountingFunctionAllocator
+        : public AZStd::allocator
+    {
+    public:
+        CountingFunctionAllocator()
+            : AZStd::allocator("CountingFunctionAllocator")
+        {
+        }
+
+        pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+        {
+            ++s_numAllocations;
+            return AZStd::allocator::allocate(byteSize, alignment, flags);
+        }
+
+        void deallocate(pointer_type ptr, size_type byteSize, size_type alignment)
+        {
+            ++s_numDeallocations;
+            AZStd::allocator::deallocate(ptr, byteSize, alignment);
+        }
+
+        static int s_numAllocations;
+        static int s_numDeallocations;
+    };
+
+    int CountingFunctionAllocator::s_numAllocations = 0;
+    int CountingFunctionAllocator::s_numDeallocations = 0;
+
+    class MoveOnlyFunctionTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            CountingFunctionAllocator::s_numAllocations = 0;
+            CountingFunctionAllocator::s_numDeallocations = 0;
+            s_numFunctors = 0;
+        }
+
+        /// Functor that keeps track of how many instances are alive.
+        struct CountedFunctor
+        {
+            CountedFunctor(int value)
+                : m_value(value)
+            {
+                ++s_numFunctors;
+            }
+            CountedFunctor(CountedFunctor&& rhs)
+                : m_value(rhs.m_value)
+            {
+                ++s_numFunctors;
+            }
+            CountedFunctor(const CountedFunctor&) = delete;
+            ~CountedFunctor()
+            {
+                --s_numFunctors;
+            }
+
+            int operator()(int value) const
+            {
+                return m_value + value;
+            }
+
+            int m_value;
+        };
+
+        static int Twice(int value)
+        {
+            return value * 2;
+        }
+
+        static int s_numFunctors;
+    };
+
+    int MoveOnlyFunctionTest::s_numFunctors = 0;
+
+    TEST_F(MoveOnlyFunctionTest, DefaultAndNull_AreEmpty)
+    {
+        move_only_function<void()> function;
+        EXPECT_TRUE(function.empty());
+        EXPECT_FALSE(function);
+
+        move_only_function<void()> nullFunction(nullptr);
+        EXPECT_FALSE(nullFunction);
+
+        void (*nullPointer)() = nullptr;
+        move_only_function<void()> nullPointerFunction(nullPointer);
+        EXPECT_FALSE(nullPointerFunction);
+    }
+
+    TEST_F(MoveOnlyFunctionTest, SmallLambda_StoredInlineWithoutAllocation)
+    {
+        int result = 0;
+        int* resultPtr = &result;
+        move_only_function<void(int)> function([resultPtr](int value) { *resultPtr = value; }, CountingFunctionAllocator());
+        EXPECT_TRUE(function.is_inline());
+        function(5);
+        EXPECT_EQ(5, result);
+        EXPECT_EQ(0, CountingFunctionAllocator::s_numAllocations);
+    }
+
+    TEST_F(MoveOnlyFunctionTest, LargeLambda_AllocatedWithAllocator)
+    {
+        char payload[128] = { 3 };
+        {
+            move_only_function<int()> function([payload]() { return static_cast<int>(payload[0]); }, CountingFunctionAllocator());
+            EXPECT_FALSE(function.is_inline());
+            EXPECT_EQ(3, function());
+            EXPECT_EQ(1, CountingFunctionAllocator::s_numAllocations);
+
+            // moving only moves the pointer to the allocated functor
+            move_only_function<int()> moved(AZStd::move(function));
+            EXPECT_FALSE(function);
+            EXPECT_EQ(3, moved());
+            EXPECT_EQ(1, CountingFunctionAllocator::s_numAllocations);
+        }
+        EXPECT_EQ(1, CountingFunctionAllocator::s_numDeallocations);
+    }
+
+    TEST_F(MoveOnlyFunctionTest, InlineCapacity_IsConfigurable)
+    {
+        char payload[128] = { 7 };
+        move_only_function<int(), 256> function([payload]() { return static_cast<int>(payload[0]); }, CountingFunctionAllocator());
+        EXPECT_TRUE(function.is_inline());
+        EXPECT_EQ(7, function());
+        EXPECT_EQ(0, CountingFunctionAllocator::s_numAllocations);
+    }
+
+    TEST_F(MoveOnlyFunctionTest, MoveOnlyCapture_Works)
+    {
+        AZStd::unique_ptr<int> value(new int(42));
+        move_only_function<int()> function([value = AZStd::move(value)]() { return *value; });
+        EXPECT_EQ(42, function());
+
+        move_only_function<int()> other;
+        other = AZStd::move(function);
+        EXPECT_FALSE(function);
+        EXPECT_EQ(42, other());
+    }
+
+    TEST_F(MoveOnlyFunctionTest, Functor_DestroyedExactlyOnce)
+    {
+        {
+            move_only_function<int(int)> function(CountedFunctor(1));
+            EXPECT_EQ(1, s_numFunctors);
+            EXPECT_EQ(3, function(2));
+
+            move_only_function<int(int)> moved(AZStd::move(function));
+            EXPECT_EQ(1, s_numFunctors);
+
+            move_only_function<int(int)> other(CountedFunctor(10));
+            EXPECT_EQ(2, s_numFunctors);
+            other.swap(moved);
+            EXPECT_EQ(2, s_numFunctors);
+            EXPECT_EQ(3, other(2));
+            EXPECT_EQ(12, moved(2));
+
+            other = nullptr;
+            EXPECT_EQ(1, s_numFunctors);
+        }
+        EXPECT_EQ(0, s_numFunctors);
+    }
+
+    TEST_F(MoveOnlyFunctionTest, FunctionPointerAndMemberFunction_Callable)
+    {
+        move_only_function<int(int)> function(&MoveOnlyFunctionTest::Twice);
+        EXPECT_EQ(8, function(4));
+
+        move_only_function<int(const CountedFunctor&, int)> member(&CountedFunctor::operator());
+        EXPECT_EQ(5, member(CountedFunctor(2), 3));
+    }
+
+    TEST_F(MoveOnlyFunctionTest, InplaceFunction_StoresAndMoves)
+    {
+        AZStd::unique_ptr<int> value(new int(9));
+        inplace_function<int(int), 16> function([value = AZStd::move(value)](int add) { return *value + add; });
+        EXPECT_TRUE(function.is_inline());
+        EXPECT_EQ(10, function(1));
+
+        inplace_function<int(int), 16> moved(AZStd::move(function));
+        EXPECT_FALSE(function);
+        EXPECT_EQ(11, moved(2));
+    }
+
+#if defined(HAVE_BENCHMARK)
+    namespace MoveOnlyFunctionBenchmark
+    {
+        /// Lambda state the size of a typical job or queued EBus call, a few pointers and a couple of values.
+        struct Capture
+        {
+            void* m_object;
+            void* m_data;
+            AZ::u64 m_values[2];
+        };
+
+        template<typename Function>
+        void ConstructMoveAndCall(benchmark::State& state)
+        {
+            CountingFunctionAllocator::s_numAllocations = 0;
+            Capture capture = {};
+            int sum = 0;
+            while (state.KeepRunning())
+            {
+                Function function([capture, &sum]() { sum += static_cast<int>(capture.m_values[0]) + 1; }, CountingFunctionAllocator());
+                Function moved(AZStd::move(function));
+                moved();
+            }
+            benchmark::DoNotOptimize(sum);
+            state.counters["allocations"] = benchmark::Counter(static_cast<double>(CountingFunctionAllocator::s_numAllocations), benchmark::Counter::kAvgIterations);
+        }
+    }
+
+    static void BM_Function_ConstructMoveAndCall(benchmark::State& state)
+    {
+        MoveOnlyFunctionBenchmark::ConstructMoveAndCall<AZStd::function<void()>>(state);
+    }
+    BENCHMARK(BM_Function_ConstructMoveAndCall);
+
+    static void BM_MoveOnlyFunction_ConstructMoveAndCall(benchmark::State& state)
+    {
+        MoveOnlyFunctionBenchmark::ConstructMoveAndCall<AZStd::move_only_function<void()>>(state);
+    }
+    BENCHMARK(BM_MoveOnlyFunction_ConstructMoveAndCall);
+#endif // HAVE_BENCHMARK
+}
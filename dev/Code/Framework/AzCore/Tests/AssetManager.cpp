@@ -2364,5 +2364,479 @@ namespace UnitTest
 
         SetLeakExpected();
     }
-}
 
+    /**
+     * Asset graph for the preload tests. Like real handlers, LoadAssetData loads the dependencies of the asset it reads,
+     * the catalog reports the same dependencies up front so PreloadAsset can schedule them.
+     */
+    class PreloadAssetType
+        : public AssetData
+    {
+    public:
+        AZ_RTTI(PreloadAssetType, "{6A7F3B0E-2C59-4E1B-9D64-3F5C1A8E2B71}", AssetData);
+        AZ_CLASS_ALLOCATOR(PreloadAssetType, SystemAllocator, 0);
+
+        AZStd::vector<Asset<AssetData>> m_dependencies;
+    };
+
+    class PreloadAssetHandlerAndCatalog
+        : public AssetHandler
+        , public AssetCatalog
+        , public AssetCatalogRequestBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PreloadAssetHandlerAndCatalog, SystemAllocator, 0);
+
+        PreloadAssetHandlerAndCatalog()
+        {
+            AssetCatalogRequestBus::Handler::BusConnect();
+        }
+
+        ~PreloadAssetHandlerAndCatalog() override
+        {
+            AssetCatalogRequestBus::Handler::BusDisconnect();
+        }
+
+        AssetId AddAsset(const AZStd::vector<AssetId>& dependencies)
+        {
+            AssetId assetId(Uuid::CreateRandom(), 0);
+            m_dependencies[assetId] = dependencies;
+            return assetId;
+        }
+
+        /// Adds depth levels of width assets, each asset depends on all the assets of the next level.
+        AssetId AddGraph(int depth, int width)
+        {
+            AZStd::vector<AssetId> level;
+            for (int index = 0; index < width; ++index)
+            {
+                level.push_back(AddAsset({}));
+            }
+            for (int levelIndex = 1; levelIndex < depth; ++levelIndex)
+            {
+                AZStd::vector<AssetId> nextLevel;
+                for (int index = 0; index < width; ++index)
+                {
+                    nextLevel.push_back(AddAsset(level));
+                }
+                level = AZStd::move(nextLevel);
+            }
+            return AddAsset(level);
+        }
+
+        size_t GetLoadIndex(const AssetId& assetId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return AZStd::find(m_loadOrder.begin(), m_loadOrder.end(), assetId) - m_loadOrder.begin();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // AssetHandler
+        AssetPtr CreateAsset(const AssetId& /*id*/, const AssetType& /*type*/) override
+        {
+            return aznew PreloadAssetType();
+        }
+
+        bool LoadAssetData(const Asset<AssetData>& asset, const char* /*assetPath*/, const AssetFilterCB& /*assetLoadFilterCB*/) override
+        {
+            if (m_loadTimeMicroseconds)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::microseconds(m_loadTimeMicroseconds));
+            }
+
+            if (m_loadDependencies)
+            {
+                PreloadAssetType* data = asset.GetAs<PreloadAssetType>();
+                for (const AssetId& dependencyId : m_dependencies[asset.GetId()])
+                {
+                    Asset<AssetData> dependency = AssetManager::Instance().FindAsset(dependencyId);
+                    if (!dependency || !dependency->IsReady())
+                    {
+                        ++m_numDependenciesLoadedByHandler;
+                        dependency = AssetManager::Instance().GetAsset(dependencyId, azrtti_typeid<PreloadAssetType>(), true, nullptr, true);
+                    }
+                    data->m_dependencies.push_back(dependency);
+                }
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_loadOrder.push_back(asset.GetId());
+            return true;
+        }
+
+        bool LoadAssetData(const Asset<AssetData>& /*asset*/, IO::GenericStream* /*stream*/, const AssetFilterCB& /*assetLoadFilterCB*/) override
+        {
+            return false;
+        }
+
+        void DestroyAsset(AssetPtr ptr) override
+        {
+            delete ptr;
+        }
+
+        void GetHandledAssetTypes(AZStd::vector<AssetType>& assetTypes) override
+        {
+            assetTypes.push_back(azrtti_typeid<PreloadAssetType>());
+        }
+        //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // AssetCatalog
+        AssetStreamInfo GetStreamInfoForLoad(const AssetId& /*assetId*/, const AssetType& /*assetType*/) override
+        {
+            AssetStreamInfo info;
+            info.m_streamName = "PreloadAsset";
+            info.m_isCustomStreamType = true;
+            return info;
+        }
+        //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // AssetCatalogRequestBus
+        AssetInfo GetAssetInfoById(const AssetId& assetId) override
+        {
+            AssetInfo result;
+            if (m_dependencies.find(assetId) != m_dependencies.end())
+            {
+                result.m_assetId = assetId;
+                result.m_assetType = azrtti_typeid<PreloadAssetType>();
+                result.m_relativePath = "PreloadAsset";
+            }
+            return result;
+        }
+
+        AZ::Outcome<AZStd::vector<ProductDependency>, AZStd::string> GetDirectProductDependencies(const AssetId& assetId) override
+        {
+            auto dependenciesIt = m_dependencies.find(assetId);
+            if (dependenciesIt == m_dependencies.end())
+            {
+                return AZ::Failure<AZStd::string>("Unknown asset");
+            }
+
+            AZStd::vector<ProductDependency> dependencies;
+            for (const AssetId& dependencyId : dependenciesIt->second)
+            {
+                dependencies.emplace_back(dependencyId, AZStd::bitset<64>());
+            }
+            return AZ::Success(dependencies);
+        }
+        //////////////////////////////////////////////////////////////////////////
+
+        AZStd::unordered_map<AssetId, AZStd::vector<AssetId>> m_dependencies; ///< Only modified before the loads start.
+        AZStd::mutex m_mutex;
+        AZStd::vector<AssetId> m_loadOrder;
+        AZStd::atomic_int m_numDependenciesLoadedByHandler{ 0 };
+        int m_loadTimeMicroseconds = 0;
+        bool m_loadDependencies = true;
+    };
+
+    class AssetPreloadTest
+        : public AllocatorsFixture
+    {
+    protected:
+        PreloadAssetHandlerAndCatalog* m_assetHandlerAndCatalog;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            AssetManager::Descriptor desc;
+            desc.m_maxWorkerThreads = 4;
+            AssetManager::Create(desc);
+
+            m_assetHandlerAndCatalog = aznew PreloadAssetHandlerAndCatalog;
+            AssetManager::Instance().RegisterHandler(m_assetHandlerAndCatalog, azrtti_typeid<PreloadAssetType>());
+            AssetManager::Instance().RegisterCatalog(m_assetHandlerAndCatalog, azrtti_typeid<PreloadAssetType>());
+        }
+
+        void TearDown() override
+        {
+            AssetManager::Instance().UnregisterHandler(m_assetHandlerAndCatalog);
+            AssetManager::Instance().UnregisterCatalog(m_assetHandlerAndCatalog);
+            delete m_assetHandlerAndCatalog;
+
+            AssetManager::Destroy();
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            AllocatorsFixture::TearDown();
+        }
+
+        AZStd::shared_ptr<AssetPreloadGraph> Preload(const AssetId& assetId)
+        {
+            AZStd::shared_ptr<AssetPreloadGraph> graph = AssetManager::Instance().PreloadAsset(assetId, azrtti_typeid<PreloadAssetType>());
+            graph->BlockUntilComplete();
+            AssetManager::Instance().DispatchEvents();
+            return graph;
+        }
+    };
+
+    TEST_F(AssetPreloadTest, PreloadAsset_Chain_LoadsDependenciesFirst)
+    {
+        const AssetId leafId = m_assetHandlerAndCatalog->AddAsset({});
+        const AssetId middleId = m_assetHandlerAndCatalog->AddAsset({ leafId });
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({ middleId });
+
+        AZStd::shared_ptr<AssetPreloadGraph> graph = Preload(rootId);
+
+        EXPECT_TRUE(graph->IsComplete());
+        EXPECT_EQ(0, graph->GetNumFailed());
+        ASSERT_EQ(3, graph->GetNodes().size());
+        EXPECT_EQ(rootId, graph->GetRootAsset().GetId());
+        EXPECT_TRUE(graph->GetRootAsset().IsReady());
+
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->GetLoadIndex(leafId));
+        EXPECT_EQ(1, m_assetHandlerAndCatalog->GetLoadIndex(middleId));
+        EXPECT_EQ(2, m_assetHandlerAndCatalog->GetLoadIndex(rootId));
+        // the handlers found their dependencies loaded already
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->m_numDependenciesLoadedByHandler);
+
+        AZStd::vector<AZ::u32> criticalPath = graph->GetCriticalPath();
+        ASSERT_EQ(3, criticalPath.size());
+        EXPECT_EQ(rootId, graph->GetNodes()[criticalPath[0]].m_asset.GetId());
+        EXPECT_EQ(leafId, graph->GetNodes()[criticalPath[2]].m_asset.GetId());
+        EXPECT_EQ(2, graph->GetNodes()[criticalPath[2]].m_priority);
+    }
+
+    TEST_F(AssetPreloadTest, PreloadAsset_SharedDependency_LoadedOnceBeforeDependents)
+    {
+        const AssetId sharedId = m_assetHandlerAndCatalog->AddAsset({});
+        const AssetId leftId = m_assetHandlerAndCatalog->AddAsset({ sharedId });
+        const AssetId rightId = m_assetHandlerAndCatalog->AddAsset({ sharedId });
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({ leftId, rightId, sharedId });
+
+        AZStd::shared_ptr<AssetPreloadGraph> graph = Preload(rootId);
+
+        ASSERT_EQ(4, graph->GetNodes().size());
+        EXPECT_EQ(4, m_assetHandlerAndCatalog->m_loadOrder.size());
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->GetLoadIndex(sharedId));
+        EXPECT_EQ(3, m_assetHandlerAndCatalog->GetLoadIndex(rootId));
+        EXPECT_EQ(0, m_assetHandlerAndCatalog->m_numDependenciesLoadedByHandler);
+
+        for (const AssetPreloadGraph::Node& node : graph->GetNodes())
+        {
+            EXPECT_TRUE(node.m_isLoaded);
+            EXPECT_LE(node.m_queueTimeUs, node.m_loadedTimeUs);
+            for (AZ::u32 dependencyIndex : node.m_dependencies)
+            {
+                // assets are only queued once their dependencies are loaded
+                EXPECT_LE(graph->GetNodes()[dependencyIndex].m_loadedTimeUs, node.m_queueTimeUs);
+            }
+        }
+    }
+
+    TEST_F(AssetPreloadTest, PreloadAsset_CyclicDependency_Completes)
+    {
+        const AssetId firstId = m_assetHandlerAndCatalog->AddAsset({});
+        const AssetId secondId = m_assetHandlerAndCatalog->AddAsset({ firstId });
+        m_assetHandlerAndCatalog->m_dependencies[firstId].push_back(secondId);
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({ firstId });
+
+        // only the graph is cyclic, the handler doesn't follow the dependencies
+        m_assetHandlerAndCatalog->m_loadDependencies = false;
+        AZStd::shared_ptr<AssetPreloadGraph> graph = Preload(rootId);
+
+        EXPECT_EQ(3, graph->GetNodes().size());
+        EXPECT_EQ(0, graph->GetNumFailed());
+        EXPECT_TRUE(graph->GetRootAsset().IsReady());
+        EXPECT_EQ(2, m_assetHandlerAndCatalog->GetLoadIndex(rootId));
+    }
+
+    TEST_F(AssetPreloadTest, PreloadAsset_DependencyMissingFromCatalog_Skipped)
+    {
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({ AssetId(Uuid::CreateRandom(), 0) });
+
+        m_assetHandlerAndCatalog->m_loadDependencies = false;
+        AZStd::shared_ptr<AssetPreloadGraph> graph = Preload(rootId);
+
+        EXPECT_EQ(1, graph->GetNodes().size());
+        EXPECT_TRUE(graph->GetRootAsset().IsReady());
+    }
+
+    using AssetLoadTimelineTest = AssetPreloadTest;
+
+    TEST_F(AssetLoadTimelineTest, LoadTimeline_NotRecording_RecordsNothing)
+    {
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({});
+        Preload(rootId);
+
+        AssetLoadTimeline& timeline = AssetManager::Instance().GetLoadTimeline();
+        EXPECT_FALSE(timeline.IsRecording());
+        EXPECT_TRUE(timeline.GetEvents().empty());
+    }
+
+    TEST_F(AssetLoadTimelineTest, LoadTimeline_Recording_RecordsEveryStep)
+    {
+        const AssetId leafId = m_assetHandlerAndCatalog->AddAsset({});
+        const AssetId rootId = m_assetHandlerAndCatalog->AddAsset({ leafId });
+
+        AssetLoadTimeline& timeline = AssetManager::Instance().GetLoadTimeline();
+        timeline.Start();
+        {
+            AZStd::shared_ptr<AssetPreloadGraph> graph = Preload(rootId);
+            EXPECT_TRUE(graph->GetRootAsset().IsReady());
+        }
+        timeline.Stop();
+
+        AZStd::vector<AssetLoadTimelineEvent> events = timeline.GetEvents();
+        for (const AssetId& assetId : { leafId, rootId })
+        {
+            AZ::u32 phases[static_cast<size_t>(AssetLoadPhase::Count)] = {};
+            for (const AssetLoadTimelineEvent& event : events)
+            {
+                if (event.m_assetId == assetId)
+                {
+                    ++phases[static_cast<size_t>(event.m_phase)];
+                }
+            }
+            EXPECT_EQ(1, phases[static_cast<size_t>(AssetLoadPhase::Queued)]);
+            EXPECT_EQ(1, phases[static_cast<size_t>(AssetLoadPhase::StreamOpen)]);
+            EXPECT_EQ(1, phases[static_cast<size_t>(AssetLoadPhase::LoadData)]);
+            EXPECT_EQ(1, phases[static_cast<size_t>(AssetLoadPhase::InitAsset)]);
+            EXPECT_EQ(1, phases[static_cast<size_t>(AssetLoadPhase::Ready)]);
+        }
+        for (size_t index = 1; index < events.size(); ++index)
+        {
+            EXPECT_LE(events[index - 1].m_startUs, events[index].m_startUs);
+        }
+
+        AZStd::vector<AssetTypeLoadStatistics> statistics = timeline.GetTypeStatistics();
+        auto preloadStatistics = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const AssetTypeLoadStatistics& typeStatistics) { return typeStatistics.m_assetType == azrtti_typeid<PreloadAssetType>(); });
+        ASSERT_NE(statistics.end(), preloadStatistics);
+        EXPECT_EQ(2, preloadStatistics->m_numLoads);
+        EXPECT_EQ(0, preloadStatistics->m_numErrors);
+
+        AZStd::string trace;
+        timeline.WriteChromeTrace(trace);
+        EXPECT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"name\":\"LoadData\",\"cat\":\"asset\",\"ph\":\"X\""));
+        EXPECT_NE(AZStd::string::npos, trace.find(rootId.ToString<AZStd::string>()));
+    }
+
+    TEST_F(AssetLoadTimelineTest, LoadTimeline_BufferFull_DropsEvents)
+    {
+        AssetLoadTimeline timeline;
+        timeline.Start(2);
+        for (int index = 0; index < 3; ++index)
+        {
+            timeline.RecordInstant(AssetLoadPhase::Queued, AssetId(Uuid::CreateRandom(), 0), azrtti_typeid<PreloadAssetType>());
+        }
+
+        EXPECT_EQ(2, timeline.GetEvents().size());
+        EXPECT_EQ(1, timeline.GetNumDroppedEvents());
+
+        // restarting discards the recorded events
+        timeline.Start(2);
+        EXPECT_TRUE(timeline.GetEvents().empty());
+        EXPECT_EQ(0, timeline.GetNumDroppedEvents());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class BM_AssetPreload
+        : public AllocatorsBenchmarkFixture
+    {
+    protected:
+        // Each asset depends on the whole next level, like a slice referencing meshes referencing materials and textures
+        static const int GraphDepth = 6;
+        static const int GraphWidth = 4;
+        static const int LoadTimeMicroseconds = 200;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            AssetManager::Descriptor desc;
+            desc.m_maxWorkerThreads = 4;
+            AssetManager::Create(desc);
+
+            m_assetHandlerAndCatalog = aznew PreloadAssetHandlerAndCatalog;
+            m_assetHandlerAndCatalog->m_loadTimeMicroseconds = LoadTimeMicroseconds;
+            AssetManager::Instance().RegisterHandler(m_assetHandlerAndCatalog, azrtti_typeid<PreloadAssetType>());
+            AssetManager::Instance().RegisterCatalog(m_assetHandlerAndCatalog, azrtti_typeid<PreloadAssetType>());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AssetManager::Instance().UnregisterHandler(m_assetHandlerAndCatalog);
+            AssetManager::Instance().UnregisterCatalog(m_assetHandlerAndCatalog);
+            delete m_assetHandlerAndCatalog;
+
+            AssetManager::Destroy();
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        PreloadAssetHandlerAndCatalog* m_assetHandlerAndCatalog = nullptr;
+    };
+
+    BENCHMARK_F(BM_AssetPreload, GetAssetBlocking_DeepGraph)(benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            // a new graph every iteration, nothing is loaded yet
+            state.PauseTiming();
+            const AssetId rootId = m_assetHandlerAndCatalog->AddGraph(GraphDepth, GraphWidth);
+            state.ResumeTiming();
+
+            // the handlers load the dependencies as they read them, one at a time
+            Asset<AssetData> root = AssetManager::Instance().GetAsset(rootId, azrtti_typeid<PreloadAssetType>(), true, nullptr, true);
+            AssetManager::Instance().DispatchEvents();
+        }
+    }
+
+    BENCHMARK_F(BM_AssetPreload, PreloadAsset_DeepGraph)(benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            const AssetId rootId = m_assetHandlerAndCatalog->AddGraph(GraphDepth, GraphWidth);
+            state.ResumeTiming();
+
+            // each level is loaded in parallel once the level below it is loaded
+            AZStd::shared_ptr<AssetPreloadGraph> graph = AssetManager::Instance().PreloadAsset(rootId, azrtti_typeid<PreloadAssetType>());
+            graph->BlockUntilComplete();
+            AssetManager::Instance().DispatchEvents();
+        }
+    }
+
+    class BM_AssetLoadTimeline
+        : public AllocatorsBenchmarkFixture
+    {
+    protected:
+        void RecordScopes(benchmark::State& state)
+        {
+            const AssetId assetId(Uuid::CreateRandom(), 0);
+            const AssetType assetType = azrtti_typeid<PreloadAssetType>();
+            while (state.KeepRunning())
+            {
+                AssetLoadTimelineScope scope(m_timeline, AssetLoadPhase::LoadData, assetId, assetType);
+            }
+        }
+
+        AssetLoadTimeline m_timeline;
+    };
+
+    BENCHMARK_F(BM_AssetLoadTimeline, RecordScope_NotRecording)(benchmark::State& state)
+    {
+        RecordScopes(state);
+    }
+
+    BENCHMARK_F(BM_AssetLoadTimeline, RecordScope_Recording)(benchmark::State& state)
+    {
+        m_timeline.Start(1024 * 1024);
+        RecordScopes(state);
+        m_timeline.Stop();
+    }
+#endif // HAVE_BENCHMARK
+}
@@ -0,0 +1,392 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    // A small object like the many components and settings serialized in slices and levels
+    struct CompressionTestObject
+    {
+        AZ_TYPE_INFO(CompressionTestObject, "{A3F1C2D4-7B6E-4E0F-9C1A-5D2B8E3F4A61}");
+        AZ_CLASS_ALLOCATOR(CompressionTestObject, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<CompressionTestObject>()
+                ->Version(1)
+                ->Field("Name", &CompressionTestObject::m_name)
+                ->Field("Id", &CompressionTestObject::m_id)
+                ->Field("Weight", &CompressionTestObject::m_weight)
+                ->Field("Position", &CompressionTestObject::m_position)
+                ->Field("Enabled", &CompressionTestObject::m_enabled)
+                ->Field("Tags", &CompressionTestObject::m_tags);
+        }
+
+        AZStd::string m_name;
+        AZ::u64 m_id = 0;
+        float m_weight = 0.0f;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        bool m_enabled = true;
+        AZStd::vector<AZ::u32> m_tags;
+    };
+
+    // Serializes numObjects random objects to XML, back to back in corpus, with the size of each in objectSizes
+    void BuildCompressionCorpus(AZ::SerializeContext& serializeContext, size_t numObjects, AZStd::vector<AZ::u8>& corpus, AZStd::vector<size_t>& objectSizes)
+    {
+        static const char* names[] = { "Light", "Mesh", "Trigger", "Spawner", "Camera", "Audio", "Physics", "Script" };
+
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&corpus);
+        for (size_t i = 0; i < numObjects; ++i)
+        {
+            CompressionTestObject object;
+            object.m_name = AZStd::string::format("%s_%u", names[random() % AZ_ARRAY_SIZE(names)], static_cast<unsigned int>(random() % 1000));
+            object.m_id = (static_cast<AZ::u64>(random()) << 32) | random();
+            object.m_weight = static_cast<float>(random() % 100) * 0.5f;
+            object.m_position = AZ::Vector3(coordinate(random), coordinate(random), coordinate(random));
+            object.m_enabled = random() % 4 != 0;
+            for (unsigned int tag = random() % 6; tag > 0; --tag)
+            {
+                object.m_tags.push_back(random() % 16);
+            }
+
+            const size_t start = corpus.size();
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_XML, &object, &serializeContext);
+            objectSizes.push_back(corpus.size() - start);
+        }
+    }
+
+    class ZStdCompressionTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = aznew AZ::SerializeContext();
+            CompressionTestObject::Reflect(*m_serializeContext);
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+
+            m_corpus = AZStd::make_unique<AZStd::vector<AZ::u8>>();
+            m_objectSizes = AZStd::make_unique<AZStd::vector<size_t>>();
+            BuildCompressionCorpus(*m_serializeContext, 2000, *m_corpus, *m_objectSizes);
+        }
+
+        void TearDown() override
+        {
+            m_corpus.reset();
+            m_objectSizes.reset();
+
+            delete m_jobContext;
+            delete m_jobManager;
+            delete m_serializeContext;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        // Compresses every object on its own and checks they all decompress, returns the compressed total
+        size_t CompressObjects(size_t firstObject, const AZ::ZStdDictionary* dictionary)
+        {
+            AZ::ZStdSeekableCompressor compressor;
+            compressor.SetDictionary(dictionary);
+            AZ::ZStdSeekableDecompressor decompressor;
+
+            size_t offset = 0;
+            for (size_t i = 0; i < firstObject; ++i)
+            {
+                offset += (*m_objectSizes)[i];
+            }
+
+            size_t compressedTotal = 0;
+            AZStd::vector<AZ::u8> compressed;
+            AZStd::vector<AZ::u8> decompressed;
+            for (size_t i = firstObject; i < m_objectSizes->size(); ++i)
+            {
+                const size_t size = (*m_objectSizes)[i];
+                EXPECT_TRUE(compressor.Compress(m_corpus->data() + offset, size, compressed));
+                compressedTotal += compressed.size();
+
+                EXPECT_TRUE(decompressor.Open(compressed.data(), compressed.size(), dictionary));
+                EXPECT_EQ(size, decompressor.GetDecompressedSize());
+                decompressed.resize(size);
+                EXPECT_EQ(size, decompressor.Decompress(0, decompressed.data(), size));
+                EXPECT_EQ(0, memcmp(m_corpus->data() + offset, decompressed.data(), size));
+                offset += size;
+            }
+            return compressedTotal;
+        }
+
+        AZ::SerializeContext* m_serializeContext = nullptr;
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::unique_ptr<AZStd::vector<AZ::u8>> m_corpus;
+        AZStd::unique_ptr<AZStd::vector<size_t>> m_objectSizes;
+    };
+
+    TEST_F(ZStdCompressionTest, Dictionary_SmallObjects_RoundTripSmaller)
+    {
+        // Train on the first half, compress the second half
+        const size_t numTrainingObjects = m_objectSizes->size() / 2;
+        AZStd::vector<AZ::u8> dictionaryData;
+        ASSERT_TRUE(AZ::ZStdDictionary::Train(m_corpus->data(), m_objectSizes->data(), static_cast<unsigned int>(numTrainingObjects), 16 * 1024, dictionaryData));
+        EXPECT_FALSE(dictionaryData.empty());
+
+        AZ::ZStdDictionary dictionary;
+        ASSERT_TRUE(dictionary.Load(dictionaryData.data(), dictionaryData.size()));
+        EXPECT_TRUE(dictionary.IsLoaded());
+        EXPECT_NE(0, dictionary.GetId());
+
+        const size_t withoutDictionary = CompressObjects(numTrainingObjects, nullptr);
+        const size_t withDictionary = CompressObjects(numTrainingObjects, &dictionary);
+        EXPECT_LT(withDictionary, withoutDictionary);
+
+        dictionary.Unload();
+        EXPECT_FALSE(dictionary.IsLoaded());
+    }
+
+    TEST_F(ZStdCompressionTest, Seekable_RandomRanges_MatchSource)
+    {
+        AZ::ZStdSeekableCompressor compressor;
+        compressor.SetFrameSize(4 * 1024);
+        AZStd::vector<AZ::u8> compressed;
+        ASSERT_TRUE(compressor.Compress(m_corpus->data(), m_corpus->size(), compressed));
+        EXPECT_LT(compressed.size(), m_corpus->size());
+
+        AZ::ZStdSeekableDecompressor decompressor;
+        ASSERT_TRUE(decompressor.Open(compressed.data(), compressed.size()));
+        EXPECT_EQ(m_corpus->size(), decompressor.GetDecompressedSize());
+        EXPECT_EQ((m_corpus->size() + 4 * 1024 - 1) / (4 * 1024), decompressor.GetNumFrames());
+
+        AZStd::vector<AZ::u8> decompressed(m_corpus->size());
+        EXPECT_EQ(m_corpus->size(), decompressor.Decompress(0, decompressed.data(), decompressed.size()));
+        EXPECT_EQ(*m_corpus, decompressed);
+
+        std::mt19937 random(42);
+        std::uniform_int_distribution<size_t> offsetDistribution(0, m_corpus->size() - 1);
+        std::uniform_int_distribution<size_t> sizeDistribution(1, 20 * 1024);
+        for (int i = 0; i < 200; ++i)
+        {
+            const size_t offset = offsetDistribution(random);
+            const size_t size = AZStd::GetMin(sizeDistribution(random), m_corpus->size() - offset);
+            EXPECT_EQ(size, decompressor.Decompress(offset, decompressed.data(), size));
+            EXPECT_EQ(0, memcmp(m_corpus->data() + offset, decompressed.data(), size));
+        }
+
+        // Reads are clamped at the end
+        EXPECT_EQ(10, decompressor.Decompress(m_corpus->size() - 10, decompressed.data(), 100));
+        EXPECT_EQ(0, decompressor.Decompress(m_corpus->size(), decompressed.data(), 100));
+    }
+
+    TEST_F(ZStdCompressionTest, Seekable_Parallel_MatchesSerial)
+    {
+        AZ::ZStdSeekableCompressor compressor;
+        compressor.SetFrameSize(8 * 1024);
+
+        AZStd::vector<AZ::u8> serial;
+        ASSERT_TRUE(compressor.Compress(m_corpus->data(), m_corpus->size(), serial));
+        AZStd::vector<AZ::u8> parallel;
+        ASSERT_TRUE(compressor.Compress(m_corpus->data(), m_corpus->size(), parallel, m_jobContext));
+        EXPECT_EQ(serial, parallel);
+    }
+
+    TEST_F(ZStdCompressionTest, Seekable_Empty_RoundTrips)
+    {
+        AZ::ZStdSeekableCompressor compressor;
+        AZStd::vector<AZ::u8> compressed;
+        ASSERT_TRUE(compressor.Compress(nullptr, 0, compressed));
+
+        AZ::ZStdSeekableDecompressor decompressor;
+        ASSERT_TRUE(decompressor.Open(compressed.data(), compressed.size()));
+        EXPECT_EQ(0, decompressor.GetNumFrames());
+        EXPECT_EQ(0, decompressor.GetDecompressedSize());
+    }
+
+    TEST_F(ZStdCompressionTest, Seekable_CorruptIndex_FailsToOpen)
+    {
+        AZ::ZStdSeekableCompressor compressor;
+        AZStd::vector<AZ::u8> compressed;
+        ASSERT_TRUE(compressor.Compress(m_corpus->data(), 100 * 1024, compressed));
+
+        AZ::ZStdSeekableDecompressor decompressor;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZStd::vector<AZ::u8> truncated(compressed.begin(), compressed.end() - 1);
+        EXPECT_FALSE(decompressor.Open(truncated.data(), truncated.size()));
+
+        // Frame count doesn't match the size of the index
+        AZStd::vector<AZ::u8> badCount = compressed;
+        badCount[badCount.size() - AZ::ZStdSeekable::FooterSize] += 1;
+        EXPECT_FALSE(decompressor.Open(badCount.data(), badCount.size()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+
+        EXPECT_FALSE(decompressor.IsOpen());
+        EXPECT_TRUE(decompressor.Open(compressed.data(), compressed.size()));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class BM_ZStdCompression
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = aznew AZ::SerializeContext();
+            UnitTest::CompressionTestObject::Reflect(*m_serializeContext);
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < AZStd::GetMax(1u, AZStd::thread::hardware_concurrency()); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+
+            m_corpus = AZStd::make_unique<AZStd::vector<AZ::u8>>();
+            m_objectSizes = AZStd::make_unique<AZStd::vector<size_t>>();
+            UnitTest::BuildCompressionCorpus(*m_serializeContext, 20000, *m_corpus, *m_objectSizes);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_corpus.reset();
+            m_objectSizes.reset();
+
+            delete m_jobContext;
+            delete m_jobManager;
+            delete m_serializeContext;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void Compress(::benchmark::State& state, AZ::JobContext* jobContext)
+        {
+            AZ::ZStdSeekableCompressor compressor;
+            AZStd::vector<AZ::u8> compressed;
+            for (auto _ : state)
+            {
+                compressor.Compress(m_corpus->data(), m_corpus->size(), compressed, jobContext);
+            }
+            state.SetBytesProcessed(state.iterations() * m_corpus->size());
+            state.counters["Ratio"] = static_cast<double>(m_corpus->size()) / compressed.size();
+        }
+
+        AZ::SerializeContext* m_serializeContext = nullptr;
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::unique_ptr<AZStd::vector<AZ::u8>> m_corpus;
+        AZStd::unique_ptr<AZStd::vector<size_t>> m_objectSizes;
+    };
+
+    BENCHMARK_F(BM_ZStdCompression, CompressSeekable)(benchmark::State& state)
+    {
+        Compress(state, nullptr);
+    }
+
+    BENCHMARK_F(BM_ZStdCompression, CompressSeekableParallel)(benchmark::State& state)
+    {
+        Compress(state, m_jobContext);
+    }
+
+    BENCHMARK_F(BM_ZStdCompression, DecompressRandomObjects)(benchmark::State& state)
+    {
+        AZ::ZStdSeekableCompressor compressor;
+        AZStd::vector<AZ::u8> compressed;
+        compressor.Compress(m_corpus->data(), m_corpus->size(), compressed, m_jobContext);
+
+        AZStd::vector<AZ::u64> offsets(1, 0);
+        for (size_t size : *m_objectSizes)
+        {
+            offsets.push_back(offsets.back() + size);
+        }
+
+        AZ::ZStdSeekableDecompressor decompressor;
+        decompressor.Open(compressed.data(), compressed.size());
+        AZStd::vector<AZ::u8> object;
+        std::mt19937 random(7);
+        size_t bytesProcessed = 0;
+        for (auto _ : state)
+        {
+            const size_t index = random() % m_objectSizes->size();
+            object.resize((*m_objectSizes)[index]);
+            bytesProcessed += decompressor.Decompress(offsets[index], object.data(), object.size());
+        }
+        state.SetBytesProcessed(bytesProcessed);
+    }
+
+    BENCHMARK_F(BM_ZStdCompression, CompressObjectsWithDictionary)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::u8> dictionaryData;
+        AZ::ZStdDictionary::Train(m_corpus->data(), m_objectSizes->data(), static_cast<unsigned int>(m_objectSizes->size()), 32 * 1024, dictionaryData);
+        AZ::ZStdDictionary dictionary;
+        dictionary.Load(dictionaryData.data(), dictionaryData.size());
+
+        AZ::ZStdSeekableCompressor compressor;
+        compressor.SetDictionary(&dictionary);
+        AZStd::vector<AZ::u8> compressed;
+        size_t compressedTotal = 0;
+        for (auto _ : state)
+        {
+            compressedTotal = 0;
+            size_t offset = 0;
+            for (size_t size : *m_objectSizes)
+            {
+                compressor.Compress(m_corpus->data() + offset, size, compressed);
+                compressedTotal += compressed.size();
+                offset += size;
+            }
+        }
+        state.SetBytesProcessed(state.iterations() * m_corpus->size());
+        state.counters["Ratio"] = static_cast<double>(m_corpus->size()) / compressedTotal;
+    }
+}
+#endif // HAVE_BENCHMARK
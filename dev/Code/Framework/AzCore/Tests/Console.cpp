@@ -13,6 +13,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 
 namespace AZ
@@ -228,4 +229,167 @@ namespace AZ
             AZ_TEST_ASSERT(completeCommand == "testVec3");
         }
     }
+
+    static uint32_t s_consoleFunctorInvokeCount = 0;
+
+    static void CountConsoleFunctorInvokes(const StringSet&)
+    {
+        ++s_consoleFunctorInvokeCount;
+    }
+
+    TEST_F(ConsoleTests, CFunc_FindCommand_IsCaseInsensitive)
+    {
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        ConsoleFunctor<void, false> functor("TestCaseCommand", "", ConsoleFunctorFlags::Null, &CountConsoleFunctorInvokes);
+        EXPECT_EQ(&functor, console->FindCommand("testcasecommand"));
+        EXPECT_EQ(&functor, console->FindCommand("TESTCASECOMMAND"));
+        EXPECT_EQ(nullptr, console->FindCommand("TestCaseComman"));
+        EXPECT_EQ(nullptr, console->FindCommand("TestCaseCommands"));
+    }
+
+    TEST_F(ConsoleTests, CFunc_Destroyed_IsNoLongerFound)
+    {
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        {
+            ConsoleFunctor<void, false> functor("testScopedCommand", "", ConsoleFunctorFlags::Null, &CountConsoleFunctorInvokes);
+            EXPECT_TRUE(console->HasCommand("testScopedCommand"));
+            EXPECT_EQ("testScopedCommand", console->AutoCompleteCommand("testScoped"));
+        }
+
+        EXPECT_FALSE(console->HasCommand("testScopedCommand"));
+        EXPECT_EQ("testScoped", console->AutoCompleteCommand("testScoped"));
+    }
+
+    TEST_F(ConsoleTests, CFunc_Invisible_HiddenFromFindAndAutocompleteButStillInvoked)
+    {
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        ConsoleFunctor<void, false> functor("testHiddenCommand", "", ConsoleFunctorFlags::IsInvisible, &CountConsoleFunctorInvokes);
+        EXPECT_EQ(nullptr, console->FindCommand("testHiddenCommand"));
+        EXPECT_EQ("testHidden", console->AutoCompleteCommand("testHidden"));
+
+        s_consoleFunctorInvokeCount = 0;
+        EXPECT_TRUE(console->PerformCommand("testHiddenCommand"));
+        EXPECT_EQ(1, s_consoleFunctorInvokeCount);
+    }
+
+    TEST_F(ConsoleTests, CFunc_SameName_AllInvoked)
+    {
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        ConsoleFunctor<void, false> first("testSharedCommand", "", ConsoleFunctorFlags::Null, &CountConsoleFunctorInvokes);
+        ConsoleFunctor<void, false> second("testSharedCommand", "", ConsoleFunctorFlags::Null, &CountConsoleFunctorInvokes);
+
+        // The most recently registered functor is found first
+        EXPECT_EQ(&second, console->FindCommand("testSharedCommand"));
+
+        s_consoleFunctorInvokeCount = 0;
+        EXPECT_TRUE(console->PerformCommand("testsharedcommand"));
+        EXPECT_EQ(2, s_consoleFunctorInvokeCount);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Registers many console functions and runs a large batch of commands through the console, the way settings files
+    // are executed at startup.
+    class BM_Console
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static const uint32_t FunctorCount = 10000;
+        static const uint32_t CommandCount = 50000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            if (!AZ::Interface<AZ::IConsole>::Get())
+            {
+                new AZ::Console;
+                AZ::Interface<AZ::IConsole>::Get()->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            }
+
+            m_names.reserve(FunctorCount);
+            for (uint32_t i = 0; i < FunctorCount; ++i)
+            {
+                m_names.push_back(AZStd::string::format("bm_console_var_%05u", i));
+            }
+
+            m_commands.reserve(CommandCount);
+            for (uint32_t i = 0; i < CommandCount; ++i)
+            {
+                m_commands.push_back(AZStd::string::format("BM_Console_Var_%05u %u", (i * 7919) % FunctorCount, i));
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_functors = {};
+            m_commands = {};
+            m_names = {};
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RegisterFunctors()
+        {
+            m_functors.reserve(FunctorCount);
+            for (const AZStd::string& name : m_names)
+            {
+                m_functors.emplace_back(new AZ::ConsoleFunctor<void, false>(name.c_str(), "", AZ::ConsoleFunctorFlags::Null, &Invoke));
+            }
+        }
+
+        static void Invoke(const AZ::StringSet&)
+        {
+        }
+
+        AZStd::vector<AZStd::string> m_names;
+        AZStd::vector<AZStd::string> m_commands;
+        AZStd::vector<AZStd::unique_ptr<AZ::ConsoleFunctor<void, false>>> m_functors;
+    };
+
+    BENCHMARK_F(BM_Console, RegisterFunctors)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            RegisterFunctors();
+
+            state.PauseTiming();
+            m_functors.clear();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * FunctorCount);
+    }
+
+    BENCHMARK_F(BM_Console, PerformCommands)(benchmark::State& state)
+    {
+        RegisterFunctors();
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        for (auto _ : state)
+        {
+            for (const AZStd::string& command : m_commands)
+            {
+                console->PerformCommand(command.c_str());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * CommandCount);
+    }
+
+    BENCHMARK_F(BM_Console, AutoCompleteCommand)(benchmark::State& state)
+    {
+        RegisterFunctors();
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(console->AutoCompleteCommand("bm_console_var_0432"));
+        }
+    }
 }
+#endif // HAVE_BENCHMARK
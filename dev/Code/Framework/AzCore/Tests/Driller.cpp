@@ -13,6 +13,7 @@
 
 #include <AzCore/IO/FileIOEventBus.h>
 
+#include <AzCore/Driller/AsyncFileStream.h>
 #include <AzCore/Driller/Driller.h>
 #include <AzCore/Driller/DrillerBus.h>
 #include <AzCore/Driller/DrillerRootHandler.h>
@@ -460,6 +461,154 @@ namespace UnitTest
         run();
     }
 
+    /**
+     * Drilling into DrillerOutputAsyncFileStream and reading back with DrillerInputIndexedFileStream.
+     */
+    class AsyncFileStreamDrillerTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_drillerManager = DrillerManager::Create();
+            m_driller = aznew MyDriller;
+            m_drillerManager->Register(m_driller);
+            m_fileName = GetTestFolderPath() + "drillasynctest.dat";
+        }
+
+        void TearDown() override
+        {
+            m_drillerManager->Unregister(m_driller);
+            DrillerManager::Destroy(m_drillerManager);
+            m_fileName = AZStd::string();
+
+            AllocatorsFixture::TearDown();
+        }
+
+        void Drill(int numFrames, int eventsPerFrame, unsigned int chunkSize)
+        {
+            DrillerManager::DrillerListType drillersToDrill;
+            DrillerManager::DrillerInfo di;
+            di.id = m_driller->GetId();
+            drillersToDrill.push_back(di);
+
+            DrillerOutputAsyncFileStream outputStream(chunkSize);
+            ASSERT_TRUE(outputStream.Open(m_fileName.c_str(), IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_WRITE_ONLY));
+
+            MyDrilledObject drilledObject;
+            DrillerSession* drillerSession = m_drillerManager->Start(outputStream, drillersToDrill);
+            for (int frame = 0; frame < numFrames; ++frame)
+            {
+                for (int i = 0; i < eventsPerFrame; ++i)
+                {
+                    drilledObject.OnEventX();
+                }
+                m_drillerManager->FrameUpdate();
+            }
+            m_drillerManager->Stop(drillerSession);
+            outputStream.Close();
+        }
+
+        // Checks the parsed frames are consecutive and their events increasing, returns the number of frames
+        static int CheckFrames(const DrillerDOMParser::Node* root, int& firstFrame)
+        {
+            const u32 frameId = AZ_CRC("Frame", 0xb5f83ccd);
+            int numFrames = 0;
+            int lastFrame = -1;
+            int lastData = -1;
+            firstFrame = -1;
+            for (const DrillerDOMParser::Node& node : root->m_tags)
+            {
+                if (node.m_name != frameId)
+                {
+                    continue;
+                }
+                int curFrame;
+                node.GetDataRequired(AZ_CRC("FrameNum", 0x85a1a919))->Read(curFrame);
+                if (firstFrame < 0)
+                {
+                    firstFrame = curFrame;
+                }
+                else
+                {
+                    EXPECT_EQ(lastFrame + 1, curFrame);
+                }
+                lastFrame = curFrame;
+                ++numFrames;
+
+                for (const DrillerDOMParser::Node& drillerNode : node.m_tags)
+                {
+                    if (const DrillerDOMParser::Data* dataEntry = drillerNode.GetData(AZ_CRC("EventX", 0xc4558ec2)))
+                    {
+                        int data;
+                        dataEntry->Read(data);
+                        EXPECT_GT(data, lastData);
+                        lastData = data;
+                    }
+                }
+            }
+            return numFrames;
+        }
+
+        DrillerManager* m_drillerManager = nullptr;
+        MyDriller* m_driller = nullptr;
+        AZStd::string m_fileName;
+    };
+
+    TEST_F(AsyncFileStreamDrillerTest, WriteAndRead_AllFrames_InOrder)
+    {
+        Drill(2000, 10, 16 * 1024);
+
+        DrillerInputIndexedFileStream inputStream;
+        ASSERT_TRUE(inputStream.Open(m_fileName.c_str(), IO::SystemFile::SF_OPEN_READ_ONLY));
+        EXPECT_GT(inputStream.GetNumChunks(), 1u);
+
+        DrillerDOMParser dp;
+        dp.ProcessStream(inputStream);
+        EXPECT_TRUE(dp.CanParse());
+        inputStream.Close();
+
+        const DrillerDOMParser::Node* root = dp.GetRootNode();
+        EXPECT_EQ(static_cast<u32>(AZ_CRC("StartData", 0xecf3f53f)), root->m_tags.front().m_name);
+        int firstFrame;
+        EXPECT_EQ(2001, CheckFrames(root, firstFrame)); // the last frame is closed when the session stops
+        EXPECT_EQ(0, firstFrame);
+    }
+
+    TEST_F(AsyncFileStreamDrillerTest, SeekChunk_ParsesFromFrameBoundary)
+    {
+        Drill(2000, 10, 16 * 1024);
+
+        DrillerInputIndexedFileStream inputStream;
+        ASSERT_TRUE(inputStream.Open(m_fileName.c_str(), IO::SystemFile::SF_OPEN_READ_ONLY));
+        const unsigned int numChunks = inputStream.GetNumChunks();
+        ASSERT_GT(numChunks, 3u);
+
+        // A range of chunks in the middle is a sequence of whole frames
+        ASSERT_TRUE(inputStream.SeekChunk(numChunks / 2, 2));
+        DrillerDOMParser middle;
+        middle.ProcessStream(inputStream);
+        EXPECT_TRUE(middle.CanParse());
+        int middleFirstFrame;
+        const int middleFrames = CheckFrames(middle.GetRootNode(), middleFirstFrame);
+        EXPECT_GT(middleFrames, 0);
+        EXPECT_GT(middleFirstFrame, 0);
+        EXPECT_EQ(static_cast<size_t>(middleFrames), middle.GetRootNode()->m_tags.size());
+
+        // Seeking back to the start reads the whole stream again
+        ASSERT_TRUE(inputStream.SeekChunk(0));
+        DrillerDOMParser all;
+        all.ProcessStream(inputStream);
+        EXPECT_TRUE(all.CanParse());
+        int firstFrame;
+        EXPECT_EQ(2001, CheckFrames(all.GetRootNode(), firstFrame));
+
+        EXPECT_FALSE(inputStream.SeekChunk(numChunks));
+        inputStream.Close();
+    }
+
     /**
      *
      */
@@ -953,3 +1102,78 @@ namespace UnitTest
         //////////////////////////////////////////////////////////////////////////
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Events per second a driller can report while capturing to a file, with the synchronous zlib stream
+    // and with the asynchronous stream which compresses on its writer thread.
+    class BM_DrillerFileStream
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static const int EventsPerFrame = 1000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_drillerManager = DrillerManager::Create();
+            m_driller = aznew UnitTest::MyDriller;
+            m_drillerManager->Register(m_driller);
+            m_fileName = UnitTest::GetTestFolderPath() + "drillbenchmark.dat";
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_drillerManager->Unregister(m_driller);
+            DrillerManager::Destroy(m_drillerManager);
+            m_fileName = AZStd::string();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template<class StreamType>
+        void Drill(::benchmark::State& state, StreamType& outputStream)
+        {
+            outputStream.Open(m_fileName.c_str(), IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_WRITE_ONLY);
+
+            DrillerManager::DrillerListType drillersToDrill;
+            DrillerManager::DrillerInfo di;
+            di.id = m_driller->GetId();
+            drillersToDrill.push_back(di);
+
+            UnitTest::MyDrilledObject drilledObject;
+            DrillerSession* drillerSession = m_drillerManager->Start(outputStream, drillersToDrill);
+            for (auto _ : state)
+            {
+                for (int i = 0; i < EventsPerFrame; ++i)
+                {
+                    drilledObject.OnEventX();
+                }
+                m_drillerManager->FrameUpdate();
+            }
+            m_drillerManager->Stop(drillerSession);
+            outputStream.Close();
+
+            state.SetItemsProcessed(state.iterations() * EventsPerFrame);
+        }
+
+        DrillerManager* m_drillerManager = nullptr;
+        UnitTest::MyDriller* m_driller = nullptr;
+        AZStd::string m_fileName;
+    };
+
+    BENCHMARK_F(BM_DrillerFileStream, SyncFileStream)(benchmark::State& state)
+    {
+        DrillerOutputFileStream outputStream;
+        Drill(state, outputStream);
+    }
+
+    BENCHMARK_F(BM_DrillerFileStream, AsyncFileStream)(benchmark::State& state)
+    {
+        DrillerOutputAsyncFileStream outputStream;
+        Drill(state, outputStream);
+    }
+}
+#endif // HAVE_BENCHMARK
@@ -10,8 +10,13 @@
 *
 */
 
+#include <AzCore/EBus/DeferredEvent.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/string.h>
 
 namespace UnitTest
 {
@@ -149,6 +154,138 @@ namespace UnitTest
 
         EXPECT_TRUE(!testEvent.HasHandlerConnected());
     }
+
+    TEST_F(EventTests, TestDeferredEventDeliveredOnDispatch)
+    {
+        AZ::DeferredEvent<int32_t> testEvent;
+        AZStd::vector<int32_t> invokedValues;
+        AZ::DeferredEvent<int32_t>::Handler testHandler([&invokedValues](int32_t value) { invokedValues.push_back(value); });
+        testEvent.Connect(testHandler);
+        EXPECT_TRUE(testEvent.HasHandlerConnected());
+
+        testEvent.QueueSignal(1);
+        testEvent.QueueSignal(2);
+        EXPECT_TRUE(invokedValues.empty());
+
+        EXPECT_EQ(2, testEvent.DispatchQueuedSignals());
+        ASSERT_EQ(2, invokedValues.size());
+        EXPECT_EQ(1, invokedValues[0]);
+        EXPECT_EQ(2, invokedValues[1]);
+
+        EXPECT_EQ(0, testEvent.DispatchQueuedSignals());
+        EXPECT_EQ(2, invokedValues.size());
+    }
+
+    TEST_F(EventTests, TestDeferredEventOverflowKeepsOrder)
+    {
+        const int32_t numSignals = static_cast<int32_t>(AZ::DeferredEvent<int32_t, AZStd::string>::QueueCapacity) * 3;
+
+        AZ::DeferredEvent<int32_t, AZStd::string> testEvent;
+        AZStd::vector<int32_t> invokedValues;
+        bool namesMatch = true;
+        AZ::DeferredEvent<int32_t, AZStd::string>::Handler testHandler([&invokedValues, &namesMatch](int32_t value, AZStd::string name)
+        {
+            invokedValues.push_back(value);
+            namesMatch = namesMatch && name == AZStd::string::format("signal %d", value);
+        });
+        testEvent.Connect(testHandler);
+
+        for (int32_t i = 0; i < numSignals; ++i)
+        {
+            testEvent.QueueSignal(i, AZStd::string::format("signal %d", i));
+        }
+        EXPECT_EQ(numSignals, testEvent.DispatchQueuedSignals());
+
+        ASSERT_EQ(numSignals, invokedValues.size());
+        for (int32_t i = 0; i < numSignals; ++i)
+        {
+            EXPECT_EQ(i, invokedValues[i]);
+        }
+        EXPECT_TRUE(namesMatch);
+    }
+
+    TEST_F(EventTests, TestDeferredEventQueuedDuringDispatch)
+    {
+        AZ::DeferredEvent<int32_t> testEvent;
+        int32_t invokedCount = 0;
+        AZ::DeferredEvent<int32_t>::Handler testHandler([&invokedCount, &testEvent](int32_t value)
+        {
+            ++invokedCount;
+            if (value > 0)
+            {
+                testEvent.QueueSignal(value - 1);
+            }
+        });
+        testEvent.Connect(testHandler);
+
+        // Signals queued by the handlers are delivered by the next dispatch
+        testEvent.QueueSignal(2);
+        EXPECT_EQ(1, testEvent.DispatchQueuedSignals());
+        EXPECT_EQ(1, invokedCount);
+        EXPECT_EQ(1, testEvent.DispatchQueuedSignals());
+        EXPECT_EQ(1, testEvent.DispatchQueuedSignals());
+        EXPECT_EQ(0, testEvent.DispatchQueuedSignals());
+        EXPECT_EQ(3, invokedCount);
+    }
+
+    TEST_F(EventTests, TestDeferredEventUndispatchedSignalsDestroyed)
+    {
+        AZStd::shared_ptr<int32_t> payload = AZStd::make_shared<int32_t>(1);
+        {
+            AZ::DeferredEvent<AZStd::shared_ptr<int32_t>> testEvent;
+            testEvent.QueueSignal(payload);
+            EXPECT_EQ(2, payload.use_count());
+        }
+        EXPECT_EQ(1, payload.use_count());
+    }
+
+    TEST_F(EventTests, TestDeferredEventQueueFromThreads)
+    {
+        const int32_t numThreads = 4;
+        const int32_t numSignalsPerThread = 1000;
+
+        AZ::DeferredEvent<int32_t, int32_t> testEvent;
+        AZStd::vector<int32_t> lastValues(numThreads, -1);
+        bool inOrder = true;
+        int32_t invokedCount = 0;
+        AZ::DeferredEvent<int32_t, int32_t>::Handler testHandler([&](int32_t thread, int32_t value)
+        {
+            // Signals of a thread are delivered in the order they were queued
+            inOrder = inOrder && value == lastValues[thread] + 1;
+            lastValues[thread] = value;
+            ++invokedCount;
+        });
+        testEvent.Connect(testHandler);
+
+        AZStd::atomic<int32_t> threadsDone(0);
+        AZStd::vector<AZStd::thread> threads;
+        for (int32_t thread = 0; thread < numThreads; ++thread)
+        {
+            threads.emplace_back([&testEvent, &threadsDone, thread, numSignalsPerThread]()
+            {
+                for (int32_t value = 0; value < numSignalsPerThread; ++value)
+                {
+                    testEvent.QueueSignal(thread, value);
+                }
+                ++threadsDone;
+            });
+        }
+
+        // Dispatch while the threads are queuing
+        while (threadsDone < numThreads)
+        {
+            testEvent.DispatchQueuedSignals();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        testEvent.DispatchQueuedSignals();
+
+        EXPECT_TRUE(inOrder);
+        EXPECT_EQ(numThreads * numSignalsPerThread, invokedCount);
+    }
 }
 
 #if defined(HAVE_BENCHMARK)
@@ -271,5 +408,78 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EventPerf_EBusIncrementLambda);
+
+    // Signals queued from a job or another thread and delivered on the main thread, a batch of signals per frame
+    static constexpr int32_t NumQueuedSignals = 64;
+    static constexpr int32_t NumQueuedHandlers = 16;
+
+    static void BM_EventPerf_DeferredEventQueueAndDispatch(benchmark::State& state)
+    {
+        AZ::DeferredEvent<int32_t> testEvent;
+        AZ::DeferredEvent<int32_t>::Handler testHandler[NumQueuedHandlers];
+
+        int32_t incrementCounter = 0;
+
+        for (int32_t i = 0; i < NumQueuedHandlers; ++i)
+        {
+            testHandler[i] = AZ::DeferredEvent<int32_t>::Handler([&incrementCounter](int32_t value) { ++incrementCounter; });
+            testEvent.Connect(testHandler[i]);
+        }
+
+        while (state.KeepRunning())
+        {
+            for (int32_t i = 0; i < NumQueuedSignals; ++i)
+            {
+                testEvent.QueueSignal(i);
+            }
+            testEvent.DispatchQueuedSignals();
+        }
+    }
+    BENCHMARK(BM_EventPerf_DeferredEventQueueAndDispatch);
+
+    class EBusPerfQueued
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static const bool EnableEventQueue = true;
+        using MutexType = AZStd::mutex;
+
+        virtual void OnSignal(int32_t) = 0;
+    };
+    using EBusPerfQueuedBus = AZ::EBus<EBusPerfQueued>;
+
+    class EBusPerfQueuedImplIncrement
+        : public EBusPerfQueuedBus::Handler
+    {
+    public:
+        EBusPerfQueuedImplIncrement() { EBusPerfQueuedBus::Handler::BusConnect(); }
+        ~EBusPerfQueuedImplIncrement() { EBusPerfQueuedBus::Handler::BusDisconnect(); }
+        void SetIncrementCounter(int32_t* incrementCounter) { m_incrementCounter = incrementCounter; }
+        void OnSignal(int32_t) override { ++(*m_incrementCounter); }
+        int32_t* m_incrementCounter;
+    };
+
+    static void BM_EventPerf_EBusQueueAndExecute(benchmark::State& state)
+    {
+        int32_t incrementCounter = 0;
+        EBusPerfQueuedImplIncrement testHandler[NumQueuedHandlers];
+
+        for (int32_t i = 0; i < NumQueuedHandlers; ++i)
+        {
+            testHandler[i].SetIncrementCounter(&incrementCounter);
+        }
+
+        while (state.KeepRunning())
+        {
+            for (int32_t i = 0; i < NumQueuedSignals; ++i)
+            {
+                EBusPerfQueuedBus::QueueBroadcast(&EBusPerfQueued::OnSignal, i);
+            }
+            EBusPerfQueuedBus::ExecuteQueuedEvents();
+        }
+    }
+    BENCHMARK(BM_EventPerf_EBusQueueAndExecute);
 }
 #endif // HAVE_BENCHMARK
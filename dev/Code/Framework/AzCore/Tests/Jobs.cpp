@@ -26,7 +26,10 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_list.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/parallel/containers/concurrent_flat_unordered_map.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
+#include <AzCore/std/parallel/epoch_domain.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -45,6 +48,10 @@
 #   include <ppl.h>
 #endif // AZ_COMPARE_TO_PPL
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 #if defined(AZ_COMPILER_MSVC)
     #pragma warning( disable : 4701 ) // "potentially uninitialized local variable 'result1' used"
 #endif
@@ -1136,6 +1143,127 @@ namespace UnitTest
         run();
     }
 
+    class JobParallelAlgorithmsTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            DefaultJobManagerSetupFixture::SetUp();
+
+            // sizes that don't divide evenly in the number of chunks
+            m_values.resize(10007);
+            SimpleLcgRandom random(1234);
+            for (int& value : m_values)
+            {
+                value = static_cast<int>(random.GetRandom() % 1000);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_values.set_capacity(0);
+            DefaultJobManagerSetupFixture::TearDown();
+        }
+
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_Sum_MatchesSerialSum)
+    {
+        AZ::s64 expected = 0;
+        for (int value : m_values)
+        {
+            expected += value;
+        }
+
+        EXPECT_EQ(expected, parallel_reduce(m_values.begin(), m_values.end(), AZ::s64(0)));
+        EXPECT_EQ(expected, parallel_reduce(m_values.begin(), m_values.end(), AZ::s64(0), AZStd::plus<AZ::s64>(), simple_partitioner(64)));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_NonCommutativeOperation_KeepsElementOrder)
+    {
+        // concatenating digits is associative but not commutative
+        AZStd::vector<AZStd::string> digits;
+        for (int i = 0; i < 100; ++i)
+        {
+            digits.push_back(AZStd::string::format("%d", i % 10));
+        }
+        AZStd::string expected;
+        for (const AZStd::string& digit : digits)
+        {
+            expected += digit;
+        }
+
+        AZStd::string result = parallel_reduce(digits.begin(), digits.end(), AZStd::string(), [](const AZStd::string& lhs, const AZStd::string& rhs) { return lhs + rhs; }, simple_partitioner(4));
+        EXPECT_EQ(expected, result);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_EmptyRange_ReturnsIdentity)
+    {
+        EXPECT_EQ(42, parallel_reduce(m_values.begin(), m_values.begin(), 42));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelInclusiveScan_MatchesSerialScan)
+    {
+        AZStd::vector<int> result(m_values.size());
+        parallel_inclusive_scan(m_values.begin(), m_values.end(), result.begin());
+
+        int sum = 0;
+        for (size_t i = 0; i < m_values.size(); ++i)
+        {
+            sum += m_values[i];
+            ASSERT_EQ(sum, result[i]);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelExclusiveScan_InPlace_MatchesSerialScan)
+    {
+        AZStd::vector<int> original = m_values;
+        parallel_exclusive_scan(m_values.begin(), m_values.end(), m_values.begin(), 10, AZStd::plus<int>(), simple_partitioner(100));
+
+        int sum = 10;
+        for (size_t i = 0; i < original.size(); ++i)
+        {
+            ASSERT_EQ(sum, m_values[i]);
+            sum += original[i];
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_MatchesSerialSort)
+    {
+        AZStd::vector<int> expected = m_values;
+        AZStd::sort(expected.begin(), expected.end());
+
+        parallel_sort(m_values.begin(), m_values.end());
+        EXPECT_EQ(expected, m_values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_CustomCompareAndOddChunkCount_MatchesSerialSort)
+    {
+        AZStd::vector<int> expected = m_values;
+        AZStd::sort(expected.begin(), expected.end(), AZStd::greater<int>());
+
+        // 7 chunks exercises merge passes where the last run has no pair
+        parallel_sort(m_values.begin(), m_values.end(), AZStd::greater<int>(), simple_partitioner(static_cast<int>(m_values.size() / 7)));
+        EXPECT_EQ(expected, m_values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelTransform_UnaryAndBinary)
+    {
+        AZStd::vector<int> doubled(m_values.size());
+        parallel_transform(m_values.begin(), m_values.end(), doubled.begin(), [](int value) { return value * 2; });
+
+        AZStd::vector<int> sums(m_values.size());
+        parallel_transform_binary(m_values.begin(), m_values.end(), doubled.begin(), sums.begin(), [](int lhs, int rhs) { return lhs + rhs; }, static_partitioner());
+
+        for (size_t i = 0; i < m_values.size(); ++i)
+        {
+            ASSERT_EQ(m_values[i] * 2, doubled[i]);
+            ASSERT_EQ(m_values[i] * 3, sums[i]);
+        }
+    }
+
     class PERF_JobParallelForOverheadTest
         : public DefaultJobManagerSetupFixture
     {
@@ -1397,4 +1525,203 @@ namespace UnitTest
     {
         run();
     }
+
+    class JobEpochReclamationTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        struct RetiredObject
+            : public AZStd::epoch_retired
+        {
+            AZ_CLASS_ALLOCATOR(RetiredObject, SystemAllocator, 0)
+        };
+
+        static void CountReclaimed(AZStd::epoch_retired* retired, void* reclaimed)
+        {
+            ++*static_cast<AZStd::atomic<int>*>(reclaimed);
+            delete static_cast<RetiredObject*>(retired);
+        }
+    };
+
+    TEST_F(JobEpochReclamationTest, IdleWorkers_ReclaimRetiredObjects)
+    {
+        const int numRetired = 10;
+        AZStd::atomic<int> reclaimed(0);
+        AZStd::epoch_domain domain(&reclaimed);
+        for (int i = 0; i < numRetired; ++i)
+        {
+            domain.retire(aznew RetiredObject(), &CountReclaimed);
+        }
+        EXPECT_EQ(0, reclaimed);
+
+        // wake up a worker, it reclaims when it runs out of work and goes back to sleep
+        AZ::JobCompletion completion;
+        AZ::Job* job = AZ::CreateJobFunction([]() {}, true);
+        job->SetDependent(&completion);
+        job->Start();
+        completion.StartAndWaitForCompletion();
+
+        for (int wait = 0; wait < 5000 && reclaimed < numRetired; ++wait)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(numRetired, reclaimed);
+    }
+
+    // Counts its live copies, a node destroyed twice shows up as a negative count
+    struct LiveCounted
+    {
+        static AZStd::atomic<int> s_live;
+
+        LiveCounted()                       { ++s_live; }
+        LiveCounted(const LiveCounted&)     { ++s_live; }
+        ~LiveCounted()                      { --s_live; }
+        LiveCounted& operator=(const LiveCounted&) = default;
+    };
+    AZStd::atomic<int> LiveCounted::s_live(0);
+
+    TEST_F(JobEpochReclamationTest, DestroyAndClearMaps_WhileWorkersReclaim_FreesEveryNodeOnce)
+    {
+        // keeps the workers going to sleep, each time they reclaim every registered domain
+        AZStd::atomic<bool> done(false);
+        AZStd::thread waker([&done]()
+        {
+            while (!done)
+            {
+                AZ::JobCompletion completion;
+                AZ::Job* job = AZ::CreateJobFunction([]() {}, true);
+                job->SetDependent(&completion);
+                job->Start();
+                completion.StartAndWaitForCompletion();
+            }
+        });
+
+        for (int iteration = 0; iteration < 200; ++iteration)
+        {
+            AZStd::concurrent_flat_unordered_map<int, LiveCounted> map;
+            for (int i = 0; i < 256; ++i)
+            {
+                // every assignment retires the node it replaces
+                map.insert_or_assign(i & 15, LiveCounted());
+            }
+            if (iteration & 1)
+            {
+                map.clear();
+                map.insert_or_assign(0, LiveCounted());
+                map.insert_or_assign(0, LiveCounted());
+            }
+        }
+
+        done = true;
+        waker.join();
+        EXPECT_EQ(0, LiveCounted::s_live);
+    }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Runs the parallel algorithms with 1 to N worker threads, the number of workers is the first benchmark argument.
+    class BM_JobParallelAlgorithms
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < state.range(0); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+
+            m_values.resize(1 << 20);
+            SimpleLcgRandom random(1234);
+            for (float& value : m_values)
+            {
+                value = random.GetRandomFloat();
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_values.set_capacity(0);
+
+            JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static void WorkerCounts(::benchmark::internal::Benchmark* benchmark)
+        {
+            const int maxWorkers = static_cast<int>(AZStd::thread::hardware_concurrency());
+            for (int numWorkers = 1; numWorkers < maxWorkers; numWorkers *= 2)
+            {
+                benchmark->Arg(numWorkers);
+            }
+            benchmark->Arg(maxWorkers);
+            benchmark->Unit(::benchmark::kMicrosecond);
+        }
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        AZStd::vector<float> m_values;
+    };
+
+    BENCHMARK_DEFINE_F(BM_JobParallelAlgorithms, Reduce)(benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(parallel_reduce(m_values.begin(), m_values.end(), 0.0f));
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_JobParallelAlgorithms, Reduce)->Apply(&BM_JobParallelAlgorithms::WorkerCounts);
+
+    BENCHMARK_DEFINE_F(BM_JobParallelAlgorithms, InclusiveScan)(benchmark::State& state)
+    {
+        AZStd::vector<float> result(m_values.size());
+        while (state.KeepRunning())
+        {
+            parallel_inclusive_scan(m_values.begin(), m_values.end(), result.begin());
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_JobParallelAlgorithms, InclusiveScan)->Apply(&BM_JobParallelAlgorithms::WorkerCounts);
+
+    BENCHMARK_DEFINE_F(BM_JobParallelAlgorithms, Sort)(benchmark::State& state)
+    {
+        AZStd::vector<float> values;
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            values = m_values;
+            state.ResumeTiming();
+
+            parallel_sort(values.begin(), values.end());
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_JobParallelAlgorithms, Sort)->Apply(&BM_JobParallelAlgorithms::WorkerCounts);
+
+    BENCHMARK_DEFINE_F(BM_JobParallelAlgorithms, Transform)(benchmark::State& state)
+    {
+        AZStd::vector<float> result(m_values.size());
+        while (state.KeepRunning())
+        {
+            parallel_transform(m_values.begin(), m_values.end(), result.begin(), [](float value) { return sqrtf(value) * 0.5f; }, simple_partitioner(4096));
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_JobParallelAlgorithms, Transform)->Apply(&BM_JobParallelAlgorithms::WorkerCounts);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
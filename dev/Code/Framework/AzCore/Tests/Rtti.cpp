@@ -12,8 +12,14 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/ReflectionManager.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Utils/Utils.h>
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/bitset.h>
@@ -28,6 +34,7 @@
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1112,4 +1119,404 @@ namespace UnitTest
         m_reflection.reset();
         EXPECT_FALSE(TestReflectedClass::s_isReflected);
     }
+
+    // Classes reflected by three entry points, SnapshotDerived is reflected by the entry point of SnapshotBase
+    struct SnapshotBase
+    {
+        AZ_RTTI(SnapshotBase, "{0C5C2D0B-7E3A-4F7B-8C61-2D5E9B0A4E11}");
+        virtual ~SnapshotBase() = default;
+
+        int m_value = 0;
+    };
+
+    struct SnapshotDerived
+        : public SnapshotBase
+    {
+        AZ_RTTI(SnapshotDerived, "{5A1F3E6C-2B7D-4C9A-9E30-7D4B8F1C6A22}", SnapshotBase);
+
+        static void Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<SnapshotBase>()
+                    ->Version(2)
+                    ->Field("Value", &SnapshotBase::m_value);
+                serializeContext->Class<SnapshotDerived, SnapshotBase>()
+                    ->Field("Values", &SnapshotDerived::m_values)
+                    ->Field("Name", &SnapshotDerived::m_name);
+            }
+        }
+
+        AZStd::vector<float> m_values;
+        AZStd::string m_name;
+    };
+
+    struct SnapshotOther
+    {
+        AZ_TYPE_INFO(SnapshotOther, "{9D2E4B7A-6C1F-4A8E-B5D3-1E7C9A2F4B33}");
+
+        static void Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<SnapshotOther>()
+                    ->Field("Derived", &SnapshotOther::m_derived)
+                    ->Field("Ids", &SnapshotOther::m_ids);
+            }
+        }
+
+        SnapshotDerived m_derived;
+        AZStd::vector<AZ::Uuid> m_ids;
+    };
+
+    struct SnapshotUnused
+    {
+        AZ_TYPE_INFO(SnapshotUnused, "{3B8C1D5E-9F2A-4D6B-A7E4-5C3F1B9D2E44}");
+
+        static void Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<SnapshotUnused>()
+                    ->Field("Value", &SnapshotUnused::m_value);
+            }
+        }
+
+        double m_value = 0.0;
+    };
+
+    class ReflectionSnapshotTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_fileName = GetTestFolderPath() + "ReflectionSnapshotTest.bin";
+        }
+
+        void TearDown() override
+        {
+            m_fileName = AZStd::string();
+
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        static void ReflectEntryPoints(ReflectionManager& reflection)
+        {
+            reflection.Reflect(azrtti_typeid<SnapshotDerived>(), &SnapshotDerived::Reflect);
+            reflection.Reflect(azrtti_typeid<SnapshotOther>(), &SnapshotOther::Reflect);
+            reflection.Reflect(azrtti_typeid<SnapshotUnused>(), &SnapshotUnused::Reflect);
+        }
+
+        // Reflects the entry points while recording a snapshot and saves it
+        void RecordSnapshot(ReflectionManager& reflection, u64 key)
+        {
+            reflection.AddReflectContext<SerializeContext>();
+            ReflectionSnapshot snapshot(key);
+            reflection.RecordSnapshot(&snapshot);
+            ReflectEntryPoints(reflection);
+            reflection.RecordSnapshot(nullptr);
+
+            EXPECT_EQ(3, snapshot.GetNumEntryPoints());
+            EXPECT_TRUE(snapshot.Save(m_fileName.c_str()));
+        }
+
+        static void ExpectSameClassData(const SerializeContext::ClassData* expected, const SerializeContext::ClassData* actual)
+        {
+            ASSERT_NE(nullptr, expected);
+            ASSERT_NE(nullptr, actual);
+            EXPECT_STREQ(expected->m_name, actual->m_name);
+            EXPECT_EQ(expected->m_typeId, actual->m_typeId);
+            EXPECT_EQ(expected->m_version, actual->m_version);
+            ASSERT_EQ(expected->m_elements.size(), actual->m_elements.size());
+            for (size_t i = 0; i < expected->m_elements.size(); ++i)
+            {
+                const SerializeContext::ClassElement& expectedElement = expected->m_elements[i];
+                const SerializeContext::ClassElement& actualElement = actual->m_elements[i];
+                EXPECT_STREQ(expectedElement.m_name, actualElement.m_name);
+                EXPECT_EQ(expectedElement.m_nameCrc, actualElement.m_nameCrc);
+                EXPECT_EQ(expectedElement.m_typeId, actualElement.m_typeId);
+                EXPECT_EQ(expectedElement.m_offset, actualElement.m_offset);
+                EXPECT_EQ(expectedElement.m_dataSize, actualElement.m_dataSize);
+                EXPECT_EQ(expectedElement.m_flags, actualElement.m_flags);
+            }
+        }
+
+        static size_t CountClasses(const SerializeContext& serializeContext)
+        {
+            size_t numClasses = 0;
+            serializeContext.EnumerateAll([&numClasses](const SerializeContext::ClassData*, const Uuid&) { ++numClasses; return true; }, true);
+            return numClasses;
+        }
+
+        AZStd::string m_fileName;
+    };
+
+    TEST_F(ReflectionSnapshotTest, RestoredContext_MatchesReflectedContext)
+    {
+        const u64 key = ReflectionSnapshot::ComputeKey("TestBuild", { "ModuleA", "ModuleB" });
+
+        ReflectionManager reflected;
+        RecordSnapshot(reflected, key);
+
+        ReflectionSnapshot snapshot;
+        ASSERT_TRUE(snapshot.Load(m_fileName.c_str(), key));
+        const AZStd::vector<TypeId>* derivedTypes = snapshot.GetEntryPointTypes(azrtti_typeid<SnapshotDerived>());
+        ASSERT_NE(nullptr, derivedTypes);
+        EXPECT_NE(derivedTypes->end(), AZStd::find(derivedTypes->begin(), derivedTypes->end(), azrtti_typeid<SnapshotBase>()));
+
+        ReflectionManager restored;
+        restored.AddReflectContext<SerializeContext>();
+        restored.SetSnapshot(AZStd::move(snapshot));
+        ReflectEntryPoints(restored);
+        EXPECT_EQ(3, restored.GetNumDeferredEntryPoints());
+
+        SerializeContext* reflectedContext = reflected.GetReflectContext<SerializeContext>();
+        SerializeContext* restoredContext = restored.GetReflectContext<SerializeContext>();
+
+        // Looking up a class only reflects its entry point
+        ExpectSameClassData(reflectedContext->FindClassData(azrtti_typeid<SnapshotBase>()), restoredContext->FindClassData(azrtti_typeid<SnapshotBase>()));
+        EXPECT_EQ(2, restored.GetNumDeferredEntryPoints());
+        ExpectSameClassData(reflectedContext->FindClassData(azrtti_typeid<SnapshotDerived>()), restoredContext->FindClassData(azrtti_typeid<SnapshotDerived>()));
+        ExpectSameClassData(reflectedContext->FindClassData(azrtti_typeid<SnapshotOther>()), restoredContext->FindClassData(azrtti_typeid<SnapshotOther>()));
+        EXPECT_EQ(1, restored.GetNumDeferredEntryPoints());
+
+        // Enumerating reflects everything
+        EXPECT_EQ(CountClasses(*reflectedContext), CountClasses(*restoredContext));
+        EXPECT_EQ(0, restored.GetNumDeferredEntryPoints());
+        ExpectSameClassData(reflectedContext->FindClassData(azrtti_typeid<SnapshotUnused>()), restoredContext->FindClassData(azrtti_typeid<SnapshotUnused>()));
+        ExpectSameClassData(reflectedContext->FindClassData(azrtti_typeid<AZStd::vector<float>>()), restoredContext->FindClassData(azrtti_typeid<AZStd::vector<float>>()));
+
+        // Objects written with one context are read by the other
+        SnapshotOther object;
+        object.m_derived.m_value = 7;
+        object.m_derived.m_values = { 1.0f, 2.0f };
+        object.m_derived.m_name = "Snapshot";
+        object.m_ids.push_back(Uuid::CreateRandom());
+        SnapshotOther* clone = reflectedContext->CloneObject(&object);
+        SnapshotOther* restoredClone = restoredContext->CloneObject(clone);
+        ASSERT_NE(nullptr, restoredClone);
+        EXPECT_EQ(7, restoredClone->m_derived.m_value);
+        EXPECT_EQ(object.m_derived.m_values, restoredClone->m_derived.m_values);
+        EXPECT_EQ(object.m_derived.m_name, restoredClone->m_derived.m_name);
+        EXPECT_EQ(object.m_ids, restoredClone->m_ids);
+        delete clone;
+        delete restoredClone;
+    }
+
+    TEST_F(ReflectionSnapshotTest, ClassesAreFoundByName)
+    {
+        const u64 key = ReflectionSnapshot::ComputeKey("TestBuild", {});
+
+        ReflectionManager reflected;
+        RecordSnapshot(reflected, key);
+
+        ReflectionSnapshot snapshot;
+        ASSERT_TRUE(snapshot.Load(m_fileName.c_str(), key));
+        ReflectionManager restored;
+        restored.AddReflectContext<SerializeContext>();
+        restored.SetSnapshot(AZStd::move(snapshot));
+        ReflectEntryPoints(restored);
+
+        AZStd::vector<Uuid> classIds = restored.GetReflectContext<SerializeContext>()->FindClassId(Crc32("SnapshotOther"));
+        ASSERT_EQ(1, classIds.size());
+        EXPECT_EQ(azrtti_typeid<SnapshotOther>(), classIds[0]);
+    }
+
+    TEST_F(ReflectionSnapshotTest, OtherKey_IsRejected)
+    {
+        ReflectionManager reflected;
+        RecordSnapshot(reflected, ReflectionSnapshot::ComputeKey("TestBuild", { "ModuleA" }));
+
+        ReflectionSnapshot snapshot;
+        EXPECT_FALSE(snapshot.Load(m_fileName.c_str(), ReflectionSnapshot::ComputeKey("TestBuild", { "ModuleA", "ModuleB" })));
+        EXPECT_FALSE(snapshot.Load(m_fileName.c_str(), ReflectionSnapshot::ComputeKey("OtherBuild", { "ModuleA" })));
+        EXPECT_TRUE(snapshot.IsEmpty());
+        EXPECT_FALSE(snapshot.Load((m_fileName + ".missing").c_str(), 0));
+    }
+
+    TEST_F(ReflectionSnapshotTest, UnreflectDeferredEntryPoint_IsNeverReflected)
+    {
+        const u64 key = ReflectionSnapshot::ComputeKey("TestBuild", {});
+
+        ReflectionManager reflected;
+        RecordSnapshot(reflected, key);
+
+        ReflectionSnapshot snapshot;
+        ASSERT_TRUE(snapshot.Load(m_fileName.c_str(), key));
+        ReflectionManager restored;
+        restored.AddReflectContext<SerializeContext>();
+        restored.SetSnapshot(AZStd::move(snapshot));
+        ReflectEntryPoints(restored);
+
+        restored.Unreflect(azrtti_typeid<SnapshotUnused>());
+        EXPECT_EQ(2, restored.GetNumDeferredEntryPoints());
+        EXPECT_EQ(nullptr, restored.GetReflectContext<SerializeContext>()->FindClassData(azrtti_typeid<SnapshotUnused>()));
+
+        restored.ResolveDeferredReflection();
+        EXPECT_EQ(0, restored.GetNumDeferredEntryPoints());
+        EXPECT_NE(nullptr, restored.GetReflectContext<SerializeContext>()->FindClassData(azrtti_typeid<SnapshotOther>()));
+    }
+
+    TEST_F(ReflectionSnapshotTest, Record_OnlyNewClassesBelongToEntryPoint)
+    {
+        ReflectionManager reflection;
+        reflection.AddReflectContext<SerializeContext>();
+        ReflectionSnapshot snapshot(0);
+        reflection.RecordSnapshot(&snapshot);
+        ReflectEntryPoints(reflection);
+        reflection.RecordSnapshot(nullptr);
+
+        const AZStd::vector<TypeId>* derivedTypes = snapshot.GetEntryPointTypes(azrtti_typeid<SnapshotDerived>());
+        const AZStd::vector<TypeId>* otherTypes = snapshot.GetEntryPointTypes(azrtti_typeid<SnapshotOther>());
+        ASSERT_NE(nullptr, derivedTypes);
+        ASSERT_NE(nullptr, otherTypes);
+
+        auto contains = [](const AZStd::vector<TypeId>& types, const TypeId& typeId)
+        {
+            return AZStd::find(types.begin(), types.end(), typeId) != types.end();
+        };
+        EXPECT_TRUE(contains(*derivedTypes, azrtti_typeid<SnapshotBase>()));
+        EXPECT_TRUE(contains(*derivedTypes, azrtti_typeid<SnapshotDerived>()));
+        EXPECT_TRUE(contains(*otherTypes, azrtti_typeid<SnapshotOther>()));
+        EXPECT_FALSE(contains(*otherTypes, azrtti_typeid<SnapshotDerived>()));
+    }
+
+    TEST_F(ReflectionSnapshotTest, ConcurrentLookups_ReflectDeferredClassesOnce)
+    {
+        const u64 key = ReflectionSnapshot::ComputeKey("TestBuild", {});
+
+        ReflectionManager reflected;
+        RecordSnapshot(reflected, key);
+
+        ReflectionSnapshot snapshot;
+        ASSERT_TRUE(snapshot.Load(m_fileName.c_str(), key));
+        ReflectionManager restored;
+        restored.AddReflectContext<SerializeContext>();
+        restored.SetSnapshot(AZStd::move(snapshot));
+        ReflectEntryPoints(restored);
+        SerializeContext* restoredContext = restored.GetReflectContext<SerializeContext>();
+
+        const TypeId typeIds[] = { azrtti_typeid<SnapshotBase>(), azrtti_typeid<SnapshotDerived>(), azrtti_typeid<SnapshotOther>(), azrtti_typeid<SnapshotUnused>() };
+        AZStd::atomic_int numFound{ 0 };
+        AZStd::thread threads[8];
+        for (size_t threadIdx = 0; threadIdx < AZ_ARRAY_SIZE(threads); ++threadIdx)
+        {
+            threads[threadIdx] = AZStd::thread([&, threadIdx]()
+            {
+                for (size_t typeIdx = 0; typeIdx < AZ_ARRAY_SIZE(typeIds); ++typeIdx)
+                {
+                    if (restoredContext->FindClassData(typeIds[(threadIdx + typeIdx) % AZ_ARRAY_SIZE(typeIds)]))
+                    {
+                        ++numFound;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(AZ_ARRAY_SIZE(threads) * AZ_ARRAY_SIZE(typeIds), numFound.load());
+        EXPECT_EQ(0, restored.GetNumDeferredEntryPoints());
+        EXPECT_EQ(reflected.GetReflectContext<SerializeContext>()->GetNumReflectedClasses(), restoredContext->GetNumReflectedClasses());
+    }
+
+    TEST_F(ReflectionSnapshotTest, ComponentApplication_DefersReflectionPastCreate)
+    {
+        ComponentApplication::Descriptor descriptor;
+        descriptor.m_useExistingAllocator = true;
+        descriptor.m_enableDrilling = false;
+        ComponentApplication::StartupParameters startupParameters;
+        startupParameters.m_allocator = &AllocatorInstance<SystemAllocator>::Get();
+        startupParameters.m_loadDynamicModules = false;
+        startupParameters.m_reflectionSnapshotFile = m_fileName.c_str();
+        startupParameters.m_reflectionSnapshotBuildId = "TestBuild";
+
+        // The first run records the snapshot and saves it on Destroy
+        {
+            ComponentApplication app;
+            app.Create(descriptor, startupParameters);
+            EXPECT_EQ(0, ReflectionEnvironment::GetReflectionManager()->GetNumDeferredEntryPoints());
+            app.Destroy();
+        }
+
+        // The second run defers the descriptors and the application itself until their classes are looked up
+        {
+            ComponentApplication app;
+            app.Create(descriptor, startupParameters);
+
+            ReflectionManager* reflection = ReflectionEnvironment::GetReflectionManager();
+            const size_t numDeferred = reflection->GetNumDeferredEntryPoints();
+            EXPECT_LT(0, numDeferred);
+            EXPECT_NE(nullptr, app.GetSerializeContext()->FindClassData(azrtti_typeid<Entity>()));
+            EXPECT_GT(numDeferred, reflection->GetNumDeferredEntryPoints());
+
+            app.Destroy();
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class ReflectionSnapshotBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        // Entry points like the ones an application registers on startup
+        static void ReflectEntryPoints(AZ::ReflectionManager& reflection)
+        {
+            reflection.Reflect(azrtti_typeid<AZ::Vector3>(), &AZ::MathReflect);
+            reflection.Reflect(azrtti_typeid<AZ::Entity>(), &AZ::Entity::Reflect);
+            reflection.Reflect(azrtti_typeid<UnitTest::SnapshotDerived>(), &UnitTest::SnapshotDerived::Reflect);
+            reflection.Reflect(azrtti_typeid<UnitTest::SnapshotOther>(), &UnitTest::SnapshotOther::Reflect);
+        }
+
+        static void AddContexts(AZ::ReflectionManager& reflection)
+        {
+            reflection.AddReflectContext<AZ::SerializeContext>();
+            reflection.AddReflectContext<AZ::BehaviorContext>();
+        }
+    };
+
+    // Startup reflecting everything, then loading an object
+    BENCHMARK_F(ReflectionSnapshotBenchmarkFixture, BM_ReflectionStartup_Reflect)(benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZ::ReflectionManager reflection;
+            AddContexts(reflection);
+            ReflectEntryPoints(reflection);
+            benchmark::DoNotOptimize(reflection.GetReflectContext<AZ::SerializeContext>()->FindClassData(azrtti_typeid<UnitTest::SnapshotOther>()));
+        }
+    }
+
+    // Same startup from a snapshot, only the entry points of the object are reflected to the SerializeContext
+    BENCHMARK_F(ReflectionSnapshotBenchmarkFixture, BM_ReflectionStartup_Snapshot)(benchmark::State& state)
+    {
+        AZ::ReflectionSnapshot recorded;
+        {
+            AZ::ReflectionManager reflection;
+            AddContexts(reflection);
+            reflection.RecordSnapshot(&recorded);
+            ReflectEntryPoints(reflection);
+            reflection.RecordSnapshot(nullptr);
+        }
+
+        while (state.KeepRunning())
+        {
+            AZ::ReflectionSnapshot snapshot = recorded;
+            AZ::ReflectionManager reflection;
+            AddContexts(reflection);
+            reflection.SetSnapshot(AZStd::move(snapshot));
+            ReflectEntryPoints(reflection);
+            benchmark::DoNotOptimize(reflection.GetReflectContext<AZ::SerializeContext>()->FindClassData(azrtti_typeid<UnitTest::SnapshotOther>()));
+        }
+    }
 }
+#endif // HAVE_BENCHMARK
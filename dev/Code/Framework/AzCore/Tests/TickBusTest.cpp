@@ -9,11 +9,21 @@
 * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 *
 */
+#include <AzCore/Component/PhasedTickScheduler.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 using namespace AZ;
 
 // TickBus handler with customizable tick-order.
@@ -69,4 +79,331 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
 
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
-}
\ No newline at end of file
+}
+
+// PhasedTickBus handler recording its id when ticked.
+struct PhasedTicker : public PhasedTickBus::Handler
+{
+    int m_id = 0;
+    int m_phase = TICK_DEFAULT;
+    bool m_declaresResources = true;
+    AZStd::vector<Crc32> m_reads;
+    AZStd::vector<Crc32> m_writes;
+    AZStd::vector<int>* m_targetList = nullptr;
+    AZStd::mutex* m_targetMutex = nullptr;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // PhasedTickBus
+    int GetTickPhase() override { return m_phase; }
+
+    void DeclareTickResources(PhasedTickResources& resources) override
+    {
+        if (!m_declaresResources)
+        {
+            PhasedTickBus::Handler::DeclareTickResources(resources);
+            return;
+        }
+        for (Crc32 tag : m_reads)
+        {
+            resources.Read(tag);
+        }
+        for (Crc32 tag : m_writes)
+        {
+            resources.Write(tag);
+        }
+    }
+
+    void OnPhasedTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        if (m_targetList)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(*m_targetMutex);
+            m_targetList->push_back(m_id);
+        }
+    }
+    ///////////////////////////////////////////////////////////////////////////
+};
+
+class PhasedTickBusTest
+    : public UnitTest::AllocatorsFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsFixture::SetUp();
+
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+
+        JobManagerDesc desc;
+        JobManagerThreadDesc threadDesc;
+        for (int i = 0; i < 4; ++i)
+        {
+            desc.m_workerThreads.push_back(threadDesc);
+        }
+        m_jobManager = aznew JobManager(desc);
+        m_jobContext = aznew JobContext(*m_jobManager);
+
+        m_scheduler = aznew PhasedTickScheduler(m_jobContext);
+    }
+
+    void TearDown() override
+    {
+        m_tickers.clear();
+        delete m_scheduler;
+        delete m_jobContext;
+        delete m_jobManager;
+
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+
+        UnitTest::AllocatorsFixture::TearDown();
+    }
+
+    PhasedTicker& AddTicker(int id, int phase)
+    {
+        m_tickers.emplace_back();
+        PhasedTicker& ticker = m_tickers.back();
+        ticker.m_id = id;
+        ticker.m_phase = phase;
+        ticker.m_targetList = &m_tickedIds;
+        ticker.m_targetMutex = &m_tickedMutex;
+        return ticker;
+    }
+
+    void ConnectAll()
+    {
+        for (PhasedTicker& ticker : m_tickers)
+        {
+            ticker.BusConnect();
+        }
+    }
+
+    void Tick()
+    {
+        TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+    }
+
+    JobManager* m_jobManager = nullptr;
+    JobContext* m_jobContext = nullptr;
+    PhasedTickScheduler* m_scheduler = nullptr;
+    AZStd::list<PhasedTicker> m_tickers;
+    AZStd::vector<int> m_tickedIds;
+    AZStd::mutex m_tickedMutex;
+};
+
+TEST_F(PhasedTickBusTest, OnTick_PhasesInterleaveWithTickBusHandlers)
+{
+    AZStd::vector<int> actualTickOrder;
+
+    OrderedTicker early;
+    early.m_order = TICK_PLACEMENT;
+    early.m_targetList = &actualTickOrder;
+    early.TickBus::Handler::BusConnect();
+
+    OrderedTicker late;
+    late.m_order = TICK_UI;
+    late.m_targetList = &actualTickOrder;
+    late.TickBus::Handler::BusConnect();
+
+    AddTicker(TICK_ANIMATION, TICK_ANIMATION).m_targetList = &actualTickOrder;
+    ConnectAll();
+
+    Tick();
+
+    AZStd::vector<int> expectedOrder = { TICK_PLACEMENT, TICK_ANIMATION, TICK_UI };
+    EXPECT_EQ(expectedOrder, actualTickOrder);
+
+    early.TickBus::Handler::BusDisconnect();
+    late.TickBus::Handler::BusDisconnect();
+}
+
+TEST_F(PhasedTickBusTest, Rebuild_ReadersShareWaveAndWritersAreOrdered)
+{
+    const Crc32 transforms = AZ_CRC_CE("Transforms");
+
+    AddTicker(0, TICK_GAME).m_reads = { transforms };
+    AddTicker(1, TICK_GAME).m_reads = { transforms };
+    AddTicker(2, TICK_GAME).m_writes = { transforms };
+    AddTicker(3, TICK_GAME).m_reads = { transforms };
+    ConnectAll();
+
+    Tick();
+
+    // two readers in parallel, the writer, then the last reader
+    EXPECT_EQ(3, m_scheduler->GetNumWaves(TICK_GAME));
+    ASSERT_EQ(4, m_tickedIds.size());
+    EXPECT_EQ(2, m_tickedIds[2]);
+    EXPECT_EQ(3, m_tickedIds[3]);
+}
+
+TEST_F(PhasedTickBusTest, Rebuild_IndependentHandlersShareOneWave)
+{
+    for (int i = 0; i < 64; ++i)
+    {
+        AddTicker(i, TICK_GAME).m_writes = { Crc32(static_cast<AZ::u32>(i)) };
+    }
+    ConnectAll();
+
+    Tick();
+
+    EXPECT_EQ(1, m_scheduler->GetNumWaves(TICK_GAME));
+    EXPECT_EQ(64, m_tickedIds.size());
+}
+
+TEST_F(PhasedTickBusTest, Rebuild_UndeclaredHandlersKeepConnectionOrder)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        AddTicker(i, TICK_GAME).m_declaresResources = false;
+    }
+    ConnectAll();
+
+    Tick();
+
+    AZStd::vector<int> expectedOrder = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    EXPECT_EQ(expectedOrder, m_tickedIds);
+    EXPECT_EQ(8, m_scheduler->GetNumWaves(TICK_GAME));
+}
+
+TEST_F(PhasedTickBusTest, Disconnect_HandlerIsNotTicked)
+{
+    AddTicker(0, TICK_GAME);
+    PhasedTicker& removed = AddTicker(1, TICK_GAME);
+    ConnectAll();
+
+    Tick();
+    removed.BusDisconnect();
+    Tick();
+
+    AZStd::vector<int> expectedOrder = { 0, 1, 0 };
+    EXPECT_EQ(expectedOrder, m_tickedIds);
+}
+
+TEST_F(PhasedTickBusTest, GetHandlerStats_CountsTicks)
+{
+    PhasedTicker& ticker = AddTicker(0, TICK_GAME);
+    ConnectAll();
+
+    Tick();
+    Tick();
+
+    PhasedTickStats stats;
+    ASSERT_TRUE(m_scheduler->GetHandlerStats(&ticker, stats));
+    EXPECT_EQ(2, stats.m_tickCount);
+    EXPECT_GE(stats.m_totalTimeUs, stats.m_peakTimeUs);
+
+    m_scheduler->ResetStats();
+    ASSERT_TRUE(m_scheduler->GetHandlerStats(&ticker, stats));
+    EXPECT_EQ(0, stats.m_tickCount);
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Handler doing a small amount of work on its own data, as a gameplay component would.
+    struct BenchmarkTicker
+        : public TickBus::Handler
+        , public PhasedTickBus::Handler
+    {
+        float m_value = 0.0f;
+        AZ::u32 m_resource = 0;
+
+        void Work(float deltaTime)
+        {
+            for (int i = 0; i < 64; ++i)
+            {
+                m_value = m_value * 0.99f + deltaTime;
+            }
+        }
+
+        // TickBus
+        void OnTick(float deltaTime, ScriptTimePoint /*time*/) override { Work(deltaTime); }
+
+        // PhasedTickBus
+        void OnPhasedTick(float deltaTime, ScriptTimePoint /*time*/) override { Work(deltaTime); }
+        void DeclareTickResources(PhasedTickResources& resources) override { resources.Write(Crc32(m_resource)); }
+    };
+
+    class BM_PhasedTick
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            m_scheduler = aznew PhasedTickScheduler(m_jobContext);
+
+            m_tickers.resize(s_numTickers);
+            for (size_t i = 0; i < m_tickers.size(); ++i)
+            {
+                m_tickers[i].m_resource = static_cast<AZ::u32>(i);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_tickers.clear();
+            delete m_scheduler;
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static const size_t s_numTickers = 10000;
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        PhasedTickScheduler* m_scheduler = nullptr;
+        AZStd::vector<BenchmarkTicker> m_tickers;
+    };
+
+    BENCHMARK_F(BM_PhasedTick, SerialTickBus)(benchmark::State& state)
+    {
+        for (BenchmarkTicker& ticker : m_tickers)
+        {
+            ticker.TickBus::Handler::BusConnect();
+        }
+        while (state.KeepRunning())
+        {
+            TickBus::Broadcast(&TickBus::Events::OnTick, 0.016f, ScriptTimePoint{});
+        }
+        for (BenchmarkTicker& ticker : m_tickers)
+        {
+            ticker.TickBus::Handler::BusDisconnect();
+        }
+    }
+
+    BENCHMARK_F(BM_PhasedTick, PhasedTickBus)(benchmark::State& state)
+    {
+        for (BenchmarkTicker& ticker : m_tickers)
+        {
+            ticker.PhasedTickBus::Handler::BusConnect();
+        }
+        while (state.KeepRunning())
+        {
+            TickBus::Broadcast(&TickBus::Events::OnTick, 0.016f, ScriptTimePoint{});
+        }
+        for (BenchmarkTicker& ticker : m_tickers)
+        {
+            ticker.PhasedTickBus::Handler::BusDisconnect();
+        }
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -14,8 +14,6 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/algorithm.h>
-#include <AzCore/std/string/wildcard.h>
-#include <AzCore/std/string/regex.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -284,6 +282,8 @@ namespace AzFramework
                     m_fileTagsMap[data.first] = data.second;
                 }
             }
+
+            BuildTagIndex();
             return true;
         }
 
@@ -344,6 +344,7 @@ namespace AzFramework
                 }
             }
 
+            BuildTagIndex();
             return true;
         }
 
@@ -367,38 +368,23 @@ namespace AzFramework
         AZStd::set<AZStd::string> FileTagQueryManager::GetTags(const AZStd::string& filePath)
         {
             AZStd::set<AZStd::string> tags;
-            AZStd::string resolvedFilePath = ResolveFilePath(filePath);
-
-            auto found = AZStd::find_if(m_fileTagsMap.begin(), m_fileTagsMap.end(), [filePath, resolvedFilePath, this](auto& entry) -> bool
-            {
-                return resolvedFilePath == ResolveFilePath(entry.first);
-            });
-
-            if (found != m_fileTagsMap.end())
-            {
-                tags.insert(found->second.m_fileTags.begin(), found->second.m_fileTags.end());
-            }
+            m_tagIndex.GetTags(ResolveFilePath(filePath), tags);
+            return tags;
+        }
 
-            for (const AZStd::pair<AZStd::string, AzFramework::FileTag::FileTagData>& data : m_patternTagsMap)
+        AZStd::vector<AZStd::set<AZStd::string>> FileTagQueryManager::GetTagsForFiles(const AZStd::vector<AZStd::string>& filePaths)
+        {
+            AZStd::vector<AZStd::set<AZStd::string>> tags(filePaths.size());
+            for (size_t fileIndex = 0; fileIndex < filePaths.size(); ++fileIndex)
             {
-                if (data.second.m_filePatternType == AzFramework::FileTag::FilePatternType::Wildcard)
-                {
-                    if (AZStd::wildcard_match(ResolveFilePath(data.first), resolvedFilePath))
-                    {
-                        tags.insert(data.second.m_fileTags.begin(), data.second.m_fileTags.end());
-                    }
-                }
-                else
-                {
-                    AZStd::regex regex(data.first, AZStd::regex::extended);
-                    if (AZStd::regex_match(resolvedFilePath.c_str(), regex))
-                    {
-                        tags.insert(data.second.m_fileTags.begin(), data.second.m_fileTags.end());
-                    }
-                }
+                m_tagIndex.GetTags(ResolveFilePath(filePaths[fileIndex]), tags[fileIndex]);
             }
-
             return tags;
         }
+
+        void FileTagQueryManager::BuildTagIndex()
+        {
+            m_tagIndex.Build(m_fileTagsMap, m_patternTagsMap);
+        }
     }
 }
@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/string/string.h>
 #include <AzFramework/FileTag/FileTagBus.h>
+#include <AzFramework/FileTag/FileTagIndex.h>
 
 namespace AzFramework
 {
@@ -38,6 +39,9 @@ namespace AzFramework
         };
         using FileTagAssetsMap = AZStd::map<FileTagType, AZStd::unique_ptr<AzFramework::FileTag::FileTagAsset>>;
 
+        //! Resolves the aliases of a file path or pattern and fixes its separators, wildcard characters are kept.
+        AZStd::string ResolveFilePath(const AZStd::string& filePath);
+
         //! File Tag Manager class can be used to add/remove tags based on either filepaths or file patterns.
         class FileTagManager
             : public FileTagsEventBus::Handler
@@ -89,13 +93,17 @@ namespace AzFramework
             bool LoadEngineDependencies(const AZStd::string& filePath) override;
             bool Match(const AZStd::string& filePath, AZStd::vector<AZStd::string> fileTags) override;
             AZStd::set<AZStd::string> GetTags(const AZStd::string& filePath) override;
+            AZStd::vector<AZStd::set<AZStd::string>> GetTagsForFiles(const AZStd::vector<AZStd::string>& filePaths) override;
 
             /////////////////////////////////////////////////////////////////////////
 
             static AZStd::string GetDefaultFileTagFilePath(FileTagType fileTagType);
 
         protected:
+            //! Rebuilds the tag index from the tag maps, needs to be called after the maps are changed.
+            void BuildTagIndex();
 
+            AzFramework::FileTag::FileTagIndex m_tagIndex;
             AzFramework::FileTag::FileTagMap m_fileTagsMap;
             AzFramework::FileTag::FileTagMap m_patternTagsMap;
             FileTagType m_fileTagType;
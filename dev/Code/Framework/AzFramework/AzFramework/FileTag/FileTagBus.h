@@ -88,6 +88,10 @@ namespace AzFramework
 
             ///! Given a filepath, returns all of the tags that are on it.
             virtual AZStd::set<AZStd::string> GetTags(const AZStd::string& /*filePath*/) = 0;
+
+            ///! Given a list of filepaths, returns all of the tags that are on each of them, in the same order.
+            ///! Prefer this over calling GetTags for every file when tagging many files.
+            virtual AZStd::vector<AZStd::set<AZStd::string>> GetTagsForFiles(const AZStd::vector<AZStd::string>& /*filePaths*/) = 0;
         };
 
         using QueryFileTagsEventBus = AZ::EBus<QueryFileTagsEvent>;
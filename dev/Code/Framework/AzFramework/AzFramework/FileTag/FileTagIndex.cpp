@@ -0,0 +1,149 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/std/string/wildcard.h>
+#include <AzFramework/FileTag/FileTag.h>
+#include <AzFramework/FileTag/FileTagIndex.h>
+#include <cctype>
+
+namespace AzFramework
+{
+    namespace FileTag
+    {
+        void FileTagIndex::Build(const FileTagMap& fileTagsMap, const FileTagMap& patternTagsMap)
+        {
+            Clear();
+
+            for (const AZStd::pair<AZStd::string, FileTagData>& data : fileTagsMap)
+            {
+                // When several entries resolve to the same path the first one in the map is used
+                AZStd::string resolvedFilePath = ResolveFilePath(data.first);
+                if (m_exactEntries.find(resolvedFilePath) == m_exactEntries.end())
+                {
+                    m_exactEntries.emplace(AZStd::move(resolvedFilePath), AddTagSet(data.second.m_fileTags));
+                }
+            }
+
+            for (const AZStd::pair<AZStd::string, FileTagData>& data : patternTagsMap)
+            {
+                if (data.second.m_filePatternType == FilePatternType::Wildcard)
+                {
+                    AddWildcardPattern(ResolveFilePath(data.first), AddTagSet(data.second.m_fileTags));
+                }
+                else
+                {
+                    m_regexPatterns.push_back({ AZStd::regex(data.first, AZStd::regex::extended), AddTagSet(data.second.m_fileTags) });
+                }
+            }
+        }
+
+        void FileTagIndex::Clear()
+        {
+            m_tagSets.clear();
+            m_exactEntries.clear();
+            m_wildcardPatterns.clear();
+            m_trieNodes.clear();
+            m_trieEdges.clear();
+            m_regexPatterns.clear();
+        }
+
+        void FileTagIndex::GetTags(const AZStd::string& resolvedFilePath, AZStd::set<AZStd::string>& fileTags) const
+        {
+            auto found = m_exactEntries.find(resolvedFilePath);
+            if (found != m_exactEntries.end())
+            {
+                const AZStd::set<AZStd::string>& tagSet = m_tagSets[found->second];
+                fileTags.insert(tagSet.begin(), tagSet.end());
+            }
+
+            if (!m_trieNodes.empty())
+            {
+                // Walk down the trie along the path, every node reached holds patterns whose literal prefix matches it
+                AZ::u32 node = 0;
+                for (const char* character = resolvedFilePath.c_str(); ; ++character)
+                {
+                    for (AZ::u32 patternIndex : m_trieNodes[node].m_patterns)
+                    {
+                        const WildcardPattern& pattern = m_wildcardPatterns[patternIndex];
+                        if (AZStd::wildcard_match(pattern.m_resolvedPattern, resolvedFilePath))
+                        {
+                            const AZStd::set<AZStd::string>& tagSet = m_tagSets[pattern.m_tagSet];
+                            fileTags.insert(tagSet.begin(), tagSet.end());
+                        }
+                    }
+
+                    if (!*character)
+                    {
+                        break;
+                    }
+
+                    auto edge = m_trieEdges.find(GetEdgeKey(node, *character));
+                    if (edge == m_trieEdges.end())
+                    {
+                        break;
+                    }
+                    node = edge->second;
+                }
+            }
+
+            for (const RegexPattern& pattern : m_regexPatterns)
+            {
+                if (AZStd::regex_match(resolvedFilePath.c_str(), pattern.m_regex))
+                {
+                    const AZStd::set<AZStd::string>& tagSet = m_tagSets[pattern.m_tagSet];
+                    fileTags.insert(tagSet.begin(), tagSet.end());
+                }
+            }
+        }
+
+        FileTagIndex::TagSetIndex FileTagIndex::AddTagSet(const AZStd::set<AZStd::string>& fileTags)
+        {
+            m_tagSets.push_back(fileTags);
+            return static_cast<TagSetIndex>(m_tagSets.size() - 1);
+        }
+
+        void FileTagIndex::AddWildcardPattern(const AZStd::string& resolvedPattern, TagSetIndex tagSet)
+        {
+            if (m_trieNodes.empty())
+            {
+                m_trieNodes.emplace_back();
+            }
+
+            // Wildcards are matched ignoring case, so is the prefix
+            AZ::u32 node = 0;
+            for (const char* character = resolvedPattern.c_str(); *character && *character != '*' && *character != '?'; ++character)
+            {
+                const AZ::u64 edgeKey = GetEdgeKey(node, *character);
+                auto edge = m_trieEdges.find(edgeKey);
+                if (edge == m_trieEdges.end())
+                {
+                    const AZ::u32 child = static_cast<AZ::u32>(m_trieNodes.size());
+                    m_trieNodes.emplace_back();
+                    m_trieEdges.emplace(edgeKey, child);
+                    node = child;
+                }
+                else
+                {
+                    node = edge->second;
+                }
+            }
+
+            m_trieNodes[node].m_patterns.push_back(static_cast<AZ::u32>(m_wildcardPatterns.size()));
+            m_wildcardPatterns.push_back({ resolvedPattern, tagSet });
+        }
+
+        AZ::u64 FileTagIndex::GetEdgeKey(AZ::u32 node, char character)
+        {
+            return (static_cast<AZ::u64>(node) << 8) | static_cast<AZ::u8>(tolower(static_cast<unsigned char>(character)));
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/regex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Asset/FileTagAsset.h>
+
+namespace AzFramework
+{
+    namespace FileTag
+    {
+        //! Precompiled lookup of the tags of a file tag asset, so a query doesn't visit every entry of the asset.
+        //! Exact entries are hashed by their resolved path. Wildcard patterns are stored in a trie keyed by the
+        //! literal prefix in front of their first wildcard, only the patterns whose prefix starts the queried path
+        //! are matched. Regex patterns are compiled once, when the index is built.
+        //! Aliases in the entries are resolved when the index is built.
+        class FileTagIndex
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(FileTagIndex, AZ::SystemAllocator, 0);
+
+            void Build(const FileTagMap& fileTagsMap, const FileTagMap& patternTagsMap);
+            void Clear();
+
+            //! Adds the tags of the entries matching a resolved file path to fileTags.
+            void GetTags(const AZStd::string& resolvedFilePath, AZStd::set<AZStd::string>& fileTags) const;
+
+        private:
+            using TagSetIndex = AZ::u32;
+
+            struct WildcardPattern
+            {
+                AZStd::string m_resolvedPattern;
+                TagSetIndex m_tagSet;
+            };
+
+            struct RegexPattern
+            {
+                AZStd::regex m_regex;
+                TagSetIndex m_tagSet;
+            };
+
+            struct TrieNode
+            {
+                //! Wildcard patterns whose literal prefix ends at this node
+                AZStd::vector<AZ::u32> m_patterns;
+            };
+
+            TagSetIndex AddTagSet(const AZStd::set<AZStd::string>& fileTags);
+            void AddWildcardPattern(const AZStd::string& resolvedPattern, TagSetIndex tagSet);
+            static AZ::u64 GetEdgeKey(AZ::u32 node, char character);
+
+            AZStd::vector<AZStd::set<AZStd::string>> m_tagSets;
+            AZStd::unordered_map<AZStd::string, TagSetIndex> m_exactEntries;
+
+            AZStd::vector<WildcardPattern> m_wildcardPatterns;
+            AZStd::vector<TrieNode> m_trieNodes;
+            AZStd::unordered_map<AZ::u64, AZ::u32> m_trieEdges;
+
+            AZStd::vector<RegexPattern> m_regexPatterns;
+        };
+    }
+}
@@ -113,6 +113,10 @@ namespace AzToolsFramework
         /// @brief Notifies listeners about in-editor selection events (mouse hover, selected, etc.)
         virtual void OnAccentTypeChanged(EntityAccentType /*accent*/) {}
 
+        /// @brief Notifies listeners that GetEditorSelectionBoundsViewport changed without the entity moving
+        /// or its properties being edited (e.g. a mesh asset finished loading).
+        virtual void OnEditorSelectionBoundsChanged() {}
+
     protected:
         ~EditorComponentSelectionNotifications() = default;
     };
@@ -14,6 +14,7 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -106,6 +107,59 @@ namespace AzToolsFramework
         AzToolsFramework::ProcessCommunicator* m_communicator = nullptr;
     };
 
+    static bool ReportResult(const AZ::Outcome<void, AZStd::string>& result)
+    {
+        AZ_Warning(s_traceName, result.IsSuccess(), "%s", result.IsSuccess() ? "" : result.GetError().c_str());
+        return result.IsSuccess();
+    }
+
+    // Archives extracted with their root go in a folder named after the archive, as with the zip executables
+    static AZStd::string GetExtractionPath(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool includeRoot)
+    {
+        AZStd::string archiveName;
+        if (!includeRoot || !AzFramework::StringFunc::Path::GetFileName(archivePath.c_str(), archiveName))
+        {
+            return destinationPath;
+        }
+
+        AZStd::string extractionPath;
+        AzFramework::StringFunc::Path::Join(destinationPath.c_str(), archiveName.c_str(), extractionPath);
+        return extractionPath;
+    }
+
+    // Files which already exist are skipped, as the zip executables are told to
+    static AZ::Outcome<void, AZStd::string> ExtractArchiveNative(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool includeRoot, const ZipArchive::CancelCheck& isCancelled = {})
+    {
+        return ZipArchive::ExtractArchive(archivePath, GetExtractionPath(archivePath, destinationPath, includeRoot), false, isCancelled);
+    }
+
+    // Adds the files of a list file, one path per line. A relative list file path is relative to the working directory.
+    static AZ::Outcome<void, AZStd::string> AddFilesToArchiveNative(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& listFilePath, const ZipArchive::CancelCheck& isCancelled = {})
+    {
+        AZStd::string fullListFilePath = listFilePath;
+        if (!workingDirectory.empty() && AzFramework::StringFunc::Path::IsRelative(listFilePath.c_str()))
+        {
+            AzFramework::StringFunc::Path::Join(workingDirectory.c_str(), listFilePath.c_str(), fullListFilePath);
+        }
+
+        const AZ::u64 listFileSize = AZ::IO::SystemFile::Length(fullListFilePath.c_str());
+        AZStd::string listFileContent;
+        listFileContent.resize(listFileSize);
+        if (listFileSize == 0 || AZ::IO::SystemFile::Read(fullListFilePath.c_str(), listFileContent.data(), listFileSize) != listFileSize)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to read list file '%s'.", fullListFilePath.c_str()));
+        }
+
+        AZStd::vector<AZStd::string> filePaths;
+        AzFramework::StringFunc::Tokenize(listFileContent.c_str(), filePaths, "\r\n");
+        for (AZStd::string& filePath : filePaths)
+        {
+            AzFramework::StringFunc::TrimWhiteSpace(filePath, true, true);
+        }
+
+        return ZipArchive::AddFiles(archivePath, workingDirectory, filePaths, isCancelled);
+    }
+
     void ArchiveComponent::Activate()
     {
         m_zipExePath = Platform::GetZipExePath();
@@ -135,8 +189,9 @@ namespace AzToolsFramework
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<ArchiveComponent, AZ::Component>()
-                ->Version(2)
+                ->Version(3)
                 ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AZ_CRC("AssetBuilder", 0xc739c7d7) }))
+                ->Field("UseExternalZip", &ArchiveComponent::m_useExternalZip)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -146,6 +201,8 @@ namespace AzToolsFramework
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                     ->Attribute(AZ::Edit::Attributes::Category, "Editor")
                     ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ArchiveComponent::m_useExternalZip, "Use external zip",
+                        "Launches the zip executables shipped with the engine instead of reading and writing the archives in process.")
                     ;
             }
         }
@@ -153,12 +210,26 @@ namespace AzToolsFramework
 
     void ArchiveComponent::CreateArchive(const AZStd::string& archivePath, const AZStd::string& dirToArchive, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, dirToArchive](const ZipArchive::CancelCheck& isCancelled)
+            {
+                return ZipArchive::AddDirectory(archivePath, dirToArchive, isCancelled);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = AZStd::string::format(R"(a -tzip -mx=1 "%s" -r "%s\*")", archivePath.c_str(), dirToArchive.c_str());
         LaunchZipExe(m_zipExePath, commandLineArgs, respCallback, taskHandle);
     }
 
     bool ArchiveComponent::CreateArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& dirToArchive)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(ZipArchive::AddDirectory(archivePath, dirToArchive));
+        }
+
         bool success = false;
         auto createArchiveCallback = [&success](bool result, AZStd::string consoleOutput) {
             success = result;
@@ -184,6 +255,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::ExtractArchiveOutput(const AZStd::string& archivePath, const AZStd::string& destinationPath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, destinationPath](const ZipArchive::CancelCheck& isCancelled)
+            {
+                return ExtractArchiveNative(archivePath, destinationPath, true, isCancelled);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, true);
 
         if (commandLineArgs.empty())
@@ -197,6 +277,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::ExtractArchiveWithoutRoot(const AZStd::string& archivePath, const AZStd::string& destinationPath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, destinationPath](const ZipArchive::CancelCheck& isCancelled)
+            {
+                return ExtractArchiveNative(archivePath, destinationPath, false, isCancelled);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, false);
 
         if (commandLineArgs.empty())
@@ -210,6 +299,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::ExtractFile(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overWrite, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, fileInArchive, destinationPath, overWrite](const ZipArchive::CancelCheck& /*isCancelled*/)
+            {
+                return ZipArchive::ExtractFile(archivePath, fileInArchive, destinationPath, overWrite);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = AzToolsFramework::Platform::GetExtractFileCommand(archivePath, fileInArchive, destinationPath, overWrite);
         if (commandLineArgs.empty())
         {
@@ -221,6 +319,11 @@ namespace AzToolsFramework
 
     bool ArchiveComponent::ExtractFileBlocking(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overWrite)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(ZipArchive::ExtractFile(archivePath, fileInArchive, destinationPath, overWrite));
+        }
+
         AZStd::string commandLineArgs = AzToolsFramework::Platform::GetExtractFileCommand(archivePath, fileInArchive, destinationPath, overWrite);
         if (commandLineArgs.empty())
         {
@@ -238,6 +341,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::ListFilesInArchive(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& fileEntries, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, &fileEntries](const ZipArchive::CancelCheck& /*isCancelled*/)
+            {
+                return ZipArchive::ListFiles(archivePath, fileEntries);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = Platform::GetListFilesInArchiveCommand(archivePath);
         
         auto parseOutput = [respCallback, taskHandle, &fileEntries](bool exitCode, AZStd::string consoleOutput)
@@ -250,6 +362,11 @@ namespace AzToolsFramework
 
     bool ArchiveComponent::ListFilesInArchiveBlocking(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& fileEntries)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(ZipArchive::ListFiles(archivePath, fileEntries));
+        }
+
         AZStd::string listOutput;
         AZStd::string commandLineArgs = Platform::GetListFilesInArchiveCommand(archivePath.c_str());
         bool success = false;
@@ -265,6 +382,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::AddFileToArchive(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& fileToAdd, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, workingDirectory, fileToAdd](const ZipArchive::CancelCheck& isCancelled)
+            {
+                return ZipArchive::AddFiles(archivePath, workingDirectory, { fileToAdd }, isCancelled);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = Platform::GetAddFileToArchiveCommand(archivePath, fileToAdd);
         if (commandLineArgs.empty())
         {
@@ -277,6 +403,11 @@ namespace AzToolsFramework
 
     bool ArchiveComponent::AddFileToArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& fileToAdd)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(ZipArchive::AddFiles(archivePath, workingDirectory, { fileToAdd }));
+        }
+
         AZStd::string commandLineArgs = Platform::GetAddFileToArchiveCommand(archivePath, fileToAdd);
         if (commandLineArgs.empty())
         {
@@ -294,6 +425,11 @@ namespace AzToolsFramework
 
     bool ArchiveComponent::AddFilesToArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& listFilePath)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(AddFilesToArchiveNative(archivePath, workingDirectory, listFilePath));
+        }
+
         bool success = false;
 
         auto addFileToArchiveCallback = [&success](bool result, AZStd::string consoleOutput) {
@@ -313,6 +449,15 @@ namespace AzToolsFramework
 
     void ArchiveComponent::AddFilesToArchive(const AZStd::string& archivePath, const AZStd::string& workingDirectory, const AZStd::string& listFilePath, AZ::Uuid taskHandle, const ArchiveResponseOutputCallback& respCallback)
     {
+        if (!m_useExternalZip)
+        {
+            LaunchNativeTask([archivePath, workingDirectory, listFilePath](const ZipArchive::CancelCheck& isCancelled)
+            {
+                return AddFilesToArchiveNative(archivePath, workingDirectory, listFilePath, isCancelled);
+            }, respCallback, taskHandle);
+            return;
+        }
+
         AZStd::string commandLineArgs = Platform::GetAddFilesToArchiveCommand(archivePath, listFilePath);
         if (commandLineArgs.empty())
         {
@@ -326,6 +471,11 @@ namespace AzToolsFramework
 
     bool ArchiveComponent::ExtractArchiveBlocking(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool extractWithRootDirectory)
     {
+        if (!m_useExternalZip)
+        {
+            return ReportResult(ExtractArchiveNative(archivePath, destinationPath, extractWithRootDirectory));
+        }
+
         AZStd::string commandLineArgs = Platform::GetExtractArchiveCommand(archivePath, destinationPath, extractWithRootDirectory);
 
         if (commandLineArgs.empty())
@@ -365,13 +515,6 @@ namespace AzToolsFramework
     {
         auto sevenZJob = [=]()
         {
-            if (!taskHandle.IsNull())
-            {
-                AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-                m_threadInfoMap[taskHandle].threads.insert(AZStd::this_thread::get_id());
-                m_cv.notify_all();
-            }
-
             ProcessLauncher::ProcessLaunchInfo info;
             info.m_commandlineParameters = exePath + " " + commandLineArgs;
             
@@ -392,13 +535,9 @@ namespace AzToolsFramework
                     AZStd::string consoleBuffer;
                     while (watcher->IsProcessRunning(&exitCode))
                     {
-                        if (!taskHandle.IsNull())
+                        if (IsTaskCancelled(taskHandle))
                         {
-                            AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-                            if (m_threadInfoMap[taskHandle].shouldStop)
-                            {
-                                watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
-                            }
+                            watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
                         }
                         watcher->WaitForProcessToExit(g_sleepDuration);
                         AZ::u32 outputSize = watcher->GetCommunicator()->PeekOutput();
@@ -415,13 +554,9 @@ namespace AzToolsFramework
                     ConsoleEchoCommunicator echoCommunicator(watcher->GetCommunicator());
                     while (watcher->IsProcessRunning(&exitCode))
                     {
-                        if (!taskHandle.IsNull())
+                        if (IsTaskCancelled(taskHandle))
                         {
-                            AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-                            if (m_threadInfoMap[taskHandle].shouldStop)
-                            {
-                                watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
-                            }
+                            watcher->TerminateProcess(static_cast<AZ::u32>(SevenZipExitCode::UserStoppedProcess));
                         }
                         watcher->WaitForProcessToExit(g_sleepDuration);
                         echoCommunicator.Pump();
@@ -429,16 +564,40 @@ namespace AzToolsFramework
                 }
             }
 
-            if (taskHandle.IsNull())
-            {
-                respCallback(exitCode == static_cast<AZ::u32>(SevenZipExitCode::NoError), AZStd::move(consoleOutput));
-            }
-            else
+            SendResponse(respCallback, exitCode == static_cast<AZ::u32>(SevenZipExitCode::NoError), AZStd::move(consoleOutput), taskHandle);
+        };
+        RunTask(sevenZJob, taskHandle);
+    }
+
+    void ArchiveComponent::LaunchNativeTask(const NativeTask& task, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle)
+    {
+        auto nativeJob = [this, task, respCallback, taskHandle]()
+        {
+            AZ::Outcome<void, AZStd::string> result = task([this, taskHandle]() { return IsTaskCancelled(taskHandle); });
+            ReportResult(result);
+            SendResponse(respCallback, result.IsSuccess(), result.IsSuccess() ? AZStd::string() : result.TakeError(), taskHandle);
+        };
+        RunTask(nativeJob, taskHandle);
+    }
+
+    void ArchiveComponent::RunTask(const AZStd::function<void()>& task, AZ::Uuid taskHandle)
+    {
+        if (taskHandle.IsNull())
+        {
+            task();
+            return;
+        }
+
+        auto trackedTask = [this, task, taskHandle]()
+        {
             {
-                AZ::TickBus::QueueFunction(respCallback, (exitCode == static_cast<AZ::u32>(SevenZipExitCode::NoError)), AZStd::move(consoleOutput));
+                AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
+                m_threadInfoMap[taskHandle].threads.insert(AZStd::this_thread::get_id());
+                m_cv.notify_all();
             }
 
-            if (!taskHandle.IsNull())
+            task();
+
             {
                 AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
                 ThreadInfo& tInfo = m_threadInfoMap[taskHandle];
@@ -446,19 +605,36 @@ namespace AzToolsFramework
                 m_cv.notify_all();
             }
         };
-        if (!taskHandle.IsNull())
+
+        AZStd::thread processThread(trackedTask);
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
+        ThreadInfo& info = m_threadInfoMap[taskHandle];
+        m_cv.wait(lock, [&info, &processThread]() {
+            return info.threads.find(processThread.get_id()) != info.threads.end();
+        });
+        processThread.detach();
+    }
+
+    bool ArchiveComponent::IsTaskCancelled(AZ::Uuid taskHandle)
+    {
+        if (taskHandle.IsNull())
         {
-            AZStd::thread processThread(sevenZJob);
-            AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
-            ThreadInfo& info = m_threadInfoMap[taskHandle];
-            m_cv.wait(lock, [&info, &processThread]() {
-                return info.threads.find(processThread.get_id()) != info.threads.end();
-            });
-            processThread.detach();
+            return false;
+        }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadControlMutex);
+        return m_threadInfoMap[taskHandle].shouldStop;
+    }
+
+    void ArchiveComponent::SendResponse(const ArchiveResponseOutputCallback& respCallback, bool result, AZStd::string output, AZ::Uuid taskHandle)
+    {
+        if (taskHandle.IsNull())
+        {
+            respCallback(result, AZStd::move(output));
         }
         else
         {
-            sevenZJob();
+            AZ::TickBus::QueueFunction(respCallback, result, AZStd::move(output));
         }
     }
 } // namespace AzToolsFramework
@@ -20,6 +20,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
+#include <AzToolsFramework/Archive/ZipArchive.h>
 
 namespace AzToolsFramework
 {
@@ -34,7 +35,8 @@ namespace AzToolsFramework
     };
 
     // the ArchiveComponent's job is to execute zip commands.
-    // it parses the status of zip commands and returns results.
+    // the archives are read and written in process by ZipArchive, unless the component is set to launch the zip executables,
+    // in which case it parses the status of zip commands and returns results.
     class ArchiveComponent
         : public AZ::Component
         , private ArchiveCommands::Bus::Handler
@@ -72,12 +74,25 @@ namespace AzToolsFramework
         void CancelTasks(AZ::Uuid taskHandle) override;
         //////////////////////////////////////////////////////////////////////////
         
+        using NativeTask = AZStd::function<AZ::Outcome<void, AZStd::string>(const ZipArchive::CancelCheck& isCancelled)>;
+
         // Launches the input zip exe as a background child process in a detached background thread, if the task handle is not null 
         // otherwise launches input zip exe in the calling thread.
         void LaunchZipExe(const AZStd::string& exePath, const AZStd::string& commandLineArgs, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle = AZ::Uuid::CreateNull(), const AZStd::string& workingDir = "", bool captureOutput = false);
+        // Runs the task in a detached background thread if the task handle is not null, otherwise runs it in the calling thread.
+        // The error of a failed task is passed to the callback as its output.
+        void LaunchNativeTask(const NativeTask& task, const ArchiveResponseOutputCallback& respCallback, AZ::Uuid taskHandle = AZ::Uuid::CreateNull());
+
+        // Runs the function in a detached background thread tracked with the task handle if the task handle is not null,
+        // otherwise runs it in the calling thread.
+        void RunTask(const AZStd::function<void()>& task, AZ::Uuid taskHandle);
+        bool IsTaskCancelled(AZ::Uuid taskHandle);
+        void SendResponse(const ArchiveResponseOutputCallback& respCallback, bool result, AZStd::string output, AZ::Uuid taskHandle);
 
         AZStd::string m_zipExePath;
         AZStd::string m_unzipExePath;
+        // Launches the zip executables instead of reading and writing the archives in process
+        bool m_useExternalZip = false;
 
         // Struct for tracking background threads/tasks
         struct ThreadInfo
@@ -0,0 +1,1175 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzToolsFramework/Archive/ZipArchive.h>
+
+#include <AzCore/Compression/Compression.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+AZ_PUSH_DISABLE_WARNING(4251, "-Wunknown-warning-option") // 4251: 'QFileInfo::d_ptr': class 'QSharedDataPointer<QFileInfoPrivate>' needs to have dll-interface to be used by clients of class 'QFileInfo'
+#include <QDateTime>
+#include <QFileInfo>
+AZ_POP_DISABLE_WARNING
+
+namespace AzToolsFramework
+{
+    namespace ZipArchive
+    {
+        namespace
+        {
+            const AZ::u32 s_localFileHeaderSignature = 0x04034b50;
+            const AZ::u32 s_centralDirectoryHeaderSignature = 0x02014b50;
+            const AZ::u32 s_endOfCentralDirectorySignature = 0x06054b50;
+            const AZ::u32 s_dataDescriptorSignature = 0x08074b50;
+
+            const size_t s_localFileHeaderSize = 30;
+            const size_t s_centralDirectoryHeaderSize = 46;
+            const size_t s_endOfCentralDirectorySize = 22;
+            const size_t s_maxCommentSize = 0xFFFF;
+
+            const AZ::u16 s_methodStore = 0;
+            const AZ::u16 s_methodDeflate = 8;
+            const AZ::u16 s_versionNeeded = 20; // 2.0, the version adding deflate and directories
+            const AZ::u16 s_flagEncrypted = 1 << 0;
+            const AZ::u16 s_flagDataDescriptor = 1 << 3;
+            const AZ::u16 s_flagUtf8 = 1 << 11;
+            const AZ::u32 s_attributeDirectory = 0x10;
+            const AZ::u32 s_attributeArchive = 0x20;
+
+            const AZ::u32 s_maxZipValue = 0xFFFFFFFF;
+            const AZ::u32 s_maxEntries = 0xFFFF;
+
+            // Size of the reads and writes when streaming data between files
+            const AZ::u32 s_streamChunkSize = 256 * 1024;
+            // Maximum size of the files compressed in memory at the same time, a bigger file is streamed into the archive on its own
+            const AZ::u64 s_maxBatchSize = 64 * 1024 * 1024;
+
+            struct CentralDirectoryEntry
+            {
+                bool IsDirectory() const
+                {
+                    return !m_name.empty() && m_name.back() == '/';
+                }
+
+                AZStd::string m_name;
+                AZ::u16 m_flags = 0;
+                AZ::u16 m_method = s_methodStore;
+                AZ::u32 m_crc32 = 0;
+                AZ::u32 m_compressedSize = 0;
+                AZ::u32 m_uncompressedSize = 0;
+                AZ::u32 m_localHeaderOffset = 0;
+                //! The record as it is in the archive, copied to the new central directory when the archive is updated
+                AZStd::vector<AZ::u8> m_record;
+            };
+
+            struct NewEntry
+            {
+                bool IsDirectory() const
+                {
+                    return m_name.back() == '/';
+                }
+
+                AZStd::string m_sourcePath;
+                AZStd::string m_name;
+                AZ::u64 m_sourceSize = 0;
+                AZ::u16 m_dosTime = 0;
+                AZ::u16 m_dosDate = 0;
+
+                // Set when the entry is compressed
+                AZStd::vector<AZ::u8> m_data;
+                AZ::u32 m_crc32 = 0;
+                AZ::u32 m_uncompressedSize = 0;
+                AZ::u16 m_method = s_methodStore;
+                AZStd::string m_error;
+            };
+
+            AZ::u16 ReadU16(const AZ::u8* data)
+            {
+                return static_cast<AZ::u16>(data[0] | (data[1] << 8));
+            }
+
+            AZ::u32 ReadU32(const AZ::u8* data)
+            {
+                return static_cast<AZ::u32>(data[0]) | (static_cast<AZ::u32>(data[1]) << 8) | (static_cast<AZ::u32>(data[2]) << 16) | (static_cast<AZ::u32>(data[3]) << 24);
+            }
+
+            void WriteU16(AZStd::vector<AZ::u8>& buffer, AZ::u16 value)
+            {
+                buffer.push_back(static_cast<AZ::u8>(value));
+                buffer.push_back(static_cast<AZ::u8>(value >> 8));
+            }
+
+            void WriteU32(AZStd::vector<AZ::u8>& buffer, AZ::u32 value)
+            {
+                WriteU16(buffer, static_cast<AZ::u16>(value));
+                WriteU16(buffer, static_cast<AZ::u16>(value >> 16));
+            }
+
+            void PatchU32(AZ::u8* data, AZ::u32 value)
+            {
+                data[0] = static_cast<AZ::u8>(value);
+                data[1] = static_cast<AZ::u8>(value >> 8);
+                data[2] = static_cast<AZ::u8>(value >> 16);
+                data[3] = static_cast<AZ::u8>(value >> 24);
+            }
+
+            bool IsCancelled(const CancelCheck& isCancelled)
+            {
+                return isCancelled && isCancelled();
+            }
+
+            // Runs the function on the job system when there is one, some of the tools using the archives don't start it
+            template<typename Function>
+            void ForEachIndex(size_t start, size_t end, const Function& function)
+            {
+                AZ::JobContext* jobContext = nullptr;
+                AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+                if (end - start > 1 && jobContext)
+                {
+                    AZ::parallel_for(start, end, [&function](AZ::Internal::ParallelIndexType index) { function(static_cast<size_t>(index)); }, jobContext);
+                }
+                else
+                {
+                    for (size_t index = start; index < end; ++index)
+                    {
+                        function(index);
+                    }
+                }
+            }
+
+            AZStd::string ToNativePath(AZStd::string path)
+            {
+                AZStd::replace(path.begin(), path.end(), '/', AZ_CORRECT_FILESYSTEM_SEPARATOR);
+                return path;
+            }
+
+            AZStd::string ToArchivePath(AZStd::string path)
+            {
+                AZStd::replace(path.begin(), path.end(), '\\', '/');
+                while (path.starts_with("./"))
+                {
+                    path.erase(0, 2);
+                }
+                return path;
+            }
+
+            AZStd::string AppendPath(const AZStd::string& directory, const AZStd::string& archivePath)
+            {
+                if (directory.empty())
+                {
+                    return ToNativePath(archivePath);
+                }
+
+                AZStd::string path = directory;
+                if (path.back() != '/' && path.back() != '\\')
+                {
+                    path.push_back(AZ_CORRECT_FILESYSTEM_SEPARATOR);
+                }
+                path.append(ToNativePath(archivePath));
+                return path;
+            }
+
+            // Entries can't be extracted outside of the destination directory
+            bool IsSafeEntryName(const AZStd::string& name)
+            {
+                if (name.empty() || name.front() == '/' || name.find(':') != AZStd::string::npos)
+                {
+                    return false;
+                }
+
+                size_t componentStart = 0;
+                while (componentStart <= name.size())
+                {
+                    size_t componentEnd = name.find('/', componentStart);
+                    if (componentEnd == AZStd::string::npos)
+                    {
+                        componentEnd = name.size();
+                    }
+                    if (name.compare(componentStart, componentEnd - componentStart, "..") == 0)
+                    {
+                        return false;
+                    }
+                    componentStart = componentEnd + 1;
+                }
+                return true;
+            }
+
+            void GetDosDateTime(const AZStd::string& path, AZ::u16& dosTime, AZ::u16& dosDate)
+            {
+                QDateTime modified = QFileInfo(QString::fromUtf8(path.c_str())).lastModified();
+                // The DOS format stores years from 1980 to 2107
+                if (!modified.isValid() || modified.date().year() < 1980)
+                {
+                    modified = QDateTime(QDate(1980, 1, 1), QTime(0, 0));
+                }
+                const QDate date = modified.date();
+                const QTime time = modified.time();
+                dosDate = static_cast<AZ::u16>(((AZStd::min(date.year(), 2107) - 1980) << 9) | (date.month() << 5) | date.day());
+                dosTime = static_cast<AZ::u16>((time.hour() << 11) | (time.minute() << 5) | (time.second() / 2));
+            }
+
+            NewEntry MakeNewEntry(const AZStd::string& sourcePath, const AZStd::string& name, bool isDirectory)
+            {
+                NewEntry entry;
+                entry.m_sourcePath = sourcePath;
+                entry.m_name = name;
+                if (isDirectory)
+                {
+                    entry.m_name.push_back('/');
+                }
+                else
+                {
+                    entry.m_sourceSize = AZ::IO::SystemFile::Length(sourcePath.c_str());
+                }
+                GetDosDateTime(sourcePath, entry.m_dosTime, entry.m_dosDate);
+                return entry;
+            }
+
+            // Adds the content of a directory, sorted by name so archiving the same files always gives the same archive
+            void GatherDirectory(const AZStd::string& directory, const AZStd::string& archiveFolder, AZStd::vector<NewEntry>& entries)
+            {
+                AZStd::vector<AZStd::pair<AZStd::string, bool>> children;
+                AZ::IO::SystemFile::FindFiles(AppendPath(directory, "*").c_str(), [&children](const char* item, bool isFile)
+                {
+                    if (azstricmp(".", item) != 0 && azstricmp("..", item) != 0)
+                    {
+                        children.emplace_back(item, isFile);
+                    }
+                    return true;
+                });
+                AZStd::sort(children.begin(), children.end());
+
+                for (const AZStd::pair<AZStd::string, bool>& child : children)
+                {
+                    const AZStd::string sourcePath = AppendPath(directory, child.first);
+                    const AZStd::string name = archiveFolder + child.first;
+                    entries.push_back(MakeNewEntry(sourcePath, name, !child.second));
+                    if (!child.second)
+                    {
+                        GatherDirectory(sourcePath, name + "/", entries);
+                    }
+                }
+            }
+
+            // Reads the file of an entry chunk by chunk, setting its CRC and size, and hands its data to the output as it is produced,
+            // deflated with a compression level and as is without one. The output returns whether the data could be written.
+            template<typename Output>
+            AZ::Outcome<void, AZStd::string> StreamEntryData(NewEntry& entry, unsigned int compressionLevel, const Output& output)
+            {
+                if (entry.m_sourceSize >= s_maxZipValue)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' is too big to be archived without zip64 support.", entry.m_sourcePath.c_str()));
+                }
+
+                AZ::IO::SystemFile sourceFile;
+                if (!sourceFile.Open(entry.m_sourcePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to read '%s'.", entry.m_sourcePath.c_str()));
+                }
+
+                const AZ::u32 sourceSize = static_cast<AZ::u32>(entry.m_sourceSize);
+                const bool deflate = sourceSize > 0 && compressionLevel > 0;
+
+                AZ::ZLib zlib;
+                AZStd::vector<AZ::u8> input(AZStd::max(AZStd::min(sourceSize, s_streamChunkSize), 1u));
+                AZStd::vector<AZ::u8> compressed;
+                if (deflate)
+                {
+                    zlib.StartRawCompressor(compressionLevel);
+                    compressed.resize(zlib.GetMinCompressedBufferSize(static_cast<unsigned int>(input.size())));
+                }
+                const unsigned int compressedCapacity = static_cast<unsigned int>(compressed.size());
+
+                AZ::Crc32 crc;
+                AZ::u32 remainingSize = sourceSize;
+                while (remainingSize > 0)
+                {
+                    const AZ::u32 chunkSize = AZStd::min(remainingSize, s_streamChunkSize);
+                    if (sourceFile.Read(chunkSize, input.data()) != chunkSize)
+                    {
+                        return AZ::Failure(AZStd::string::format("Failed to read '%s'.", entry.m_sourcePath.c_str()));
+                    }
+                    remainingSize -= chunkSize;
+                    crc.Add(input.data(), chunkSize);
+
+                    if (!deflate)
+                    {
+                        if (!output(input.data(), chunkSize))
+                        {
+                            return AZ::Failure(AZStd::string::format("Failed to write the data of '%s'.", entry.m_sourcePath.c_str()));
+                        }
+                        continue;
+                    }
+
+                    // Deflate until the chunk is consumed and the output buffer isn't filled anymore, the last chunk finishes the stream
+                    const AZ::ZLib::FlushType flushType = remainingSize > 0 ? AZ::ZLib::FT_NO_FLUSH : AZ::ZLib::FT_FINISH;
+                    unsigned int inputRemaining = chunkSize;
+                    unsigned int produced = 0;
+                    do
+                    {
+                        produced = zlib.Compress(input.data() + chunkSize - inputRemaining, inputRemaining, compressed.data(), compressedCapacity, flushType);
+                        if (produced > 0 && !output(compressed.data(), produced))
+                        {
+                            return AZ::Failure(AZStd::string::format("Failed to write the data of '%s'.", entry.m_sourcePath.c_str()));
+                        }
+                    } while (inputRemaining > 0 || produced == compressedCapacity);
+                }
+
+                entry.m_uncompressedSize = sourceSize;
+                entry.m_crc32 = static_cast<AZ::u32>(crc);
+                entry.m_method = deflate ? s_methodDeflate : s_methodStore;
+                return AZ::Success();
+            }
+
+            // Compresses the file of an entry in memory, to be written with the other entries of its batch
+            void CompressEntry(NewEntry& entry, unsigned int compressionLevel)
+            {
+                if (entry.IsDirectory())
+                {
+                    return;
+                }
+
+                auto appendData = [&entry](const AZ::u8* data, AZ::u32 size)
+                {
+                    entry.m_data.insert(entry.m_data.end(), data, data + size);
+                    return true;
+                };
+
+                AZ::Outcome<void, AZStd::string> result = StreamEntryData(entry, compressionLevel, appendData);
+                if (result.IsSuccess() && entry.m_method == s_methodDeflate && entry.m_data.size() >= entry.m_uncompressedSize)
+                {
+                    // Data which doesn't compress is stored
+                    entry.m_data.clear();
+                    result = StreamEntryData(entry, 0, appendData);
+                }
+
+                if (!result.IsSuccess())
+                {
+                    entry.m_error = result.TakeError();
+                }
+            }
+
+            AZ::Outcome<void, AZStd::string> ReadCentralDirectory(AZ::IO::SystemFile& archiveFile, const AZStd::string& archivePath, AZStd::vector<CentralDirectoryEntry>& entries)
+            {
+                const AZ::u64 archiveSize = archiveFile.Length();
+                if (archiveSize < s_endOfCentralDirectorySize)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' is not a zip archive.", archivePath.c_str()));
+                }
+
+                // The end of central directory record is at the end of the archive, followed by a comment of up to 64KB
+                const AZ::u64 tailSize = AZStd::min<AZ::u64>(archiveSize, s_endOfCentralDirectorySize + s_maxCommentSize);
+                AZStd::vector<AZ::u8> tail(tailSize);
+                archiveFile.Seek(archiveSize - tailSize, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                if (archiveFile.Read(tailSize, tail.data()) != tailSize)
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to read '%s'.", archivePath.c_str()));
+                }
+
+                const AZ::u8* endRecord = nullptr;
+                for (size_t offset = tailSize - s_endOfCentralDirectorySize + 1; offset-- > 0;)
+                {
+                    if (ReadU32(&tail[offset]) == s_endOfCentralDirectorySignature)
+                    {
+                        endRecord = &tail[offset];
+                        break;
+                    }
+                }
+                if (!endRecord)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' is not a zip archive.", archivePath.c_str()));
+                }
+
+                const AZ::u16 diskNumber = ReadU16(endRecord + 4);
+                const AZ::u16 centralDirectoryDisk = ReadU16(endRecord + 6);
+                const AZ::u16 numEntriesOnDisk = ReadU16(endRecord + 8);
+                const AZ::u16 numEntries = ReadU16(endRecord + 10);
+                const AZ::u32 centralDirectorySize = ReadU32(endRecord + 12);
+                const AZ::u32 centralDirectoryOffset = ReadU32(endRecord + 16);
+                if (numEntries == s_maxEntries || centralDirectorySize == s_maxZipValue || centralDirectoryOffset == s_maxZipValue)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' is a zip64 archive, which isn't supported.", archivePath.c_str()));
+                }
+                if (diskNumber != 0 || centralDirectoryDisk != 0 || numEntriesOnDisk != numEntries)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' is a multi-volume archive, which isn't supported.", archivePath.c_str()));
+                }
+                if (static_cast<AZ::u64>(centralDirectoryOffset) + centralDirectorySize > archiveSize)
+                {
+                    return AZ::Failure(AZStd::string::format("The central directory of '%s' is corrupted.", archivePath.c_str()));
+                }
+
+                AZStd::vector<AZ::u8> centralDirectory(centralDirectorySize);
+                archiveFile.Seek(centralDirectoryOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                if (archiveFile.Read(centralDirectorySize, centralDirectory.data()) != centralDirectorySize)
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to read '%s'.", archivePath.c_str()));
+                }
+
+                entries.reserve(entries.size() + numEntries);
+                size_t offset = 0;
+                for (AZ::u16 entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+                {
+                    if (offset + s_centralDirectoryHeaderSize > centralDirectory.size() || ReadU32(&centralDirectory[offset]) != s_centralDirectoryHeaderSignature)
+                    {
+                        return AZ::Failure(AZStd::string::format("The central directory of '%s' is corrupted.", archivePath.c_str()));
+                    }
+
+                    const AZ::u8* header = &centralDirectory[offset];
+                    const AZ::u16 nameLength = ReadU16(header + 28);
+                    const size_t recordSize = s_centralDirectoryHeaderSize + nameLength + ReadU16(header + 30) + ReadU16(header + 32);
+                    if (offset + recordSize > centralDirectory.size())
+                    {
+                        return AZ::Failure(AZStd::string::format("The central directory of '%s' is corrupted.", archivePath.c_str()));
+                    }
+
+                    CentralDirectoryEntry entry;
+                    entry.m_flags = ReadU16(header + 8);
+                    entry.m_method = ReadU16(header + 10);
+                    entry.m_crc32 = ReadU32(header + 16);
+                    entry.m_compressedSize = ReadU32(header + 20);
+                    entry.m_uncompressedSize = ReadU32(header + 24);
+                    entry.m_localHeaderOffset = ReadU32(header + 42);
+                    if (entry.m_compressedSize == s_maxZipValue || entry.m_uncompressedSize == s_maxZipValue || entry.m_localHeaderOffset == s_maxZipValue)
+                    {
+                        return AZ::Failure(AZStd::string::format("'%s' is a zip64 archive, which isn't supported.", archivePath.c_str()));
+                    }
+
+                    // Some archivers write Windows separators
+                    entry.m_name = ToArchivePath(AZStd::string(reinterpret_cast<const char*>(header + s_centralDirectoryHeaderSize), nameLength));
+                    entry.m_record.assign(header, header + recordSize);
+                    entries.push_back(AZStd::move(entry));
+
+                    offset += recordSize;
+                }
+
+                return AZ::Success();
+            }
+
+            AZ::Outcome<void, AZStd::string> OpenArchive(const AZStd::string& archivePath, AZ::IO::SystemFile& archiveFile, AZStd::vector<CentralDirectoryEntry>& entries)
+            {
+                if (!archiveFile.Open(archivePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to open archive '%s'.", archivePath.c_str()));
+                }
+                return ReadCentralDirectory(archiveFile, archivePath, entries);
+            }
+
+            // Returns the offset of the entry's data in the archive
+            AZ::Outcome<AZ::u64, AZStd::string> ReadLocalHeader(AZ::IO::SystemFile& archiveFile, const CentralDirectoryEntry& entry)
+            {
+                AZ::u8 header[s_localFileHeaderSize];
+                archiveFile.Seek(entry.m_localHeaderOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                if (archiveFile.Read(s_localFileHeaderSize, header) != s_localFileHeaderSize || ReadU32(header) != s_localFileHeaderSignature)
+                {
+                    return AZ::Failure(AZStd::string::format("The header of '%s' in '%s' is corrupted.", entry.m_name.c_str(), archiveFile.Name()));
+                }
+                return AZ::Success(static_cast<AZ::u64>(entry.m_localHeaderOffset) + s_localFileHeaderSize + ReadU16(header + 26) + ReadU16(header + 28));
+            }
+
+            // Streams the data of an entry to the target file, inflating it and checking its CRC on the way
+            AZ::Outcome<void, AZStd::string> ExtractEntry(AZ::IO::SystemFile& archiveFile, const CentralDirectoryEntry& entry, const AZStd::string& targetPath)
+            {
+                if (entry.m_flags & s_flagEncrypted)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' in '%s' is encrypted, which isn't supported.", entry.m_name.c_str(), archiveFile.Name()));
+                }
+                if (entry.m_method != s_methodStore && entry.m_method != s_methodDeflate)
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' in '%s' uses compression method %u, which isn't supported.", entry.m_name.c_str(), archiveFile.Name(), entry.m_method));
+                }
+
+                AZ::Outcome<AZ::u64, AZStd::string> dataOffset = ReadLocalHeader(archiveFile, entry);
+                if (!dataOffset.IsSuccess())
+                {
+                    return AZ::Failure(dataOffset.TakeError());
+                }
+
+                AZ::IO::SystemFile targetFile;
+                if (!targetFile.Open(targetPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to create '%s'.", targetPath.c_str()));
+                }
+
+                // Buffers are sized for the entry, most entries are small
+                AZ::ZLib zlib;
+                AZStd::vector<AZ::u8> input(AZStd::min(entry.m_compressedSize, s_streamChunkSize));
+                AZStd::vector<AZ::u8> output;
+                if (entry.m_method == s_methodDeflate)
+                {
+                    zlib.StartRawDecompressor();
+                    output.resize(AZStd::max(AZStd::min(entry.m_uncompressedSize, s_streamChunkSize), 1u));
+                }
+                const unsigned int outputCapacity = static_cast<unsigned int>(output.size());
+
+                AZ::Crc32 crc;
+                AZ::u64 extractedSize = 0;
+                bool writeFailed = false;
+                bool corrupted = false;
+                bool streamEnded = entry.m_method == s_methodStore;
+                auto writeOutput = [&](const AZ::u8* data, unsigned int size)
+                {
+                    crc.Add(data, size);
+                    extractedSize += size;
+                    writeFailed |= targetFile.Write(data, size) != size;
+                };
+
+                archiveFile.Seek(dataOffset.GetValue(), AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                AZ::u32 remainingSize = entry.m_compressedSize;
+                while (remainingSize > 0 && !writeFailed && !corrupted)
+                {
+                    const AZ::u32 inputSize = AZStd::min(remainingSize, s_streamChunkSize);
+                    if (archiveFile.Read(inputSize, input.data()) != inputSize)
+                    {
+                        break;
+                    }
+                    remainingSize -= inputSize;
+
+                    if (entry.m_method == s_methodStore)
+                    {
+                        writeOutput(input.data(), inputSize);
+                        continue;
+                    }
+
+                    // Inflate until the input is consumed and the output buffer isn't filled anymore, data past the end of the stream is ignored
+                    unsigned int inputRemaining = inputSize;
+                    unsigned int outputRemaining = 0;
+                    while (!streamEnded && !writeFailed)
+                    {
+                        outputRemaining = outputCapacity;
+                        const AZ::ZLib::DecompressResult result = zlib.DecompressChecked(input.data() + inputSize - inputRemaining, inputRemaining, output.data(), outputRemaining);
+                        if (result == AZ::ZLib::DR_CORRUPTED)
+                        {
+                            corrupted = true;
+                            break;
+                        }
+                        streamEnded = result == AZ::ZLib::DR_STREAM_END;
+
+                        const unsigned int produced = outputCapacity - outputRemaining;
+                        if (produced > 0)
+                        {
+                            writeOutput(output.data(), produced);
+                        }
+                        if (inputRemaining == 0 && outputRemaining > 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+                targetFile.Close();
+
+                AZStd::string error;
+                if (writeFailed)
+                {
+                    error = AZStd::string::format("Failed to write '%s'.", targetPath.c_str());
+                }
+                else if (corrupted)
+                {
+                    error = AZStd::string::format("'%s' in '%s' is corrupted, its data can't be inflated.", entry.m_name.c_str(), archiveFile.Name());
+                }
+                else if (remainingSize > 0 || !streamEnded)
+                {
+                    error = AZStd::string::format("'%s' in '%s' is truncated.", entry.m_name.c_str(), archiveFile.Name());
+                }
+                else if (extractedSize != entry.m_uncompressedSize || static_cast<AZ::u32>(crc) != entry.m_crc32)
+                {
+                    error = AZStd::string::format("'%s' in '%s' is corrupted, its CRC doesn't match.", entry.m_name.c_str(), archiveFile.Name());
+                }
+
+                if (!error.empty())
+                {
+                    AZ::IO::SystemFile::Delete(targetPath.c_str());
+                    return AZ::Failure(AZStd::move(error));
+                }
+                return AZ::Success();
+            }
+
+            class ArchiveWriter
+            {
+            public:
+                explicit ArchiveWriter(AZ::IO::SystemFile& archiveFile)
+                    : m_archiveFile(archiveFile)
+                {
+                }
+
+                //! Copies an entry of another archive as is, without recompressing it.
+                AZ::Outcome<void, AZStd::string> CopyEntry(AZ::IO::SystemFile& sourceArchive, const CentralDirectoryEntry& entry)
+                {
+                    AZ::Outcome<AZ::u64, AZStd::string> dataOffset = ReadLocalHeader(sourceArchive, entry);
+                    if (!dataOffset.IsSuccess())
+                    {
+                        return AZ::Failure(dataOffset.TakeError());
+                    }
+
+                    AZ::u64 recordSize = dataOffset.GetValue() - entry.m_localHeaderOffset + entry.m_compressedSize;
+                    if (entry.m_flags & s_flagDataDescriptor)
+                    {
+                        // The data descriptor following the data may or may not start with a signature
+                        AZ::u8 signature[4] = {};
+                        sourceArchive.Seek(dataOffset.GetValue() + entry.m_compressedSize, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                        sourceArchive.Read(sizeof(signature), signature);
+                        recordSize += ReadU32(signature) == s_dataDescriptorSignature ? 16 : 12;
+                    }
+
+                    AZStd::vector<AZ::u8> centralRecord = entry.m_record;
+                    PatchU32(&centralRecord[42], static_cast<AZ::u32>(m_offset));
+                    AZ::Outcome<void, AZStd::string> result = AddCentralRecord(centralRecord);
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+
+                    AZStd::vector<AZ::u8> buffer(static_cast<size_t>(AZStd::min<AZ::u64>(recordSize, s_streamChunkSize)));
+                    sourceArchive.Seek(entry.m_localHeaderOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                    while (recordSize > 0)
+                    {
+                        const AZ::u32 chunkSize = static_cast<AZ::u32>(AZStd::min<AZ::u64>(recordSize, s_streamChunkSize));
+                        if (sourceArchive.Read(chunkSize, buffer.data()) != chunkSize)
+                        {
+                            return AZ::Failure(AZStd::string::format("Failed to read '%s'.", sourceArchive.Name()));
+                        }
+                        result = Write(buffer.data(), chunkSize);
+                        if (!result.IsSuccess())
+                        {
+                            return result;
+                        }
+                        recordSize -= chunkSize;
+                    }
+                    return AZ::Success();
+                }
+
+                //! Adds an entry compressed in memory.
+                AZ::Outcome<void, AZStd::string> AddEntry(const NewEntry& entry)
+                {
+                    const AZ::u32 compressedSize = static_cast<AZ::u32>(entry.m_data.size());
+                    const AZ::u32 localHeaderOffset = static_cast<AZ::u32>(m_offset);
+                    AZ::Outcome<void, AZStd::string> result = AddCentralRecord(MakeCentralRecord(entry, compressedSize, localHeaderOffset));
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+
+                    const AZStd::vector<AZ::u8> localHeader = MakeLocalHeader(entry, compressedSize);
+                    result = Write(localHeader.data(), localHeader.size());
+                    if (result.IsSuccess() && compressedSize > 0)
+                    {
+                        result = Write(entry.m_data.data(), compressedSize);
+                    }
+                    return result;
+                }
+
+                //! Adds an entry compressed straight into the archive, for files too big to be held in memory.
+                //! The CRC and sizes of the local header are patched once the data is written.
+                //! The data is kept deflated even when it doesn't get any smaller.
+                AZ::Outcome<void, AZStd::string> AddStreamedEntry(NewEntry& entry, unsigned int compressionLevel)
+                {
+                    if (m_numEntries + 1 >= s_maxEntries || m_offset >= s_maxZipValue)
+                    {
+                        return AZ::Failure(AZStd::string::format("'%s' would need zip64 support, which isn't supported.", m_archiveFile.Name()));
+                    }
+
+                    // The method is known before the data is, the CRC and sizes aren't
+                    entry.m_method = (entry.m_sourceSize > 0 && compressionLevel > 0) ? s_methodDeflate : s_methodStore;
+                    const AZ::u64 localHeaderOffset = m_offset;
+                    const AZStd::vector<AZ::u8> localHeader = MakeLocalHeader(entry, 0);
+                    AZ::Outcome<void, AZStd::string> result = Write(localHeader.data(), localHeader.size());
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+
+                    const AZ::u64 dataOffset = m_offset;
+                    result = StreamEntryData(entry, compressionLevel, [this](const AZ::u8* data, AZ::u32 size)
+                    {
+                        return Write(data, size).IsSuccess();
+                    });
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+
+                    const AZ::u64 compressedSize = m_offset - dataOffset;
+                    if (compressedSize >= s_maxZipValue)
+                    {
+                        return AZ::Failure(AZStd::string::format("'%s' would need zip64 support, which isn't supported.", m_archiveFile.Name()));
+                    }
+
+                    AZStd::vector<AZ::u8> sizes;
+                    WriteU32(sizes, entry.m_crc32);
+                    WriteU32(sizes, static_cast<AZ::u32>(compressedSize));
+                    WriteU32(sizes, entry.m_uncompressedSize);
+                    m_archiveFile.Seek(localHeaderOffset + 14, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                    const bool patched = m_archiveFile.Write(sizes.data(), sizes.size()) == sizes.size();
+                    m_archiveFile.Seek(m_offset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+                    if (!patched)
+                    {
+                        return AZ::Failure(AZStd::string::format("Failed to write '%s'.", m_archiveFile.Name()));
+                    }
+
+                    return AddCentralRecord(MakeCentralRecord(entry, static_cast<AZ::u32>(compressedSize), static_cast<AZ::u32>(localHeaderOffset)));
+                }
+
+                //! Writes the central directory, after all the entries.
+                AZ::Outcome<void, AZStd::string> Finish()
+                {
+                    const AZ::u64 centralDirectoryOffset = m_offset;
+                    if (centralDirectoryOffset + m_centralDirectory.size() >= s_maxZipValue)
+                    {
+                        return AZ::Failure(AZStd::string::format("'%s' would need zip64 support, which isn't supported.", m_archiveFile.Name()));
+                    }
+
+                    AZStd::vector<AZ::u8> endRecord;
+                    endRecord.reserve(s_endOfCentralDirectorySize);
+                    WriteU32(endRecord, s_endOfCentralDirectorySignature);
+                    WriteU16(endRecord, 0); // Disk number
+                    WriteU16(endRecord, 0); // Disk of the central directory
+                    WriteU16(endRecord, static_cast<AZ::u16>(m_numEntries));
+                    WriteU16(endRecord, static_cast<AZ::u16>(m_numEntries));
+                    WriteU32(endRecord, static_cast<AZ::u32>(m_centralDirectory.size()));
+                    WriteU32(endRecord, static_cast<AZ::u32>(centralDirectoryOffset));
+                    WriteU16(endRecord, 0); // Comment length
+
+                    AZ::Outcome<void, AZStd::string> result = Write(m_centralDirectory.data(), m_centralDirectory.size());
+                    if (result.IsSuccess())
+                    {
+                        result = Write(endRecord.data(), endRecord.size());
+                    }
+                    return result;
+                }
+
+            private:
+                static AZ::u16 GetFlags(const NewEntry& entry)
+                {
+                    const bool isUtf8 = AZStd::any_of(entry.m_name.begin(), entry.m_name.end(), [](char character) { return static_cast<AZ::u8>(character) >= 0x80; });
+                    return isUtf8 ? s_flagUtf8 : 0;
+                }
+
+                // The fields the local header and central record share, from the version needed to the uncompressed size
+                static void WriteEntryFields(AZStd::vector<AZ::u8>& buffer, const NewEntry& entry, AZ::u32 compressedSize)
+                {
+                    WriteU16(buffer, s_versionNeeded);
+                    WriteU16(buffer, GetFlags(entry));
+                    WriteU16(buffer, entry.m_method);
+                    WriteU16(buffer, entry.m_dosTime);
+                    WriteU16(buffer, entry.m_dosDate);
+                    WriteU32(buffer, entry.m_crc32);
+                    WriteU32(buffer, compressedSize);
+                    WriteU32(buffer, entry.m_uncompressedSize);
+                }
+
+                static AZStd::vector<AZ::u8> MakeLocalHeader(const NewEntry& entry, AZ::u32 compressedSize)
+                {
+                    AZStd::vector<AZ::u8> localHeader;
+                    localHeader.reserve(s_localFileHeaderSize + entry.m_name.size());
+                    WriteU32(localHeader, s_localFileHeaderSignature);
+                    WriteEntryFields(localHeader, entry, compressedSize);
+                    WriteU16(localHeader, static_cast<AZ::u16>(entry.m_name.size()));
+                    WriteU16(localHeader, 0); // Extra field length
+                    localHeader.insert(localHeader.end(), entry.m_name.begin(), entry.m_name.end());
+                    return localHeader;
+                }
+
+                static AZStd::vector<AZ::u8> MakeCentralRecord(const NewEntry& entry, AZ::u32 compressedSize, AZ::u32 localHeaderOffset)
+                {
+                    AZStd::vector<AZ::u8> centralRecord;
+                    centralRecord.reserve(s_centralDirectoryHeaderSize + entry.m_name.size());
+                    WriteU32(centralRecord, s_centralDirectoryHeaderSignature);
+                    WriteU16(centralRecord, s_versionNeeded); // Version made by, with the host system being MS-DOS
+                    WriteEntryFields(centralRecord, entry, compressedSize);
+                    WriteU16(centralRecord, static_cast<AZ::u16>(entry.m_name.size()));
+                    WriteU16(centralRecord, 0); // Extra field length
+                    WriteU16(centralRecord, 0); // Comment length
+                    WriteU16(centralRecord, 0); // Disk number
+                    WriteU16(centralRecord, 0); // Internal attributes
+                    WriteU32(centralRecord, entry.IsDirectory() ? s_attributeDirectory : s_attributeArchive);
+                    WriteU32(centralRecord, localHeaderOffset);
+                    centralRecord.insert(centralRecord.end(), entry.m_name.begin(), entry.m_name.end());
+                    return centralRecord;
+                }
+
+                AZ::Outcome<void, AZStd::string> AddCentralRecord(const AZStd::vector<AZ::u8>& centralRecord)
+                {
+                    if (m_numEntries + 1 >= s_maxEntries || m_offset >= s_maxZipValue)
+                    {
+                        return AZ::Failure(AZStd::string::format("'%s' would need zip64 support, which isn't supported.", m_archiveFile.Name()));
+                    }
+                    m_centralDirectory.insert(m_centralDirectory.end(), centralRecord.begin(), centralRecord.end());
+                    ++m_numEntries;
+                    return AZ::Success();
+                }
+
+                AZ::Outcome<void, AZStd::string> Write(const void* data, size_t size)
+                {
+                    if (m_archiveFile.Write(data, size) != size)
+                    {
+                        return AZ::Failure(AZStd::string::format("Failed to write '%s'.", m_archiveFile.Name()));
+                    }
+                    m_offset += size;
+                    return AZ::Success();
+                }
+
+                AZ::IO::SystemFile& m_archiveFile;
+                AZ::u64 m_offset = 0;
+                AZ::u32 m_numEntries = 0;
+                AZStd::vector<AZ::u8> m_centralDirectory;
+            };
+
+            AZ::Outcome<void, AZStd::string> WriteArchive(ArchiveWriter& writer, AZ::IO::SystemFile& existingArchive, const AZStd::vector<CentralDirectoryEntry>& existingEntries,
+                AZStd::vector<NewEntry>& newEntries, const CancelCheck& isCancelled, unsigned int compressionLevel)
+            {
+                AZStd::unordered_set<AZStd::string> newNames;
+                for (const NewEntry& entry : newEntries)
+                {
+                    newNames.insert(entry.m_name);
+                }
+
+                for (const CentralDirectoryEntry& entry : existingEntries)
+                {
+                    if (newNames.find(entry.m_name) == newNames.end())
+                    {
+                        AZ::Outcome<void, AZStd::string> result = writer.CopyEntry(existingArchive, entry);
+                        if (!result.IsSuccess())
+                        {
+                            return result;
+                        }
+                    }
+                }
+
+                // The files are compressed in parallel by batches, which are written in order once compressed
+                size_t batchStart = 0;
+                while (batchStart < newEntries.size())
+                {
+                    if (IsCancelled(isCancelled))
+                    {
+                        return AZ::Failure(AZStd::string("The operation was cancelled."));
+                    }
+
+                    size_t batchEnd = batchStart;
+                    AZ::u64 batchSize = 0;
+                    do
+                    {
+                        batchSize += newEntries[batchEnd++].m_sourceSize;
+                    } while (batchEnd < newEntries.size() && batchSize + newEntries[batchEnd].m_sourceSize <= s_maxBatchSize);
+
+                    // A file too big for a batch is compressed on its own, straight into the archive
+                    NewEntry& firstEntry = newEntries[batchStart];
+                    if (batchEnd == batchStart + 1 && firstEntry.m_sourceSize > s_maxBatchSize && !firstEntry.IsDirectory())
+                    {
+                        AZ::Outcome<void, AZStd::string> result = writer.AddStreamedEntry(firstEntry, compressionLevel);
+                        if (!result.IsSuccess())
+                        {
+                            return result;
+                        }
+                        batchStart = batchEnd;
+                        continue;
+                    }
+
+                    ForEachIndex(batchStart, batchEnd, [&newEntries, compressionLevel](size_t entryIndex)
+                    {
+                        CompressEntry(newEntries[entryIndex], compressionLevel);
+                    });
+
+                    for (size_t entryIndex = batchStart; entryIndex < batchEnd; ++entryIndex)
+                    {
+                        NewEntry& entry = newEntries[entryIndex];
+                        if (!entry.m_error.empty())
+                        {
+                            return AZ::Failure(AZStd::move(entry.m_error));
+                        }
+                        AZ::Outcome<void, AZStd::string> result = writer.AddEntry(entry);
+                        if (!result.IsSuccess())
+                        {
+                            return result;
+                        }
+                        entry.m_data.set_capacity(0);
+                    }
+                    batchStart = batchEnd;
+                }
+
+                return writer.Finish();
+            }
+
+            // Writes the archive with the new entries next to it, then replaces it
+            AZ::Outcome<void, AZStd::string> UpdateArchive(const AZStd::string& archivePath, AZStd::vector<NewEntry>& newEntries, const CancelCheck& isCancelled, unsigned int compressionLevel)
+            {
+                // A file listed twice is added once
+                AZStd::unordered_set<AZStd::string> names;
+                newEntries.erase(AZStd::remove_if(newEntries.begin(), newEntries.end(), [&names](const NewEntry& entry) { return !names.insert(entry.m_name).second; }), newEntries.end());
+
+                AZ::IO::SystemFile existingArchive;
+                AZStd::vector<CentralDirectoryEntry> existingEntries;
+                if (AZ::IO::SystemFile::Exists(archivePath.c_str()))
+                {
+                    AZ::Outcome<void, AZStd::string> result = OpenArchive(archivePath, existingArchive, existingEntries);
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+                }
+
+                const AZStd::string tempArchivePath = archivePath + ".tmp";
+                AZ::IO::SystemFile archiveFile;
+                if (!archiveFile.Open(tempArchivePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to create '%s'.", tempArchivePath.c_str()));
+                }
+
+                ArchiveWriter writer(archiveFile);
+                AZ::Outcome<void, AZStd::string> result = WriteArchive(writer, existingArchive, existingEntries, newEntries, isCancelled, compressionLevel);
+                archiveFile.Close();
+                existingArchive.Close();
+
+                if (result.IsSuccess() && !AZ::IO::SystemFile::Rename(tempArchivePath.c_str(), archivePath.c_str(), true))
+                {
+                    result = AZ::Failure(AZStd::string::format("Failed to replace '%s'.", archivePath.c_str()));
+                }
+                if (!result.IsSuccess())
+                {
+                    AZ::IO::SystemFile::Delete(tempArchivePath.c_str());
+                }
+                return result;
+            }
+        } // namespace
+
+        AZ::Outcome<void, AZStd::string> ListEntries(const AZStd::string& archivePath, AZStd::vector<EntryInfo>& entries)
+        {
+            AZ::IO::SystemFile archiveFile;
+            AZStd::vector<CentralDirectoryEntry> archiveEntries;
+            AZ::Outcome<void, AZStd::string> result = OpenArchive(archivePath, archiveFile, archiveEntries);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            entries.reserve(entries.size() + archiveEntries.size());
+            for (CentralDirectoryEntry& archiveEntry : archiveEntries)
+            {
+                EntryInfo entry;
+                entry.m_isDirectory = archiveEntry.IsDirectory();
+                entry.m_path = AZStd::move(archiveEntry.m_name);
+                entry.m_size = archiveEntry.m_uncompressedSize;
+                entry.m_compressedSize = archiveEntry.m_compressedSize;
+                entry.m_crc32 = archiveEntry.m_crc32;
+                entries.push_back(AZStd::move(entry));
+            }
+            return AZ::Success();
+        }
+
+        AZ::Outcome<void, AZStd::string> ListFiles(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& filePaths)
+        {
+            AZStd::vector<EntryInfo> entries;
+            AZ::Outcome<void, AZStd::string> result = ListEntries(archivePath, entries);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            // Listed with native separators, as the zip executables list them
+            for (const EntryInfo& entry : entries)
+            {
+                if (!entry.m_isDirectory)
+                {
+                    filePaths.push_back(ToNativePath(entry.m_path));
+                }
+            }
+            return AZ::Success();
+        }
+
+        AZ::Outcome<void, AZStd::string> AddDirectory(const AZStd::string& archivePath, const AZStd::string& directory, const CancelCheck& isCancelled, unsigned int compressionLevel)
+        {
+            if (!QFileInfo(QString::fromUtf8(directory.c_str())).isDir())
+            {
+                return AZ::Failure(AZStd::string::format("Failed to find directory '%s'.", directory.c_str()));
+            }
+
+            AZStd::vector<NewEntry> newEntries;
+            GatherDirectory(directory, "", newEntries);
+            return UpdateArchive(archivePath, newEntries, isCancelled, compressionLevel);
+        }
+
+        AZ::Outcome<void, AZStd::string> AddFiles(const AZStd::string& archivePath, const AZStd::string& workingDirectory,
+            const AZStd::vector<AZStd::string>& filePaths, const CancelCheck& isCancelled, unsigned int compressionLevel)
+        {
+            AZStd::string workingFolder = ToArchivePath(workingDirectory);
+            if (!workingFolder.empty() && workingFolder.back() != '/')
+            {
+                workingFolder.push_back('/');
+            }
+
+            AZStd::vector<NewEntry> newEntries;
+            for (const AZStd::string& filePath : filePaths)
+            {
+                AZStd::string sourcePath;
+                AZStd::string name;
+                if (AzFramework::StringFunc::Path::IsRelative(filePath.c_str()))
+                {
+                    sourcePath = AppendPath(workingDirectory, filePath);
+                    name = ToArchivePath(filePath);
+                }
+                else
+                {
+                    sourcePath = filePath;
+                    name = ToArchivePath(filePath);
+                    if (!workingFolder.empty() && azstrnicmp(name.c_str(), workingFolder.c_str(), workingFolder.size()) == 0)
+                    {
+                        name.erase(0, workingFolder.size());
+                    }
+                    else
+                    {
+                        name.erase(0, name.find_last_of('/') + 1);
+                    }
+                }
+
+                while (!name.empty() && name.back() == '/')
+                {
+                    name.pop_back();
+                }
+                if (!IsSafeEntryName(name))
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' can't be added to an archive.", filePath.c_str()));
+                }
+
+                const QFileInfo fileInfo(QString::fromUtf8(sourcePath.c_str()));
+                if (!fileInfo.exists())
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to find '%s'.", sourcePath.c_str()));
+                }
+
+                newEntries.push_back(MakeNewEntry(sourcePath, name, fileInfo.isDir()));
+                if (fileInfo.isDir())
+                {
+                    GatherDirectory(sourcePath, name + "/", newEntries);
+                }
+            }
+
+            return UpdateArchive(archivePath, newEntries, isCancelled, compressionLevel);
+        }
+
+        AZ::Outcome<void, AZStd::string> ExtractArchive(const AZStd::string& archivePath, const AZStd::string& destinationPath, bool overwrite, const CancelCheck& isCancelled)
+        {
+            AZStd::vector<CentralDirectoryEntry> entries;
+            {
+                AZ::IO::SystemFile archiveFile;
+                AZ::Outcome<void, AZStd::string> result = OpenArchive(archivePath, archiveFile, entries);
+                if (!result.IsSuccess())
+                {
+                    return result;
+                }
+            }
+
+            AZStd::vector<AZStd::string> targetPaths;
+            targetPaths.reserve(entries.size());
+            for (const CentralDirectoryEntry& entry : entries)
+            {
+                if (!IsSafeEntryName(entry.m_name))
+                {
+                    return AZ::Failure(AZStd::string::format("'%s' in '%s' would be extracted outside of '%s'.", entry.m_name.c_str(), archivePath.c_str(), destinationPath.c_str()));
+                }
+                targetPaths.push_back(AppendPath(destinationPath, entry.m_name));
+            }
+
+            if (!AZ::IO::SystemFile::Exists(destinationPath.c_str()) && !AZ::IO::SystemFile::CreateDir(destinationPath.c_str()))
+            {
+                return AZ::Failure(AZStd::string::format("Failed to create '%s'.", destinationPath.c_str()));
+            }
+
+            // Directories are created upfront, the files are extracted in parallel, each job reading the archive with its own handle
+            AZStd::vector<size_t> fileIndices;
+            for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+            {
+                if (!entries[entryIndex].IsDirectory())
+                {
+                    fileIndices.push_back(entryIndex);
+                }
+                else if (!AZ::IO::SystemFile::Exists(targetPaths[entryIndex].c_str()) && !AZ::IO::SystemFile::CreateDir(targetPaths[entryIndex].c_str()))
+                {
+                    return AZ::Failure(AZStd::string::format("Failed to create '%s'.", targetPaths[entryIndex].c_str()));
+                }
+            }
+
+            AZStd::vector<AZStd::string> errors(fileIndices.size());
+            ForEachIndex(0, fileIndices.size(), [&](size_t fileIndex)
+            {
+                const size_t entryIndex = fileIndices[fileIndex];
+                if (IsCancelled(isCancelled))
+                {
+                    errors[fileIndex] = "The operation was cancelled.";
+                    return;
+                }
+                if (!overwrite && AZ::IO::SystemFile::Exists(targetPaths[entryIndex].c_str()))
+                {
+                    return;
+                }
+
+                AZ::IO::SystemFile archiveFile;
+                if (!archiveFile.Open(archivePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    errors[fileIndex] = AZStd::string::format("Failed to open archive '%s'.", archivePath.c_str());
+                    return;
+                }
+
+                AZ::Outcome<void, AZStd::string> result = ExtractEntry(archiveFile, entries[entryIndex], targetPaths[entryIndex]);
+                if (!result.IsSuccess())
+                {
+                    errors[fileIndex] = result.TakeError();
+                }
+            });
+
+            for (AZStd::string& error : errors)
+            {
+                if (!error.empty())
+                {
+                    return AZ::Failure(AZStd::move(error));
+                }
+            }
+            return AZ::Success();
+        }
+
+        AZ::Outcome<void, AZStd::string> ExtractFile(const AZStd::string& archivePath, const AZStd::string& fileInArchive, const AZStd::string& destinationPath, bool overwrite)
+        {
+            AZ::IO::SystemFile archiveFile;
+            AZStd::vector<CentralDirectoryEntry> entries;
+            AZ::Outcome<void, AZStd::string> result = OpenArchive(archivePath, archiveFile, entries);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            // Exact matches are preferred, the zip executables match names ignoring case on Windows
+            const AZStd::string name = ToArchivePath(fileInArchive);
+            auto entry = AZStd::find_if(entries.begin(), entries.end(), [&name](const CentralDirectoryEntry& entry) { return entry.m_name == name; });
+            if (entry == entries.end())
+            {
+                entry = AZStd::find_if(entries.begin(), entries.end(), [&name](const CentralDirectoryEntry& entry) { return azstricmp(entry.m_name.c_str(), name.c_str()) == 0; });
+            }
+            if (entry == entries.end() || entry->IsDirectory())
+            {
+                return AZ::Failure(AZStd::string::format("'%s' isn't a file in '%s'.", fileInArchive.c_str(), archivePath.c_str()));
+            }
+
+            const AZStd::string targetPath = AppendPath(destinationPath, entry->m_name.substr(entry->m_name.find_last_of('/') + 1));
+            if (!overwrite && AZ::IO::SystemFile::Exists(targetPath.c_str()))
+            {
+                return AZ::Success();
+            }
+            return ExtractEntry(archiveFile, *entry, targetPath);
+        }
+    } // namespace ZipArchive
+} // namespace AzToolsFramework
@@ -0,0 +1,73 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AzToolsFramework
+{
+    //! In-process reading and writing of zip archives, used by the ArchiveComponent instead of launching a zip executable.
+    //! Files are stored or deflated, the entries being added are compressed in parallel on the job system when there
+    //! is one. Entries are extracted in parallel, streaming their data from the archive.
+    //! Zip64 archives (over 4GB or 65535 entries) are not supported.
+    namespace ZipArchive
+    {
+        //! Polled during long operations, returning true stops the operation.
+        using CancelCheck = AZStd::function<bool()>;
+
+        //! Compression level used when none is specified, matches the level used by the zip executables.
+        static const unsigned int DefaultCompressionLevel = 1;
+
+        struct EntryInfo
+        {
+            //! Path of the entry inside the archive, with '/' separators. Paths of directories end with a '/'.
+            AZStd::string m_path;
+            AZ::u64 m_size = 0;
+            AZ::u64 m_compressedSize = 0;
+            AZ::u32 m_crc32 = 0;
+            bool m_isDirectory = false;
+        };
+
+        //! Lists all the entries of an archive, directories included.
+        AZ::Outcome<void, AZStd::string> ListEntries(const AZStd::string& archivePath, AZStd::vector<EntryInfo>& entries);
+
+        //! Lists the paths of the files in an archive, directories are skipped.
+        AZ::Outcome<void, AZStd::string> ListFiles(const AZStd::string& archivePath, AZStd::vector<AZStd::string>& filePaths);
+
+        //! Adds the content of a directory to an archive, recursively, with paths relative to the directory.
+        //! The archive is created if it doesn't exist, entries already in the archive with the same path are replaced.
+        AZ::Outcome<void, AZStd::string> AddDirectory(const AZStd::string& archivePath, const AZStd::string& directory,
+            const CancelCheck& isCancelled = {}, unsigned int compressionLevel = DefaultCompressionLevel);
+
+        //! Adds files to an archive. Relative file paths are read from the working directory and keep the same path in the
+        //! archive, absolute paths are stored relative to the working directory when they are in it, by name otherwise.
+        //! The archive is created if it doesn't exist, entries already in the archive with the same path are replaced.
+        AZ::Outcome<void, AZStd::string> AddFiles(const AZStd::string& archivePath, const AZStd::string& workingDirectory,
+            const AZStd::vector<AZStd::string>& filePaths, const CancelCheck& isCancelled = {}, unsigned int compressionLevel = DefaultCompressionLevel);
+
+        //! Extracts all the entries of an archive into the destination directory, keeping their paths.
+        //! Existing files are kept unless overwrite is set.
+        AZ::Outcome<void, AZStd::string> ExtractArchive(const AZStd::string& archivePath, const AZStd::string& destinationPath,
+            bool overwrite, const CancelCheck& isCancelled = {});
+
+        //! Extracts a single file of an archive directly into the destination directory, or the current directory when
+        //! the destination is empty, without the path it has in the archive.
+        //! An existing file is kept unless overwrite is set.
+        AZ::Outcome<void, AZStd::string> ExtractFile(const AZStd::string& archivePath, const AZStd::string& fileInArchive,
+            const AZStd::string& destinationPath, bool overwrite);
+    } // namespace ZipArchive
+} // namespace AzToolsFramework
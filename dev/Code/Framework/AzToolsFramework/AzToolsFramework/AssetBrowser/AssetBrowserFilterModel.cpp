@@ -12,6 +12,7 @@
 #include <AzToolsFramework/AssetBrowser/Search/Filter.h>
 #include <AzToolsFramework/AssetBrowser/Entries/FolderAssetBrowserEntry.h>
 #include <AzToolsFramework/AssetBrowser/Entries/SourceAssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntryCache.h>
 
 AZ_PUSH_DISABLE_WARNING(4251, "-Wunknown-warning-option")
 #include <AzToolsFramework/AssetBrowser/AssetBrowserFilterModel.h>
@@ -45,6 +46,7 @@ namespace AzToolsFramework
         {
             connect(filter.data(), &AssetBrowserEntryFilter::updatedSignal, this, &AssetBrowserFilterModel::filterUpdatedSlot);
             m_filter = filter;
+            m_filterResolved = false;
             m_invalidateFilter = true;
             // asset browser entries are not guaranteed to have populated when the filter is set, delay filtering until they are
             bool isAssetBrowserComponentReady = false;
@@ -59,6 +61,7 @@ namespace AzToolsFramework
         {
             if (m_invalidateFilter)
             {
+                ResolveFilter();
                 invalidateFilter();
                 m_invalidateFilter = false;
             }
@@ -86,6 +89,19 @@ namespace AzToolsFramework
             {
                 return true;
             }
+
+            // entries added or changed since the filter was resolved are matched
+            if (m_filterResolved)
+            {
+                if (EntryCache* cache = EntryCache::GetInstance())
+                {
+                    bool accepted = false;
+                    if (cache->m_searchIndex.Lookup(m_acceptedEntries, m_acceptedRevision, entry, accepted))
+                    {
+                        return accepted;
+                    }
+                }
+            }
             return m_filter->Match(entry);
         }
 
@@ -148,12 +164,26 @@ namespace AzToolsFramework
                     m_stringFilter = qobject_cast<QSharedPointer<const StringFilter> >(*it);
                 }
             }
+            ResolveFilter();
             invalidateFilter();
             Q_EMIT filterChanged();
         }
 
+        void AssetBrowserFilterModel::ResolveFilter()
+        {
+            m_filterResolved = false;
+            EntryCache* cache = EntryCache::GetInstance();
+            if (m_filter && cache)
+            {
+                m_filterResolved = m_filter->Resolve(cache->m_searchIndex, m_acceptedEntries);
+                m_acceptedRevision = cache->m_searchIndex.GetRevision();
+            }
+        }
+
         void AssetBrowserFilterModel::filterUpdatedSlot()
         {
+            // the filter changed, rows are matched until it is resolved again
+            m_filterResolved = false;
             if (!m_alreadyRecomputingFilters)
             {
                 m_alreadyRecomputingFilters = true;
@@ -14,6 +14,7 @@
 #include <AzToolsFramework/AssetBrowser/AssetBrowserBus.h>
 #include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntry.h>
 #include <AzToolsFramework/AssetBrowser/Search/Filter.h>
+#include <AzToolsFramework/AssetBrowser/Search/SearchIndex.h>
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/std/containers/vector.h>
@@ -64,6 +65,9 @@ namespace AzToolsFramework
             void filterUpdatedSlot();
 
         protected:
+            //! Resolve the entries accepted by the filter from the search index, so rows are looked up instead of matched
+            void ResolveFilter();
+
             //set for filtering columns
             //if the column is in the set the column is not filtered and is shown
             AZStd::fixed_unordered_set<int, 3, static_cast<int>(AssetBrowserEntry::Column::Count)> m_showColumn;
@@ -76,6 +80,10 @@ namespace AzToolsFramework
             QCollator m_collator;  // cache the collator as its somewhat expensive to constantly create and destroy one.
             AZ_POP_DISABLE_WARNING
             bool m_invalidateFilter = false;
+            //! Entries accepted by the filter, valid when m_filterResolved is set
+            SearchIndex::EntrySet m_acceptedEntries;
+            AZ::u64 m_acceptedRevision = 0;
+            bool m_filterResolved = false;
         };
     } // namespace AssetBrowser
 } // namespace AzToolsFramework
@@ -15,6 +15,7 @@
 #include <AzToolsFramework/AssetBrowser/AssetEntryChangeset.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
 #include <AzToolsFramework/AssetBrowser/Entries/RootAssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntryCache.h>
 #include <AzToolsFramework/AssetBrowser/AssetEntryChange.h>
 
 namespace AzToolsFramework
@@ -99,6 +100,12 @@ namespace AzToolsFramework
             // try again next time.
             m_changes = changesFailed;
 
+            // entries removed by the changes leave garbage in the search index
+            if (EntryCache* cache = EntryCache::GetInstance())
+            {
+                cache->m_searchIndex.CompactIfFragmented();
+            }
+
             if (m_rootEntry->IsInitialUpdate())
             {
                 m_rootEntry->SetInitialUpdate(false);
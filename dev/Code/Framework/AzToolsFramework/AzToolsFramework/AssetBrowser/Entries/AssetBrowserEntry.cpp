@@ -77,6 +77,11 @@ namespace AzToolsFramework
 
             UpdateChildPaths(child);
 
+            if (EntryCache* cache = EntryCache::GetInstance())
+            {
+                cache->m_searchIndex.AddEntry(child);
+            }
+
             AssetBrowserModelRequestBus::Broadcast(&AssetBrowserModelRequests::BeginAddEntry, this);
             child->m_row = static_cast<int>(m_children.size());
             m_children.push_back(child);
@@ -97,6 +102,11 @@ namespace AzToolsFramework
                 return;
             }
 
+            if (EntryCache* cache = EntryCache::GetInstance())
+            {
+                cache->m_searchIndex.RemoveEntry(child);
+            }
+
             AssetBrowserModelRequestBus::Broadcast(&AssetBrowserModelRequests::BeginRemoveEntry, childToRemove.get());
             auto it = m_children.erase(m_children.begin() + child->m_row);
 
@@ -67,6 +67,7 @@ namespace AzToolsFramework
             m_dirtyThumbnailsSet.clear();
             m_knownScanFolders.clear();
             m_absolutePathToFileId.clear();
+            m_searchIndex.Clear();
         }
     }
 }
\ No newline at end of file
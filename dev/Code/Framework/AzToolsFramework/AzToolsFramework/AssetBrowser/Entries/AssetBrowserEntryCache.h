@@ -15,6 +15,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Search/SearchIndex.h>
 
 namespace AZ
 {
@@ -56,6 +57,8 @@ namespace AzToolsFramework
             AZStd::unordered_map<AZStd::string, AZ::s64> m_absolutePathToFileId;
 
             AZStd::unordered_set<AssetBrowserEntry*> m_dirtyThumbnailsSet;
+            //! Every entry in the tree, searchable by the asset browser filters
+            SearchIndex m_searchIndex;
             static const char* s_environmentVariableName;
             static AZ::EnvironmentVariable<EntryCache*> g_globalInstance;
 
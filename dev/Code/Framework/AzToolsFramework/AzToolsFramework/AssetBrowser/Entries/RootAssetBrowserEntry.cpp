@@ -89,6 +89,7 @@ namespace AzToolsFramework
                 const auto scanFolder = CreateFolders(scanFolderDatabaseEntry.m_scanFolder.c_str(), this);
                 scanFolder->m_displayName = QString::fromUtf8(scanFolderDatabaseEntry.m_displayName.c_str());
                 EntryCache::GetInstance()->m_scanFolderIdMap[scanFolderDatabaseEntry.m_scanFolderID] = scanFolder;
+                EntryCache::GetInstance()->m_searchIndex.UpdateEntry(scanFolder);
             }
 
             if (!scanFolderDatabaseEntry.m_outputPrefix.empty())
@@ -298,6 +299,11 @@ namespace AzToolsFramework
                 // save this for last since it actually causes other lookups (like thumbnail lookups) to occur.
                 source->AddChild(product);
             }
+            else
+            {
+                // already in the tree, its name and type may have changed
+                EntryCache::GetInstance()->m_searchIndex.UpdateEntry(product);
+            }
 
             return true;
         }
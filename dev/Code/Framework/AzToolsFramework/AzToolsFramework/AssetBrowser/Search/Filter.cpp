@@ -88,6 +88,33 @@ namespace AzToolsFramework
                 }
                 ExpandDown(result, entry);
             }
+
+            //! Add all children of an entry recursively to the set, skipping the subtrees already in it
+            void ResolveDown(const SearchIndex& index, const AssetBrowserEntry* entry, SearchIndex::EntrySet& result)
+            {
+                for (int row = 0; row < entry->GetChildCount(); ++row)
+                {
+                    const AssetBrowserEntry* child = entry->GetChild(row);
+                    SearchIndex::Slot slot;
+                    if (index.FindSlot(child, slot) && !result.Contains(slot))
+                    {
+                        result.Insert(slot);
+                        ResolveDown(index, child, result);
+                    }
+                }
+            }
+
+            //! Add the parents of an entry to the set, up to the first one already in it
+            void ResolveUp(const SearchIndex& index, const AssetBrowserEntry* entry, SearchIndex::EntrySet& result)
+            {
+                auto parent = entry->GetParent();
+                SearchIndex::Slot slot;
+                while (parent && index.FindSlot(parent, slot) && !result.Contains(slot))
+                {
+                    result.Insert(slot);
+                    parent = parent->GetParent();
+                }
+            }
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -156,6 +183,39 @@ namespace AzToolsFramework
             }
         }
 
+        bool AssetBrowserEntryFilter::Resolve(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            SearchIndex::EntrySet matches;
+            if (!ResolveInternal(index, matches))
+            {
+                return false;
+            }
+
+            result = matches;
+
+            // an entry under a match is matched through its parent
+            if (m_direction & Up)
+            {
+                SearchIndex::EntrySet children = matches;
+                matches.ForEach([&index, &children](SearchIndex::Slot slot)
+                {
+                    ResolveDown(index, index.GetEntry(slot), children);
+                });
+                result.Unite(children);
+            }
+            // an entry above a match is matched through its child
+            if (m_direction & Down)
+            {
+                SearchIndex::EntrySet parents = matches;
+                matches.ForEach([&index, &parents](SearchIndex::Slot slot)
+                {
+                    ResolveUp(index, index.GetEntry(slot), parents);
+                });
+                result.Unite(parents);
+            }
+            return true;
+        }
+
         QString AssetBrowserEntryFilter::GetName() const
         {
             return m_name.isEmpty() ? GetNameInternal() : m_name;
@@ -189,6 +249,11 @@ namespace AzToolsFramework
             }
         }
 
+        bool AssetBrowserEntryFilter::ResolveInternal(const SearchIndex& /*index*/, SearchIndex::EntrySet& /*result*/) const
+        {
+            return false;
+        }
+
         bool AssetBrowserEntryFilter::MatchDown(const AssetBrowserEntry* entry) const
         {
             if (MatchInternal(entry))
@@ -255,6 +320,13 @@ namespace AzToolsFramework
             return false;
         }
 
+        bool StringFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            // an empty filter string is matched by every name
+            index.FindByName(m_filterString, result);
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // AssetTypeFilter
         //////////////////////////////////////////////////////////////////////////
@@ -304,6 +376,19 @@ namespace AzToolsFramework
             return false;
         }
 
+        bool AssetTypeFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            if (m_assetType.IsNull())
+            {
+                index.FindByEntryType(AssetBrowserEntry::AssetEntryType::Product, result);
+            }
+            else
+            {
+                index.FindByAssetType(m_assetType, result);
+            }
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // AssetGroupFilter
         //////////////////////////////////////////////////////////////////////////
@@ -353,6 +438,33 @@ namespace AzToolsFramework
             return (m_group.compare(group, Qt::CaseInsensitive) == 0);
         }
 
+        bool AssetGroupFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            if (m_group.compare("All", Qt::CaseInsensitive) == 0)
+            {
+                index.FindByEntryType(AssetBrowserEntry::AssetEntryType::Product, result);
+                return true;
+            }
+
+            // the group is looked up once per asset type rather than once per product
+            result.Reset(index.GetSlotCount());
+            AZStd::vector<AZ::Data::AssetType> assetTypes;
+            index.GetAssetTypes(assetTypes);
+            for (const AZ::Data::AssetType& assetType : assetTypes)
+            {
+                QString group;
+                AZ::AssetTypeInfoBus::EventResult(group, assetType, &AZ::AssetTypeInfo::GetGroup);
+
+                if ((m_group.compare("Other", Qt::CaseInsensitive) == 0 && group.isEmpty()) || m_group.compare(group, Qt::CaseInsensitive) == 0)
+                {
+                    SearchIndex::EntrySet products;
+                    index.FindByAssetType(assetType, products);
+                    result.Unite(products);
+                }
+            }
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // EntryTypeFilter
         //////////////////////////////////////////////////////////////////////////
@@ -379,6 +491,12 @@ namespace AzToolsFramework
             return entry->GetEntryType() == m_entryType;
         }
 
+        bool EntryTypeFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            index.FindByEntryType(m_entryType, result);
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // CompositeFilter
         //////////////////////////////////////////////////////////////////////////
@@ -522,6 +640,52 @@ namespace AzToolsFramework
             }
         }
 
+        bool CompositeFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            if (m_subFilters.isEmpty())
+            {
+                if (m_emptyResult)
+                {
+                    index.FindAll(result);
+                }
+                else
+                {
+                    result.Reset(index.GetSlotCount());
+                }
+                return true;
+            }
+
+            bool firstResult = true;
+            for (auto filter : m_subFilters)
+            {
+                if (firstResult)
+                {
+                    firstResult = false;
+                    if (!filter->Resolve(index, result))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                SearchIndex::EntrySet set;
+                if (!filter->Resolve(index, set))
+                {
+                    return false;
+                }
+
+                if (m_logicOperator == LogicOperatorType::AND)
+                {
+                    result.Intersect(set);
+                }
+                else
+                {
+                    result.Unite(set);
+                }
+            }
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // InverseFilter
         //////////////////////////////////////////////////////////////////////////
@@ -565,6 +729,25 @@ namespace AzToolsFramework
             }
         }
 
+        bool InverseFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            if (m_filter.isNull())
+            {
+                result.Reset(index.GetSlotCount());
+                return true;
+            }
+
+            if (!m_filter->Resolve(index, result))
+            {
+                return false;
+            }
+
+            SearchIndex::EntrySet allEntries;
+            index.FindAll(allEntries);
+            result.Complement(allEntries);
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // CleanerProductsFilter
         //////////////////////////////////////////////////////////////////////////
@@ -609,6 +792,36 @@ namespace AzToolsFramework
                 Expand(result, entry);
             }
         }
+
+        bool CleanerProductsFilter::ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const
+        {
+            index.FindAll(result);
+
+            // a product is cleaned out when it is the only child of its source and its asset type has no display name
+            AZStd::vector<AZ::Data::AssetType> assetTypes;
+            index.GetAssetTypes(assetTypes);
+            for (const AZ::Data::AssetType& assetType : assetTypes)
+            {
+                AZStd::string assetTypeName;
+                AZ::AssetTypeInfoBus::EventResult(assetTypeName, assetType, &AZ::AssetTypeInfo::GetAssetTypeDisplayName);
+                if (!assetTypeName.empty())
+                {
+                    continue;
+                }
+
+                SearchIndex::EntrySet products;
+                index.FindByAssetType(assetType, products);
+                products.ForEach([&index, &result](SearchIndex::Slot slot)
+                {
+                    auto source = index.GetEntry(slot)->GetParent();
+                    if (source && source->GetChildCount() == 1)
+                    {
+                        result.Erase(slot);
+                    }
+                });
+            }
+            return true;
+        }
     } // namespace AssetBrowser
 } // namespace AzToolsFramework
 
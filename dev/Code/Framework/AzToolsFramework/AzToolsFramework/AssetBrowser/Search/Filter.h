@@ -12,6 +12,7 @@
 #pragma once
 
 #include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Search/SearchIndex.h>
 
 #include <QObject>
 #include <QString>
@@ -63,6 +64,10 @@ namespace AzToolsFramework
             //! Retrieve all matching entries that are either entry itself or its parents or children
             void Filter(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const;
 
+            //! Resolve all the entries matching the filter from the search index, instead of matching entries one by one
+            //! Returns false when the filter can't be resolved from the index, its entries have to be matched then
+            bool Resolve(const SearchIndex& index, SearchIndex::EntrySet& result) const;
+
             //! Filter name is used to uniquely identify the filter
             QString GetName() const;
             void SetName(const QString& name);
@@ -84,6 +89,8 @@ namespace AzToolsFramework
             virtual bool MatchInternal(const AssetBrowserEntry* entry) const = 0;
             //! Internal filtering logic overrided by every filter type
             virtual void FilterInternal(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const;
+            //! Internal resolving logic, filters that can't be resolved from the search index keep the default which returns false
+            virtual bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const;
 
         private:
             QString m_name;
@@ -112,6 +119,7 @@ namespace AzToolsFramework
         protected:
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             QString m_filterString;
@@ -136,6 +144,7 @@ namespace AzToolsFramework
         protected:
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             AZ::Data::AssetType m_assetType;
@@ -159,6 +168,7 @@ namespace AzToolsFramework
         protected:
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             QString m_group;
@@ -181,6 +191,7 @@ namespace AzToolsFramework
         protected:
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             AssetBrowserEntry::AssetEntryType m_entryType;
@@ -220,6 +231,7 @@ namespace AzToolsFramework
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
             void FilterInternal(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             QList<FilterConstType> m_subFilters;
@@ -245,6 +257,7 @@ namespace AzToolsFramework
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
             void FilterInternal(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             FilterConstType m_filter;
@@ -266,6 +279,7 @@ namespace AzToolsFramework
             QString GetNameInternal() const override;
             bool MatchInternal(const AssetBrowserEntry* entry) const override;
             void FilterInternal(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const override;
+            bool ResolveInternal(const SearchIndex& index, SearchIndex::EntrySet& result) const override;
 
         private:
             FilterConstType m_filter;
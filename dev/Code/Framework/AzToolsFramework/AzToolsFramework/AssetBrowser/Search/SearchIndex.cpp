@@ -0,0 +1,418 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <AzToolsFramework/AssetBrowser/Search/SearchIndex.h>
+#include <AzToolsFramework/AssetBrowser/Entries/ProductAssetBrowserEntry.h>
+
+namespace AzToolsFramework
+{
+    namespace AssetBrowser
+    {
+        namespace
+        {
+            const int s_trigramLength = 3;
+            // below this many removed or updated entries the garbage they leave behind isn't worth a rebuild
+            const size_t s_minStaleCountToCompact = 1024;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SearchIndex::EntrySet
+        //////////////////////////////////////////////////////////////////////////
+        void SearchIndex::EntrySet::Reset(Slot slotCount)
+        {
+            m_bits.assign((static_cast<size_t>(slotCount) + 63) / 64, 0);
+        }
+
+        void SearchIndex::EntrySet::Insert(Slot slot)
+        {
+            const size_t wordIndex = slot / 64;
+            if (wordIndex >= m_bits.size())
+            {
+                m_bits.resize(wordIndex + 1, 0);
+            }
+            m_bits[wordIndex] |= AZ::u64(1) << (slot % 64);
+        }
+
+        void SearchIndex::EntrySet::Erase(Slot slot)
+        {
+            const size_t wordIndex = slot / 64;
+            if (wordIndex < m_bits.size())
+            {
+                m_bits[wordIndex] &= ~(AZ::u64(1) << (slot % 64));
+            }
+        }
+
+        bool SearchIndex::EntrySet::Contains(Slot slot) const
+        {
+            const size_t wordIndex = slot / 64;
+            return wordIndex < m_bits.size() && (m_bits[wordIndex] & (AZ::u64(1) << (slot % 64))) != 0;
+        }
+
+        void SearchIndex::EntrySet::Intersect(const EntrySet& other)
+        {
+            for (size_t wordIndex = 0; wordIndex < m_bits.size(); ++wordIndex)
+            {
+                m_bits[wordIndex] &= wordIndex < other.m_bits.size() ? other.m_bits[wordIndex] : 0;
+            }
+        }
+
+        void SearchIndex::EntrySet::Unite(const EntrySet& other)
+        {
+            if (m_bits.size() < other.m_bits.size())
+            {
+                m_bits.resize(other.m_bits.size(), 0);
+            }
+            for (size_t wordIndex = 0; wordIndex < other.m_bits.size(); ++wordIndex)
+            {
+                m_bits[wordIndex] |= other.m_bits[wordIndex];
+            }
+        }
+
+        void SearchIndex::EntrySet::Complement(const EntrySet& mask)
+        {
+            m_bits.resize(mask.m_bits.size(), 0);
+            for (size_t wordIndex = 0; wordIndex < m_bits.size(); ++wordIndex)
+            {
+                m_bits[wordIndex] = mask.m_bits[wordIndex] & ~m_bits[wordIndex];
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SearchIndex
+        //////////////////////////////////////////////////////////////////////////
+        void SearchIndex::AddEntry(const AssetBrowserEntry* entry)
+        {
+            if (m_slots.find(entry) != m_slots.end())
+            {
+                UpdateEntry(entry);
+                return;
+            }
+
+            const Slot slot = static_cast<Slot>(m_entries.size());
+            m_entries.emplace_back();
+            m_slots.emplace(entry, slot);
+            IndexEntry(slot, entry);
+            TouchParents(entry, true);
+        }
+
+        void SearchIndex::UpdateEntry(const AssetBrowserEntry* entry)
+        {
+            auto it = m_slots.find(entry);
+            if (it == m_slots.end())
+            {
+                AddEntry(entry);
+                return;
+            }
+
+            // the previous postings of the slot are left behind, they no longer verify against the entry
+            ++m_staleCount;
+            IndexEntry(it->second, entry);
+            TouchParents(entry, false);
+        }
+
+        void SearchIndex::RemoveEntry(const AssetBrowserEntry* entry)
+        {
+            auto it = m_slots.find(entry);
+            if (it == m_slots.end())
+            {
+                return;
+            }
+
+            m_entries[it->second] = IndexedEntry();
+            m_slots.erase(it);
+            ++m_staleCount;
+            ++m_revision;
+            TouchParents(entry, true);
+        }
+
+        void SearchIndex::Clear()
+        {
+            m_entries.clear();
+            m_slots.clear();
+            m_trigrams.clear();
+            for (auto& entryTypeSlots : m_entryTypes)
+            {
+                entryTypeSlots.clear();
+            }
+            m_assetTypes.clear();
+            m_staleCount = 0;
+            m_compactedRevision = ++m_revision;
+        }
+
+        void SearchIndex::CompactIfFragmented()
+        {
+            if (m_staleCount >= s_minStaleCountToCompact && m_staleCount > m_slots.size())
+            {
+                Rebuild();
+            }
+        }
+
+        SearchIndex::Slot SearchIndex::GetSlotCount() const
+        {
+            return static_cast<Slot>(m_entries.size());
+        }
+
+        const AssetBrowserEntry* SearchIndex::GetEntry(Slot slot) const
+        {
+            return slot < m_entries.size() ? m_entries[slot].m_entry : nullptr;
+        }
+
+        bool SearchIndex::FindSlot(const AssetBrowserEntry* entry, Slot& slot) const
+        {
+            auto it = m_slots.find(entry);
+            if (it == m_slots.end())
+            {
+                return false;
+            }
+            slot = it->second;
+            return true;
+        }
+
+        AZ::u64 SearchIndex::GetRevision() const
+        {
+            return m_revision;
+        }
+
+        bool SearchIndex::Lookup(const EntrySet& entries, AZ::u64 revision, const AssetBrowserEntry* entry, bool& contained) const
+        {
+            if (revision < m_compactedRevision)
+            {
+                return false;
+            }
+
+            // an entry can be matched through the entries below it
+            Slot slot;
+            if (!FindSlot(entry, slot) || m_entries[slot].m_revision > revision || m_entries[slot].m_subtreeRevision > revision)
+            {
+                return false;
+            }
+
+            // or through the entries above it, and its siblings, as when a product is cleaned out for being the only child of its source
+            Slot parentSlot;
+            auto parent = entry->GetParent();
+            if (parent && FindSlot(parent, parentSlot) && m_entries[parentSlot].m_childrenRevision > revision)
+            {
+                return false;
+            }
+            for (; parent && FindSlot(parent, parentSlot); parent = parent->GetParent())
+            {
+                if (m_entries[parentSlot].m_revision > revision)
+                {
+                    return false;
+                }
+            }
+
+            contained = entries.Contains(slot);
+            return true;
+        }
+
+        void SearchIndex::FindAll(EntrySet& result) const
+        {
+            result.Reset(GetSlotCount());
+            for (Slot slot = 0; slot < m_entries.size(); ++slot)
+            {
+                if (m_entries[slot].m_entry)
+                {
+                    result.Insert(slot);
+                }
+            }
+        }
+
+        void SearchIndex::FindByName(const QString& text, EntrySet& result) const
+        {
+            const QString foldedText = text.toCaseFolded();
+            if (foldedText.isEmpty())
+            {
+                FindAll(result);
+                return;
+            }
+
+            result.Reset(GetSlotCount());
+
+            // too short to have a trigram, every name has to be checked
+            if (foldedText.size() < s_trigramLength)
+            {
+                for (Slot slot = 0; slot < m_entries.size(); ++slot)
+                {
+                    const IndexedEntry& indexed = m_entries[slot];
+                    if (indexed.m_entry && indexed.m_foldedName.contains(foldedText))
+                    {
+                        result.Insert(slot);
+                    }
+                }
+                return;
+            }
+
+            // every name containing the text contains all of its trigrams, only the candidates of the rarest one are checked
+            const AZStd::vector<Slot>* candidates = nullptr;
+            for (int position = 0; position + s_trigramLength <= foldedText.size(); ++position)
+            {
+                auto it = m_trigrams.find(GetTrigram(foldedText.constData() + position));
+                if (it == m_trigrams.end())
+                {
+                    return;
+                }
+                if (!candidates || it->second.size() < candidates->size())
+                {
+                    candidates = &it->second;
+                }
+            }
+
+            for (Slot slot : *candidates)
+            {
+                const IndexedEntry& indexed = m_entries[slot];
+                if (indexed.m_entry && indexed.m_foldedName.contains(foldedText))
+                {
+                    result.Insert(slot);
+                }
+            }
+        }
+
+        void SearchIndex::FindByEntryType(AssetBrowserEntry::AssetEntryType entryType, EntrySet& result) const
+        {
+            result.Reset(GetSlotCount());
+            for (Slot slot : m_entryTypes[static_cast<size_t>(entryType)])
+            {
+                const IndexedEntry& indexed = m_entries[slot];
+                if (indexed.m_entry && indexed.m_entryType == entryType)
+                {
+                    result.Insert(slot);
+                }
+            }
+        }
+
+        void SearchIndex::FindByAssetType(const AZ::Data::AssetType& assetType, EntrySet& result) const
+        {
+            result.Reset(GetSlotCount());
+            auto it = m_assetTypes.find(assetType);
+            if (it == m_assetTypes.end())
+            {
+                return;
+            }
+
+            for (Slot slot : it->second)
+            {
+                const IndexedEntry& indexed = m_entries[slot];
+                if (indexed.m_entry && indexed.m_entryType == AssetBrowserEntry::AssetEntryType::Product && indexed.m_assetType == assetType)
+                {
+                    result.Insert(slot);
+                }
+            }
+        }
+
+        void SearchIndex::GetAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes) const
+        {
+            assetTypes.reserve(assetTypes.size() + m_assetTypes.size());
+            for (const auto& assetTypeSlots : m_assetTypes)
+            {
+                assetTypes.push_back(assetTypeSlots.first);
+            }
+        }
+
+        void SearchIndex::IndexEntry(Slot slot, const AssetBrowserEntry* entry)
+        {
+            IndexedEntry& indexed = m_entries[slot];
+            indexed.m_entry = entry;
+            indexed.m_foldedName = entry->GetDisplayName().toCaseFolded();
+            indexed.m_entryType = entry->GetEntryType();
+            indexed.m_revision = ++m_revision;
+
+            AddTrigrams(slot, indexed.m_foldedName);
+            m_entryTypes[static_cast<size_t>(indexed.m_entryType)].push_back(slot);
+
+            if (indexed.m_entryType == AssetBrowserEntry::AssetEntryType::Product)
+            {
+                indexed.m_assetType = static_cast<const ProductAssetBrowserEntry*>(entry)->GetAssetType();
+                m_assetTypes[indexed.m_assetType].push_back(slot);
+            }
+            else
+            {
+                indexed.m_assetType = AZ::Data::AssetType::CreateNull();
+            }
+        }
+
+        void SearchIndex::TouchParents(const AssetBrowserEntry* entry, bool childAddedOrRemoved)
+        {
+            // a parent can be matched through its children, sets resolved before they changed don't know about it.
+            // The children of an entry changed by it are found stale when they are looked up, from the revisions of their parents
+            for (auto parent = entry->GetParent(); parent; parent = parent->GetParent())
+            {
+                auto it = m_slots.find(parent);
+                if (it == m_slots.end())
+                {
+                    break;
+                }
+                IndexedEntry& indexed = m_entries[it->second];
+                indexed.m_subtreeRevision = m_revision;
+                if (childAddedOrRemoved && parent == entry->GetParent())
+                {
+                    indexed.m_childrenRevision = m_revision;
+                }
+            }
+        }
+
+        void SearchIndex::AddTrigrams(Slot slot, const QString& foldedName)
+        {
+            if (foldedName.size() < s_trigramLength)
+            {
+                return;
+            }
+
+            // a trigram repeated in a name is only posted once
+            AZStd::vector<AZ::u64> trigrams;
+            trigrams.reserve(foldedName.size() - s_trigramLength + 1);
+            for (int position = 0; position + s_trigramLength <= foldedName.size(); ++position)
+            {
+                trigrams.push_back(GetTrigram(foldedName.constData() + position));
+            }
+            AZStd::sort(trigrams.begin(), trigrams.end());
+            trigrams.erase(AZStd::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+            for (AZ::u64 trigram : trigrams)
+            {
+                m_trigrams[trigram].push_back(slot);
+            }
+        }
+
+        void SearchIndex::Rebuild()
+        {
+            AZStd::vector<const AssetBrowserEntry*> liveEntries;
+            liveEntries.reserve(m_slots.size());
+            for (const IndexedEntry& indexed : m_entries)
+            {
+                if (indexed.m_entry)
+                {
+                    liveEntries.push_back(indexed.m_entry);
+                }
+            }
+
+            Clear();
+
+            m_entries.reserve(liveEntries.size());
+            for (const AssetBrowserEntry* entry : liveEntries)
+            {
+                AddEntry(entry);
+            }
+            m_compactedRevision = m_revision;
+        }
+
+        AZ::u64 SearchIndex::GetTrigram(const QChar* characters)
+        {
+            return (static_cast<AZ::u64>(characters[0].unicode()) << 32) |
+                (static_cast<AZ::u64>(characters[1].unicode()) << 16) |
+                static_cast<AZ::u64>(characters[2].unicode());
+        }
+    } // namespace AssetBrowser
+} // namespace AzToolsFramework
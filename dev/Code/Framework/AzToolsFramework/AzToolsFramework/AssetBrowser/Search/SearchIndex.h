@@ -0,0 +1,149 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntry.h>
+
+#include <QString>
+
+namespace AzToolsFramework
+{
+    namespace AssetBrowser
+    {
+        //! SearchIndex keeps the asset browser entries searchable without visiting the whole tree
+        /*
+            Every entry added to the tree gets a slot in the index. Display names are indexed by their case folded
+            trigrams and entries are listed by entry type and by asset type, so a filter can resolve the set of entries
+            it accepts from the few entries that can match it.
+            The index is updated as entries are added to and removed from the tree while the AssetEntryChangeset is
+            synchronized, removed slots are only reclaimed when the index is compacted.
+        */
+        class SearchIndex
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SearchIndex, AZ::SystemAllocator, 0);
+
+            using Slot = AZ::u32;
+
+            //! Set of indexed entries, one bit per slot
+            class EntrySet
+            {
+            public:
+                //! Empty the set, sized to hold slotCount slots
+                void Reset(Slot slotCount);
+
+                void Insert(Slot slot);
+                void Erase(Slot slot);
+                bool Contains(Slot slot) const;
+
+                void Intersect(const EntrySet& other);
+                void Unite(const EntrySet& other);
+                //! Keep the slots of mask that are not in the set
+                void Complement(const EntrySet& mask);
+
+                //! Call visitor on every slot in the set, in increasing order
+                template<typename Visitor>
+                void ForEach(Visitor visitor) const;
+
+            private:
+                AZStd::vector<AZ::u64> m_bits;
+            };
+
+            void AddEntry(const AssetBrowserEntry* entry);
+            //! Re-index an entry whose display name or asset type changed after it was added
+            void UpdateEntry(const AssetBrowserEntry* entry);
+            void RemoveEntry(const AssetBrowserEntry* entry);
+            void Clear();
+
+            //! Reclaim the slots of removed entries when they outnumber the live ones
+            void CompactIfFragmented();
+
+            //! Number of slots a set must hold to represent any indexed entry
+            Slot GetSlotCount() const;
+            const AssetBrowserEntry* GetEntry(Slot slot) const;
+            bool FindSlot(const AssetBrowserEntry* entry, Slot& slot) const;
+
+            //! Revision is incremented every time the index changes
+            AZ::u64 GetRevision() const;
+            //! Look up an entry in a set that was resolved at the given revision of the index
+            //! Returns false when the set knows nothing about the entry, because it, one of its children or parents, or the list of
+            //! its siblings changed since, or the index was compacted
+            bool Lookup(const EntrySet& entries, AZ::u64 revision, const AssetBrowserEntry* entry, bool& contained) const;
+
+            //! All the indexed entries
+            void FindAll(EntrySet& result) const;
+            //! Entries whose display name contains text, ignoring case
+            void FindByName(const QString& text, EntrySet& result) const;
+            void FindByEntryType(AssetBrowserEntry::AssetEntryType entryType, EntrySet& result) const;
+            void FindByAssetType(const AZ::Data::AssetType& assetType, EntrySet& result) const;
+            //! Asset types of the indexed products
+            void GetAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes) const;
+
+        private:
+            static const size_t s_entryTypeCount = static_cast<size_t>(AssetBrowserEntry::AssetEntryType::Product) + 1;
+
+            struct IndexedEntry
+            {
+                //! null once the entry is removed
+                const AssetBrowserEntry* m_entry = nullptr;
+                QString m_foldedName;
+                AZ::Data::AssetType m_assetType = AZ::Data::AssetType::CreateNull();
+                AssetBrowserEntry::AssetEntryType m_entryType = AssetBrowserEntry::AssetEntryType::Root;
+                //! Revision at which the entry was last indexed
+                AZ::u64 m_revision = 0;
+                //! Revision at which an entry below it was last added, updated or removed
+                AZ::u64 m_subtreeRevision = 0;
+                //! Revision at which one of its children was last added or removed
+                AZ::u64 m_childrenRevision = 0;
+            };
+
+            void IndexEntry(Slot slot, const AssetBrowserEntry* entry);
+            void TouchParents(const AssetBrowserEntry* entry, bool childAddedOrRemoved);
+            void AddTrigrams(Slot slot, const QString& foldedName);
+            void Rebuild();
+            static AZ::u64 GetTrigram(const QChar* characters);
+
+            // posting lists may hold stale slots of removed or updated entries, candidates are verified against m_entries
+            AZStd::vector<IndexedEntry> m_entries;
+            AZStd::unordered_map<const AssetBrowserEntry*, Slot> m_slots;
+            AZStd::unordered_map<AZ::u64, AZStd::vector<Slot>> m_trigrams;
+            AZStd::array<AZStd::vector<Slot>, s_entryTypeCount> m_entryTypes;
+            AZStd::unordered_map<AZ::Data::AssetType, AZStd::vector<Slot>> m_assetTypes;
+
+            size_t m_staleCount = 0;
+            AZ::u64 m_revision = 0;
+            //! Revision at which slots were last renumbered, sets resolved before it are meaningless
+            AZ::u64 m_compactedRevision = 0;
+        };
+
+        template<typename Visitor>
+        void SearchIndex::EntrySet::ForEach(Visitor visitor) const
+        {
+            for (size_t wordIndex = 0; wordIndex < m_bits.size(); ++wordIndex)
+            {
+                AZ::u64 word = m_bits[wordIndex];
+                while (word)
+                {
+                    const AZ::u32 bit = az_ctz_u64(word);
+                    visitor(static_cast<Slot>(wordIndex * 64 + bit));
+                    word &= word - 1;
+                }
+            }
+        }
+    } // namespace AssetBrowser
+} // namespace AzToolsFramework
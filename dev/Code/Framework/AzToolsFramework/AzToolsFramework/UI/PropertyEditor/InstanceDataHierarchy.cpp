@@ -14,6 +14,8 @@
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
@@ -608,6 +610,7 @@ namespace AzToolsFramework
     void InstanceDataHierarchy::AddComparisonInstance(void* instance, const AZ::Uuid& classId)
     {
         m_comparisonInstances.emplace_back(instance, classId);
+        InvalidateComparisonHierarchies();
     }
 
     //-----------------------------------------------------------------------------
@@ -1060,22 +1063,36 @@ namespace AzToolsFramework
             }
             else
             {
-                // Search through the parent's class elements to find a match
-                for (NodeContainer::iterator it = m_curParentNode->m_children.begin(); it != m_curParentNode->m_children.end(); ++it)
+                auto isMatch = [classData, classElement, elementEditData](const InstanceDataNode& subElement)
                 {
-                    InstanceDataNode* subElement = &(*it);
-                    if (!subElement->m_matched &&
-                        subElement->m_classElement->m_nameCrc == classElement->m_nameCrc &&
-                        subElement->m_classData == classData &&
-                        (subElement->m_elementEditData == elementEditData ||
-                        (subElement->m_elementEditData && elementEditData &&
-                            subElement->m_elementEditData->m_name && elementEditData->m_name &&
-                            azstricmp(subElement->m_elementEditData->m_name, elementEditData->m_name) == 0)))
+                    return !subElement.m_matched &&
+                        subElement.m_classElement->m_nameCrc == classElement->m_nameCrc &&
+                        subElement.m_classData == classData &&
+                        (subElement.m_elementEditData == elementEditData ||
+                        (subElement.m_elementEditData && elementEditData &&
+                            subElement.m_elementEditData->m_name && elementEditData->m_name &&
+                            azstricmp(subElement.m_elementEditData->m_name, elementEditData->m_name) == 0));
+                };
+
+                // Search through the parent's class elements to find a match.
+                // Instances of the same type enumerate their elements in the same order, so start after the
+                // previous match and wrap around. This keeps merging a large selection linear in the hierarchy size.
+                NodeContainer& siblings = m_curParentNode->m_children;
+                NodeContainer::iterator matchIt = AZStd::find_if(m_curParentNode->m_mergeCursor, siblings.end(), isMatch);
+                if (matchIt == siblings.end())
+                {
+                    matchIt = AZStd::find_if(siblings.begin(), m_curParentNode->m_mergeCursor, isMatch);
+                    if (matchIt == m_curParentNode->m_mergeCursor)
                     {
-                        node = subElement;
-                        break;
+                        matchIt = siblings.end();
                     }
                 }
+
+                if (matchIt != siblings.end())
+                {
+                    node = &(*matchIt);
+                    m_curParentNode->m_mergeCursor = AZStd::next(matchIt);
+                }
             }
 
             if (node)
@@ -1092,6 +1109,7 @@ namespace AzToolsFramework
                 {
                     it->m_matched = false;
                 }
+                node->m_mergeCursor = node->m_children.begin();
             }
             else
             {
@@ -1292,17 +1310,50 @@ namespace AzToolsFramework
             }
         }
 
-        // Generate a hierarchy for the comparison instance.
-        m_comparisonHierarchies.clear();
-        for (const InstanceData& comparisonInstance : m_comparisonInstances)
+        // A multi-selection of slice instances usually shares its comparison instances, each distinct one is compared once.
+        InstanceDataArray distinctComparisonInstances;
+        {
+            AZStd::unordered_set<const void*> comparisonInstancesSeen;
+            for (const InstanceData& comparisonInstance : m_comparisonInstances)
+            {
+                if (comparisonInstancesSeen.insert(comparisonInstance.m_instance).second)
+                {
+                    distinctComparisonInstances.push_back(comparisonInstance);
+                }
+            }
+        }
+
+        // Generate a hierarchy for the comparison instances. The comparison nodes reference the instances directly,
+        // so the hierarchies are kept while the instances keep their layout and only the values are compared again.
+        bool comparisonHierarchiesMatch = m_comparisonHierarchies.size() == distinctComparisonInstances.size() && m_comparisonAccessFlags == accessFlags;
+        for (size_t i = 0; comparisonHierarchiesMatch && i < m_comparisonHierarchies.size(); ++i)
+        {
+            const InstanceDataArray& builtInstances = m_comparisonHierarchies[i]->m_rootInstances;
+            comparisonHierarchiesMatch = builtInstances.size() == 1 &&
+                builtInstances[0].m_instance == distinctComparisonInstances[i].m_instance &&
+                builtInstances[0].m_classId == distinctComparisonInstances[i].m_classId &&
+                IsLayoutCurrent(*m_comparisonHierarchies[i]);
+        }
+
+        if (!comparisonHierarchiesMatch)
         {
-            AZ_Assert(comparisonInstance.m_classId == m_rootInstances[0].m_classId, "Compare instance type does not match root instance type.");
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzToolsFramework, "InstanceDataHierarchy::RefreshComparisonData:BuildComparisonHierarchies");
 
-            m_comparisonHierarchies.emplace_back(aznew InstanceDataHierarchy());
-            auto& comparisonHierarchy = m_comparisonHierarchies.back();
-            comparisonHierarchy->AddRootInstance(comparisonInstance.m_instance, comparisonInstance.m_classId);
-            comparisonHierarchy->Build(m_root->GetSerializeContext(), accessFlags, dynamicEditDataProvider);
+            m_comparisonHierarchies.clear();
+            m_comparisonAccessFlags = accessFlags;
+            for (const InstanceData& comparisonInstance : distinctComparisonInstances)
+            {
+                AZ_Assert(comparisonInstance.m_classId == m_rootInstances[0].m_classId, "Compare instance type does not match root instance type.");
 
+                m_comparisonHierarchies.emplace_back(aznew InstanceDataHierarchy());
+                auto& comparisonHierarchy = m_comparisonHierarchies.back();
+                comparisonHierarchy->AddRootInstance(comparisonInstance.m_instance, comparisonInstance.m_classId);
+                comparisonHierarchy->Build(m_root->GetSerializeContext(), accessFlags, dynamicEditDataProvider);
+            }
+        }
+
+        for (auto& comparisonHierarchy : m_comparisonHierarchies)
+        {
             // Compare the two hierarchies...
             if (comparisonHierarchy->m_root)
             {
@@ -1369,6 +1420,64 @@ namespace AzToolsFramework
         return allDataMatches;
     }
 
+    //-----------------------------------------------------------------------------
+    void InstanceDataHierarchy::InvalidateComparisonHierarchies()
+    {
+        m_comparisonHierarchies.clear();
+    }
+
+    //-----------------------------------------------------------------------------
+    bool InstanceDataHierarchy::IsLayoutCurrent(const InstanceDataNode& node)
+    {
+        if (node.m_instances.empty() || !node.m_classData)
+        {
+            return true;
+        }
+
+        void* instance = node.GetInstance(0);
+        if (node.m_classData->m_container)
+        {
+            // Elements added or removed, the element nodes may point to freed storage.
+            size_t numElements = 0;
+            for (const InstanceDataNode& child : node.m_children)
+            {
+                if (!child.m_classElement || !(child.m_classElement->m_flags & AZ::SerializeContext::ClassElement::FLG_UI_ELEMENT))
+                {
+                    ++numElements;
+                }
+            }
+            if (numElements != node.m_classData->m_container->Size(instance))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // A pointer now pointing to another object moves all the members under it.
+            for (const InstanceDataNode& child : node.m_children)
+            {
+                if (child.m_classElement && !child.m_instances.empty() &&
+                    !(child.m_classElement->m_flags & (AZ::SerializeContext::ClassElement::FLG_UI_ELEMENT | AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD)))
+                {
+                    if (child.m_instances[0] != reinterpret_cast<char*>(instance) + child.m_classElement->m_offset)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+
+        for (const InstanceDataNode& child : node.m_children)
+        {
+            if (!IsLayoutCurrent(child))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //-----------------------------------------------------------------------------
     InstanceDataNode* InstanceDataHierarchy::FindNodeByAddress(const InstanceDataNode::Address& address) const
     {
@@ -1530,24 +1639,30 @@ namespace AzToolsFramework
         {
             if (targetNode->m_classData->m_container)
             {
+                // Index the source elements by identifier so large containers aren't matched pairwise.
+                AZStd::unordered_map<InstanceDataNode::Identifier, const InstanceDataNode*> sourceElements;
+                sourceElements.reserve(sourceNode->m_children.size());
+                for (const InstanceDataNode& sourceElementNode : sourceNode->m_children)
+                {
+                    // Keep the first element for duplicated identifiers.
+                    sourceElements.insert(AZStd::make_pair(sourceElementNode.m_identifier, &sourceElementNode));
+                }
+
+                AZStd::unordered_set<InstanceDataNode::Identifier> targetIdentifiers;
+                targetIdentifiers.reserve(targetNode->m_children.size());
+
                 // Find elements in the container that have been added or modified.
                 for (InstanceDataNode& targetElementNode : targetNode->m_children)
                 {
+                    targetIdentifiers.insert(targetElementNode.m_identifier);
+
                     if (targetElementNode.IsRemovedVersusComparison())
                     {
                         continue; // Don't compare removal placeholders.
                     }
 
-                    const InstanceDataNode* sourceNodeMatch = nullptr;
-
-                    for (const InstanceDataNode& sourceElementNode : sourceNode->m_children)
-                    {
-                        if (sourceElementNode.m_identifier == targetElementNode.m_identifier)
-                        {
-                            sourceNodeMatch = &sourceElementNode;
-                            break;
-                        }
-                    }
+                    auto sourceElementIt = sourceElements.find(targetElementNode.m_identifier);
+                    const InstanceDataNode* sourceNodeMatch = sourceElementIt != sourceElements.end() ? sourceElementIt->second : nullptr;
 
                     if (sourceNodeMatch)
                     {
@@ -1591,18 +1706,7 @@ namespace AzToolsFramework
                 // Find elements that've been removed.
                 for (const InstanceDataNode& sourceElementNode : sourceNode->m_children)
                 {
-                    bool isRemoved = true;
-
-                    for (InstanceDataNode& targetElementNode : targetNode->m_children)
-                    {
-                        if (sourceElementNode.m_identifier == targetElementNode.m_identifier)
-                        {
-                            isRemoved = false;
-                            break;
-                        }
-                    }
-
-                    if (isRemoved)
+                    if (targetIdentifiers.find(sourceElementNode.m_identifier) == targetIdentifiers.end())
                     {
                         removedNodeCallback(&sourceElementNode, targetNode);
                     }
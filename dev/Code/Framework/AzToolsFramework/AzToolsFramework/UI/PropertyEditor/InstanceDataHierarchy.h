@@ -167,6 +167,7 @@ namespace AzToolsFramework
         const InstanceDataNode*                     m_comparisonNode;
         bool                                        m_ignoreComparisonResult;
         bool                                        m_matched;          // true if this node was matched across all instances, used internally when the hierarchy is built.
+        NodeContainer::iterator                     m_mergeCursor;      // Child after the last one matched while merging, used internally when the hierarchy is built.
         Identifier                                  m_identifier;       // Local identifier for this node (name crc, or persistent Id / index among siblings in container case).
         const AZ::Edit::ElementData*                m_groupElementData; // Group data for this item
 
@@ -321,9 +322,15 @@ namespace AzToolsFramework
         void Build(AZ::SerializeContext* sc, unsigned int accessFlags, DynamicEditDataProvider dynamicEditDataProvider = DynamicEditDataProvider(), ComponentEditor* editorParent = nullptr);
 
         /// Re-compares root instance against specified Compare instance and updates node flags accordingly.
+        /// One hierarchy is built per distinct comparison instance on the first call, later calls only compare the values
+        /// again. The hierarchies are rebuilt when the comparison instances or their types change, or when a container in
+        /// them was resized or a pointer in them now points to another object.
         /// \return true if all instances match the comparison instance.
         bool RefreshComparisonData(unsigned int accessFlags, DynamicEditDataProvider dynamicEditDataProvider);
 
+        /// Discards the cached comparison hierarchies, they are rebuilt by the next RefreshComparisonData().
+        void InvalidateComparisonHierarchies();
+
         /// Callback to receive notification of nodes found in the target hierarchy, but not the source hierarchy.
         typedef AZStd::function<void(InstanceDataNode* /*targetNode*/, AZStd::vector<AZ::u8>& /*data*/)> NewNodeCB;
 
@@ -438,6 +445,9 @@ namespace AzToolsFramework
         bool BeginNode(void* instance, const AZ::SerializeContext::ClassData* classData, const AZ::SerializeContext::ClassElement* classElement, DynamicEditDataProvider dynamicEditDataProvider);
         bool EndNode();
 
+        /// Returns false if the instance data under node no longer has the layout the node was built from.
+        static bool IsLayoutCurrent(const InstanceDataNode& node);
+
         static void CompareHierarchies(const InstanceDataNode* sourceNode, InstanceDataNode* targetNode,
             AZStd::vector<AZ::u8>& tempSourceBuffer,
             AZStd::vector<AZ::u8>& tempTargetBuffer,
@@ -456,7 +466,8 @@ namespace AzToolsFramework
         SupplementalEditDataContainer                           m_supplementalEditData;     ///< List of additional edit data generated during traversal for elements.
         EditDataOverrideStack                                   m_editDataOverrides;
         InstanceDataArray                                       m_comparisonInstances;      ///< Optional comparison instance for Override recognition.
-        AZStd::vector<AZStd::unique_ptr<InstanceDataHierarchy>> m_comparisonHierarchies;    ///< Hierarchy representing comparison instance.
+        AZStd::vector<AZStd::unique_ptr<InstanceDataHierarchy>> m_comparisonHierarchies;    ///< Hierarchies representing the distinct comparison instances.
+        unsigned int                                            m_comparisonAccessFlags = 0; ///< Access flags the comparison hierarchies were built with.
         ValueComparisonFunction                                 m_valueComparisonFunction;  ///< Customizable function for comparing value nodes.
         AZ::u8                                                  m_buildFlags = 0;           ///< Flags to customize behavior during Build.
     };
@@ -0,0 +1,465 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "EditorEntitySpatialIndex.h"
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzToolsFramework
+{
+    static AZ::Aabb CombineAabbs(const AZ::Aabb& lhs, const AZ::Aabb& rhs)
+    {
+        return AZ::Aabb::CreateFromMinMax(lhs.GetMin().GetMin(rhs.GetMin()), lhs.GetMax().GetMax(rhs.GetMax()));
+    }
+
+    // slab test of the segment [origin, origin + direction * length] against the aabb
+    static bool SegmentIntersectsAabb(
+        const AZ::Vector3& origin, const AZ::Vector3& directionReciprocal, const float length, const AZ::Aabb& aabb)
+    {
+        const AZ::Vector3 t1 = (aabb.GetMin() - origin) * directionReciprocal;
+        const AZ::Vector3 t2 = (aabb.GetMax() - origin) * directionReciprocal;
+        const float enter = AZ::GetMax(static_cast<float>(t1.GetMin(t2).GetMaxElement()), 0.0f);
+        const float exit = AZ::GetMin(static_cast<float>(t1.GetMax(t2).GetMinElement()), length);
+        return enter <= exit;
+    }
+
+    // true if the aabb is at least partially on the positive side of every plane
+    static bool AabbInsideVolume(const AZ::Plane* planes, const size_t planeCount, const AZ::Aabb& aabb)
+    {
+        for (size_t planeIndex = 0; planeIndex < planeCount; ++planeIndex)
+        {
+            // test the corner furthest along the plane normal
+            const AZ::Plane& plane = planes[planeIndex];
+            const AZ::Vector3 furthestCorner = AZ::Vector3::CreateSelectCmpGreaterEqual(
+                plane.GetNormal(), AZ::Vector3::CreateZero(), aabb.GetMax(), aabb.GetMin());
+
+            if (static_cast<float>(plane.GetPointDist(furthestCorner)) < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    EditorEntitySpatialIndex::EditorEntitySpatialIndex(const float margin)
+        : m_margin(margin)
+    {
+    }
+
+    void EditorEntitySpatialIndex::InsertOrUpdate(const AZ::EntityId entityId, const AZ::Aabb& bounds)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const auto leafIt = m_leaves.find(entityId);
+        if (leafIt != m_leaves.end())
+        {
+            const int leafIndex = leafIt->second;
+
+            // the entity moved within its expanded bounds, nothing to do
+            if (m_nodes[leafIndex].m_aabb.Contains(bounds))
+            {
+                return;
+            }
+
+            RemoveLeaf(leafIndex);
+            m_nodes[leafIndex].m_aabb = bounds.GetExpanded(m_margin);
+            InsertLeaf(leafIndex);
+            return;
+        }
+
+        const int leafIndex = AllocateNode();
+        Node& leaf = m_nodes[leafIndex];
+        leaf.m_aabb = bounds.GetExpanded(m_margin);
+        leaf.m_entityId = entityId;
+        leaf.m_height = 0;
+        m_leaves.emplace(entityId, leafIndex);
+
+        InsertLeaf(leafIndex);
+    }
+
+    bool EditorEntitySpatialIndex::Remove(const AZ::EntityId entityId)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const auto leafIt = m_leaves.find(entityId);
+        if (leafIt == m_leaves.end())
+        {
+            return false;
+        }
+
+        const int leafIndex = leafIt->second;
+        m_leaves.erase(leafIt);
+
+        RemoveLeaf(leafIndex);
+        FreeNode(leafIndex);
+        return true;
+    }
+
+    void EditorEntitySpatialIndex::Clear()
+    {
+        m_nodes.clear();
+        m_leaves.clear();
+        m_root = s_nullNode;
+        m_freeList = s_nullNode;
+    }
+
+    bool EditorEntitySpatialIndex::Contains(const AZ::EntityId entityId) const
+    {
+        return m_leaves.find(entityId) != m_leaves.end();
+    }
+
+    size_t EditorEntitySpatialIndex::Size() const
+    {
+        return m_leaves.size();
+    }
+
+    void EditorEntitySpatialIndex::EnumerateOverlapping(const AZ::Aabb& aabb, const EntityVisitor& visitor) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        Enumerate([&aabb](const AZ::Aabb& nodeAabb)
+        {
+            return nodeAabb.Overlaps(aabb);
+        }, visitor);
+    }
+
+    void EditorEntitySpatialIndex::EnumerateRayIntersecting(
+        const AZ::Vector3& origin, const AZ::Vector3& direction, const float length, const EntityVisitor& visitor) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const AZ::Vector3 directionReciprocal = direction.GetReciprocal();
+        Enumerate([&origin, &directionReciprocal, length](const AZ::Aabb& nodeAabb)
+        {
+            return SegmentIntersectsAabb(origin, directionReciprocal, length, nodeAabb);
+        }, visitor);
+    }
+
+    void EditorEntitySpatialIndex::EnumerateInsideVolume(
+        const AZ::Plane* planes, const size_t planeCount, const EntityVisitor& visitor) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        Enumerate([planes, planeCount](const AZ::Aabb& nodeAabb)
+        {
+            return AabbInsideVolume(planes, planeCount, nodeAabb);
+        }, visitor);
+    }
+
+    template<typename OverlapTest>
+    void EditorEntitySpatialIndex::Enumerate(const OverlapTest& overlapTest, const EntityVisitor& visitor) const
+    {
+        if (m_root == s_nullNode)
+        {
+            return;
+        }
+
+        AZStd::vector<int> stack;
+        stack.reserve(64);
+        stack.push_back(m_root);
+
+        while (!stack.empty())
+        {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            if (!overlapTest(node.m_aabb))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                visitor(node.m_entityId);
+            }
+            else
+            {
+                stack.push_back(node.m_child1);
+                stack.push_back(node.m_child2);
+            }
+        }
+    }
+
+    int EditorEntitySpatialIndex::AllocateNode()
+    {
+        if (m_freeList == s_nullNode)
+        {
+            m_nodes.emplace_back();
+            return static_cast<int>(m_nodes.size()) - 1;
+        }
+
+        const int nodeIndex = m_freeList;
+        m_freeList = m_nodes[nodeIndex].m_parent;
+        m_nodes[nodeIndex] = Node();
+        return nodeIndex;
+    }
+
+    void EditorEntitySpatialIndex::FreeNode(const int nodeIndex)
+    {
+        m_nodes[nodeIndex] = Node();
+        m_nodes[nodeIndex].m_parent = m_freeList;
+        m_freeList = nodeIndex;
+    }
+
+    void EditorEntitySpatialIndex::InsertLeaf(const int leafIndex)
+    {
+        if (m_root == s_nullNode)
+        {
+            m_root = leafIndex;
+            m_nodes[leafIndex].m_parent = s_nullNode;
+            return;
+        }
+
+        // descend to the sibling that adds the least surface area to the tree
+        const AZ::Aabb leafAabb = m_nodes[leafIndex].m_aabb;
+        int siblingIndex = m_root;
+        while (!m_nodes[siblingIndex].IsLeaf())
+        {
+            const Node& node = m_nodes[siblingIndex];
+
+            const float area = node.m_aabb.GetSurfaceArea();
+            const float combinedArea = CombineAabbs(node.m_aabb, leafAabb).GetSurfaceArea();
+
+            // cost of creating a new parent for this node and the new leaf
+            const float cost = 2.0f * combinedArea;
+            // minimum cost of pushing the leaf further down the tree
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            const auto descendCost = [this, &leafAabb, inheritanceCost](const int childIndex)
+            {
+                const Node& child = m_nodes[childIndex];
+                const float childCombinedArea = CombineAabbs(child.m_aabb, leafAabb).GetSurfaceArea();
+                return child.IsLeaf()
+                    ? childCombinedArea + inheritanceCost
+                    : childCombinedArea - child.m_aabb.GetSurfaceArea() + inheritanceCost;
+            };
+
+            const float cost1 = descendCost(node.m_child1);
+            const float cost2 = descendCost(node.m_child2);
+
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+
+            siblingIndex = cost1 < cost2 ? node.m_child1 : node.m_child2;
+        }
+
+        // allocating may grow the node storage, only take references afterwards
+        const int newParentIndex = AllocateNode();
+        Node& newParent = m_nodes[newParentIndex];
+        Node& sibling = m_nodes[siblingIndex];
+        const int oldParentIndex = sibling.m_parent;
+
+        newParent.m_parent = oldParentIndex;
+        newParent.m_aabb = CombineAabbs(leafAabb, sibling.m_aabb);
+        newParent.m_height = sibling.m_height + 1;
+        newParent.m_child1 = siblingIndex;
+        newParent.m_child2 = leafIndex;
+        sibling.m_parent = newParentIndex;
+        m_nodes[leafIndex].m_parent = newParentIndex;
+
+        if (oldParentIndex != s_nullNode)
+        {
+            Node& oldParent = m_nodes[oldParentIndex];
+            if (oldParent.m_child1 == siblingIndex)
+            {
+                oldParent.m_child1 = newParentIndex;
+            }
+            else
+            {
+                oldParent.m_child2 = newParentIndex;
+            }
+        }
+        else
+        {
+            m_root = newParentIndex;
+        }
+
+        RefitAncestors(m_nodes[leafIndex].m_parent);
+    }
+
+    void EditorEntitySpatialIndex::RemoveLeaf(const int leafIndex)
+    {
+        if (leafIndex == m_root)
+        {
+            m_root = s_nullNode;
+            return;
+        }
+
+        const int parentIndex = m_nodes[leafIndex].m_parent;
+        const int grandParentIndex = m_nodes[parentIndex].m_parent;
+        const int siblingIndex = m_nodes[parentIndex].m_child1 == leafIndex
+            ? m_nodes[parentIndex].m_child2
+            : m_nodes[parentIndex].m_child1;
+
+        // replace the parent by the sibling of the leaf
+        if (grandParentIndex != s_nullNode)
+        {
+            Node& grandParent = m_nodes[grandParentIndex];
+            if (grandParent.m_child1 == parentIndex)
+            {
+                grandParent.m_child1 = siblingIndex;
+            }
+            else
+            {
+                grandParent.m_child2 = siblingIndex;
+            }
+
+            m_nodes[siblingIndex].m_parent = grandParentIndex;
+            FreeNode(parentIndex);
+
+            RefitAncestors(grandParentIndex);
+        }
+        else
+        {
+            m_root = siblingIndex;
+            m_nodes[siblingIndex].m_parent = s_nullNode;
+            FreeNode(parentIndex);
+        }
+
+        m_nodes[leafIndex].m_parent = s_nullNode;
+    }
+
+    void EditorEntitySpatialIndex::RefitAncestors(int nodeIndex)
+    {
+        while (nodeIndex != s_nullNode)
+        {
+            nodeIndex = Balance(nodeIndex);
+
+            Node& node = m_nodes[nodeIndex];
+            const Node& child1 = m_nodes[node.m_child1];
+            const Node& child2 = m_nodes[node.m_child2];
+
+            node.m_height = 1 + AZ::GetMax(child1.m_height, child2.m_height);
+            node.m_aabb = CombineAabbs(child1.m_aabb, child2.m_aabb);
+
+            nodeIndex = node.m_parent;
+        }
+    }
+
+    // rotates the taller child of the node up if the children heights differ by more than one,
+    // returns the index of the node now at the position of the given node
+    int EditorEntitySpatialIndex::Balance(const int indexA)
+    {
+        Node& nodeA = m_nodes[indexA];
+        if (nodeA.IsLeaf() || nodeA.m_height < 2)
+        {
+            return indexA;
+        }
+
+        const int indexB = nodeA.m_child1;
+        const int indexC = nodeA.m_child2;
+        Node& nodeB = m_nodes[indexB];
+        Node& nodeC = m_nodes[indexC];
+
+        const int balance = nodeC.m_height - nodeB.m_height;
+
+        // replaces A by its child in the parent of A
+        const auto promote = [this, indexA](Node& child, const int childIndex)
+        {
+            child.m_parent = m_nodes[indexA].m_parent;
+            m_nodes[indexA].m_parent = childIndex;
+
+            if (child.m_parent != s_nullNode)
+            {
+                Node& parent = m_nodes[child.m_parent];
+                if (parent.m_child1 == indexA)
+                {
+                    parent.m_child1 = childIndex;
+                }
+                else
+                {
+                    parent.m_child2 = childIndex;
+                }
+            }
+            else
+            {
+                m_root = childIndex;
+            }
+        };
+
+        // rotate C up
+        if (balance > 1)
+        {
+            const int indexF = nodeC.m_child1;
+            const int indexG = nodeC.m_child2;
+            Node& nodeF = m_nodes[indexF];
+            Node& nodeG = m_nodes[indexG];
+
+            nodeC.m_child1 = indexA;
+            promote(nodeC, indexC);
+
+            if (nodeF.m_height > nodeG.m_height)
+            {
+                nodeC.m_child2 = indexF;
+                nodeA.m_child2 = indexG;
+                nodeG.m_parent = indexA;
+                nodeA.m_aabb = CombineAabbs(nodeB.m_aabb, nodeG.m_aabb);
+                nodeC.m_aabb = CombineAabbs(nodeA.m_aabb, nodeF.m_aabb);
+                nodeA.m_height = 1 + AZ::GetMax(nodeB.m_height, nodeG.m_height);
+                nodeC.m_height = 1 + AZ::GetMax(nodeA.m_height, nodeF.m_height);
+            }
+            else
+            {
+                nodeC.m_child2 = indexG;
+                nodeA.m_child2 = indexF;
+                nodeF.m_parent = indexA;
+                nodeA.m_aabb = CombineAabbs(nodeB.m_aabb, nodeF.m_aabb);
+                nodeC.m_aabb = CombineAabbs(nodeA.m_aabb, nodeG.m_aabb);
+                nodeA.m_height = 1 + AZ::GetMax(nodeB.m_height, nodeF.m_height);
+                nodeC.m_height = 1 + AZ::GetMax(nodeA.m_height, nodeG.m_height);
+            }
+
+            return indexC;
+        }
+
+        // rotate B up
+        if (balance < -1)
+        {
+            const int indexD = nodeB.m_child1;
+            const int indexE = nodeB.m_child2;
+            Node& nodeD = m_nodes[indexD];
+            Node& nodeE = m_nodes[indexE];
+
+            nodeB.m_child1 = indexA;
+            promote(nodeB, indexB);
+
+            if (nodeD.m_height > nodeE.m_height)
+            {
+                nodeB.m_child2 = indexD;
+                nodeA.m_child1 = indexE;
+                nodeE.m_parent = indexA;
+                nodeA.m_aabb = CombineAabbs(nodeC.m_aabb, nodeE.m_aabb);
+                nodeB.m_aabb = CombineAabbs(nodeA.m_aabb, nodeD.m_aabb);
+                nodeA.m_height = 1 + AZ::GetMax(nodeC.m_height, nodeE.m_height);
+                nodeB.m_height = 1 + AZ::GetMax(nodeA.m_height, nodeD.m_height);
+            }
+            else
+            {
+                nodeB.m_child2 = indexE;
+                nodeA.m_child1 = indexD;
+                nodeD.m_parent = indexA;
+                nodeA.m_aabb = CombineAabbs(nodeC.m_aabb, nodeD.m_aabb);
+                nodeB.m_aabb = CombineAabbs(nodeA.m_aabb, nodeE.m_aabb);
+                nodeA.m_height = 1 + AZ::GetMax(nodeC.m_height, nodeD.m_height);
+                nodeB.m_height = 1 + AZ::GetMax(nodeA.m_height, nodeE.m_height);
+            }
+
+            return indexB;
+        }
+
+        return indexA;
+    }
+} // namespace AzToolsFramework
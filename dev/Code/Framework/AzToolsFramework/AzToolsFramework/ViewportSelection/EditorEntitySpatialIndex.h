@@ -0,0 +1,89 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AzToolsFramework
+{
+    /// Bounding volume hierarchy of entity bounds, maintained incrementally as entities move.
+    /// Leaves store the entity bounds expanded by a margin so small movements do not
+    /// restructure the tree. Queries are conservative, they may return entities whose
+    /// actual bounds are just outside of the query volume.
+    class EditorEntitySpatialIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EditorEntitySpatialIndex, AZ::SystemAllocator, 0);
+
+        using EntityVisitor = AZStd::function<void(AZ::EntityId)>;
+
+        /// @param margin Distance the stored bounds extend past the entity bounds in every direction.
+        explicit EditorEntitySpatialIndex(float margin = 0.1f);
+
+        /// Adds the entity to the index, or updates its bounds if it is already indexed.
+        void InsertOrUpdate(AZ::EntityId entityId, const AZ::Aabb& bounds);
+        /// Removes the entity from the index, returns false if the entity was not indexed.
+        bool Remove(AZ::EntityId entityId);
+        void Clear();
+
+        bool Contains(AZ::EntityId entityId) const;
+        size_t Size() const;
+
+        /// Visits every entity whose bounds overlap the aabb.
+        void EnumerateOverlapping(const AZ::Aabb& aabb, const EntityVisitor& visitor) const;
+        /// Visits every entity whose bounds are hit by the ray, in no particular order.
+        /// @param direction Normalized direction of the ray.
+        void EnumerateRayIntersecting(
+            const AZ::Vector3& origin, const AZ::Vector3& direction, float length, const EntityVisitor& visitor) const;
+        /// Visits every entity whose bounds are not completely outside of the convex volume.
+        /// @param planes Planes bounding the volume, with their normals pointing inside of it.
+        void EnumerateInsideVolume(const AZ::Plane* planes, size_t planeCount, const EntityVisitor& visitor) const;
+
+    private:
+        static const int s_nullNode = -1;
+
+        struct Node
+        {
+            bool IsLeaf() const { return m_child1 == s_nullNode; }
+
+            AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+            AZ::EntityId m_entityId; ///< Only valid for leaves.
+            int m_parent = s_nullNode; ///< Next free node when the node is not used.
+            int m_child1 = s_nullNode;
+            int m_child2 = s_nullNode;
+            int m_height = -1; ///< 0 for leaves, -1 when the node is not used.
+        };
+
+        int AllocateNode();
+        void FreeNode(int nodeIndex);
+        void InsertLeaf(int leafIndex);
+        void RemoveLeaf(int leafIndex);
+        void RefitAncestors(int nodeIndex);
+        int Balance(int nodeIndex);
+
+        template<typename OverlapTest>
+        void Enumerate(const OverlapTest& overlapTest, const EntityVisitor& visitor) const;
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::unordered_map<AZ::EntityId, int> m_leaves; ///< Leaf node of each indexed entity.
+        AZ::Vector3 m_margin;
+        int m_root = s_nullNode;
+        int m_freeList = s_nullNode;
+    };
+} // namespace AzToolsFramework
@@ -86,46 +86,95 @@ namespace AzToolsFramework
         // going to constantly be pushing/popping the widget context
         ViewportInteraction::WidgetContextGuard widgetContextGuard(viewportId);
 
-        const bool helpersVisible = HelpersVisible();
-
-        // selecting new entities
-        AZ::EntityId entityIdUnderCursor;
-        AZ::VectorFloat closestDistance = AZ::g_fltMax;
-        for (size_t entityCacheIndex = 0; entityCacheIndex < m_entityDataCache->VisibleEntityDataCount(); ++entityCacheIndex)
+        const auto entitySelectable = [this](const size_t entityCacheIndex)
         {
-            const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
+            return !m_entityDataCache->IsVisibleEntityLocked(entityCacheIndex)
+                && m_entityDataCache->IsVisibleEntityVisible(entityCacheIndex);
+        };
 
-            if (    m_entityDataCache->IsVisibleEntityLocked(entityCacheIndex)
-                || !m_entityDataCache->IsVisibleEntityVisible(entityCacheIndex))
-            {
-                continue;
-            }
+        const auto& mousePick = mouseInteraction.m_mouseInteraction.m_mousePick;
 
-            // 2d screen space selection - did we click an icon
-            if (helpersVisible)
+        // 2d screen space selection - did we click an icon
+        // note: icons take precedence over component bounds
+        if (HelpersVisible())
+        {
+            const auto screenCoords = mousePick.m_screenCoordinates;
+            const auto iconUnderCursor = [this, &cameraState, &entitySelectable, screenCoords, viewportId](
+                const size_t entityCacheIndex)
             {
                 // some components choose to hide their icons (e.g. meshes)
-                if (!m_entityDataCache->IsVisibleEntityIconHidden(entityCacheIndex))
+                if (    !entitySelectable(entityCacheIndex)
+                    ||  m_entityDataCache->IsVisibleEntityIconHidden(entityCacheIndex))
                 {
-                    const AZ::Vector3& entityPosition = m_entityDataCache->GetVisibleEntityPosition(entityCacheIndex);
+                    return false;
+                }
 
-                    // selecting based on 2d icon - should only do it when visible and not selected
-                    const QPoint screenPosition = GetScreenPosition(viewportId, entityPosition);
+                const AZ::Vector3& entityPosition = m_entityDataCache->GetVisibleEntityPosition(entityCacheIndex);
+
+                // selecting based on 2d icon - should only do it when visible and not selected
+                const QPoint screenPosition = GetScreenPosition(viewportId, entityPosition);
+
+                const AZ::VectorFloat distSqFromCamera = cameraState.m_position.GetDistanceSq(entityPosition);
+                const auto iconRange = static_cast<float>(GetIconScale(distSqFromCamera) * s_iconSize * 0.5f);
+
+                return  screenCoords.m_x >= screenPosition.x() - iconRange
+                    &&  screenCoords.m_x <= screenPosition.x() + iconRange
+                    &&  screenCoords.m_y >= screenPosition.y() - iconRange
+                    &&  screenCoords.m_y <= screenPosition.y() + iconRange;
+            };
 
-                    const AZ::VectorFloat distSqFromCamera = cameraState.m_position.GetDistanceSq(entityPosition);
-                    const auto iconRange = static_cast<float>(GetIconScale(distSqFromCamera) * s_iconSize * 0.5f);
-                    const auto screenCoords = mouseInteraction.m_mouseInteraction.m_mousePick.m_screenCoordinates;
+            // only entities seen through the area the largest icon covers around the cursor can be under it
+            const int iconRange = static_cast<int>(ceilf(s_iconMaxScale * s_iconSize * 0.5f));
+            const QRect iconRect(
+                screenCoords.m_x - iconRange, screenCoords.m_y - iconRange, 2 * iconRange + 1, 2 * iconRange + 1);
 
-                    if (    screenCoords.m_x >= screenPosition.x() - iconRange
-                        &&  screenCoords.m_x <= screenPosition.x() + iconRange
-                        &&  screenCoords.m_y >= screenPosition.y() - iconRange
-                        &&  screenCoords.m_y <= screenPosition.y() + iconRange)
+            AZStd::array<AZ::Plane, 4> iconVolume;
+            if (CalculateScreenRectVolume(iconRect, cameraState, iconVolume))
+            {
+                // pick the first icon in cache order, as if all entities were tested
+                AZStd::optional<size_t> iconEntityCacheIndex;
+                m_entityDataCache->EnumerateVisibleEntitiesInsideVolume(
+                    iconVolume.data(), iconVolume.size(),
+                    [&iconEntityCacheIndex, &iconUnderCursor](const size_t entityCacheIndex)
+                {
+                    if (    (!iconEntityCacheIndex || entityCacheIndex < iconEntityCacheIndex.value())
+                        &&  iconUnderCursor(entityCacheIndex))
                     {
-                        entityIdUnderCursor = entityId;
-                        break;
+                        iconEntityCacheIndex = entityCacheIndex;
                     }
+                });
+
+                if (iconEntityCacheIndex)
+                {
+                    return m_entityDataCache->GetVisibleEntityId(iconEntityCacheIndex.value());
                 }
             }
+            else
+            {
+                for (size_t entityCacheIndex = 0; entityCacheIndex < m_entityDataCache->VisibleEntityDataCount(); ++entityCacheIndex)
+                {
+                    if (iconUnderCursor(entityCacheIndex))
+                    {
+                        return m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
+                    }
+                }
+            }
+        }
+
+        // selecting new entities - only entities with bounds along the pick ray are tested
+        AZ::EntityId entityIdUnderCursor;
+        AZ::VectorFloat closestDistance = AZ::g_fltMax;
+        m_entityDataCache->EnumerateVisibleEntitiesAlongRay(
+            mousePick.m_rayOrigin, mousePick.m_rayDirection, s_pickRayLength,
+            [this, &entitySelectable, &entityIdUnderCursor, &closestDistance, &mouseInteraction, viewportId](
+                const size_t entityCacheIndex)
+        {
+            if (!entitySelectable(entityCacheIndex))
+            {
+                return;
+            }
+
+            const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
 
             // check if components provide an aabb
             const AZ::Aabb aabb = CalculateComponentAabbs(viewportId, entityId);
@@ -144,7 +193,7 @@ namespace AzToolsFramework
                     }
                 }
             }
-        }
+        });
 
         return entityIdUnderCursor;
     }
@@ -19,9 +19,6 @@
 
 namespace AzToolsFramework
 {
-    /// Default ray length for picking in the viewport.
-    static const AZ::VectorFloat s_pickRayLength = AZ::VectorFloat(1000.0f);
-
     AZ::Vector3 CalculateCenterOffset(
         const AZ::EntityId entityId, const EditorTransformComponentSelectionRequests::Pivot pivot)
     {
@@ -53,6 +50,90 @@ namespace AzToolsFramework
         return screenPosition;
     }
 
+    // direction from the camera through a point on screen (y down)
+    static AZ::Vector3 ScreenDirection(
+        const float x, const float y, const AzFramework::CameraState& cameraState)
+    {
+        const float width = cameraState.m_viewportSize.GetX();
+        const float height = cameraState.m_viewportSize.GetY();
+        const float tanHalfFov = tanf(cameraState.VerticalFovRadian() * 0.5f);
+
+        const float ndcX = 2.0f * x / width - 1.0f;
+        const float ndcY = 1.0f - 2.0f * y / height;
+
+        return cameraState.m_forward
+            + cameraState.m_side * AZ::VectorFloat(ndcX * tanHalfFov * (width / height))
+            + cameraState.m_up * AZ::VectorFloat(ndcY * tanHalfFov);
+    }
+
+    bool CalculateScreenRectVolume(
+        const QRect& screenRect, const AzFramework::CameraState& cameraState, AZStd::array<AZ::Plane, 4>& planes)
+    {
+        if (    cameraState.m_orthographic
+            ||  cameraState.m_viewportSize.GetX() <= 0.0f
+            ||  cameraState.m_viewportSize.GetY() <= 0.0f)
+        {
+            return false;
+        }
+
+        // grow the rectangle slightly so the volume is never degenerate and
+        // rounding of screen positions never excludes an entity on its edge
+        const int margin = 2;
+        const QRect rect = screenRect.normalized().adjusted(-margin, -margin, margin, margin);
+
+        const float left = static_cast<float>(rect.left());
+        const float right = static_cast<float>(rect.right() + 1);
+        const float top = static_cast<float>(rect.top());
+        const float bottom = static_cast<float>(rect.bottom() + 1);
+
+        const AZ::Vector3 corners[] = {
+            ScreenDirection(left, top, cameraState),
+            ScreenDirection(right, top, cameraState),
+            ScreenDirection(right, bottom, cameraState),
+            ScreenDirection(left, bottom, cameraState)
+        };
+
+        const AZ::Vector3 center = ScreenDirection(
+            (left + right) * 0.5f, (top + bottom) * 0.5f, cameraState);
+
+        for (size_t edge = 0; edge < planes.size(); ++edge)
+        {
+            AZ::Vector3 normal = corners[edge].Cross(corners[(edge + 1) % 4]).GetNormalized();
+            if (static_cast<float>(normal.Dot(center)) < 0.0f)
+            {
+                normal = -normal;
+            }
+
+            planes[edge] = AZ::Plane::CreateFromNormalAndPoint(normal, cameraState.m_position);
+        }
+
+        return true;
+    }
+
+    bool CalculateViewFrustum(const AzFramework::CameraState& cameraState, AZStd::array<AZ::Plane, 6>& planes)
+    {
+        const QRect viewportRect(
+            0, 0, static_cast<int>(cameraState.m_viewportSize.GetX()), static_cast<int>(cameraState.m_viewportSize.GetY()));
+
+        AZStd::array<AZ::Plane, 4> sidePlanes;
+        if (!CalculateScreenRectVolume(viewportRect, cameraState, sidePlanes))
+        {
+            return false;
+        }
+
+        for (size_t side = 0; side < sidePlanes.size(); ++side)
+        {
+            planes[side] = sidePlanes[side];
+        }
+
+        planes[4] = AZ::Plane::CreateFromNormalAndPoint(
+            cameraState.m_forward, cameraState.m_position + cameraState.m_forward * AZ::VectorFloat(cameraState.m_nearClip));
+        planes[5] = AZ::Plane::CreateFromNormalAndPoint(
+            -cameraState.m_forward, cameraState.m_position + cameraState.m_forward * AZ::VectorFloat(cameraState.m_farClip));
+
+        return true;
+    }
+
     bool AabbIntersectMouseRay(
         const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb)
     {
@@ -13,11 +13,15 @@
 #pragma once
 
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Plane.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzToolsFramework/Viewport/ViewportTypes.h>
 #include <AzToolsFramework/ViewportSelection/EditorTransformComponentSelectionRequestBus.h>
 
+#include <QRect>
+
 namespace AZ
 {
     class Aabb;
@@ -32,6 +36,9 @@ namespace AzToolsFramework
 {
     static const AZ::VectorFloat s_tenRecip = AZ::VectorFloat(1.0f / 10.0f);
 
+    /// Default ray length for picking in the viewport.
+    static const AZ::VectorFloat s_pickRayLength = AZ::VectorFloat(1000.0f);
+
     /// Is the pivot at the center of the object (middle of extents) or at the
     /// exported authored object root position.
     inline bool Centered(const EditorTransformComponentSelectionRequests::Pivot pivot)
@@ -55,6 +62,16 @@ namespace AzToolsFramework
     /// Map from world space to screen space.
     QPoint GetScreenPosition(int viewportId, const AZ::Vector3& worldTranslation);
 
+    /// Calculate the planes bounding the volume seen through a rectangle of the viewport (in screen space).
+    /// The plane normals point inside of the volume. Returns false if the volume can not be
+    /// calculated from the camera state (e.g. orthographic views).
+    bool CalculateScreenRectVolume(
+        const QRect& screenRect, const AzFramework::CameraState& cameraState, AZStd::array<AZ::Plane, 4>& planes);
+
+    /// Calculate the planes bounding the view frustum of the camera, including the near and far clip planes.
+    /// The plane normals point inside of the frustum. Returns false for the same camera states as CalculateScreenRectVolume.
+    bool CalculateViewFrustum(const AzFramework::CameraState& cameraState, AZStd::array<AZ::Plane, 6>& planes);
+
     /// Given a mouse interaction, determine if the pick ray from its position
     /// in screen space intersected an aabb in world space.
     bool AabbIntersectMouseRay(
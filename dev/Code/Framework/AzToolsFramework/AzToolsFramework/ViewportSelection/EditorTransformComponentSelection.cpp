@@ -336,6 +336,7 @@ namespace AzToolsFramework
         const EntityIdContainer& activeSelectedEntityIds, EntityIdContainer& selectedEntityIdsBeforeBoxSelect,
         EntityIdContainer& potentialSelectedEntityIds, EntityIdContainer& potentialDeselectedEntityIds,
         const EditorVisibleEntityDataCache& entityDataCache, const int viewportId,
+        const AzFramework::CameraState& cameraState,
         const ViewportInteraction::KeyboardModifiers currentKeyboardModifiers,
         const ViewportInteraction::KeyboardModifiers& previousKeyboardModifiers)
     {
@@ -363,12 +364,12 @@ namespace AzToolsFramework
             // going to constantly be pushing/popping the widget context
             ViewportInteraction::WidgetContextGuard widgetContextGuard(viewportId);
 
-            for (size_t entityCacheIndex = 0; entityCacheIndex < entityDataCache.VisibleEntityDataCount(); ++entityCacheIndex)
+            const auto boxSelectEntity = [&](const size_t entityCacheIndex)
             {
                 if (    entityDataCache.IsVisibleEntityLocked(entityCacheIndex)
                     || !entityDataCache.IsVisibleEntityVisible(entityCacheIndex))
                 {
-                    continue;
+                    return;
                 }
 
                 const AZ::EntityId entityId = entityDataCache.GetVisibleEntityId(entityCacheIndex);
@@ -402,6 +403,44 @@ namespace AzToolsFramework
                             return entityId == entityIds.end();
                         });
                 }
+            };
+
+            AZStd::array<AZ::Plane, 4> boxVolume;
+            if (CalculateScreenRectVolume(boxSelect.value(), cameraState, boxVolume))
+            {
+                // only entities seen through the box can be inside of it
+                EntityIdContainer visitedEntityIds;
+                entityDataCache.EnumerateVisibleEntitiesInsideVolume(
+                    boxVolume.data(), boxVolume.size(),
+                    [&entityDataCache, &boxSelectEntity, &visitedEntityIds](const size_t entityCacheIndex)
+                {
+                    visitedEntityIds.insert(entityDataCache.GetVisibleEntityId(entityCacheIndex));
+                    boxSelectEntity(entityCacheIndex);
+                });
+
+                // entities the box select changed that are now outside of the box must be reverted,
+                // iterate over a copy as reverting removes them from the container
+                const EntityIdContainer outgoingEntityIds = currentKeyboardModifiers.Ctrl()
+                    ? potentialDeselectedEntityIds
+                    : potentialSelectedEntityIds;
+
+                for (const AZ::EntityId entityId : outgoingEntityIds)
+                {
+                    if (visitedEntityIds.find(entityId) == visitedEntityIds.end())
+                    {
+                        if (AZStd::optional<size_t> entityCacheIndex = entityDataCache.GetVisibleEntityIndexFromId(entityId))
+                        {
+                            boxSelectEntity(entityCacheIndex.value());
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (size_t entityCacheIndex = 0; entityCacheIndex < entityDataCache.VisibleEntityDataCount(); ++entityCacheIndex)
+                {
+                    boxSelectEntity(entityCacheIndex);
+                }
             }
         }
     }
@@ -1019,6 +1058,7 @@ namespace AzToolsFramework
                 m_boxSelect.BoxRegion(), *this, m_selectedEntityIds, entityBoxSelectData->m_selectedEntityIdsBeforeBoxSelect,
                 entityBoxSelectData->m_potentialSelectedEntityIds, entityBoxSelectData->m_potentialDeselectedEntityIds,
                 *m_entityDataCache, mouseInteraction.m_mouseInteraction.m_interactionId.m_viewportId,
+                GetCameraState(mouseInteraction.m_mouseInteraction.m_interactionId.m_viewportId),
                 mouseInteraction.m_mouseInteraction.m_keyboardModifiers,
                 m_boxSelect.PreviousModifiers());
         });
@@ -1076,7 +1116,8 @@ namespace AzToolsFramework
                     entityBoxSelectData->m_selectedEntityIdsBeforeBoxSelect,
                     entityBoxSelectData->m_potentialSelectedEntityIds,
                     entityBoxSelectData->m_potentialDeselectedEntityIds,
-                    *m_entityDataCache, viewportInfo.m_viewportId, modifiers,
+                    *m_entityDataCache, viewportInfo.m_viewportId,
+                    GetCameraState(viewportInfo.m_viewportId), modifiers,
                     m_boxSelect.PreviousModifiers());
             }
 
@@ -12,9 +12,15 @@
 
 #include "EditorVisibleEntityDataCache.h"
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/sort.h>
 #include <AzToolsFramework/Viewport/ViewportMessages.h>
+#include <AzToolsFramework/ViewportSelection/EditorEntitySpatialIndex.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionUtil.h>
 #include <Entity/EditorEntityHelpers.h>
+#include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityModel.h>
 
 namespace AzToolsFramework
@@ -55,8 +61,20 @@ namespace AzToolsFramework
         EntityIdList m_visibleEntityIds; ///< The EntityIds that are visible this frame.
         EntityIdList m_prevVisibleEntityIds; ///< The EntityIds that were visible the previous frame (unsorted).
         EntityDatas m_visibleEntityDatas; ///< Cached EntityData required by EditorTransformComponentSelection.
+        EditorEntitySpatialIndex m_spatialIndex; ///< Bounds of all active editor entities.
+        AZStd::unordered_set<AZ::EntityId> m_staleBoundsEntityIds; ///< Entities to query the bounds of before the next use of m_spatialIndex.
+        size_t m_nextRevalidatedEntityIndex = 0; ///< Next entry of m_visibleEntityDatas to query the bounds of again.
+        int m_viewportId = 0; ///< Viewport the entity bounds are calculated for.
+
+        void MarkEntityBoundsStale(AZ::EntityId entityId);
+        void UpdateStaleEntityBounds();
+        void RevalidateVisibleEntityBounds();
     };
 
+    /// Number of visible entities whose bounds are queried again each frame, even without a notification,
+    /// so bounds changed by components that do not notify EditorComponentSelectionNotifications are picked up.
+    static const size_t s_revalidatedEntityBoundsPerFrame = 64;
+
     // constructor for EntityData to support emplace_back in vector
     EntityData::EntityData(
         const AZ::EntityId entityId, const AZ::Transform& worldFromLocal,
@@ -116,27 +134,109 @@ namespace AzToolsFramework
         return { entityId, worldFromLocal, locked, visible, IsSelected(entityId), iconHidden };
     }
 
+    static bool IsEditorEntity(const AZ::EntityId entityId)
+    {
+        bool editorEntity = false;
+        EditorEntityContextRequestBus::BroadcastResult(
+            editorEntity, &EditorEntityContextRequests::IsEditorEntity, entityId);
+
+        return editorEntity;
+    }
+
+    // bounds of the components of the entity, including the entity position so its icon is also covered
+    static AZ::Aabb EntityBoundsFromEntityId(const int viewportId, const AZ::EntityId entityId)
+    {
+        AZ::EBusReduceResult<AZ::Aabb, AabbAggregator> aabbResult(AZ::Aabb::CreateNull());
+        EditorComponentSelectionRequestsBus::EventResult(
+            aabbResult, entityId, &EditorComponentSelectionRequests::GetEditorSelectionBoundsViewport,
+            AzFramework::ViewportInfo{ viewportId });
+
+        AZ::Vector3 worldTranslation = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(
+            worldTranslation, entityId, &AZ::TransformBus::Events::GetWorldTranslation);
+
+        AZ::Aabb bounds = AZ::Aabb::CreateFromPoint(worldTranslation);
+        if (aabbResult.value.IsValid())
+        {
+            bounds.AddAabb(aabbResult.value);
+        }
+
+        return bounds;
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::MarkEntityBoundsStale(const AZ::EntityId entityId)
+    {
+        m_staleBoundsEntityIds.insert(entityId);
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::UpdateStaleEntityBounds()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        // an entity notifying several changes in a frame (e.g. the children of a dragged entity)
+        // only has its bounds queried once
+        for (const AZ::EntityId entityId : m_staleBoundsEntityIds)
+        {
+            m_spatialIndex.InsertOrUpdate(entityId, EntityBoundsFromEntityId(m_viewportId, entityId));
+        }
+
+        m_staleBoundsEntityIds.clear();
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::RevalidateVisibleEntityBounds()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const size_t visibleEntityCount = m_visibleEntityDatas.size();
+        const size_t revalidatedEntityCount = AZStd::min(visibleEntityCount, s_revalidatedEntityBoundsPerFrame);
+        for (size_t revalidated = 0; revalidated < revalidatedEntityCount; ++revalidated)
+        {
+            if (m_nextRevalidatedEntityIndex >= visibleEntityCount)
+            {
+                m_nextRevalidatedEntityIndex = 0;
+            }
+
+            const AZ::EntityId entityId = m_visibleEntityDatas[m_nextRevalidatedEntityIndex++].m_entityId;
+            m_spatialIndex.InsertOrUpdate(entityId, EntityBoundsFromEntityId(m_viewportId, entityId));
+        }
+    }
+
     EditorVisibleEntityDataCache::EditorVisibleEntityDataCache()
         : m_impl(AZStd::make_unique<EditorVisibleEntityDataCacheImpl>())
     {
+        // index the editor entities that were activated before the cache was created
+        AZ::ComponentApplicationBus::Broadcast(
+            &AZ::ComponentApplicationRequests::EnumerateEntities,
+            [this](const AZ::Entity* entity)
+        {
+            if (entity->GetState() == AZ::Entity::ES_ACTIVE && IsEditorEntity(entity->GetId()))
+            {
+                m_impl->MarkEntityBoundsStale(entity->GetId());
+            }
+        });
+
+        AZ::EntitySystemBus::Handler::BusConnect();
         EditorEntityVisibilityNotificationBus::Router::BusRouterConnect();
         EditorEntityLockComponentNotificationBus::Router::BusRouterConnect();
         AZ::TransformNotificationBus::Router::BusRouterConnect();
         EditorComponentSelectionNotificationsBus::Router::BusRouterConnect();
         EntitySelectionEvents::Bus::Router::BusRouterConnect();
         EditorEntityIconComponentNotificationBus::Router::BusRouterConnect();
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterConnect();
         ToolsApplicationNotificationBus::Handler::BusConnect();
     }
 
     EditorVisibleEntityDataCache::~EditorVisibleEntityDataCache()
     {
         ToolsApplicationNotificationBus::Handler::BusDisconnect();
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterDisconnect();
         EditorEntityIconComponentNotificationBus::Router::BusRouterDisconnect();
         EntitySelectionEvents::Bus::Router::BusRouterDisconnect();
         EditorComponentSelectionNotificationsBus::Router::BusRouterDisconnect();
         AZ::TransformNotificationBus::Router::BusRouterDisconnect();
         EditorEntityLockComponentNotificationBus::Router::BusRouterConnect();
         EditorEntityVisibilityNotificationBus::Router::BusRouterConnect();
+        AZ::EntitySystemBus::Handler::BusDisconnect();
     }
 
     EditorVisibleEntityDataCache::EditorVisibleEntityDataCache(EditorVisibleEntityDataCache&&) = default;
@@ -150,6 +250,7 @@ namespace AzToolsFramework
         for (AZ::EntityId entityId : m_impl->m_visibleEntityIds)
         {
             m_impl->m_visibleEntityDatas.push_back(EntityDataFromEntityId(entityId));
+            m_impl->MarkEntityBoundsStale(entityId);
         }
 
         AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
@@ -160,12 +261,29 @@ namespace AzToolsFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
 
-        // request list of visible entities from authoritative system
+        m_impl->m_viewportId = viewportInfo.m_viewportId;
+        m_impl->RevalidateVisibleEntityBounds();
+        m_impl->UpdateStaleEntityBounds();
+
         EntityIdList nextVisibleEntityIds;
-        ViewportInteraction::MainEditorViewportInteractionRequestBus::Event(
-            viewportInfo.m_viewportId,
-            &ViewportInteraction::MainEditorViewportInteractionRequestBus::Events::FindVisibleEntities,
-            nextVisibleEntityIds);
+        AZStd::array<AZ::Plane, 6> viewFrustum;
+        if (CalculateViewFrustum(GetCameraState(viewportInfo.m_viewportId), viewFrustum))
+        {
+            // find the entities in the view with the spatial index instead of testing every entity
+            m_impl->m_spatialIndex.EnumerateInsideVolume(
+                viewFrustum.data(), viewFrustum.size(), [&nextVisibleEntityIds](const AZ::EntityId entityId)
+            {
+                nextVisibleEntityIds.push_back(entityId);
+            });
+        }
+        else
+        {
+            // request list of visible entities from authoritative system (e.g. for orthographic views)
+            ViewportInteraction::MainEditorViewportInteractionRequestBus::Event(
+                viewportInfo.m_viewportId,
+                &ViewportInteraction::MainEditorViewportInteractionRequestBus::Events::FindVisibleEntities,
+                nextVisibleEntityIds);
+        }
 
         // only bother resorting if we know the lists have changed
         if (!EntityIdListsEqual(m_impl->m_prevVisibleEntityIds, nextVisibleEntityIds))
@@ -213,6 +331,11 @@ namespace AzToolsFramework
             for (const AZ::EntityId entityId : added)
             {
                 m_impl->m_visibleEntityDatas.push_back(EntityDataFromEntityId(entityId));
+
+                if (!m_impl->m_spatialIndex.Contains(entityId))
+                {
+                    m_impl->MarkEntityBoundsStale(entityId);
+                }
             }
 
             // after inserting added elements, ensure we keep the visible entity data in sorted order
@@ -284,6 +407,53 @@ namespace AzToolsFramework
         return {};
     }
 
+    void EditorVisibleEntityDataCache::EnumerateVisibleEntitiesAlongRay(
+        const AZ::Vector3& origin, const AZ::Vector3& direction, const float length,
+        const AZStd::function<void(size_t)>& visitor) const
+    {
+        m_impl->UpdateStaleEntityBounds();
+        m_impl->m_spatialIndex.EnumerateRayIntersecting(
+            origin, direction, length, [this, &visitor](const AZ::EntityId entityId)
+        {
+            if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
+            {
+                visitor(entityIndex.value());
+            }
+        });
+    }
+
+    void EditorVisibleEntityDataCache::EnumerateVisibleEntitiesInsideVolume(
+        const AZ::Plane* planes, const size_t planeCount, const AZStd::function<void(size_t)>& visitor) const
+    {
+        m_impl->UpdateStaleEntityBounds();
+        m_impl->m_spatialIndex.EnumerateInsideVolume(
+            planes, planeCount, [this, &visitor](const AZ::EntityId entityId)
+        {
+            if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
+            {
+                visitor(entityIndex.value());
+            }
+        });
+    }
+
+    void EditorVisibleEntityDataCache::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        if (IsEditorEntity(entityId))
+        {
+            m_impl->MarkEntityBoundsStale(entityId);
+        }
+    }
+
+    void EditorVisibleEntityDataCache::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        m_impl->m_staleBoundsEntityIds.erase(entityId);
+        m_impl->m_spatialIndex.Remove(entityId);
+    }
+
     void EditorVisibleEntityDataCache::AfterUndoRedo()
     {
         // ensure we refresh all EntityData after an undo/redo action as
@@ -291,6 +461,7 @@ namespace AzToolsFramework
         for (EntityData& entityData : m_impl->m_visibleEntityDatas)
         {
             entityData = EntityDataFromEntityId(entityData.m_entityId);
+            m_impl->MarkEntityBoundsStale(entityData.m_entityId);
         }
     }
 
@@ -329,6 +500,11 @@ namespace AzToolsFramework
         {
             m_impl->m_visibleEntityDatas[entityIndex.value()].m_worldFromLocal = world;
         }
+
+        if (m_impl->m_spatialIndex.Contains(entityId))
+        {
+            m_impl->MarkEntityBoundsStale(entityId);
+        }
     }
 
     void EditorVisibleEntityDataCache::OnAccentTypeChanged(const EntityAccentType accent)
@@ -343,6 +519,18 @@ namespace AzToolsFramework
         }
     }
 
+    void EditorVisibleEntityDataCache::OnEditorSelectionBoundsChanged()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const AZ::EntityId entityId = *EditorComponentSelectionNotificationsBus::GetCurrentBusId();
+
+        if (m_impl->m_spatialIndex.Contains(entityId))
+        {
+            m_impl->MarkEntityBoundsStale(entityId);
+        }
+    }
+
     void EditorVisibleEntityDataCache::OnSelected()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
@@ -383,4 +571,17 @@ namespace AzToolsFramework
             m_impl->m_visibleEntityDatas[entityIndex.value()].m_iconHidden = iconHidden;
         }
     }
+
+    void EditorVisibleEntityDataCache::OnEntityComponentPropertyChanged(const AZ::ComponentId /*componentId*/)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
+
+        const AZ::EntityId entityId = *PropertyEditorEntityChangeNotificationBus::GetCurrentBusId();
+
+        // component properties (e.g. shape dimensions) may change the bounds without moving the entity
+        if (m_impl->m_spatialIndex.Contains(entityId))
+        {
+            m_impl->MarkEntityBoundsStale(entityId);
+        }
+    }
 } // namespace AzToolsFramework
@@ -12,25 +12,35 @@
 
 #pragma once
 
+#include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/optional.h>
 #include <AzToolsFramework/API/ComponentEntitySelectionBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorEntityIconComponentBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorLockComponentBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorSelectionAccentSystemComponent.h>
 #include <AzToolsFramework/ToolsComponents/EditorVisibilityBus.h>
+#include <AzToolsFramework/UI/PropertyEditor/PropertyEditorAPI.h>
 
 namespace AzToolsFramework
 {
     /// A cache of packed EntityData that can be iterated over efficiently without
-    /// the need to make individual EBus calls
+    /// the need to make individual EBus calls.
+    /// The bounds of all active editor entities are kept in a spatial index, so finding the
+    /// entities in the view frustum, picking and box select only need to consider the
+    /// entities near the cursor or inside the volume. Bounds are queried again lazily, before
+    /// the next use of the index, for entities that moved or notified a change of their bounds.
     class EditorVisibleEntityDataCache
-        : private EditorEntityVisibilityNotificationBus::Router
+        : private AZ::EntitySystemBus::Handler
+        , private EditorEntityVisibilityNotificationBus::Router
         , private EditorEntityLockComponentNotificationBus::Router
         , private AZ::TransformNotificationBus::Router
         , private EditorComponentSelectionNotificationsBus::Router
         , private EntitySelectionEvents::Bus::Router
         , private EditorEntityIconComponentNotificationBus::Router
+        , private PropertyEditorEntityChangeNotificationBus::Router
         , private ToolsApplicationNotificationBus::Handler
     {
     public:
@@ -59,9 +69,22 @@ namespace AzToolsFramework
 
         AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const;
 
+        /// Visits the index of every cached entity whose bounds may be hit by the ray.
+        void EnumerateVisibleEntitiesAlongRay(
+            const AZ::Vector3& origin, const AZ::Vector3& direction, float length,
+            const AZStd::function<void(size_t)>& visitor) const;
+        /// Visits the index of every cached entity whose bounds may be inside of the convex volume.
+        /// @param planes Planes bounding the volume, with their normals pointing inside of it.
+        void EnumerateVisibleEntitiesInsideVolume(
+            const AZ::Plane* planes, size_t planeCount, const AZStd::function<void(size_t)>& visitor) const;
+
         void AddEntityIds(const EntityIdList& entityIds);
 
     private:
+        // EntitySystemBus
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
         // ToolsApplicationNotificationBus
         void AfterUndoRedo() override;
 
@@ -77,6 +100,7 @@ namespace AzToolsFramework
 
         // EditorComponentSelectionNotificationsBus
         void OnAccentTypeChanged(EntityAccentType accent) override;
+        void OnEditorSelectionBoundsChanged() override;
 
         // EntitySelectionEvents::Bus
         void OnSelected() override;
@@ -85,6 +109,9 @@ namespace AzToolsFramework
         // EditorEntityIconComponentNotificationBus
         void OnEntityIconChanged(const AZ::Data::AssetId& entityIconAssetId) override;
 
+        // PropertyEditorEntityChangeNotificationBus
+        void OnEntityComponentPropertyChanged(AZ::ComponentId componentId) override;
+
         class EditorVisibleEntityDataCacheImpl;
         AZStd::unique_ptr<EditorVisibleEntityDataCacheImpl> m_impl; ///< Internal representation of entity data cache.
     };
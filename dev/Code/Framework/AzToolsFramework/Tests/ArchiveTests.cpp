@@ -51,6 +51,50 @@ namespace UnitTest
             return true;
         }
 
+        QString ReadFileContent(const QString& fullPathToFile)
+        {
+            QFile reader(fullPathToFile);
+            if (!reader.open(QFile::ReadOnly))
+            {
+                return {};
+            }
+            return QString(reader.readAll());
+        }
+
+        // Absorbs the errors of an operation expected to fail, and counts the asserts it shouldn't trigger
+        class AssertCounter
+            : public AZ::Debug::TraceMessageBus::Handler
+        {
+        public:
+            AssertCounter()
+            {
+                BusConnect();
+            }
+
+            ~AssertCounter()
+            {
+                BusDisconnect();
+            }
+
+            bool OnPreAssert(const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* /*message*/) override
+            {
+                ++m_assertCount;
+                return true;
+            }
+
+            bool OnPreError(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* /*message*/) override
+            {
+                return true;
+            }
+
+            bool OnPreWarning(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* /*message*/) override
+            {
+                return true;
+            }
+
+            int m_assertCount = 0;
+        };
+
         class ArchiveTest :
             public ::testing::Test
         {
@@ -74,14 +118,14 @@ namespace UnitTest
                 return "Archive";
             }
 
-            void CreateArchiveFolder( QString archiveFolderName, QStringList fileList )
+            void CreateArchiveFolder( QString archiveFolderName, QStringList fileList, bool nameAsContent = false )
             {
                 QDir tempPath = QDir(m_tempDir.path()).filePath(archiveFolderName);
 
                 for (const auto& thisFile : fileList)
                 {
                     QString absoluteTestFilePath = tempPath.absoluteFilePath(thisFile);
-                    EXPECT_TRUE(CreateDummyFile(absoluteTestFilePath));
+                    EXPECT_TRUE(CreateDummyFile(absoluteTestFilePath, nameAsContent ? thisFile : QString()));
                 }
             }
 
@@ -100,6 +144,20 @@ namespace UnitTest
                 return QDir(m_tempDir.path()).filePath(GetArchiveFolderName());
             }
 
+            QString GetExtractFolder()
+            {
+                return QDir(m_tempDir.path()).filePath("Extracted");
+            }
+
+            AZStd::vector<AZStd::string> ListArchive()
+            {
+                AZStd::vector<AZStd::string> fileList;
+                bool listResult{ false };
+                AzToolsFramework::ArchiveCommandsBus::BroadcastResult(listResult, &AzToolsFramework::ArchiveCommandsBus::Events::ListFilesInArchiveBlocking, GetArchivePath().toStdString().c_str(), fileList);
+                EXPECT_TRUE(listResult);
+                return fileList;
+            }
+
             bool CreateArchive()
             {
                 bool createResult{ false };
@@ -147,6 +205,149 @@ namespace UnitTest
             EXPECT_EQ(fileList.size(), 6);
         }
 
+        TEST_F(ArchiveTest, ExtractArchiveBlocking_FilesAtThreeDepths_ContentMatches)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+            QStringList fileList = CreateArchiveFileList();
+            CreateArchiveFolder(GetArchiveFolderName(), fileList, true);
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchiveBlocking, GetArchivePath().toStdString().c_str(), GetExtractFolder().toStdString().c_str(), false);
+            EXPECT_EQ(extractResult, true);
+
+            QDir archiveFolder(GetArchiveFolder());
+            QDir extractFolder(GetExtractFolder());
+            for (const auto& thisFile : fileList)
+            {
+                QString extractedContent = ReadFileContent(extractFolder.absoluteFilePath(thisFile));
+                EXPECT_FALSE(extractedContent.isEmpty());
+                EXPECT_EQ(extractedContent, ReadFileContent(archiveFolder.absoluteFilePath(thisFile)));
+            }
+        }
+
+        TEST_F(ArchiveTest, ExtractArchiveBlocking_WithRootDirectory_ExtractedInArchiveNamedFolder)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+            CreateArchiveFolder();
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchiveBlocking, GetArchivePath().toStdString().c_str(), GetExtractFolder().toStdString().c_str(), true);
+            EXPECT_EQ(extractResult, true);
+
+            QDir rootFolder(QDir(GetExtractFolder()).filePath("TestArchive"));
+            for (const auto& thisFile : CreateArchiveFileList())
+            {
+                EXPECT_TRUE(QFileInfo(rootFolder.absoluteFilePath(thisFile)).isFile());
+            }
+        }
+
+        TEST_F(ArchiveTest, AddFileToArchiveBlocking_NewAndExistingFiles_ArchiveUpdated)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+            CreateArchiveFolder(GetArchiveFolderName(), CreateArchiveFileList(), true);
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            // A new file is added next to the existing ones, an existing file is replaced
+            QDir archiveFolder(GetArchiveFolder());
+            EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath("testfolder/addedfile.txt"), "added"));
+            EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath("basicfile.txt"), "replaced"));
+
+            bool addResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(addResult, &AzToolsFramework::ArchiveCommandsBus::Events::AddFileToArchiveBlocking, GetArchivePath().toStdString().c_str(), GetArchiveFolder().toStdString().c_str(), "testfolder/addedfile.txt");
+            EXPECT_EQ(addResult, true);
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(addResult, &AzToolsFramework::ArchiveCommandsBus::Events::AddFileToArchiveBlocking, GetArchivePath().toStdString().c_str(), GetArchiveFolder().toStdString().c_str(), "basicfile.txt");
+            EXPECT_EQ(addResult, true);
+
+            EXPECT_EQ(ListArchive().size(), 7);
+
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchiveBlocking, GetArchivePath().toStdString().c_str(), GetExtractFolder().toStdString().c_str(), false);
+            EXPECT_EQ(extractResult, true);
+
+            QDir extractFolder(GetExtractFolder());
+            EXPECT_EQ(ReadFileContent(extractFolder.absoluteFilePath("testfolder/addedfile.txt")), ReadFileContent(archiveFolder.absoluteFilePath("testfolder/addedfile.txt")));
+            EXPECT_EQ(ReadFileContent(extractFolder.absoluteFilePath("basicfile.txt")), ReadFileContent(archiveFolder.absoluteFilePath("basicfile.txt")));
+            EXPECT_EQ(ReadFileContent(extractFolder.absoluteFilePath("testfolder2/sharedfolderfile.txt")), ReadFileContent(archiveFolder.absoluteFilePath("testfolder2/sharedfolderfile.txt")));
+        }
+
+        TEST_F(ArchiveTest, ExtractFileBlocking_ExistingFile_OverwrittenOnlyWhenRequested)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+            CreateArchiveFolder(GetArchiveFolderName(), CreateArchiveFileList(), true);
+
+            EXPECT_EQ(CreateArchive(), true);
+
+            // The file is extracted without the folders it is in inside the archive
+            QString extractedFile = QDir(GetExtractFolder()).absoluteFilePath("depthfile.bat");
+            EXPECT_TRUE(CreateDummyFile(extractedFile, "existing"));
+            const QString existingContent = ReadFileContent(extractedFile);
+
+            bool extractResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractFileBlocking, GetArchivePath().toStdString().c_str(), "testfolder3/testfolder4/depthfile.bat", GetExtractFolder().toStdString().c_str(), false);
+            EXPECT_EQ(extractResult, true);
+            EXPECT_EQ(ReadFileContent(extractedFile), existingContent);
+
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractFileBlocking, GetArchivePath().toStdString().c_str(), "testfolder3/testfolder4/depthfile.bat", GetExtractFolder().toStdString().c_str(), true);
+            EXPECT_EQ(extractResult, true);
+            EXPECT_EQ(ReadFileContent(extractedFile), ReadFileContent(QDir(GetArchiveFolder()).absoluteFilePath("testfolder3/testfolder4/depthfile.bat")));
+        }
+
+        TEST_F(ArchiveTest, ListFilesInArchiveBlocking_NotAnArchive_Failure)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+            EXPECT_TRUE(CreateDummyFile(GetArchivePath(), "not an archive"));
+
+            AZStd::vector<AZStd::string> fileList;
+            bool listResult{ true };
+            AZ::Test::AssertAbsorber assertAbsorber;
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(listResult, &AzToolsFramework::ArchiveCommandsBus::Events::ListFilesInArchiveBlocking, GetArchivePath().toStdString().c_str(), fileList);
+
+            EXPECT_EQ(listResult, false);
+            EXPECT_TRUE(fileList.empty());
+        }
+
+        TEST_F(ArchiveTest, ExtractArchiveBlocking_CorruptedDeflatedEntry_FailureWithoutAssert)
+        {
+            EXPECT_TRUE(m_tempDir.isValid());
+
+            // Repeated content, so the file gets deflated
+            QDir archiveFolder(GetArchiveFolder());
+            EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath("compressed.txt"), QString("compressed content ").repeated(1000)));
+
+            bool addResult{ false };
+            AzToolsFramework::ArchiveCommandsBus::BroadcastResult(addResult, &AzToolsFramework::ArchiveCommandsBus::Events::AddFileToArchiveBlocking, GetArchivePath().toStdString().c_str(), GetArchiveFolder().toStdString().c_str(), "compressed.txt");
+            EXPECT_EQ(addResult, true);
+
+            // The first byte of the deflated data now starts a block of the reserved type, which no inflater accepts
+            QFile archive(GetArchivePath());
+            ASSERT_TRUE(archive.open(QFile::ReadWrite));
+            QByteArray archiveData = archive.readAll();
+            ASSERT_GT(archiveData.size(), 30);
+            const AZ::u8* localHeader = reinterpret_cast<const AZ::u8*>(archiveData.constData());
+            EXPECT_EQ(localHeader[8], 8); // Deflated
+            const int dataOffset = 30 + (localHeader[26] | (localHeader[27] << 8)) + (localHeader[28] | (localHeader[29] << 8));
+            ASSERT_LT(dataOffset, archiveData.size());
+            archiveData[dataOffset] = static_cast<char>(0xFF);
+            archive.seek(0);
+            archive.write(archiveData);
+            archive.close();
+
+            bool extractResult{ true };
+            {
+                AssertCounter assertCounter;
+                AzToolsFramework::ArchiveCommandsBus::BroadcastResult(extractResult, &AzToolsFramework::ArchiveCommandsBus::Events::ExtractArchiveBlocking, GetArchivePath().toStdString().c_str(), GetExtractFolder().toStdString().c_str(), false);
+                EXPECT_EQ(assertCounter.m_assertCount, 0);
+            }
+
+            EXPECT_EQ(extractResult, false);
+            EXPECT_FALSE(QFileInfo(QDir(GetExtractFolder()).absoluteFilePath("compressed.txt")).exists());
+        }
+
         TEST_F(ArchiveTest, CreateDeltaCatalog_AssetsNotRegistered_Failure)
         {
             QStringList fileList = CreateArchiveFileList();
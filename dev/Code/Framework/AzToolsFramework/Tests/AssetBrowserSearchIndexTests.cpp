@@ -0,0 +1,455 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+#include <AzToolsFramework/AssetBrowser/AssetBrowserFilterModel.h>
+#include <AzToolsFramework/AssetBrowser/AssetBrowserModel.h>
+#include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntryCache.h>
+#include <AzToolsFramework/AssetBrowser/Entries/ProductAssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Entries/RootAssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Entries/SourceAssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/Search/Filter.h>
+#include <AzToolsFramework/AssetBrowser/Search/SearchIndex.h>
+#include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
+
+namespace UnitTest
+{
+    using namespace AzToolsFramework;
+    using namespace AzToolsFramework::AssetBrowser;
+
+    static const AZ::s64 s_scanFolderId = 1;
+    static const char* s_scanFolderPath = "C:/Project/Assets";
+    static const AZ::u32 s_productsPerSource = 2;
+
+    static const AZ::Data::AssetType s_meshAssetType("{B1F3D2C4-1A8E-4E0B-9B6A-7C21E5D0A001}");
+    static const AZ::Data::AssetType s_materialAssetType("{B1F3D2C4-1A8E-4E0B-9B6A-7C21E5D0A002}");
+    static const AZ::Data::AssetType s_textureAssetType("{B1F3D2C4-1A8E-4E0B-9B6A-7C21E5D0A003}");
+
+    // adds sources, each with a few products, spread over nested folders of a single scan folder
+    static void CreateCatalog(RootAssetBrowserEntry& rootEntry, AZ::u32 sourceCount)
+    {
+        static const char* words[] = { "Tree", "Rock", "Grass", "Bark", "Cliff", "Water", "Lamp", "Door", "Crate", "Barrel", "Fence", "Roof" };
+        static const size_t wordCount = AZ_ARRAY_SIZE(words);
+        static const AZ::Data::AssetType assetTypes[] = { s_meshAssetType, s_materialAssetType, s_textureAssetType };
+
+        EntryCache::GetInstance()->m_knownScanFolders[s_scanFolderId] = s_scanFolderPath;
+
+        for (AZ::u32 sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex)
+        {
+            AssetDatabase::FileDatabaseEntry file;
+            file.m_fileID = sourceIndex + 1;
+            file.m_scanFolderPK = s_scanFolderId;
+            file.m_fileName = AZStd::string::format("%s/%s%u/%s_%s_%u.fbx",
+                words[sourceIndex % wordCount], words[(sourceIndex / wordCount) % wordCount], sourceIndex % 7,
+                words[(sourceIndex * 7) % wordCount], words[(sourceIndex * 5 + 3) % wordCount], sourceIndex);
+            file.m_isFolder = false;
+            rootEntry.AddFile(file);
+
+            const AZ::Uuid sourceUuid = AZ::Uuid::CreateName(file.m_fileName.c_str());
+            rootEntry.AddSource({ file.m_fileID, AssetDatabase::SourceDatabaseEntry(sourceIndex + 1, s_scanFolderId, file.m_fileName.c_str(), sourceUuid, "") });
+
+            for (AZ::u32 subId = 0; subId < s_productsPerSource; ++subId)
+            {
+                const AZStd::string productName = AZStd::string::format("pc/%s_lod%u.cgf", words[(sourceIndex + subId) % wordCount], subId);
+                const AZ::Data::AssetType& assetType = assetTypes[(sourceIndex + subId) % AZ_ARRAY_SIZE(assetTypes)];
+                rootEntry.AddProduct({ sourceUuid, AssetDatabase::ProductDatabaseEntry(sourceIndex * s_productsPerSource + subId + 1, sourceIndex + 1, subId, productName.c_str(), assetType) });
+            }
+        }
+    }
+
+    // a filter built the way the asset browser search widget builds it
+    static QSharedPointer<CompositeFilter> CreateSearchFilter(const QString& text, const AZStd::vector<AZ::Data::AssetType>& assetTypes)
+    {
+        QSharedPointer<CompositeFilter> filter(new CompositeFilter(CompositeFilter::LogicOperatorType::AND));
+        filter->SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Down);
+
+        QSharedPointer<CompositeFilter> stringFilters(new CompositeFilter(CompositeFilter::LogicOperatorType::AND));
+        stringFilters->SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Up);
+        for (const QString& word : text.split(' ', QString::SkipEmptyParts))
+        {
+            auto stringFilter = new StringFilter();
+            stringFilter->SetFilterString(word);
+            stringFilters->AddFilter(FilterConstType(stringFilter));
+        }
+        filter->AddFilter(stringFilters);
+
+        auto hiddenGroupFilter = new AssetGroupFilter();
+        hiddenGroupFilter->SetAssetGroup("Hidden");
+        auto inverseFilter = new InverseFilter();
+        inverseFilter->SetFilter(FilterConstType(hiddenGroupFilter));
+        filter->AddFilter(FilterConstType(inverseFilter));
+        filter->AddFilter(FilterConstType(new CleanerProductsFilter()));
+
+        QSharedPointer<CompositeFilter> typeFilters(new CompositeFilter(CompositeFilter::LogicOperatorType::OR));
+        typeFilters->SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Down);
+        for (const AZ::Data::AssetType& assetType : assetTypes)
+        {
+            auto assetTypeFilter = new AssetTypeFilter();
+            assetTypeFilter->SetAssetType(assetType);
+            typeFilters->AddFilter(FilterConstType(assetTypeFilter));
+        }
+        filter->AddFilter(typeFilters);
+
+        return filter;
+    }
+
+    // hides a filter from the search index, its entries have to be matched one by one
+    class MatchOnlyFilter
+        : public AssetBrowserEntryFilter
+    {
+    public:
+        explicit MatchOnlyFilter(FilterConstType filter)
+            : m_filter(filter)
+        {
+        }
+
+    protected:
+        QString GetNameInternal() const override
+        {
+            return m_filter->GetName();
+        }
+
+        bool MatchInternal(const AssetBrowserEntry* entry) const override
+        {
+            return m_filter->Match(entry);
+        }
+
+    private:
+        FilterConstType m_filter;
+    };
+
+    static void GetAllEntries(const AssetBrowserEntry* entry, AZStd::vector<const AssetBrowserEntry*>& entries)
+    {
+        for (int row = 0; row < entry->GetChildCount(); ++row)
+        {
+            entries.push_back(entry->GetChild(row));
+            GetAllEntries(entry->GetChild(row), entries);
+        }
+    }
+
+    static int CountRows(const QAbstractItemModel& model, const QModelIndex& parent)
+    {
+        int count = 0;
+        for (int row = 0; row < model.rowCount(parent); ++row)
+        {
+            count += 1 + CountRows(model, model.index(row, 0, parent));
+        }
+        return count;
+    }
+
+    class AssetBrowserSearchIndexTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            m_rootEntry = AZStd::make_shared<RootAssetBrowserEntry>();
+            CreateCatalog(*m_rootEntry, 500);
+        }
+
+        void TearDown() override
+        {
+            m_rootEntry.reset();
+            EntryCache::DestroyInstance();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        const SearchIndex& GetIndex() const
+        {
+            return EntryCache::GetInstance()->m_searchIndex;
+        }
+
+        // every entry the filter resolves to is matched by it, and the other way around
+        void ExpectResolvedLikeMatched(const AssetBrowserEntryFilter& filter) const
+        {
+            SearchIndex::EntrySet resolved;
+            ASSERT_TRUE(filter.Resolve(GetIndex(), resolved));
+
+            AZStd::vector<const AssetBrowserEntry*> entries;
+            GetAllEntries(m_rootEntry.get(), entries);
+            for (const AssetBrowserEntry* entry : entries)
+            {
+                bool contained = false;
+                ASSERT_TRUE(GetIndex().Lookup(resolved, GetIndex().GetRevision(), entry, contained));
+                EXPECT_EQ(filter.Match(entry), contained) << entry->GetFullPath().c_str();
+            }
+        }
+
+        AZStd::shared_ptr<RootAssetBrowserEntry> m_rootEntry;
+    };
+
+    TEST_F(AssetBrowserSearchIndexTest, FindByName_TextOfAnyLength_FindsNamesContainingItIgnoringCase)
+    {
+        AZStd::vector<const AssetBrowserEntry*> entries;
+        GetAllEntries(m_rootEntry.get(), entries);
+
+        for (const QString text : { "r", "Ro", "rock", "ROCK_cliff", "_lod1", "tree0", "NotInAnyName" })
+        {
+            SearchIndex::EntrySet found;
+            GetIndex().FindByName(text, found);
+
+            for (const AssetBrowserEntry* entry : entries)
+            {
+                SearchIndex::Slot slot;
+                ASSERT_TRUE(GetIndex().FindSlot(entry, slot));
+                EXPECT_EQ(entry->GetDisplayName().contains(text, Qt::CaseInsensitive), found.Contains(slot));
+            }
+        }
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, Resolve_SearchFilters_AcceptTheEntriesTheyMatch)
+    {
+        ExpectResolvedLikeMatched(*CreateSearchFilter("", {}));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("ro", {}));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("rock", {}));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("bark lod0", {}));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("", { s_textureAssetType }));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("tree", { s_meshAssetType, s_materialAssetType }));
+        ExpectResolvedLikeMatched(*CreateSearchFilter("NotInAnyName", {}));
+
+        EntryTypeFilter sourceFilter;
+        sourceFilter.SetEntryType(AssetBrowserEntry::AssetEntryType::Source);
+        ExpectResolvedLikeMatched(sourceFilter);
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, Resolve_FilterWithoutIndexSupport_IsNotResolved)
+    {
+        MatchOnlyFilter filter(CreateSearchFilter("rock", {}));
+
+        SearchIndex::EntrySet resolved;
+        EXPECT_FALSE(filter.Resolve(GetIndex(), resolved));
+
+        QSharedPointer<CompositeFilter> composite = CreateSearchFilter("rock", {});
+        composite->AddFilter(FilterConstType(new MatchOnlyFilter(CreateSearchFilter("", {}))));
+        EXPECT_FALSE(composite->Resolve(GetIndex(), resolved));
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, Lookup_EntryAddedAfterResolve_IsUnknownToTheResolvedSet)
+    {
+        QSharedPointer<CompositeFilter> filter = CreateSearchFilter("NewCrate", {});
+        SearchIndex::EntrySet resolved;
+        ASSERT_TRUE(filter->Resolve(GetIndex(), resolved));
+        const AZ::u64 revision = GetIndex().GetRevision();
+
+        AssetDatabase::FileDatabaseEntry file;
+        file.m_fileID = 100000;
+        file.m_scanFolderPK = s_scanFolderId;
+        file.m_fileName = "Tree/Rock0/NewCrate.fbx";
+        m_rootEntry->AddFile(file);
+
+        const AssetBrowserEntry* newEntry = EntryCache::GetInstance()->m_fileIdMap[file.m_fileID];
+        ASSERT_NE(nullptr, newEntry);
+
+        // the new entry and the folders above it, which may now match through it, have to be matched
+        bool contained = false;
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, newEntry, contained));
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, newEntry->GetParent(), contained));
+
+        // entries elsewhere in the tree are still known
+        const AssetBrowserEntry* otherEntry = EntryCache::GetInstance()->m_fileIdMap[2];
+        ASSERT_NE(newEntry->GetParent(), otherEntry->GetParent());
+        EXPECT_TRUE(GetIndex().Lookup(resolved, revision, otherEntry, contained));
+        EXPECT_FALSE(contained);
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, Lookup_ParentUpdatedAfterResolve_EntriesBelowAreUnknownToTheResolvedSet)
+    {
+        // entries are matched through the folders above them
+        StringFilter filter;
+        filter.SetFilterString("rock");
+        filter.SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Up);
+        SearchIndex::EntrySet resolved;
+        ASSERT_TRUE(filter.Resolve(GetIndex(), resolved));
+        const AZ::u64 revision = GetIndex().GetRevision();
+
+        const AssetBrowserEntry* source = EntryCache::GetInstance()->m_fileIdMap[1];
+        ASSERT_NE(nullptr, source);
+        ASSERT_GT(source->GetChildCount(), 0);
+        const AssetBrowserEntry* folder = source->GetParent();
+        EntryCache::GetInstance()->m_searchIndex.UpdateEntry(folder);
+
+        bool contained = false;
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, folder, contained));
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, source, contained));
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, source->GetChild(0), contained));
+
+        // entries outside of the updated folder are still known
+        const AssetBrowserEntry* otherEntry = EntryCache::GetInstance()->m_fileIdMap[2];
+        ASSERT_NE(folder, otherEntry->GetParent());
+        EXPECT_TRUE(GetIndex().Lookup(resolved, revision, otherEntry, contained));
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, Lookup_SiblingAddedOrRemovedAfterResolve_OnlyChildIsUnknownToCleanerProductsFilter)
+    {
+        const SourceAssetBrowserEntry* source = azrtti_cast<const SourceAssetBrowserEntry*>(EntryCache::GetInstance()->m_fileIdMap[1]);
+        ASSERT_NE(nullptr, source);
+        ASSERT_EQ(static_cast<int>(s_productsPerSource), source->GetChildCount());
+        const AssetBrowserEntry* keptProduct = source->GetChild(0);
+        const ProductAssetBrowserEntry* removedProduct = azrtti_cast<const ProductAssetBrowserEntry*>(source->GetChild(1));
+        ASSERT_NE(nullptr, removedProduct);
+        const AZ::Data::AssetId removedAssetId = removedProduct->GetAssetId();
+        const AZ::Data::AssetType removedAssetType = removedProduct->GetAssetType();
+
+        // no asset type has a display name here, a product is cleaned out when it is the only child of its source
+        CleanerProductsFilter filter;
+        SearchIndex::EntrySet resolved;
+        ASSERT_TRUE(filter.Resolve(GetIndex(), resolved));
+        AZ::u64 revision = GetIndex().GetRevision();
+
+        bool contained = false;
+        ASSERT_TRUE(GetIndex().Lookup(resolved, revision, keptProduct, contained));
+        EXPECT_TRUE(contained);
+
+        m_rootEntry->RemoveProduct(removedAssetId);
+        ASSERT_EQ(1, source->GetChildCount());
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, keptProduct, contained));
+        ExpectResolvedLikeMatched(filter);
+
+        ASSERT_TRUE(filter.Resolve(GetIndex(), resolved));
+        revision = GetIndex().GetRevision();
+        ASSERT_TRUE(GetIndex().Lookup(resolved, revision, keptProduct, contained));
+        EXPECT_FALSE(contained);
+
+        m_rootEntry->AddProduct({ source->GetSourceUuid(), AssetDatabase::ProductDatabaseEntry(100000, 1, removedAssetId.m_subId, "pc/readded.cgf", removedAssetType) });
+        ASSERT_EQ(static_cast<int>(s_productsPerSource), source->GetChildCount());
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, keptProduct, contained));
+        ExpectResolvedLikeMatched(filter);
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, CompactIfFragmented_MostFilesRemoved_ReclaimsSlotsAndKeepsResults)
+    {
+        for (AZ::s64 fileId = 1; fileId <= 400; ++fileId)
+        {
+            m_rootEntry->RemoveFile(fileId);
+        }
+
+        QSharedPointer<CompositeFilter> filter = CreateSearchFilter("rock", {});
+        SearchIndex::EntrySet resolved;
+        ASSERT_TRUE(filter->Resolve(GetIndex(), resolved));
+        const AZ::u64 revision = GetIndex().GetRevision();
+
+        AZStd::vector<const AssetBrowserEntry*> entries;
+        GetAllEntries(m_rootEntry.get(), entries);
+        EXPECT_GT(GetIndex().GetSlotCount(), entries.size());
+
+        EntryCache::GetInstance()->m_searchIndex.CompactIfFragmented();
+        EXPECT_EQ(entries.size(), GetIndex().GetSlotCount());
+
+        // slots were renumbered, the sets resolved before mean nothing
+        bool contained = false;
+        EXPECT_FALSE(GetIndex().Lookup(resolved, revision, entries.front(), contained));
+
+        ExpectResolvedLikeMatched(*filter);
+    }
+
+    TEST_F(AssetBrowserSearchIndexTest, FilterModel_ResolvedFilter_ShowsTheRowsOfTheMatchedFilter)
+    {
+        AssetBrowserModel model;
+        model.SetRootEntry(m_rootEntry);
+
+        for (const QString text : { "", "ro", "rock lod1", "NotInAnyName" })
+        {
+            QSharedPointer<CompositeFilter> filter = CreateSearchFilter(text, { s_meshAssetType, s_textureAssetType });
+
+            AssetBrowserFilterModel resolvedModel;
+            resolvedModel.setSourceModel(&model);
+            resolvedModel.SetFilter(filter);
+            resolvedModel.OnAssetBrowserComponentReady();
+
+            AssetBrowserFilterModel matchedModel;
+            matchedModel.setSourceModel(&model);
+            matchedModel.SetFilter(FilterConstType(new MatchOnlyFilter(filter)));
+            matchedModel.OnAssetBrowserComponentReady();
+
+            EXPECT_EQ(CountRows(matchedModel, QModelIndex()), CountRows(resolvedModel, QModelIndex())) << text.toUtf8().constData();
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class AssetBrowserFilterModelBenchmarkFixture
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_rootEntry = AZStd::make_shared<RootAssetBrowserEntry>();
+            CreateCatalog(*m_rootEntry, static_cast<AZ::u32>(state.range(0)));
+
+            m_model = AZStd::make_unique<AssetBrowserModel>();
+            m_model->SetRootEntry(m_rootEntry);
+            m_filterModel = AZStd::make_unique<AssetBrowserFilterModel>();
+            m_filterModel->setSourceModel(m_model.get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_filterModel.reset();
+            m_model.reset();
+            m_rootEntry.reset();
+            EntryCache::DestroyInstance();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // filters the model once per keystroke, as when typing in the search box
+        void TypeSearchText(::benchmark::State& state, bool useIndex)
+        {
+            QSharedPointer<CompositeFilter> filter = CreateSearchFilter("", {});
+            auto stringFilter = new StringFilter();
+            QSharedPointer<CompositeFilter> stringFilters(new CompositeFilter(CompositeFilter::LogicOperatorType::AND));
+            stringFilters->SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Up);
+            stringFilters->AddFilter(FilterConstType(stringFilter));
+            filter->AddFilter(stringFilters);
+
+            m_filterModel->SetFilter(useIndex ? FilterConstType(filter) : FilterConstType(new MatchOnlyFilter(filter)));
+            m_filterModel->OnAssetBrowserComponentReady();
+
+            const QString searchText("barrel_lod");
+            for (auto _ : state)
+            {
+                for (int length = 1; length <= searchText.size(); ++length)
+                {
+                    stringFilter->SetFilterString(searchText.left(length));
+                    m_filterModel->FilterUpdatedSlotImmediate();
+                }
+            }
+        }
+
+        AZStd::shared_ptr<RootAssetBrowserEntry> m_rootEntry;
+        AZStd::unique_ptr<AssetBrowserModel> m_model;
+        AZStd::unique_ptr<AssetBrowserFilterModel> m_filterModel;
+    };
+
+    BENCHMARK_DEFINE_F(AssetBrowserFilterModelBenchmarkFixture, TypeSearchTextMatched)(benchmark::State& state)
+    {
+        TypeSearchText(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(AssetBrowserFilterModelBenchmarkFixture, TypeSearchTextIndexed)(benchmark::State& state)
+    {
+        TypeSearchText(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(AssetBrowserFilterModelBenchmarkFixture, TypeSearchTextMatched)
+        ->Arg(1000)->Arg(10000)->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(AssetBrowserFilterModelBenchmarkFixture, TypeSearchTextIndexed)
+        ->Arg(1000)->Arg(10000)->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
+} // namespace UnitTest
@@ -0,0 +1,393 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzTest/AzTest.h>
+#include <AzToolsFramework/ViewportSelection/EditorEntitySpatialIndex.h>
+
+namespace UnitTest
+{
+    using namespace AzToolsFramework;
+
+    static const size_t s_testEntityCount = 2000;
+    static const float s_testLevelSize = 200.0f;
+
+    // entity bounds laid out the way levels commonly are
+    enum class EntityLayout
+    {
+        Grid, ///< Evenly spaced, e.g. vegetation or tiled props.
+        Clustered, ///< Dense groups of entities, e.g. buildings and their contents.
+        Random ///< Uniformly scattered over the level.
+    };
+
+    static AZStd::vector<AZ::Aabb> CreateEntityBounds(
+        const EntityLayout layout, const size_t count, const float levelSize, const AZ::u64 seed)
+    {
+        AZ::SimpleLcgRandom random(seed);
+        const auto randomPosition = [&random](const AZ::Vector3& min, const float size)
+        {
+            return min + AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * size;
+        };
+
+        AZStd::vector<AZ::Aabb> bounds;
+        bounds.reserve(count);
+
+        const size_t clusterCount = AZ::GetMax<size_t>(count / 500, 1);
+        AZStd::vector<AZ::Vector3> clusterCenters;
+        for (size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex)
+        {
+            clusterCenters.push_back(randomPosition(AZ::Vector3::CreateZero(), levelSize));
+        }
+
+        const size_t gridSide = static_cast<size_t>(ceilf(cbrtf(static_cast<float>(count))));
+        const float gridSpacing = levelSize / static_cast<float>(gridSide);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            AZ::Vector3 center;
+            switch (layout)
+            {
+            case EntityLayout::Grid:
+                center = AZ::Vector3(
+                    static_cast<float>(index % gridSide),
+                    static_cast<float>((index / gridSide) % gridSide),
+                    static_cast<float>(index / (gridSide * gridSide))) * gridSpacing;
+                break;
+            case EntityLayout::Clustered:
+                center = randomPosition(clusterCenters[index % clusterCount] - AZ::Vector3(10.0f), 20.0f);
+                break;
+            case EntityLayout::Random:
+                center = randomPosition(AZ::Vector3::CreateZero(), levelSize);
+                break;
+            }
+
+            const float halfExtent = 0.1f + random.GetRandomFloat() * 2.0f;
+            bounds.push_back(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(halfExtent)));
+        }
+
+        return bounds;
+    }
+
+    // planes of an axis aligned box, facing inside
+    static AZStd::array<AZ::Plane, 6> CreateBoxVolume(const AZ::Aabb& box)
+    {
+        return { {
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3::CreateAxisX(), box.GetMin()),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3::CreateAxisY(), box.GetMin()),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3::CreateAxisZ(), box.GetMin()),
+            AZ::Plane::CreateFromNormalAndPoint(-AZ::Vector3::CreateAxisX(), box.GetMax()),
+            AZ::Plane::CreateFromNormalAndPoint(-AZ::Vector3::CreateAxisY(), box.GetMax()),
+            AZ::Plane::CreateFromNormalAndPoint(-AZ::Vector3::CreateAxisZ(), box.GetMax())
+        } };
+    }
+
+    class EditorEntitySpatialIndexFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            m_index = AZStd::make_unique<EditorEntitySpatialIndex>();
+            m_bounds = CreateEntityBounds(EntityLayout::Random, s_testEntityCount, s_testLevelSize, 1234);
+            for (size_t index = 0; index < m_bounds.size(); ++index)
+            {
+                m_index->InsertOrUpdate(AZ::EntityId(index + 1), m_bounds[index]);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_index.reset();
+            m_bounds = AZStd::vector<AZ::Aabb>();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZStd::unordered_set<AZ::EntityId> QueryOverlapping(const AZ::Aabb& aabb) const
+        {
+            AZStd::unordered_set<AZ::EntityId> entityIds;
+            m_index->EnumerateOverlapping(aabb, [&entityIds](const AZ::EntityId entityId)
+            {
+                EXPECT_TRUE(entityIds.insert(entityId).second);
+            });
+            return entityIds;
+        }
+
+        AZStd::unique_ptr<EditorEntitySpatialIndex> m_index;
+        AZStd::vector<AZ::Aabb> m_bounds;
+    };
+
+    TEST_F(EditorEntitySpatialIndexFixture, OverlapQueryReturnsEveryOverlappingEntity)
+    {
+        EXPECT_EQ(m_index->Size(), s_testEntityCount);
+
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(50.0f), AZ::Vector3(90.0f));
+        const AZStd::unordered_set<AZ::EntityId> entityIds = QueryOverlapping(query);
+
+        for (size_t index = 0; index < m_bounds.size(); ++index)
+        {
+            // every overlapping entity must be found, bounds are only expanded by the margin
+            if (m_bounds[index].Overlaps(query))
+            {
+                EXPECT_EQ(entityIds.count(AZ::EntityId(index + 1)), 1);
+            }
+            else if (!m_bounds[index].GetExpanded(AZ::Vector3(0.1f)).Overlaps(query))
+            {
+                EXPECT_EQ(entityIds.count(AZ::EntityId(index + 1)), 0);
+            }
+        }
+    }
+
+    TEST_F(EditorEntitySpatialIndexFixture, RayQueryReturnsEveryIntersectedEntity)
+    {
+        const AZ::Vector3 origin = AZ::Vector3(-10.0f);
+        const AZ::Vector3 direction = AZ::Vector3(1.0f, 1.0f, 1.0f).GetNormalized();
+        const float length = 1000.0f;
+
+        AZStd::unordered_set<AZ::EntityId> entityIds;
+        m_index->EnumerateRayIntersecting(origin, direction, length, [&entityIds](const AZ::EntityId entityId)
+        {
+            entityIds.insert(entityId);
+        });
+
+        EXPECT_FALSE(entityIds.empty());
+        for (size_t index = 0; index < m_bounds.size(); ++index)
+        {
+            // the point of the ray closest to the center of the entity is inside of it
+            const AZ::VectorFloat distanceAlongRay = (m_bounds[index].GetCenter() - origin).Dot(direction);
+            if (m_bounds[index].Contains(origin + direction * distanceAlongRay))
+            {
+                EXPECT_EQ(entityIds.count(AZ::EntityId(index + 1)), 1);
+            }
+        }
+    }
+
+    TEST_F(EditorEntitySpatialIndexFixture, VolumeQueryMatchesOverlapQuery)
+    {
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(20.0f, 0.0f, 30.0f), AZ::Vector3(120.0f, 40.0f, 70.0f));
+        const AZStd::array<AZ::Plane, 6> volume = CreateBoxVolume(query);
+
+        AZStd::unordered_set<AZ::EntityId> entityIds;
+        m_index->EnumerateInsideVolume(volume.data(), volume.size(), [&entityIds](const AZ::EntityId entityId)
+        {
+            entityIds.insert(entityId);
+        });
+
+        EXPECT_EQ(entityIds, QueryOverlapping(query));
+    }
+
+    TEST_F(EditorEntitySpatialIndexFixture, MovedEntitiesAreFoundAtTheirNewPosition)
+    {
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1000.0f), AZ::Vector3(-900.0f));
+        EXPECT_TRUE(QueryOverlapping(query).empty());
+
+        // move every other entity far away from the others
+        for (size_t index = 0; index < m_bounds.size(); index += 2)
+        {
+            m_index->InsertOrUpdate(AZ::EntityId(index + 1), AZ::Aabb::CreateCenterRadius(AZ::Vector3(-950.0f), 1.0f));
+        }
+
+        const AZStd::unordered_set<AZ::EntityId> entityIds = QueryOverlapping(query);
+        EXPECT_EQ(entityIds.size(), s_testEntityCount / 2);
+        EXPECT_EQ(m_index->Size(), s_testEntityCount);
+
+        // small movements stay within the expanded bounds
+        m_index->InsertOrUpdate(AZ::EntityId(1), AZ::Aabb::CreateCenterRadius(AZ::Vector3(-950.05f), 1.0f));
+        EXPECT_EQ(QueryOverlapping(query).count(AZ::EntityId(1)), 1);
+    }
+
+    TEST_F(EditorEntitySpatialIndexFixture, RemovedEntitiesAreNotReturned)
+    {
+        for (size_t index = 0; index < m_bounds.size(); ++index)
+        {
+            if (index % 3 != 0)
+            {
+                EXPECT_TRUE(m_index->Remove(AZ::EntityId(index + 1)));
+            }
+        }
+
+        EXPECT_FALSE(m_index->Remove(AZ::EntityId(2)));
+        EXPECT_EQ(m_index->Size(), (s_testEntityCount + 2) / 3);
+
+        const AZ::Aabb everything = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(s_testLevelSize + 10.0f));
+        const AZStd::unordered_set<AZ::EntityId> entityIds = QueryOverlapping(everything);
+        EXPECT_EQ(entityIds.size(), m_index->Size());
+        for (const AZ::EntityId entityId : entityIds)
+        {
+            EXPECT_EQ((static_cast<AZ::u64>(entityId) - 1) % 3, 0);
+        }
+
+        // removed nodes are reused
+        m_index->InsertOrUpdate(AZ::EntityId(2), m_bounds[1]);
+        EXPECT_TRUE(m_index->Contains(AZ::EntityId(2)));
+        EXPECT_EQ(QueryOverlapping(m_bounds[1]).count(AZ::EntityId(2)), 1);
+    }
+
+    TEST_F(EditorEntitySpatialIndexFixture, EmptyIndexReturnsNothing)
+    {
+        EditorEntitySpatialIndex index;
+        bool visited = false;
+        index.EnumerateOverlapping(
+            AZ::Aabb::CreateCenterRadius(AZ::Vector3::CreateZero(), 10.0f), [&visited](AZ::EntityId) { visited = true; });
+        index.EnumerateRayIntersecting(
+            AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 10.0f, [&visited](AZ::EntityId) { visited = true; });
+
+        EXPECT_FALSE(visited);
+        EXPECT_EQ(index.Size(), 0);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class EditorEntitySpatialIndexBenchmarkFixture
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr float s_levelSize = 2000.0f;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_bounds = CreateEntityBounds(
+                static_cast<EntityLayout>(state.range(0)), static_cast<size_t>(state.range(1)), s_levelSize, 1234);
+
+            m_index = AZStd::make_unique<EditorEntitySpatialIndex>();
+            for (size_t index = 0; index < m_bounds.size(); ++index)
+            {
+                m_index->InsertOrUpdate(AZ::EntityId(index + 1), m_bounds[index]);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_index.reset();
+            m_bounds = AZStd::vector<AZ::Aabb>();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // a ray from the edge of the level through its center, as when picking in the viewport
+        AZ::Vector3 RayOrigin() const { return AZ::Vector3(-10.0f, -10.0f, s_levelSize * 0.5f); }
+        AZ::Vector3 RayDirection() const { return AZ::Vector3(1.0f, 1.0f, 0.0f).GetNormalized(); }
+
+        // a region covering a small part of the level, as when box selecting
+        AZ::Aabb BoxSelectRegion() const
+        {
+            return AZ::Aabb::CreateCenterRadius(AZ::Vector3(s_levelSize * 0.5f), s_levelSize * 0.05f);
+        }
+
+        static void Layouts(::benchmark::internal::Benchmark* benchmark)
+        {
+            for (const int layout : { static_cast<int>(EntityLayout::Grid), static_cast<int>(EntityLayout::Clustered), static_cast<int>(EntityLayout::Random) })
+            {
+                for (const int count : { 1000, 10000, 100000 })
+                {
+                    benchmark->Args({ layout, count });
+                }
+            }
+        }
+
+        AZStd::unique_ptr<EditorEntitySpatialIndex> m_index;
+        AZStd::vector<AZ::Aabb> m_bounds;
+    };
+
+    BENCHMARK_DEFINE_F(EditorEntitySpatialIndexBenchmarkFixture, RayPickLinear)(benchmark::State& state)
+    {
+        const AZ::Vector3 origin = RayOrigin();
+        const AZ::Vector3 direction = RayDirection() * s_levelSize * 2.0f;
+        const AZ::Vector3 directionReciprocal = direction.GetReciprocal();
+
+        for (auto _ : state)
+        {
+            size_t hits = 0;
+            for (const AZ::Aabb& bounds : m_bounds)
+            {
+                AZ::VectorFloat start, end;
+                hits += AZ::Intersect::IntersectRayAABB2(origin, directionReciprocal, bounds, start, end)
+                    != AZ::Intersect::ISECT_RAY_AABB_NONE ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(hits);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(EditorEntitySpatialIndexBenchmarkFixture, RayPickIndexed)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            size_t hits = 0;
+            m_index->EnumerateRayIntersecting(RayOrigin(), RayDirection(), s_levelSize * 2.0f, [&hits](AZ::EntityId)
+            {
+                ++hits;
+            });
+            benchmark::DoNotOptimize(hits);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(EditorEntitySpatialIndexBenchmarkFixture, BoxSelectLinear)(benchmark::State& state)
+    {
+        const AZ::Aabb region = BoxSelectRegion();
+
+        for (auto _ : state)
+        {
+            size_t hits = 0;
+            for (const AZ::Aabb& bounds : m_bounds)
+            {
+                hits += region.Contains(bounds.GetCenter()) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(hits);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(EditorEntitySpatialIndexBenchmarkFixture, BoxSelectIndexed)(benchmark::State& state)
+    {
+        const AZStd::array<AZ::Plane, 6> volume = CreateBoxVolume(BoxSelectRegion());
+
+        for (auto _ : state)
+        {
+            size_t hits = 0;
+            m_index->EnumerateInsideVolume(volume.data(), volume.size(), [&hits](AZ::EntityId)
+            {
+                ++hits;
+            });
+            benchmark::DoNotOptimize(hits);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(EditorEntitySpatialIndexBenchmarkFixture, MoveEntities)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom random(4321);
+
+        for (auto _ : state)
+        {
+            // move a selection of 100 entities, as when dragging them with the translation manipulator
+            const AZ::Vector3 offset = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), 0.0f);
+            for (size_t index = 0; index < AZ::GetMin<size_t>(100, m_bounds.size()); ++index)
+            {
+                m_bounds[index].Translate(offset);
+                m_index->InsertOrUpdate(AZ::EntityId(index + 1), m_bounds[index]);
+            }
+        }
+    }
+
+    BENCHMARK_REGISTER_F(EditorEntitySpatialIndexBenchmarkFixture, RayPickLinear)->Apply(EditorEntitySpatialIndexBenchmarkFixture::Layouts);
+    BENCHMARK_REGISTER_F(EditorEntitySpatialIndexBenchmarkFixture, RayPickIndexed)->Apply(EditorEntitySpatialIndexBenchmarkFixture::Layouts);
+    BENCHMARK_REGISTER_F(EditorEntitySpatialIndexBenchmarkFixture, BoxSelectLinear)->Apply(EditorEntitySpatialIndexBenchmarkFixture::Layouts);
+    BENCHMARK_REGISTER_F(EditorEntitySpatialIndexBenchmarkFixture, BoxSelectIndexed)->Apply(EditorEntitySpatialIndexBenchmarkFixture::Layouts);
+    BENCHMARK_REGISTER_F(EditorEntitySpatialIndexBenchmarkFixture, MoveEntities)->Apply(EditorEntitySpatialIndexBenchmarkFixture::Layouts);
+#endif // HAVE_BENCHMARK
+} // namespace UnitTest
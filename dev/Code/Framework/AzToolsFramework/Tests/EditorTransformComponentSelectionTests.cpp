@@ -10,6 +10,7 @@
 *
 */
 
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/ToString.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -25,11 +26,14 @@
 #include <AzToolsFramework/ToolsComponents/EditorVisibilityComponent.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
 #include <AzToolsFramework/Viewport/ActionBus.h>
+#include <AzToolsFramework/Viewport/ViewportMessages.h>
 #include <AzToolsFramework/ViewportSelection/EditorDefaultSelection.h>
 #include <AzToolsFramework/ViewportSelection/EditorInteractionSystemViewportSelectionRequestBus.h>
 #include <AzToolsFramework/ViewportSelection/EditorTransformComponentSelection.h>
 #include <AzToolsFramework/ViewportSelection/EditorVisibleEntityDataCache.h>
 
+#include <QPoint>
+
 using namespace AzToolsFramework;
 
 namespace UnitTest
@@ -99,6 +103,156 @@ namespace UnitTest
         EXPECT_FALSE(m_cache.IsVisibleEntityVisible(m_cache.GetVisibleEntityIndexFromId(m_entityIds[2]).value()));
     }
 
+    // Stand-in for a mesh component whose selection bounds become available after its asset loads.
+    class DeferredBoundsHandler
+        : private EditorComponentSelectionRequestsBus::Handler
+    {
+    public:
+        explicit DeferredBoundsHandler(const AZ::EntityId entityId)
+        {
+            EditorComponentSelectionRequestsBus::Handler::BusConnect(entityId);
+        }
+
+        ~DeferredBoundsHandler()
+        {
+            EditorComponentSelectionRequestsBus::Handler::BusDisconnect();
+        }
+
+        AZ::Aabb GetEditorSelectionBoundsViewport(const AzFramework::ViewportInfo& /*viewportInfo*/) override
+        {
+            return m_bounds;
+        }
+
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+    };
+
+    TEST_F(EditorEntityVisibilityCacheFixture, SelectionBoundsChangedRefreshesEntityBoundsInEditorEntityCache)
+    {
+        // Given
+        const AZ::EntityId entityId = CreateDefaultEditorEntity("Entity");
+        DeferredBoundsHandler boundsHandler(entityId);
+        m_cache.AddEntityIds({ entityId });
+
+        // ray passing well clear of the entity origin
+        const AZ::Vector3 origin = AZ::Vector3(5.0f, -10.0f, 0.0f);
+        const AZ::Vector3 direction = AZ::Vector3::CreateAxisY();
+        const auto entitiesAlongRay = [this, &origin, &direction]()
+        {
+            int count = 0;
+            m_cache.EnumerateVisibleEntitiesAlongRay(origin, direction, 20.0f, [&count](size_t) { ++count; });
+            return count;
+        };
+
+        // Check preconditions.
+        EXPECT_EQ(entitiesAlongRay(), 0);
+
+        // When
+        boundsHandler.m_bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(10.0f));
+
+        // Then
+        // the cached bounds are stale until the bounds changed notification arrives
+        EXPECT_EQ(entitiesAlongRay(), 0);
+
+        EditorComponentSelectionNotificationsBus::Event(
+            entityId, &EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
+
+        EXPECT_EQ(entitiesAlongRay(), 1);
+    }
+
+    TEST_F(EditorEntityVisibilityCacheFixture, UnnotifiedSelectionBoundsChangeIsPickedUpByLaterFrames)
+    {
+        // Given
+        const AZ::EntityId entityId = CreateDefaultEditorEntity("Entity");
+        DeferredBoundsHandler boundsHandler(entityId);
+        m_cache.AddEntityIds({ entityId });
+
+        const AZ::Vector3 origin = AZ::Vector3(5.0f, -10.0f, 0.0f);
+        const AZ::Vector3 direction = AZ::Vector3::CreateAxisY();
+        const auto entitiesAlongRay = [this, &origin, &direction]()
+        {
+            int count = 0;
+            m_cache.EnumerateVisibleEntitiesAlongRay(origin, direction, 20.0f, [&count](size_t) { ++count; });
+            return count;
+        };
+
+        // When
+        // bounds change without the component sending a notification
+        boundsHandler.m_bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(10.0f));
+
+        // Then
+        EXPECT_EQ(entitiesAlongRay(), 0);
+
+        m_cache.CalculateVisibleEntityDatas(AzFramework::ViewportInfo{ 0 });
+
+        EXPECT_EQ(entitiesAlongRay(), 1);
+    }
+
+    // Stand-in for the editor viewport, only providing the camera state.
+    class CameraStateViewport
+        : private ViewportInteraction::ViewportInteractionRequestBus::Handler
+    {
+    public:
+        CameraStateViewport(const int viewportId, const AzFramework::CameraState& cameraState)
+            : m_cameraState(cameraState)
+        {
+            ViewportInteraction::ViewportInteractionRequestBus::Handler::BusConnect(viewportId);
+        }
+
+        ~CameraStateViewport()
+        {
+            ViewportInteraction::ViewportInteractionRequestBus::Handler::BusDisconnect();
+        }
+
+        AzFramework::CameraState GetCameraState() override { return m_cameraState; }
+        bool GridSnappingEnabled() override { return false; }
+        float GridSize() override { return 0.0f; }
+        bool AngleSnappingEnabled() override { return false; }
+        float AngleStep() override { return 0.0f; }
+        QPoint ViewportWorldToScreen(const AZ::Vector3& /*worldPosition*/) override { return QPoint(); }
+
+    private:
+        AzFramework::CameraState m_cameraState;
+    };
+
+    TEST_F(EditorEntityVisibilityCacheFixture, EntitiesInsideViewFrustumAreCached)
+    {
+        // Given
+        AzFramework::CameraState cameraState;
+        cameraState.m_viewportSize = AZ::Vector2(1280.0f, 720.0f);
+        cameraState.m_fovOrZoom = AZ::DegToRad(60.0f);
+        cameraState.m_nearClip = 0.1f;
+        cameraState.m_farClip = 100.0f;
+
+        const int viewportId = 1234;
+        CameraStateViewport viewport(viewportId, cameraState);
+
+        const AZ::EntityId inFront = CreateDefaultEditorEntity("InFront");
+        const AZ::EntityId behind = CreateDefaultEditorEntity("Behind");
+        const AZ::EntityId beyondFarClip = CreateDefaultEditorEntity("BeyondFarClip");
+        const AZ::EntityId outsideOnTheSide = CreateDefaultEditorEntity("OutsideOnTheSide");
+
+        AZ::TransformBus::Event(inFront, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 10.0f, 0.0f));
+        AZ::TransformBus::Event(behind, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, -10.0f, 0.0f));
+        AZ::TransformBus::Event(beyondFarClip, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 200.0f, 0.0f));
+        AZ::TransformBus::Event(outsideOnTheSide, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(50.0f, 10.0f, 0.0f));
+
+        // When
+        m_cache.CalculateVisibleEntityDatas(AzFramework::ViewportInfo{ viewportId });
+
+        // Then
+        EXPECT_TRUE(m_cache.GetVisibleEntityIndexFromId(inFront).has_value());
+        EXPECT_FALSE(m_cache.GetVisibleEntityIndexFromId(behind).has_value());
+        EXPECT_FALSE(m_cache.GetVisibleEntityIndexFromId(beyondFarClip).has_value());
+        EXPECT_FALSE(m_cache.GetVisibleEntityIndexFromId(outsideOnTheSide).has_value());
+
+        // When
+        AZ::TransformBus::Event(behind, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 20.0f, 0.0f));
+        m_cache.CalculateVisibleEntityDatas(AzFramework::ViewportInfo{ viewportId });
+
+        // Then
+        EXPECT_TRUE(m_cache.GetVisibleEntityIndexFromId(behind).has_value());
+    }
+
     // Fixture to support testing EditorTransformComponentSelection functionality on an Entity selection.
     class EditorTransformComponentSelectionTest
         : public ToolsApplicationFixture
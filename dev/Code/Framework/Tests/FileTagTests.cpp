@@ -13,6 +13,8 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/regex.h>
+#include <AzCore/std/string/wildcard.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/FileTag/FileTag.h>
@@ -70,9 +72,113 @@ namespace UnitTest
         {
             m_fileTagsMap.clear();
             m_patternTagsMap.clear();
+            BuildTagIndex();
+        }
+
+        void AddEntry(const AZStd::string& filePath, const AzFramework::FileTag::FileTagData& fileTagData)
+        {
+            if (fileTagData.m_filePatternType == AzFramework::FileTag::FilePatternType::Exact)
+            {
+                m_fileTagsMap[filePath] = fileTagData;
+            }
+            else
+            {
+                m_patternTagsMap[filePath] = fileTagData;
+            }
+        }
+
+        void RebuildTagIndex()
+        {
+            BuildTagIndex();
+        }
+
+        //! Looks up the tags by visiting every entry, as done before the tag index.
+        AZStd::set<AZStd::string> GetTagsLinear(const AZStd::string& filePath) const
+        {
+            using namespace AzFramework::FileTag;
+            AZStd::set<AZStd::string> tags;
+            AZStd::string resolvedFilePath = ResolveFilePath(filePath);
+
+            for (const AZStd::pair<AZStd::string, FileTagData>& data : m_fileTagsMap)
+            {
+                if (ResolveFilePath(data.first) == resolvedFilePath)
+                {
+                    tags.insert(data.second.m_fileTags.begin(), data.second.m_fileTags.end());
+                    break;
+                }
+            }
+
+            for (const AZStd::pair<AZStd::string, FileTagData>& data : m_patternTagsMap)
+            {
+                bool matched = false;
+                if (data.second.m_filePatternType == FilePatternType::Wildcard)
+                {
+                    matched = AZStd::wildcard_match(ResolveFilePath(data.first), resolvedFilePath);
+                }
+                else
+                {
+                    AZStd::regex regex(data.first, AZStd::regex::extended);
+                    matched = AZStd::regex_match(resolvedFilePath.c_str(), regex);
+                }
+
+                if (matched)
+                {
+                    tags.insert(data.second.m_fileTags.begin(), data.second.m_fileTags.end());
+                }
+            }
+
+            return tags;
         }
     };
 
+    const char* TestTagFolders[] = { "levels", "Textures", "objects/characters", "materials", "scripts/ai" };
+    const char* TestTagExtensions[] = { "dds", "mtl", "cgf", "lua", "xml" };
+    const size_t NumTestTagFolders = AZ_ARRAY_SIZE(TestTagFolders);
+    const size_t NumTestTagExtensions = AZ_ARRAY_SIZE(TestTagExtensions);
+
+    void AddTestTagData(FileTagQueryManagerTest& queryManager, size_t numFileEntries)
+    {
+        using namespace AzFramework::FileTag;
+
+        for (size_t entryIndex = 0; entryIndex < numFileEntries; ++entryIndex)
+        {
+            const char* folder = TestTagFolders[entryIndex % NumTestTagFolders];
+            const char* extension = TestTagExtensions[(entryIndex / NumTestTagFolders) % NumTestTagExtensions];
+            queryManager.AddEntry(AZStd::string::format("%s/file_%zu.%s", folder, entryIndex, extension), FileTagData({ "ignore" }, FilePatternType::Exact));
+        }
+
+        for (size_t folderIndex = 0; folderIndex < NumTestTagFolders; ++folderIndex)
+        {
+            const char* extension = TestTagExtensions[folderIndex];
+            queryManager.AddEntry(AZStd::string::format("%s/*.%s", TestTagFolders[folderIndex], extension), FileTagData({ extension }, FilePatternType::Wildcard));
+        }
+
+        queryManager.AddEntry("*.XML", FileTagData({ "xml" }, FilePatternType::Wildcard));
+        queryManager.AddEntry("Lev?ls/file_1*", FileTagData({ "editoronly" }, FilePatternType::Wildcard));
+        queryManager.AddEntry("objects/*/file_?.cgf", FileTagData({ "shader" }, FilePatternType::Wildcard));
+        queryManager.AddEntry("textures/file_2*", FileTagData({ "error" }, FilePatternType::Wildcard));
+        queryManager.AddEntry(R"(^(.*)scripts/ai/file_[0-9]+\.lua$)", FileTagData({ "productdependency" }, FilePatternType::Regex));
+        queryManager.AddEntry(R"(^(.*)_1[0-9]\.dds$)", FileTagData({ "productdependency" }, FilePatternType::Regex));
+    }
+
+    AZStd::vector<AZStd::string> GenerateTestFilePaths(size_t numFilePaths)
+    {
+        AZStd::vector<AZStd::string> filePaths;
+        filePaths.reserve(numFilePaths);
+        for (size_t pathIndex = 0; pathIndex < numFilePaths; ++pathIndex)
+        {
+            // Walk the folders and extensions in a different order than the entries, so only some paths have exact entries
+            AZStd::string folder = TestTagFolders[(pathIndex / 3) % NumTestTagFolders];
+            if (pathIndex % 7 == 0)
+            {
+                AZStd::to_upper(folder.begin(), folder.end());
+            }
+            const char* extension = TestTagExtensions[pathIndex % NumTestTagExtensions];
+            filePaths.push_back(AZStd::string::format("%s/file_%zu.%s", folder.c_str(), pathIndex / 2, extension));
+        }
+        return filePaths;
+    }
+
     class FileTagTest
         : public AllocatorsFixture
     {
@@ -405,4 +511,127 @@ namespace UnitTest
         excludedPatternTags = { DummyFileTags[DummyFileTagIndex::EIdx], DummyFileTags[DummyFileTagIndex::FIdx] };
         EXPECT_FALSE(m_data->m_fileTagManager.RemoveFilePatternTags(pattern, FilePatternType::Regex, FileTagType::Exclude, excludedPatternTags).IsSuccess());
     }
+
+    TEST_F(FileTagTest, FileTags_TagIndex_MatchesLinearLookup)
+    {
+        FileTagQueryManagerTest& queryManager = *m_data->m_excludeFileQueryManager;
+        queryManager.ClearData();
+        AddTestTagData(queryManager, 500);
+        queryManager.RebuildTagIndex();
+
+        AZStd::vector<AZStd::string> filePaths = GenerateTestFilePaths(2000);
+        filePaths.push_back("");
+        filePaths.push_back("levels");
+        filePaths.push_back("levels/");
+
+        AZStd::vector<AZStd::set<AZStd::string>> batchTags = queryManager.GetTagsForFiles(filePaths);
+        ASSERT_EQ(batchTags.size(), filePaths.size());
+
+        size_t numTaggedFiles = 0;
+        for (size_t pathIndex = 0; pathIndex < filePaths.size(); ++pathIndex)
+        {
+            const AZStd::set<AZStd::string> expectedTags = queryManager.GetTagsLinear(filePaths[pathIndex]);
+            EXPECT_TRUE(queryManager.GetTags(filePaths[pathIndex]) == expectedTags) << filePaths[pathIndex].c_str();
+            EXPECT_TRUE(batchTags[pathIndex] == expectedTags) << filePaths[pathIndex].c_str();
+            numTaggedFiles += expectedTags.empty() ? 0 : 1;
+        }
+
+        // the data needs to exercise both matching and non matching files
+        EXPECT_GT(numTaggedFiles, 0);
+        EXPECT_LT(numTaggedFiles, filePaths.size());
+    }
+
+    TEST_F(FileTagTest, FileTags_QueryFilesBatch_Valid)
+    {
+        AZStd::vector<AZStd::string> filePaths = { DummyFile, AnotherDummyFile, MatchingPatternFile, NonMatchingPatternFile, MatchingWildcardFile };
+
+        AZStd::vector<AZStd::set<AZStd::string>> tags = m_data->m_excludeFileQueryManager->GetTagsForFiles(filePaths);
+        ASSERT_EQ(tags.size(), filePaths.size());
+        for (size_t pathIndex = 0; pathIndex < filePaths.size(); ++pathIndex)
+        {
+            EXPECT_TRUE(tags[pathIndex] == m_data->m_excludeFileQueryManager->GetTags(filePaths[pathIndex]));
+        }
+
+        EXPECT_EQ(tags[0].count(DummyFileTagsLowerCase[DummyFileTagIndex::AIdx]), 1);
+        EXPECT_EQ(tags[2].count(DummyFileTagsLowerCase[DummyFileTagIndex::EIdx]), 1);
+        EXPECT_TRUE(tags[3].empty());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class FileTagBenchmarkFixture
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_localFileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            m_priorFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_localFileIO.get());
+
+            m_queryManager = AZStd::make_unique<FileTagQueryManagerTest>(AzFramework::FileTag::FileTagType::Exclude);
+            AddTestTagData(*m_queryManager, 2000);
+            m_queryManager->RebuildTagIndex();
+
+            m_filePaths = GenerateTestFilePaths(static_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_filePaths = AZStd::vector<AZStd::string>();
+            m_queryManager.reset();
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_priorFileIO);
+            m_localFileIO.reset();
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::IO::FileIOBase> m_localFileIO;
+        AZ::IO::FileIOBase* m_priorFileIO = nullptr;
+        AZStd::unique_ptr<FileTagQueryManagerTest> m_queryManager;
+        AZStd::vector<AZStd::string> m_filePaths;
+    };
+
+    BENCHMARK_DEFINE_F(FileTagBenchmarkFixture, GetTagsLinear)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZStd::string& filePath : m_filePaths)
+            {
+                benchmark::DoNotOptimize(m_queryManager->GetTagsLinear(filePath));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_filePaths.size());
+    }
+
+    BENCHMARK_DEFINE_F(FileTagBenchmarkFixture, GetTagsIndexed)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZStd::string& filePath : m_filePaths)
+            {
+                benchmark::DoNotOptimize(m_queryManager->GetTags(filePath));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_filePaths.size());
+    }
+
+    BENCHMARK_DEFINE_F(FileTagBenchmarkFixture, GetTagsForFiles)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_queryManager->GetTagsForFiles(m_filePaths));
+        }
+        state.SetItemsProcessed(state.iterations() * m_filePaths.size());
+    }
+
+    BENCHMARK_REGISTER_F(FileTagBenchmarkFixture, GetTagsLinear)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(FileTagBenchmarkFixture, GetTagsIndexed)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(FileTagBenchmarkFixture, GetTagsForFiles)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
 }
@@ -1067,11 +1067,121 @@ namespace UnitTest
         }
     };
 
+    /**
+    * InstanceDataHierarchyMultiSelectionTest
+    * Builds the merged hierarchy of a large selection, as the entity inspector does when many entities are selected.
+    */
+    class InstanceDataHierarchyMultiSelectionTest
+        : public AllocatorsFixture
+    {
+    public:
+        static const size_t s_numSelected = 1000;
+
+        const AzToolsFramework::InstanceDataNode* FindChild(const AzToolsFramework::InstanceDataNode& node, const char* name)
+        {
+            const AZ::u32 nameCrc = AZ::Crc32(name);
+            for (const AzToolsFramework::InstanceDataNode& child : node.GetChildren())
+            {
+                if (child.GetElementMetadata() && child.GetElementMetadata()->m_nameCrc == nameCrc)
+                {
+                    return &child;
+                }
+            }
+            return nullptr;
+        }
+
+        void run()
+        {
+            using namespace AzToolsFramework;
+
+            AZ::SerializeContext serializeContext;
+            serializeContext.CreateEditContext();
+            Entity::Reflect(&serializeContext);
+            TestComponent::Reflect(&serializeContext);
+
+            TestComponent comparison;
+            comparison.m_normalContainer.push_back(TestComponent::SubData(1));
+            comparison.m_normalContainer.push_back(TestComponent::SubData(2));
+
+            AZStd::vector<AZStd::unique_ptr<TestComponent>> selection;
+            selection.reserve(s_numSelected);
+            for (size_t i = 0; i < s_numSelected; ++i)
+            {
+                selection.emplace_back(aznew TestComponent());
+                selection.back()->m_normalContainer = comparison.m_normalContainer;
+            }
+
+            InstanceDataHierarchy idh;
+            for (const AZStd::unique_ptr<TestComponent>& component : selection)
+            {
+                idh.AddRootInstance(component.get());
+            }
+            idh.AddComparisonInstance(&comparison);
+            idh.Build(&serializeContext, AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+
+            ASSERT_NE(nullptr, idh.GetRootNode());
+
+            // Every node of the merged hierarchy maps to an instance from each selected component.
+            AZStd::vector<const InstanceDataNode*> stack;
+            stack.push_back(idh.GetRootNode());
+            while (!stack.empty())
+            {
+                const InstanceDataNode* node = stack.back();
+                stack.pop_back();
+
+                EXPECT_EQ(s_numSelected, node->GetNumInstances());
+                for (const InstanceDataNode& child : node->GetChildren())
+                {
+                    stack.push_back(&child);
+                }
+            }
+
+            const InstanceDataNode* floatNode = FindChild(*idh.GetRootNode(), "Float");
+            const InstanceDataNode* containerNode = FindChild(*idh.GetRootNode(), "NormalContainer");
+            ASSERT_NE(nullptr, floatNode);
+            ASSERT_NE(nullptr, containerNode);
+            EXPECT_EQ(2, containerNode->GetChildren().size());
+            EXPECT_FALSE(floatNode->IsDifferentVersusComparison());
+
+            // Refreshing reuses the comparison hierarchy and only compares the values again.
+            selection[0]->m_float = 1.f;
+            EXPECT_FALSE(idh.RefreshComparisonData(AZ::SerializeContext::ENUM_ACCESS_FOR_READ, DynamicEditDataProvider()));
+            EXPECT_TRUE(floatNode->IsDifferentVersusComparison());
+
+            comparison.m_float = 1.f;
+            EXPECT_TRUE(idh.RefreshComparisonData(AZ::SerializeContext::ENUM_ACCESS_FOR_READ, DynamicEditDataProvider()));
+            EXPECT_FALSE(floatNode->IsDifferentVersusComparison());
+
+            // Resizing a container of the comparison instance rebuilds the comparison hierarchy on the next refresh.
+            comparison.m_normalContainer.push_back(TestComponent::SubData(3));
+            EXPECT_FALSE(idh.RefreshComparisonData(AZ::SerializeContext::ENUM_ACCESS_FOR_READ, DynamicEditDataProvider()));
+            EXPECT_TRUE(containerNode->IsDifferentVersusComparison());
+
+            comparison.m_normalContainer.pop_back();
+            EXPECT_TRUE(idh.RefreshComparisonData(AZ::SerializeContext::ENUM_ACCESS_FOR_READ, DynamicEditDataProvider()));
+            EXPECT_FALSE(containerNode->IsDifferentVersusComparison());
+
+            // Adding a comparison instance discards the cached hierarchies, the next refresh compares against both instances.
+            TestComponent otherComparison;
+            otherComparison.m_normalContainer = comparison.m_normalContainer;
+            otherComparison.m_float = 2.f;
+            idh.AddComparisonInstance(&otherComparison);
+            EXPECT_FALSE(idh.RefreshComparisonData(AZ::SerializeContext::ENUM_ACCESS_FOR_READ, DynamicEditDataProvider()));
+            EXPECT_TRUE(floatNode->IsDifferentVersusComparison());
+            EXPECT_FALSE(containerNode->IsDifferentVersusComparison());
+        }
+    };
+
     TEST_F(InstanceDataHierarchyBasicTest, Test)
     {
         run();
     }
 
+    TEST_F(InstanceDataHierarchyMultiSelectionTest, Test)
+    {
+        run();
+    }
+
     TEST_F(InstanceDataHierarchyCopyContainerChangesTest, Test)
     {
         run();
@@ -828,6 +828,8 @@ void AIConsoleVars::Init()
         "Set path finding frame time quota in seconds (Set to 0 for no limit)");
     REGISTER_CVAR2("ai_MNMPathFinderDebug", &MNMPathFinderDebug, 0, VF_CHEAT | VF_CHEAT_NOCHECK,
         "[0-1] Enable/Disable debug draw statistics on pathfinder load");
+    REGISTER_CVAR2("ai_MNMPathFinderHierarchicalDistance", &MNMPathFinderHierarchicalDistance, 48.0f, VF_CHEAT | VF_CHEAT_NOCHECK,
+        "Paths at least this long are planned over the navigation mesh tiles first, then refined inside the corridor of tiles found (Set to 0 to always search the whole mesh)");
 
     REGISTER_CVAR2("ai_MNMProfileMemory", &MNMProfileMemory, 0, VF_CHEAT | VF_CHEAT_NOCHECK,
         "[0-1] Display navigation system memory statistics");
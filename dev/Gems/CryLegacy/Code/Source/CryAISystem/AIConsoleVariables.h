@@ -338,6 +338,7 @@ struct AIConsoleVars
 
     float MNMPathFinderQuota;
     int MNMPathFinderDebug;
+    float MNMPathFinderHierarchicalDistance;
 
     int MNMProfileMemory;
 
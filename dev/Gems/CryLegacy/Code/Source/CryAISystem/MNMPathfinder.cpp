@@ -205,6 +205,8 @@ void CMNMPathfinder::Reset()
     m_processingContextsPool.Reset();
     m_pathfindingFailedEventsToDispatch.clear();
     m_pathfindingCompletedEventsToDispatch.clear();
+
+    m_tileGraphs.clear();
 }
 
 const std::tuple<uint32, Vec3, Vec3, Vec3> CMNMPathfinder::GetCurrentNavTriangle(const IAIPathAgent* pRequester, NavigationAgentTypeID agentTypeID) const
@@ -510,8 +512,40 @@ void CMNMPathfinder::Update()
     SpawnJobs();
 }
 
+void CMNMPathfinder::OnNavigationMeshDestroyed(const NavigationMeshID meshId)
+{
+    TileGraphs::iterator tileGraphIt = m_tileGraphs.find(meshId);
+    if (tileGraphIt == m_tileGraphs.end())
+    {
+        return;
+    }
+
+    // The mesh id can be reused by a mesh with another grid, which then gets its own graph.
+    // No job may still plan over the destroyed graph, nor any request set up to.
+    WaitForJobsToFinish();
+
+    const size_t maximumAmountOfSlotsToUpdate = m_processingContextsPool.GetMaxSlots();
+    for (size_t i = 0; i < maximumAmountOfSlotsToUpdate; ++i)
+    {
+        MNM::PathfinderUtils::ProcessingRequest& processingRequest = m_processingContextsPool.GetContextAtPosition(i).processingRequest;
+        if (processingRequest.IsValid() && (processingRequest.meshID == meshId))
+        {
+            processingRequest.pTileGraph = NULL;
+        }
+    }
+
+    m_tileGraphs.erase(tileGraphIt);
+}
+
 void CMNMPathfinder::OnNavigationMeshChanged(const NavigationMeshID meshId, const MNM::TileID tileId)
 {
+    TileGraphs::iterator tileGraphIt = m_tileGraphs.find(meshId);
+    if (tileGraphIt != m_tileGraphs.end())
+    {
+        const NavigationMesh& mesh = gAIEnv.pNavigationSystem->GetMesh(meshId);
+        tileGraphIt->second.UpdateTile(mesh.grid, tileId);
+    }
+
     const size_t maximumAmountOfSlotsToUpdate = m_processingContextsPool.GetOccupiedSlotsCount();
     for (size_t i = 0; i < maximumAmountOfSlotsToUpdate; ++i)
     {
@@ -650,6 +684,16 @@ bool CMNMPathfinder::SetupForNextPathRequest(MNM::QueuedPathID requestID, MNM::P
     processingRequest.data.requestParams.endLocation = safeEndLocation;
 
     const MNM::real_t startToEndDist = (endLocation - startLocation).lenNoOverflow();
+
+    processingContext.workingSet.corridorTiles.clear();
+
+    const float hierarchicalDistance = gAIEnv.CVars.MNMPathFinderHierarchicalDistance;
+    if ((hierarchicalDistance > 0.0f) && (startToEndDist >= MNM::real_t(hierarchicalDistance)) &&
+        (MNM::ComputeTileID(triangleStartID) != MNM::ComputeTileID(triangleEndID)))
+    {
+        processingRequest.pTileGraph = &GetTileGraph(meshID, grid);
+    }
+
     processingContext.workingSet.aStarOpenList.SetUpForPathSolving(mesh.grid.GetTriangleCount(), triangleStartID, startLocation, startToEndDist);
 
     return true;
@@ -677,15 +721,46 @@ void CMNMPathfinder::ProcessPathRequest(MNM::PathfinderUtils::ProcessingContext&
         processingRequest.data.requestParams.endLocation - gridParams.origin, meshOffMeshNav,
         processingRequest.data.GetDangersInfos());
 
+    if (processingRequest.pTileGraph)
+    {
+        PlanCorridor(processingContext);
+    }
+
     if (grid.FindWay(inputParams, processingContext.workingSet, processingContext.queryResult) == MNM::MeshGrid::eWQR_Continuing)
     {
         return;
     }
 
+    if (!processingContext.queryResult.GetWaySize() && !processingContext.workingSet.corridorTiles.empty())
+    {
+        // No way was found inside the corridor, search the whole mesh from the next step on
+        processingContext.workingSet.corridorTiles.clear();
+
+        const MNM::vector3_t startLocation(processingRequest.data.requestParams.startLocation);
+        const MNM::vector3_t endLocation(processingRequest.data.requestParams.endLocation);
+        processingContext.workingSet.aStarOpenList.SetUpForPathSolving(grid.GetTriangleCount(), processingRequest.fromTriangleID,
+            startLocation, (endLocation - startLocation).lenNoOverflow());
+        return;
+    }
+
     processingContext.status = MNM::PathfinderUtils::ProcessingContext::FindWayCompleted;
     return;
 }
 
+void CMNMPathfinder::PlanCorridor(MNM::PathfinderUtils::ProcessingContext& processingContext)
+{
+    FUNCTION_PROFILER(gEnv->pSystem, PROFILE_AI);
+
+    MNM::PathfinderUtils::ProcessingRequest& processingRequest = processingContext.processingRequest;
+    const MNM::TileGraph& tileGraph = *processingRequest.pTileGraph;
+    processingRequest.pTileGraph = NULL;
+
+    // When the tiles are not connected in the graph, through off-mesh links only for instance,
+    // the corridor stays empty and the whole mesh is searched
+    tileGraph.FindCorridor(MNM::ComputeTileID(processingRequest.fromTriangleID), MNM::ComputeTileID(processingRequest.toTriangleID),
+        processingContext.tileGraphWorkingSet, processingContext.workingSet.corridorTiles);
+}
+
 void CMNMPathfinder::ConstructPathIfWayWasFound(MNM::PathfinderUtils::ProcessingContext& processingContext)
 {
     if (processingContext.status != MNM::PathfinderUtils::ProcessingContext::FindWayCompleted)
@@ -819,6 +894,19 @@ void CMNMPathfinder::PathRequestFailed(MNM::QueuedPathID requestID, const MNM::P
     request.requestParams.resultCallback(requestID, result);
 }
 
+const MNM::TileGraph& CMNMPathfinder::GetTileGraph(NavigationMeshID meshID, const MNM::MeshGrid& grid)
+{
+    MNM::TileGraph& tileGraph = m_tileGraphs[meshID];
+
+    // Meshes loaded from file, or tiles regenerated for debugging, don't go through OnNavigationMeshChanged
+    if (!tileGraph.IsBuilt() || (tileGraph.GetTileCount() != grid.GetTileCount()))
+    {
+        tileGraph.Build(grid);
+    }
+
+    return tileGraph;
+}
+
 void CMNMPathfinder::DebugAllStatistics()
 {
     float y = 40.0f;
@@ -17,6 +17,7 @@
 
 #include "Navigation/MNM/MNM.h"
 #include "Navigation/MNM/MeshGrid.h"
+#include "Navigation/MNM/TileGraph.h"
 #include "NavPath.h"
 #include <AgePriorityQueue.h>
 #include <INavigationSystem.h>
@@ -69,6 +70,7 @@ namespace MNM
                 , meshID(0)
                 , fromTriangleID(0)
                 , toTriangleID(0)
+                , pTileGraph(NULL)
                 , data()
                 , queuedID(0)
             {
@@ -82,6 +84,9 @@ namespace MNM
             MNM::TriangleID fromTriangleID;
             MNM::TriangleID toTriangleID;
 
+            // Set for long paths until their corridor is planned over the tiles of the mesh
+            const MNM::TileGraph* pTileGraph;
+
             QueuedRequest data;
             MNM::QueuedPathID queuedID;
         };
@@ -111,6 +116,7 @@ namespace MNM
                 : processingRequest(std::move(other.processingRequest))
                 , queryResult(std::move(other.queryResult))
                 , workingSet(std::move(other.workingSet))
+                , tileGraphWorkingSet(std::move(other.tileGraphWorkingSet))
                 , status(std::move(other.status))
             {
                 other.jobExecutor.WaitForCompletion();
@@ -153,6 +159,7 @@ namespace MNM
             ProcessingRequest processingRequest;
             MeshGrid::WayQueryResult queryResult;
             MeshGrid::WayQueryWorkingSet workingSet;
+            TileGraph::QueryWorkingSet tileGraphWorkingSet;
             bool pathHasBeenUnmarked;
 
             volatile EProcessingStatus   status;
@@ -372,6 +379,7 @@ public:
     size_t GetRequestQueueSize() const { return m_requestedPathsQueue.size(); }
 
     void OnNavigationMeshChanged(NavigationMeshID meshId, MNM::TileID tileId);
+    void OnNavigationMeshDestroyed(NavigationMeshID meshId);
 
     const std::tuple<uint32, Vec3, Vec3, Vec3> GetCurrentNavTriangle(const IAIPathAgent* pRequester, NavigationAgentTypeID agentTypeID) const override;
 
@@ -386,11 +394,14 @@ private:
     void SpawnPathConstructionJob(MNM::PathfinderUtils::ProcessingContext& processingContext);
     void WaitForJobToFinish(MNM::PathfinderUtils::ProcessingContext& processingContext);
     void ProcessPathRequest(MNM::PathfinderUtils::ProcessingContext& processingContext);
+    void PlanCorridor(MNM::PathfinderUtils::ProcessingContext& processingContext);
     void ConstructPathIfWayWasFound(MNM::PathfinderUtils::ProcessingContext& processingContext);
 
     bool SetupForNextPathRequest(MNM::QueuedPathID requestID, MNM::PathfinderUtils::QueuedRequest& request, MNM::PathfinderUtils::ProcessingContext& processingContext);
     void PathRequestFailed(MNM::QueuedPathID requestID, const MNM::PathfinderUtils::QueuedRequest& request);
 
+    const MNM::TileGraph& GetTileGraph(NavigationMeshID meshID, const MNM::MeshGrid& grid);
+
     void CancelResultDispatchingForRequest(MNM::QueuedPathID requestId);
 
     void DebugAllStatistics();
@@ -405,6 +416,10 @@ private:
     MNM::PathfinderUtils::ProcessingContextsPool m_processingContextsPool;
     MNM::PathfinderUtils::PathfinderFailedEventQueue m_pathfindingFailedEventsToDispatch;
     MNM::PathfinderUtils::PathfinderCompletedEventQueue m_pathfindingCompletedEventsToDispatch;
+
+    // Only modified on the main thread, while no processing job runs
+    typedef std::map<NavigationMeshID, MNM::TileGraph> TileGraphs;
+    TileGraphs m_tileGraphs;
 };
 
 #endif // CRYINCLUDE_CRYAISYSTEM_MNMPATHFINDER_H
@@ -860,6 +860,11 @@ namespace MNM
                             continue;
                         }
 
+                        if (!workingSet.IsTileInCorridor(ComputeTileID(nextTri.triangleID)))
+                        {
+                            continue;
+                        }
+
                         AStarOpenList::Node* nextNode = NULL;
                         const bool inserted = workingSet.aStarOpenList.InsertNode(nextTri, &nextNode);
 
@@ -2069,6 +2074,19 @@ namespace MNM
         return 0;
     }
 
+    void MeshGrid::GetTileIDs(std::vector<TileID>& tileIDs) const
+    {
+        tileIDs.reserve(tileIDs.size() + m_tileMap.size());
+
+        TileMap::const_iterator it = m_tileMap.begin();
+        TileMap::const_iterator end = m_tileMap.end();
+
+        for (; it != end; ++it)
+        {
+            tileIDs.push_back(it->second);
+        }
+    }
+
     const Tile& MeshGrid::GetTile(TileID tileID) const
     {
         assert(tileID > 0);
@@ -244,10 +244,19 @@ namespace MNM
                 aStarOpenList.Reset();
                 nextLinkedTriangles.clear();
                 nextLinkedTriangles.reserve(32);
+                corridorTiles.clear();
+            }
+
+            ILINE bool IsTileInCorridor(const TileID tileID) const
+            {
+                return corridorTiles.empty() || ((tileID < corridorTiles.size()) && corridorTiles[tileID]);
             }
 
             TNextLinkedTriangles nextLinkedTriangles;
             AStarOpenList aStarOpenList;
+
+            // When not empty, only the triangles of the tiles flagged here (indexed by TileID) are searched
+            std::vector<bool> corridorTiles;
         };
 
         struct WayQueryResult
@@ -435,6 +444,7 @@ namespace MNM
         }
 
         TileID GetTileID(size_t x, size_t y, size_t z) const;
+        void GetTileIDs(std::vector<TileID>& tileIDs) const;
         const Tile& GetTile(TileID) const;
         Tile& GetTile(TileID);
         const vector3_t GetTileContainerCoordinates(TileID) const;
@@ -0,0 +1,237 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "CryLegacy_precompiled.h"
+#include "TileGraph.h"
+
+namespace MNM
+{
+    TileGraph::TileGraph()
+        : m_tileCount(0)
+        , m_built(false)
+    {
+    }
+
+    void TileGraph::Build(const MeshGrid& grid)
+    {
+        FUNCTION_PROFILER(gEnv->pSystem, PROFILE_AI);
+
+        Clear();
+
+        std::vector<TileID> tileIDs;
+        grid.GetTileIDs(tileIDs);
+
+        for (size_t i = 0; i < tileIDs.size(); ++i)
+        {
+            ReadTile(grid, tileIDs[i]);
+        }
+
+        m_built = true;
+    }
+
+    void TileGraph::UpdateTile(const MeshGrid& grid, TileID tileID)
+    {
+        if (!m_built)
+        {
+            return;
+        }
+
+        ReadTile(grid, tileID);
+
+        // Connecting or clearing a tile recomputes the links of its neighbours too
+        const Node& node = m_nodes[tileID];
+        const size_t x = node.x;
+        const size_t y = node.y;
+        const size_t z = node.z;
+
+        for (size_t side = 0; side < MeshGrid::SideCount; ++side)
+        {
+            if (const TileID neighbourID = grid.GetNeighbourTileID(x, y, z, side))
+            {
+                ReadTile(grid, neighbourID);
+            }
+        }
+    }
+
+    void TileGraph::Clear()
+    {
+        m_nodes.clear();
+        m_tileCount = 0;
+        m_built = false;
+    }
+
+    bool TileGraph::FindCorridor(TileID fromTileID, TileID toTileID, QueryWorkingSet& workingSet, std::vector<bool>& corridorTiles) const
+    {
+        FUNCTION_PROFILER(gEnv->pSystem, PROFILE_AI);
+
+        workingSet.expandedCount = 0;
+
+        if ((fromTileID >= m_nodes.size()) || (toTileID >= m_nodes.size()) || !m_nodes[fromTileID].valid || !m_nodes[toTileID].valid)
+        {
+            return false;
+        }
+
+        // Node states of previous searches are told apart by their search id, instead of clearing them all
+        if (workingSet.nodeStates.size() < m_nodes.size())
+        {
+            workingSet.nodeStates.resize(m_nodes.size());
+        }
+
+        if (++workingSet.searchID == 0)
+        {
+            std::fill(workingSet.nodeStates.begin(), workingSet.nodeStates.end(), QueryWorkingSet::NodeState());
+            workingSet.searchID = 1;
+        }
+
+        const uint32 searchID = workingSet.searchID;
+        const Vec3& goalPosition = m_nodes[toTileID].position;
+
+        QueryWorkingSet::NodeState& startState = workingSet.nodeStates[fromTileID];
+        startState.cost = 0.0f;
+        startState.parentID = 0;
+        startState.searchID = searchID;
+        startState.closed = false;
+
+        std::vector<QueryWorkingSet::OpenNode>& openList = workingSet.openList;
+        openList.clear();
+        openList.push_back(QueryWorkingSet::OpenNode(fromTileID, m_nodes[fromTileID].position.GetDistance(goalPosition)));
+
+        bool found = false;
+
+        while (!openList.empty())
+        {
+            std::pop_heap(openList.begin(), openList.end());
+            const TileID bestID = openList.back().tileID;
+            openList.pop_back();
+
+            QueryWorkingSet::NodeState& bestState = workingSet.nodeStates[bestID];
+            if (bestState.closed)
+            {
+                // Stale entry, the tile was pushed again with a lower cost
+                continue;
+            }
+
+            bestState.closed = true;
+            ++workingSet.expandedCount;
+
+            if (bestID == toTileID)
+            {
+                found = true;
+                break;
+            }
+
+            const Node& bestNode = m_nodes[bestID];
+
+            for (size_t side = 0; side < MeshGrid::SideCount; ++side)
+            {
+                const TileID nextID = bestNode.neighbours[side];
+                if (!nextID || (nextID >= m_nodes.size()) || !m_nodes[nextID].valid)
+                {
+                    continue;
+                }
+
+                const Node& nextNode = m_nodes[nextID];
+                const float cost = bestState.cost + bestNode.position.GetDistance(nextNode.position);
+
+                QueryWorkingSet::NodeState& nextState = workingSet.nodeStates[nextID];
+                if ((nextState.searchID == searchID) && (nextState.closed || (nextState.cost <= cost)))
+                {
+                    continue;
+                }
+
+                nextState.cost = cost;
+                nextState.parentID = bestID;
+                nextState.searchID = searchID;
+                nextState.closed = false;
+
+                openList.push_back(QueryWorkingSet::OpenNode(nextID, cost + nextNode.position.GetDistance(goalPosition)));
+                std::push_heap(openList.begin(), openList.end());
+            }
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+
+        // The tiles next to the path are part of the corridor too, the triangle level path can cut corners
+        // or go around obstacles through them
+        corridorTiles.assign(m_nodes.size(), false);
+
+        for (TileID tileID = toTileID;; tileID = workingSet.nodeStates[tileID].parentID)
+        {
+            const Node& node = m_nodes[tileID];
+            corridorTiles[tileID] = true;
+
+            for (size_t side = 0; side < MeshGrid::SideCount; ++side)
+            {
+                const TileID neighbourID = node.neighbours[side];
+                if (neighbourID && (neighbourID < corridorTiles.size()))
+                {
+                    corridorTiles[neighbourID] = true;
+                }
+            }
+
+            if (tileID == fromTileID)
+            {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    void TileGraph::ReadTile(const MeshGrid& grid, TileID tileID)
+    {
+        if (tileID >= m_nodes.size())
+        {
+            m_nodes.resize(tileID + 1);
+        }
+
+        const vector3_t coordinates = grid.GetTileContainerCoordinates(tileID);
+        const size_t x = coordinates.x.as_int();
+        const size_t y = coordinates.y.as_int();
+        const size_t z = coordinates.z.as_int();
+
+        Node& node = m_nodes[tileID];
+        const bool wasValid = node.valid;
+
+        node = Node();
+        node.x = static_cast<uint16>(x);
+        node.y = static_cast<uint16>(y);
+        node.z = static_cast<uint16>(z);
+
+        // A cleared tile keeps its container coordinates until the id is reused
+        node.valid = (grid.GetTileID(x, y, z) == tileID);
+
+        if (node.valid)
+        {
+            const Vec3i& tileSize = grid.GetParams().tileSize;
+            node.position = Vec3((x + 0.5f) * tileSize.x, (y + 0.5f) * tileSize.y, (z + 0.5f) * tileSize.z);
+
+            const Tile& tile = grid.GetTile(tileID);
+            for (size_t l = 0; l < tile.linkCount; ++l)
+            {
+                const Tile::Link& link = tile.links[l];
+                if ((link.side < MeshGrid::SideCount) && !node.neighbours[link.side])
+                {
+                    node.neighbours[link.side] = grid.GetNeighbourTileID(x, y, z, link.side);
+                }
+            }
+        }
+
+        if (node.valid != wasValid)
+        {
+            m_tileCount = node.valid ? m_tileCount + 1 : m_tileCount - 1;
+        }
+    }
+}
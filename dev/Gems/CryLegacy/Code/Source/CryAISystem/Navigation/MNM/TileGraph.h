@@ -0,0 +1,128 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#ifndef CRYINCLUDE_CRYAISYSTEM_NAVIGATION_MNM_TILEGRAPH_H
+#define CRYINCLUDE_CRYAISYSTEM_NAVIGATION_MNM_TILEGRAPH_H
+#pragma once
+
+#include "MNM.h"
+#include "MeshGrid.h"
+
+namespace MNM
+{
+    // Coarse view of a MeshGrid where every tile is a node, connected to the neighbour tiles its triangles
+    // have links to. Long paths are planned on it first, then refined at triangle level inside the corridor
+    // of tiles the coarse path goes through.
+    // Off-mesh links are not part of the graph, they are agent dependent and not known by the mesh grid.
+    class TileGraph
+    {
+    public:
+        // Scratch memory of a search, one per concurrent query
+        struct QueryWorkingSet
+        {
+            QueryWorkingSet()
+                : searchID(0)
+                , expandedCount(0)
+            {
+            }
+
+            struct NodeState
+            {
+                NodeState()
+                    : cost(0.0f)
+                    , parentID(0)
+                    , searchID(0)
+                    , closed(false)
+                {
+                }
+
+                float  cost;
+                TileID parentID;
+                uint32 searchID;
+                bool   closed;
+            };
+
+            struct OpenNode
+            {
+                OpenNode(TileID _tileID, float _estimatedTotalCost)
+                    : tileID(_tileID)
+                    , estimatedTotalCost(_estimatedTotalCost)
+                {
+                }
+
+                // Inverted to keep the cheapest node on top of the std heap
+                bool operator<(const OpenNode& other) const
+                {
+                    return estimatedTotalCost > other.estimatedTotalCost;
+                }
+
+                TileID tileID;
+                float  estimatedTotalCost;
+            };
+
+            std::vector<NodeState> nodeStates;
+            std::vector<OpenNode>  openList;
+            uint32 searchID;
+
+            // Number of tiles expanded by the last search
+            size_t expandedCount;
+        };
+
+        TileGraph();
+
+        void Build(const MeshGrid& grid);
+        // Reads again the links of a tile that was set, cleared or reconnected, and of its neighbours
+        void UpdateTile(const MeshGrid& grid, TileID tileID);
+        void Clear();
+
+        inline bool IsBuilt() const
+        {
+            return m_built;
+        }
+
+        inline size_t GetTileCount() const
+        {
+            return m_tileCount;
+        }
+
+        // Finds the cheapest tile path between two tiles and flags its tiles, and the tiles next to them, in
+        // corridorTiles (indexed by TileID). Returns false when the tiles are not connected in the graph.
+        bool FindCorridor(TileID fromTileID, TileID toTileID, QueryWorkingSet& workingSet, std::vector<bool>& corridorTiles) const;
+
+    private:
+        struct Node
+        {
+            Node()
+                : position(ZERO)
+                , x(0)
+                , y(0)
+                , z(0)
+                , valid(false)
+            {
+                std::fill(neighbours, neighbours + MeshGrid::SideCount, TileID(0));
+            }
+
+            Vec3   position;                        // Tile center, relative to the mesh origin
+            uint16 x, y, z;
+            TileID neighbours[MeshGrid::SideCount]; // 0 when no triangle links to that side
+            bool   valid;
+        };
+
+        void ReadTile(const MeshGrid& grid, TileID tileID);
+
+        std::vector<Node> m_nodes; // Indexed by TileID
+        size_t m_tileCount;
+        bool   m_built;
+    };
+}
+
+#endif // CRYINCLUDE_CRYAISYSTEM_NAVIGATION_MNM_TILEGRAPH_H
@@ -412,6 +412,11 @@ void NavigationSystem::DestroyMesh(NavigationMeshID meshID)
 
         m_offMeshNavigationManager.OnNavigationMeshDestroyed(meshID);
 
+        if (gAIEnv.pMNMPathfinder)
+        {
+            gAIEnv.pMNMPathfinder->OnNavigationMeshDestroyed(meshID);
+        }
+
         ComputeWorldAABB();
     }
 }
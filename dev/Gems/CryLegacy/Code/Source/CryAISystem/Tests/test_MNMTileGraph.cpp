@@ -0,0 +1,328 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "CryLegacy_precompiled.h"
+#include <AzTest/AzTest.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <Mocks/StubTimer.h>
+#include "../Navigation/MNM/MeshGrid.h"
+#include "../Navigation/MNM/TileGraph.h"
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace MNMTileGraphTest
+{
+    // Flat square tiles of 4x4 cells, two triangles per cell
+    const size_t CellsPerSide = 4;
+    const size_t VerticesPerSide = CellsPerSide + 1;
+    const uint16 CenterTriangleIndex = (1 * CellsPerSide + 1) * 2;
+
+    // The tiles of the wall column are missing, except for the door at its bottom
+    const size_t TileCountX = 12;
+    const size_t TileCountY = 12;
+    const size_t WallX = 6;
+    const size_t DoorY = 0;
+
+    // Global environment stubs the mesh grid needs for profiling and path solving contention
+    class ScopedTestEnvironment
+    {
+    public:
+        ScopedTestEnvironment()
+        {
+            m_env = new(AZ_OS_MALLOC(sizeof(SSystemGlobalEnvironment), alignof(SSystemGlobalEnvironment))) SSystemGlobalEnvironment();
+            m_stubTimer = new StubTimer(1.0f / 30.0f);
+            gEnv = m_env;
+            gEnv->pTimer = m_stubTimer;
+        }
+
+        ~ScopedTestEnvironment()
+        {
+            gEnv->pTimer = nullptr;
+            gEnv = nullptr;
+            delete m_stubTimer;
+            m_env->~SSystemGlobalEnvironment();
+            AZ_OS_FREE(m_env);
+        }
+
+    private:
+        SSystemGlobalEnvironment* m_env;
+        StubTimer* m_stubTimer;
+    };
+
+    class TestMesh
+    {
+    public:
+        TestMesh()
+        {
+            MNM::MeshGrid::Params params;
+            params.tileCount = TileCountX * TileCountY;
+            m_grid.Init(params);
+
+            for (size_t y = 0; y < TileCountY; ++y)
+            {
+                for (size_t x = 0; x < TileCountX; ++x)
+                {
+                    if ((x != WallX) || (y == DoorY))
+                    {
+                        SetTile(x, y);
+                    }
+                }
+            }
+
+            m_grid.CreateNetwork();
+        }
+
+        MNM::TileID SetTile(size_t x, size_t y)
+        {
+            MNM::Tile::Vertex vertices[VerticesPerSide * VerticesPerSide];
+            for (size_t j = 0; j < VerticesPerSide; ++j)
+            {
+                for (size_t i = 0; i < VerticesPerSide; ++i)
+                {
+                    vertices[j * VerticesPerSide + i] = MNM::Tile::Vertex(Vec3(i * 4.0f, j * 4.0f, 0.0f));
+                }
+            }
+
+            MNM::Tile::Triangle triangles[CellsPerSide * CellsPerSide * 2];
+            for (size_t j = 0; j < CellsPerSide; ++j)
+            {
+                for (size_t i = 0; i < CellsPerSide; ++i)
+                {
+                    const MNM::Tile::Index v00 = static_cast<MNM::Tile::Index>(j * VerticesPerSide + i);
+                    const MNM::Tile::Index v10 = v00 + 1;
+                    const MNM::Tile::Index v01 = static_cast<MNM::Tile::Index>(v00 + VerticesPerSide);
+                    const MNM::Tile::Index v11 = v01 + 1;
+
+                    MNM::Tile::Triangle* cellTriangles = triangles + (j * CellsPerSide + i) * 2;
+                    SetTriangle(cellTriangles[0], v00, v10, v11);
+                    SetTriangle(cellTriangles[1], v00, v11, v01);
+                }
+            }
+
+            MNM::Tile tile;
+            tile.CopyVertices(vertices, VerticesPerSide * VerticesPerSide);
+            tile.CopyTriangles(triangles, CellsPerSide * CellsPerSide * 2);
+
+            return m_grid.SetTile(x, y, 0, tile);
+        }
+
+        MNM::TriangleID GetCenterTriangle(size_t x, size_t y) const
+        {
+            return MNM::ComputeTriangleID(m_grid.GetTileID(x, y, 0), CenterTriangleIndex);
+        }
+
+        // Lies inside the center triangle of the tile
+        MNM::vector3_t GetCenterLocation(size_t x, size_t y) const
+        {
+            return MNM::vector3_t(Vec3(x * 16.0f + 7.0f, y * 16.0f + 5.0f, 0.0f));
+        }
+
+        size_t FindWay(size_t fromX, size_t fromY, size_t toX, size_t toY, MNM::MeshGrid::WayQueryWorkingSet& workingSet,
+            MNM::MeshGrid::WayQueryResult& result) const
+        {
+            const MNM::TriangleID fromTriangleID = GetCenterTriangle(fromX, fromY);
+            const MNM::TriangleID toTriangleID = GetCenterTriangle(toX, toY);
+            const MNM::vector3_t fromLocation = GetCenterLocation(fromX, fromY);
+            const MNM::vector3_t toLocation = GetCenterLocation(toX, toY);
+
+            workingSet.aStarOpenList.SetUpForPathSolving(m_grid.GetTriangleCount(), fromTriangleID, fromLocation, (toLocation - fromLocation).lenNoOverflow());
+
+            MNM::MeshGrid::WayQueryRequest request(nullptr, fromTriangleID, fromLocation, toTriangleID, toLocation, m_offMeshNavigation, MNM::DangerousAreasList());
+            while (m_grid.FindWay(request, workingSet, result) == MNM::MeshGrid::eWQR_Continuing)
+            {
+            }
+
+            workingSet.aStarOpenList.PathSolvingDone();
+
+            return result.GetWaySize();
+        }
+
+        MNM::MeshGrid& GetGrid()
+        {
+            return m_grid;
+        }
+
+        const MNM::MeshGrid& GetGrid() const
+        {
+            return m_grid;
+        }
+
+    private:
+        static void SetTriangle(MNM::Tile::Triangle& triangle, MNM::Tile::Index v0, MNM::Tile::Index v1, MNM::Tile::Index v2)
+        {
+            triangle.vertex[0] = v0;
+            triangle.vertex[1] = v1;
+            triangle.vertex[2] = v2;
+            triangle.linkCount = 0;
+            triangle.firstLink = 0;
+            triangle.islandID = MNM::Constants::eStaticIsland_InvalidIslandID;
+        }
+
+        MNM::MeshGrid m_grid;
+        MNM::OffMeshNavigation m_offMeshNavigation;
+    };
+
+    class MNMTileGraphTest
+        : public ::testing::Test
+    {
+    protected:
+        bool IsInCorridor(const std::vector<bool>& corridorTiles, size_t x, size_t y) const
+        {
+            const MNM::TileID tileID = m_mesh.GetGrid().GetTileID(x, y, 0);
+            return tileID && (tileID < corridorTiles.size()) && corridorTiles[tileID];
+        }
+
+        ScopedTestEnvironment m_environment;
+        TestMesh m_mesh;
+        MNM::TileGraph m_tileGraph;
+        MNM::TileGraph::QueryWorkingSet m_queryWorkingSet;
+    };
+
+    TEST_F(MNMTileGraphTest, Build_AllTilesAreNodes)
+    {
+        m_tileGraph.Build(m_mesh.GetGrid());
+
+        EXPECT_TRUE(m_tileGraph.IsBuilt());
+        EXPECT_EQ(m_mesh.GetGrid().GetTileCount(), m_tileGraph.GetTileCount());
+    }
+
+    TEST_F(MNMTileGraphTest, FindCorridor_AcrossWall_GoesThroughDoor)
+    {
+        const MNM::MeshGrid& grid = m_mesh.GetGrid();
+        m_tileGraph.Build(grid);
+
+        std::vector<bool> corridorTiles;
+        const bool found = m_tileGraph.FindCorridor(grid.GetTileID(WallX - 1, TileCountY - 1, 0), grid.GetTileID(WallX + 1, TileCountY - 1, 0),
+                m_queryWorkingSet, corridorTiles);
+
+        ASSERT_TRUE(found);
+        EXPECT_TRUE(IsInCorridor(corridorTiles, WallX, DoorY));
+        EXPECT_TRUE(IsInCorridor(corridorTiles, WallX - 1, TileCountY / 2));
+        EXPECT_TRUE(IsInCorridor(corridorTiles, WallX + 1, TileCountY / 2));
+        EXPECT_FALSE(IsInCorridor(corridorTiles, 0, TileCountY / 2));
+        EXPECT_FALSE(IsInCorridor(corridorTiles, TileCountX - 1, TileCountY / 2));
+    }
+
+    TEST_F(MNMTileGraphTest, FindCorridor_DoorCleared_NotConnected)
+    {
+        MNM::MeshGrid& grid = m_mesh.GetGrid();
+        m_tileGraph.Build(grid);
+
+        const MNM::TileID doorTileID = grid.GetTileID(WallX, DoorY, 0);
+        grid.ClearTile(doorTileID);
+        m_tileGraph.UpdateTile(grid, doorTileID);
+
+        EXPECT_EQ(grid.GetTileCount(), m_tileGraph.GetTileCount());
+
+        std::vector<bool> corridorTiles;
+        EXPECT_FALSE(m_tileGraph.FindCorridor(grid.GetTileID(0, 0, 0), grid.GetTileID(TileCountX - 1, 0, 0), m_queryWorkingSet, corridorTiles));
+
+        const MNM::TileID newDoorTileID = m_mesh.SetTile(WallX, TileCountY - 1);
+        grid.ConnectToNetwork(newDoorTileID);
+        m_tileGraph.UpdateTile(grid, newDoorTileID);
+
+        EXPECT_EQ(grid.GetTileCount(), m_tileGraph.GetTileCount());
+        ASSERT_TRUE(m_tileGraph.FindCorridor(grid.GetTileID(0, 0, 0), grid.GetTileID(TileCountX - 1, 0, 0), m_queryWorkingSet, corridorTiles));
+        EXPECT_TRUE(IsInCorridor(corridorTiles, WallX, TileCountY - 1));
+    }
+
+    TEST_F(MNMTileGraphTest, FindWay_InsideCorridor_ReachesTargetWithFewerExpansions)
+    {
+        const MNM::MeshGrid& grid = m_mesh.GetGrid();
+        m_tileGraph.Build(grid);
+
+        const size_t fromX = WallX - 4;
+        const size_t toX = WallX + 4;
+        const size_t y = TileCountY - 1;
+
+        MNM::MeshGrid::WayQueryWorkingSet fullWorkingSet;
+        MNM::MeshGrid::WayQueryResult fullResult(1024);
+        const size_t fullWaySize = m_mesh.FindWay(fromX, y, toX, y, fullWorkingSet, fullResult);
+        ASSERT_GT(fullWaySize, 0u);
+
+        MNM::MeshGrid::WayQueryWorkingSet corridorWorkingSet;
+        ASSERT_TRUE(m_tileGraph.FindCorridor(grid.GetTileID(fromX, y, 0), grid.GetTileID(toX, y, 0), m_queryWorkingSet, corridorWorkingSet.corridorTiles));
+
+        MNM::MeshGrid::WayQueryResult corridorResult(1024);
+        const size_t corridorWaySize = m_mesh.FindWay(fromX, y, toX, y, corridorWorkingSet, corridorResult);
+        ASSERT_GT(corridorWaySize, 0u);
+
+        // The way is stored from its end to its start
+        EXPECT_EQ(fullResult.GetWayData()[0].triangleID, corridorResult.GetWayData()[0].triangleID);
+        EXPECT_EQ(fullResult.GetWayData()[fullWaySize - 1].triangleID, corridorResult.GetWayData()[corridorWaySize - 1].triangleID);
+
+        EXPECT_LT(corridorWorkingSet.aStarOpenList.GetContentionStats().peakSearchSteps, fullWorkingSet.aStarOpenList.GetContentionStats().peakSearchSteps);
+    }
+
+#ifdef HAVE_BENCHMARK
+    class MNMTileGraphBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            m_environment.reset(new ScopedTestEnvironment());
+            m_mesh.reset(new TestMesh());
+            m_tileGraph.Build(m_mesh->GetGrid());
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_tileGraph.Clear();
+            m_mesh.reset();
+            m_environment.reset();
+        }
+
+    protected:
+        std::unique_ptr<ScopedTestEnvironment> m_environment;
+        std::unique_ptr<TestMesh> m_mesh;
+        MNM::TileGraph m_tileGraph;
+    };
+
+    BENCHMARK_DEFINE_F(MNMTileGraphBenchmarkFixture, BM_FindWay_FullMesh)(benchmark::State& state)
+    {
+        MNM::MeshGrid::WayQueryWorkingSet workingSet;
+        MNM::MeshGrid::WayQueryResult result(1024);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_mesh->FindWay(WallX - 4, TileCountY - 1, WallX + 4, TileCountY - 1, workingSet, result));
+        }
+
+        state.counters["Expansions"] = workingSet.aStarOpenList.GetContentionStats().averageSearchSteps;
+    }
+
+    BENCHMARK_DEFINE_F(MNMTileGraphBenchmarkFixture, BM_FindWay_Hierarchical)(benchmark::State& state)
+    {
+        const MNM::MeshGrid& grid = m_mesh->GetGrid();
+        const MNM::TileID fromTileID = grid.GetTileID(WallX - 4, TileCountY - 1, 0);
+        const MNM::TileID toTileID = grid.GetTileID(WallX + 4, TileCountY - 1, 0);
+
+        MNM::TileGraph::QueryWorkingSet queryWorkingSet;
+        MNM::MeshGrid::WayQueryWorkingSet workingSet;
+        MNM::MeshGrid::WayQueryResult result(1024);
+
+        for (auto _ : state)
+        {
+            m_tileGraph.FindCorridor(fromTileID, toTileID, queryWorkingSet, workingSet.corridorTiles);
+            benchmark::DoNotOptimize(m_mesh->FindWay(WallX - 4, TileCountY - 1, WallX + 4, TileCountY - 1, workingSet, result));
+        }
+
+        state.counters["Expansions"] = workingSet.aStarOpenList.GetContentionStats().averageSearchSteps;
+        state.counters["TileExpansions"] = queryWorkingSet.expandedCount;
+    }
+
+    BENCHMARK_REGISTER_F(MNMTileGraphBenchmarkFixture, BM_FindWay_FullMesh)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(MNMTileGraphBenchmarkFixture, BM_FindWay_Hierarchical)->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+}
@@ -0,0 +1,771 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "CryLegacy_precompiled.h"
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <Mocks/StubTimer.h>
+#include "../VisionMap.h"
+#include "../VisionMapObservableStore.h"
+#include <HashGrid.h>
+
+#include <random>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+// Reads the PVS update state of a vision map, and marks PVS entries visible as the ray casts the tests can't run would
+class VisionMapUnitTestAccessor
+{
+public:
+    static std::vector<uint32> GetPVS(const CVisionMap& visionMap, const ObserverID& observerID)
+    {
+        std::vector<uint32> result;
+
+        CVisionMap::Observers::const_iterator observerIt = visionMap.m_observers.find(observerID);
+        if (observerIt != visionMap.m_observers.end())
+        {
+            const CVisionMap::PVS& pvs = observerIt->second.pvs;
+            for (CVisionMap::PVS::const_iterator pvsIt = pvs.begin(), end = pvs.end(); pvsIt != end; ++pvsIt)
+            {
+                result.push_back(pvsIt->first);
+            }
+        }
+
+        return result;
+    }
+
+    static void SetVisible(CVisionMap& visionMap, const ObserverID& observerID, const ObservableID& observableID)
+    {
+        visionMap.m_observers.find(observerID)->second.pvs.find(observableID)->second.visible = true;
+    }
+
+    static std::vector<uint32> GetPVSUpdateQueue(const CVisionMap& visionMap)
+    {
+        return std::vector<uint32>(visionMap.m_observerPVSUpdateQueue.begin(), visionMap.m_observerPVSUpdateQueue.end());
+    }
+
+    static size_t GetPVSUpdateQueueSize(const CVisionMap& visionMap)
+    {
+        return visionMap.m_observerPVSUpdateQueue.size();
+    }
+
+#if VISIONMAP_DEBUG
+    static float GetPVSUpdateQueueLatency(const CVisionMap& visionMap)
+    {
+        return visionMap.m_pvsUpdateQueueLatency.GetSeconds();
+    }
+#endif
+};
+
+namespace VisionMapObservableStoreTest
+{
+    const size_t ObserverCount = 2000;
+    const size_t ObservableCount = 4000;
+    const float WorldSize = 200.0f;
+    const float FrameTime = 1.0f / 30.0f;
+
+    // Observers and observables scattered in a square of the world, with random masks, ranges and cones.
+    // Vision ids are handed out by a vision map, as nothing else can create them.
+    class TestWorld
+    {
+    public:
+        TestWorld(size_t observerCount, size_t observableCount, uint32 seed)
+            : m_random(seed)
+        {
+            m_observerIDs.reserve(observerCount);
+            m_observerParams.resize(observerCount);
+            for (size_t i = 0; i < observerCount; ++i)
+            {
+                m_observerIDs.push_back(m_visionMap.CreateVisionID("Observer"));
+                m_observerParams[i] = CreateObserverParams();
+            }
+
+            m_observableIDs.reserve(observableCount);
+            m_observableParams.resize(observableCount);
+            for (size_t i = 0; i < observableCount; ++i)
+            {
+                m_observableIDs.push_back(m_visionMap.CreateVisionID("Observable"));
+                m_observableParams[i] = CreateObservableParams();
+                m_store.Add(m_observableIDs[i], m_observableParams[i]);
+            }
+        }
+
+        ObserverParams CreateObserverParams()
+        {
+            ObserverParams params;
+            params.typesToObserveMask = RandomMask();
+            params.factionsToObserveMask = RandomMask();
+            params.eyePosition = RandomPosition();
+
+            Vec3 eyeDirection(Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-0.2f, 0.2f));
+            params.eyeDirection = eyeDirection.IsZero() ? Vec3(0.0f, 1.0f, 0.0f) : eyeDirection.GetNormalized();
+
+            // Some observers see without limits, to cover the paths skipping the range and cone tests
+            params.sightRange = (Random(0.0f, 1.0f) < 0.1f) ? 0.0f : Random(5.0f, 60.0f);
+            params.fovCos = (Random(0.0f, 1.0f) < 0.1f) ? -1.0f : Random(-0.9f, 0.95f);
+            return params;
+        }
+
+        ObservableParams CreateObservableParams()
+        {
+            ObservableParams params;
+            params.typeMask = 1u << (m_random() % 8);
+            // Past 31 to cover the factions wrapping around in the masks
+            params.faction = static_cast<uint8>(m_random() % 40);
+            params.observablePositionsCount = static_cast<uint8>(1 + m_random() % ObservableParams::MaxPositionCount);
+
+            const Vec3 position = RandomPosition();
+            for (int p = 0; p < params.observablePositionsCount; ++p)
+            {
+                params.observablePositions[p] = position + Vec3(Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(0.0f, 2.0f));
+            }
+            return params;
+        }
+
+        // Observable ids the observer should observe, checked one by one without the store
+        std::vector<uint32> FindObservedReference(size_t observerIndex) const
+        {
+            std::vector<uint32> result;
+            for (size_t i = 0; i < m_observableIDs.size(); ++i)
+            {
+                if ((m_observableIDs[i] != m_observerIDs[observerIndex]) &&
+                    CVisionMapObservableStore::ShouldObserve(m_observerParams[observerIndex], m_observableParams[i]))
+                {
+                    result.push_back(m_observableIDs[i]);
+                }
+            }
+
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        // Observable ids the observer should observe, found the way the vision map did before the store:
+        // the observables of a grid around the eye for observers with a sight range, all of them otherwise
+        std::vector<uint32> FindObservedGridReference(size_t observerIndex) const
+        {
+            const ObserverParams& observerParams = m_observerParams[observerIndex];
+
+            std::vector<size_t> candidates;
+            if (observerParams.sightRange > 0.0f)
+            {
+                ObservablesGrid grid(20.0f, 20.0f, 20.0f, ObservablePosition(this));
+                for (size_t i = 0; i < m_observableIDs.size(); ++i)
+                {
+                    grid.insert(m_observableParams[i].observablePositions[0], i);
+                }
+
+                std::vector<std::pair<float, size_t> > queryObservables;
+                grid.query_sphere_distance(observerParams.eyePosition, observerParams.sightRange, queryObservables);
+                for (size_t i = 0; i < queryObservables.size(); ++i)
+                {
+                    candidates.push_back(queryObservables[i].second);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_observableIDs.size(); ++i)
+                {
+                    candidates.push_back(i);
+                }
+            }
+
+            std::vector<uint32> result;
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                const size_t observableIndex = candidates[i];
+                if ((m_observableIDs[observableIndex] != m_observerIDs[observerIndex]) &&
+                    CVisionMapObservableStore::ShouldObserve(observerParams, m_observableParams[observableIndex]))
+                {
+                    result.push_back(m_observableIDs[observableIndex]);
+                }
+            }
+
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        std::vector<uint32> ToObservableIDs(const CVisionMapObservableStore::Query& query) const
+        {
+            std::vector<uint32> result;
+            for (size_t i = 0; i < query.observed.size(); ++i)
+            {
+                result.push_back(m_store.GetObservableID(query.observed[i]));
+            }
+            return result;
+        }
+
+        void SetupQuery(size_t observerIndex, CVisionMapObservableStore::Query& query) const
+        {
+            query.observerParams = &m_observerParams[observerIndex];
+            query.observerID = m_observerIDs[observerIndex];
+        }
+
+        void SetupQueries(std::vector<CVisionMapObservableStore::Query>& queries) const
+        {
+            queries.resize(m_observerIDs.size());
+            for (size_t i = 0; i < queries.size(); ++i)
+            {
+                SetupQuery(i, queries[i]);
+            }
+        }
+
+        uint32 RandomMask()
+        {
+            return static_cast<uint32>(m_random()) | static_cast<uint32>(m_random());
+        }
+
+        float Random(float minValue, float maxValue)
+        {
+            return std::uniform_real_distribution<float>(minValue, maxValue)(m_random);
+        }
+
+        Vec3 RandomPosition()
+        {
+            return Vec3(Random(0.0f, WorldSize), Random(0.0f, WorldSize), Random(0.0f, 4.0f));
+        }
+
+        struct ObservablePosition
+        {
+            ObservablePosition(const TestWorld* _world = NULL)
+                : world(_world)
+            {
+            }
+
+            inline Vec3 operator()(size_t observableIndex) const
+            {
+                return world->m_observableParams[observableIndex].observablePositions[0];
+            }
+
+            const TestWorld* world;
+        };
+
+        typedef hash_grid<256, size_t, hash_grid_2d<Vec3, Vec3i>, ObservablePosition> ObservablesGrid;
+
+        CVisionMap m_visionMap;
+        CVisionMapObservableStore m_store;
+
+        std::vector<ObserverID> m_observerIDs;
+        std::vector<ObserverParams> m_observerParams;
+        std::vector<ObservableID> m_observableIDs;
+        std::vector<ObservableParams> m_observableParams;
+
+        std::mt19937 m_random;
+    };
+
+    class VisionMapObservableStoreTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(VisionMapObservableStoreTests, FindObserved_RandomWorld_MatchesShouldObserve)
+    {
+        TestWorld world(ObserverCount, ObservableCount, 1);
+
+        CVisionMapObservableStore::Query query;
+        for (size_t i = 0; i < ObserverCount; ++i)
+        {
+            world.SetupQuery(i, query);
+            world.m_store.FindObserved(query);
+
+            ASSERT_EQ(world.FindObservedReference(i), world.ToObservableIDs(query)) << "Observer " << i;
+        }
+    }
+
+    TEST_F(VisionMapObservableStoreTests, FindObserved_ObservableIsObserver_IsNotObserved)
+    {
+        TestWorld world(0, 1, 2);
+
+        ObserverParams observerParams;
+        observerParams.typesToObserveMask = VISION_MAP_ALL_TYPES;
+        observerParams.factionsToObserveMask = VISION_MAP_ALL_FACTIONS;
+        observerParams.sightRange = 0.0f;
+
+        CVisionMapObservableStore::Query query;
+        query.observerParams = &observerParams;
+        query.observerID = world.m_observableIDs[0];
+        world.m_store.FindObserved(query);
+        EXPECT_TRUE(query.observed.empty());
+
+        query.observerID = 0;
+        world.m_store.FindObserved(query);
+        ASSERT_EQ(1u, query.observed.size());
+        EXPECT_TRUE(world.m_store.Contains(query.observed, world.m_observableIDs[0]));
+    }
+
+    TEST_F(VisionMapObservableStoreTests, FindObserved_BatchOfQueries_MatchesSingleQueries)
+    {
+        TestWorld world(ObserverCount, ObservableCount, 3);
+
+        std::vector<CVisionMapObservableStore::Query> queries;
+        world.SetupQueries(queries);
+        world.m_store.FindObserved(&queries[0], queries.size());
+
+        CVisionMapObservableStore::Query query;
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            world.SetupQuery(i, query);
+            world.m_store.FindObserved(query);
+
+            ASSERT_EQ(query.observed, queries[i].observed) << "Observer " << i;
+        }
+    }
+
+    TEST_F(VisionMapObservableStoreTests, RemoveAndUpdate_RandomWorld_MatchesShouldObserve)
+    {
+        TestWorld world(200, ObservableCount, 4);
+
+        // Remove every third observable, the last ones taking their slots, and move the others around
+        for (size_t i = 0, k = 0; i < world.m_observableIDs.size(); ++k)
+        {
+            if (k % 3 == 0)
+            {
+                world.m_store.Remove(world.m_observableIDs[i]);
+                world.m_observableIDs.erase(world.m_observableIDs.begin() + i);
+                world.m_observableParams.erase(world.m_observableParams.begin() + i);
+            }
+            else
+            {
+                world.m_observableParams[i] = world.CreateObservableParams();
+                world.m_store.Update(world.m_observableIDs[i], world.m_observableParams[i]);
+                ++i;
+            }
+        }
+
+        ASSERT_EQ(world.m_observableIDs.size(), world.m_store.GetCount());
+
+        CVisionMapObservableStore::Query query;
+        for (size_t i = 0; i < world.m_observerIDs.size(); ++i)
+        {
+            world.SetupQuery(i, query);
+            world.m_store.FindObserved(query);
+
+            ASSERT_EQ(world.FindObservedReference(i), world.ToObservableIDs(query)) << "Observer " << i;
+        }
+
+        world.m_store.Clear();
+        EXPECT_EQ(0u, world.m_store.GetCount());
+
+        world.SetupQuery(0, query);
+        world.m_store.FindObserved(query);
+        EXPECT_TRUE(query.observed.empty());
+    }
+
+    TEST_F(VisionMapObservableStoreTests, AddRemoveUpdate_Stress_MatchesGridPath)
+    {
+        TestWorld world(500, ObservableCount, 7);
+
+        // Observables keep moving across cells, leave and come back, the last ones taking the slots of removed ones
+        std::vector<ObservableID> removedIDs;
+        for (int round = 0; round < 10; ++round)
+        {
+            for (size_t i = 0; i < world.m_observableIDs.size(); )
+            {
+                const uint32 action = world.m_random() % 4;
+                if (action == 0)
+                {
+                    world.m_store.Remove(world.m_observableIDs[i]);
+                    removedIDs.push_back(world.m_observableIDs[i]);
+                    world.m_observableIDs.erase(world.m_observableIDs.begin() + i);
+                    world.m_observableParams.erase(world.m_observableParams.begin() + i);
+                    continue;
+                }
+
+                if (action == 1)
+                {
+                    world.m_observableParams[i] = world.CreateObservableParams();
+                    world.m_store.Update(world.m_observableIDs[i], world.m_observableParams[i]);
+                }
+                ++i;
+            }
+
+            while (removedIDs.size() > ObservableCount / 8)
+            {
+                world.m_observableIDs.push_back(removedIDs.back());
+                world.m_observableParams.push_back(world.CreateObservableParams());
+                world.m_store.Add(world.m_observableIDs.back(), world.m_observableParams.back());
+                removedIDs.pop_back();
+            }
+
+            for (size_t i = 0; i < world.m_observerParams.size(); ++i)
+            {
+                world.m_observerParams[i] = world.CreateObserverParams();
+            }
+
+            ASSERT_EQ(world.m_observableIDs.size(), world.m_store.GetCount()) << "Round " << round;
+
+            CVisionMapObservableStore::Query query;
+            for (size_t i = 0; i < world.m_observerIDs.size(); ++i)
+            {
+                world.SetupQuery(i, query);
+                world.m_store.FindObserved(query);
+
+                ASSERT_EQ(world.FindObservedGridReference(i), world.ToObservableIDs(query)) << "Observer " << i << ", round " << round;
+            }
+        }
+    }
+
+    // The timer a vision map reads the frame start time from and the cvar limiting its PVS updates per frame.
+    // There are no visibility updates, their ray casts need a physical world.
+    class ScopedVisionMapEnvironment
+    {
+    public:
+        ScopedVisionMapEnvironment()
+            : m_frame(0)
+            , m_savedPVSUpdatesPerFrame(gAIEnv.CVars.VisionMapNumberOfPVSUpdatesPerFrame)
+            , m_savedVisibilityUpdatesPerFrame(gAIEnv.CVars.VisionMapNumberOfVisibilityUpdatesPerFrame)
+        {
+            m_env = new(AZ_OS_MALLOC(sizeof(SSystemGlobalEnvironment), alignof(SSystemGlobalEnvironment))) SSystemGlobalEnvironment();
+            m_stubTimer = new StubTimer(FrameTime);
+            gEnv = m_env;
+            gEnv->pTimer = m_stubTimer;
+
+            SetPVSUpdates(16);
+            gAIEnv.CVars.VisionMapNumberOfVisibilityUpdatesPerFrame = 0;
+        }
+
+        ~ScopedVisionMapEnvironment()
+        {
+            gAIEnv.CVars.VisionMapNumberOfPVSUpdatesPerFrame = m_savedPVSUpdatesPerFrame;
+            gAIEnv.CVars.VisionMapNumberOfVisibilityUpdatesPerFrame = m_savedVisibilityUpdatesPerFrame;
+
+            gEnv->pTimer = nullptr;
+            gEnv = nullptr;
+            delete m_stubTimer;
+            m_env->~SSystemGlobalEnvironment();
+            AZ_OS_FREE(m_env);
+        }
+
+        void SetPVSUpdates(int updatesPerFrame)
+        {
+            gAIEnv.CVars.VisionMapNumberOfPVSUpdatesPerFrame = updatesPerFrame;
+        }
+
+        void RunFrame(CVisionMap& visionMap)
+        {
+            ++m_frame;
+            m_stubTimer->SetTime(m_frame * FrameTime);
+            visionMap.Update(FrameTime);
+        }
+
+    private:
+        SSystemGlobalEnvironment* m_env;
+        StubTimer* m_stubTimer;
+        size_t m_frame;
+
+        int m_savedPVSUpdatesPerFrame;
+        int m_savedVisibilityUpdatesPerFrame;
+    };
+
+    // The observables go first, the observers then only get their PVS from the PVS updates
+    void RegisterWorld(const TestWorld& world, CVisionMap& visionMap)
+    {
+        for (size_t i = 0; i < world.m_observableIDs.size(); ++i)
+        {
+            visionMap.RegisterObservable(world.m_observableIDs[i], world.m_observableParams[i]);
+        }
+
+        for (size_t i = 0; i < world.m_observerIDs.size(); ++i)
+        {
+            visionMap.RegisterObserver(world.m_observerIDs[i], world.m_observerParams[i]);
+        }
+    }
+
+    void MoveObservers(CVisionMap& visionMap, const std::vector<ObserverID>& observerIDs, const std::vector<ObserverParams>& observerParams)
+    {
+        for (size_t i = 0; i < observerIDs.size(); ++i)
+        {
+            visionMap.ObserverChanged(observerIDs[i], observerParams[i], eChangedAll);
+        }
+    }
+
+    // Runs frames until the PVS update queue is empty and returns how many it took
+    size_t DrainPVSUpdateQueue(ScopedVisionMapEnvironment& environment, CVisionMap& visionMap)
+    {
+        size_t frameCount = 0;
+        do
+        {
+            environment.RunFrame(visionMap);
+            ++frameCount;
+        }
+        while (VisionMapUnitTestAccessor::GetPVSUpdateQueueSize(visionMap));
+
+        return frameCount;
+    }
+
+    class VisionMapPVSUpdateTests
+        : public VisionMapObservableStoreTests
+    {
+    protected:
+        void SetUp() override
+        {
+            VisionMapObservableStoreTests::SetUp();
+            m_environment = new ScopedVisionMapEnvironment();
+        }
+
+        void TearDown() override
+        {
+            delete m_environment;
+            VisionMapObservableStoreTests::TearDown();
+        }
+
+        ScopedVisionMapEnvironment* m_environment;
+    };
+
+    TEST_F(VisionMapPVSUpdateTests, UpdatePVS_ThousandsOfObservers_MatchesShouldObserveAndLatencyShrinksWithUpdatesPerFrame)
+    {
+        TestWorld world(ObserverCount, ObservableCount, 5);
+
+        // Every observer moves at once after its first PVS update, the way a mass teleport does,
+        // the observables it stops observing being found missing from the resolved observable ids
+        std::vector<ObserverParams> movedParams(ObserverCount);
+        for (size_t i = 0; i < ObserverCount; ++i)
+        {
+            movedParams[i] = world.CreateObserverParams();
+        }
+
+        std::vector<std::vector<uint32> > reference(ObserverCount);
+        std::vector<std::vector<uint32> > movedReference(ObserverCount);
+        for (size_t i = 0; i < ObserverCount; ++i)
+        {
+            reference[i] = world.FindObservedReference(i);
+        }
+
+        world.m_observerParams.swap(movedParams);
+        for (size_t i = 0; i < ObserverCount; ++i)
+        {
+            movedReference[i] = world.FindObservedReference(i);
+        }
+        world.m_observerParams.swap(movedParams);
+
+        const int updatesPerFrameCounts[] = { 16, 32, 64 };
+        float previousLatency = 0.0f;
+
+        for (int updatesPerFrame : updatesPerFrameCounts)
+        {
+            m_environment->SetPVSUpdates(updatesPerFrame);
+            const size_t expectedFrameCount = (ObserverCount + updatesPerFrame - 1) / updatesPerFrame;
+
+            CVisionMap visionMap;
+            RegisterWorld(world, visionMap);
+
+            EXPECT_EQ(expectedFrameCount, DrainPVSUpdateQueue(*m_environment, visionMap)) << updatesPerFrame << " updates per frame";
+            for (size_t i = 0; i < ObserverCount; ++i)
+            {
+                ASSERT_EQ(reference[i], VisionMapUnitTestAccessor::GetPVS(visionMap, world.m_observerIDs[i])) << "Observer " << i << ", " << updatesPerFrame << " updates per frame";
+            }
+
+            MoveObservers(visionMap, world.m_observerIDs, movedParams);
+
+            EXPECT_EQ(expectedFrameCount, DrainPVSUpdateQueue(*m_environment, visionMap)) << updatesPerFrame << " updates per frame";
+            for (size_t i = 0; i < ObserverCount; ++i)
+            {
+                ASSERT_EQ(movedReference[i], VisionMapUnitTestAccessor::GetPVS(visionMap, world.m_observerIDs[i])) << "Observer " << i << ", " << updatesPerFrame << " updates per frame";
+            }
+
+#if VISIONMAP_DEBUG
+            // The last observer waited from the frame all of them got queued to the last frame
+            const float latency = VisionMapUnitTestAccessor::GetPVSUpdateQueueLatency(visionMap);
+            EXPECT_NEAR((expectedFrameCount - 1) * FrameTime, latency, 0.001f) << updatesPerFrame << " updates per frame";
+            if (previousLatency > 0.0f)
+            {
+                EXPECT_LT(latency, previousLatency) << updatesPerFrame << " updates per frame";
+            }
+            previousLatency = latency;
+#endif
+        }
+    }
+
+    // An observer reacting to losing sight of an observable by unregistering another observable and observer
+    class LostSightHandler
+    {
+    public:
+        LostSightHandler(CVisionMap& visionMap, const ObservableID& observableToUnregister, const ObserverID& observerToUnregister)
+            : m_visionMap(visionMap)
+            , m_observableToUnregister(observableToUnregister)
+            , m_observerToUnregister(observerToUnregister)
+            , m_callCount(0)
+            , m_lostObservableID(0)
+            , m_visible(true)
+        {
+        }
+
+        void OnVisibilityChanged(const VisionID& /*observerID*/, const ObserverParams& /*observerParams*/, const VisionID& observableID, const ObservableParams& /*observableParams*/, bool visible)
+        {
+            ++m_callCount;
+            m_lostObservableID = observableID;
+            m_visible = visible;
+            m_queueWhenCalled = VisionMapUnitTestAccessor::GetPVSUpdateQueue(m_visionMap);
+
+            m_visionMap.UnregisterObservable(m_observableToUnregister);
+            m_visionMap.UnregisterObserver(m_observerToUnregister);
+        }
+
+        CVisionMap& m_visionMap;
+        ObservableID m_observableToUnregister;
+        ObserverID m_observerToUnregister;
+
+        int m_callCount;
+        uint32 m_lostObservableID;
+        bool m_visible;
+        std::vector<uint32> m_queueWhenCalled;
+    };
+
+    TEST_F(VisionMapPVSUpdateTests, UpdatePVS_CallbackUnregistersMidApply_LaterObserversSkipThem)
+    {
+        CVisionMap visionMap;
+
+        // Observable ids increase in creation order, the lost observable comes first in the PVS of the moving observer
+        const ObservableID lostID = visionMap.CreateVisionID("Lost");
+        const ObservableID unregisteredID = visionMap.CreateVisionID("Unregistered");
+        const ObservableID keptID = visionMap.CreateVisionID("Kept");
+        const ObservableID observableIDs[] = { lostID, unregisteredID, keptID };
+
+        ObserverID observerIDs[4];
+        for (ObserverID& observerID : observerIDs)
+        {
+            observerID = visionMap.CreateVisionID("Observer");
+        }
+
+        LostSightHandler handler(visionMap, unregisteredID, observerIDs[2]);
+
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(observableIDs); ++i)
+        {
+            ObservableParams observableParams;
+            observableParams.typeMask = 1;
+            observableParams.observablePositionsCount = 1;
+            observableParams.observablePositions[0] = Vec3(0.0f, 10.0f + static_cast<float>(i), 0.0f);
+            visionMap.RegisterObservable(observableIDs[i], observableParams);
+        }
+
+        ObserverParams observerParams[4];
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(observerIDs); ++i)
+        {
+            observerParams[i].typesToObserveMask = VISION_MAP_ALL_TYPES;
+            observerParams[i].factionsToObserveMask = VISION_MAP_ALL_FACTIONS;
+            observerParams[i].sightRange = 50.0f;
+            observerParams[i].eyePosition = Vec3(static_cast<float>(i), 0.0f, 0.0f);
+            observerParams[i].eyeDirection = Vec3(0.0f, 1.0f, 0.0f);
+            visionMap.RegisterObserver(observerIDs[i], observerParams[i]);
+        }
+
+        observerParams[0].callback = functor(handler, &LostSightHandler::OnVisibilityChanged);
+        visionMap.ObserverChanged(observerIDs[0], observerParams[0], eChangedCallback);
+
+        DrainPVSUpdateQueue(*m_environment, visionMap);
+        const std::vector<uint32> allObservables = { lostID, unregisteredID, keptID };
+        ASSERT_EQ(allObservables, VisionMapUnitTestAccessor::GetPVS(visionMap, observerIDs[0]));
+        VisionMapUnitTestAccessor::SetVisible(visionMap, observerIDs[0], lostID);
+
+        // Queued one per frame while nothing is updated, the first observer moving out of sight of every observable
+        m_environment->SetPVSUpdates(0);
+        observerParams[0].eyePosition = Vec3(0.0f, -1000.0f, 0.0f);
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(observerIDs); ++i)
+        {
+            observerParams[i].eyePosition.z += 1.0f;
+            visionMap.ObserverChanged(observerIDs[i], observerParams[i], eChangedPosition);
+            m_environment->RunFrame(visionMap);
+        }
+
+        const std::vector<uint32> queue = { observerIDs[0], observerIDs[1], observerIDs[2], observerIDs[3] };
+        ASSERT_EQ(queue, VisionMapUnitTestAccessor::GetPVSUpdateQueue(visionMap));
+
+        // The first three observers are updated this frame, all of them leave the queue before the first callback
+        m_environment->SetPVSUpdates(3);
+        m_environment->RunFrame(visionMap);
+
+        EXPECT_EQ(1, handler.m_callCount);
+        EXPECT_EQ(static_cast<uint32>(lostID), handler.m_lostObservableID);
+        EXPECT_FALSE(handler.m_visible);
+        EXPECT_EQ(std::vector<uint32>(1, observerIDs[3]), handler.m_queueWhenCalled);
+
+        EXPECT_EQ(nullptr, visionMap.GetObservableParams(unregisteredID));
+        EXPECT_EQ(nullptr, visionMap.GetObserverParams(observerIDs[2]));
+        EXPECT_FALSE(visionMap.IsVisible(observerIDs[0], lostID));
+        EXPECT_TRUE(VisionMapUnitTestAccessor::GetPVS(visionMap, observerIDs[0]).empty());
+
+        // The second observer resolved the unregistered observable before the callback, it isn't added back
+        const std::vector<uint32> remainingObservables = { lostID, keptID };
+        EXPECT_EQ(remainingObservables, VisionMapUnitTestAccessor::GetPVS(visionMap, observerIDs[1]));
+        EXPECT_EQ(std::vector<uint32>(1, observerIDs[3]), VisionMapUnitTestAccessor::GetPVSUpdateQueue(visionMap));
+
+        m_environment->RunFrame(visionMap);
+        EXPECT_EQ(0u, VisionMapUnitTestAccessor::GetPVSUpdateQueueSize(visionMap));
+        EXPECT_EQ(remainingObservables, VisionMapUnitTestAccessor::GetPVS(visionMap, observerIDs[3]));
+    }
+
+#ifdef HAVE_BENCHMARK
+    class VisionMapObservableStoreBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_environment = new ScopedVisionMapEnvironment();
+            m_world = new TestWorld(ObserverCount, ObservableCount, 6);
+
+            m_movedParams.resize(ObserverCount);
+            for (size_t i = 0; i < ObserverCount; ++i)
+            {
+                m_movedParams[i] = m_world->CreateObserverParams();
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_movedParams = std::vector<ObserverParams>();
+            delete m_world;
+            delete m_environment;
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        ScopedVisionMapEnvironment* m_environment;
+        TestWorld* m_world;
+        std::vector<ObserverParams> m_movedParams;
+    };
+
+    // Time to drain the PVS update queue of a vision map after every observer moved, as many observers updated per frame
+    // as the argument, with the number of frames it took and how long the last observer waited
+    BENCHMARK_DEFINE_F(VisionMapObservableStoreBenchmarkFixture, BM_DrainPVSUpdateQueue)(benchmark::State& state)
+    {
+        m_environment->SetPVSUpdates(static_cast<int>(state.range(0)));
+
+        CVisionMap visionMap;
+        RegisterWorld(*m_world, visionMap);
+        DrainPVSUpdateQueue(*m_environment, visionMap);
+
+        bool moved = false;
+        size_t frameCount = 0;
+
+        for (auto _ : state)
+        {
+            moved = !moved;
+            MoveObservers(visionMap, m_world->m_observerIDs, moved ? m_movedParams : m_world->m_observerParams);
+            frameCount = DrainPVSUpdateQueue(*m_environment, visionMap);
+        }
+
+        state.counters["QueueLatencyFrames"] = static_cast<double>(frameCount);
+#if VISIONMAP_DEBUG
+        state.counters["QueueLatencySeconds"] = VisionMapUnitTestAccessor::GetPVSUpdateQueueLatency(visionMap);
+#endif
+        state.SetItemsProcessed(state.iterations() * ObserverCount);
+    }
+
+    BENCHMARK_REGISTER_F(VisionMapObservableStoreBenchmarkFixture, BM_DrainPVSUpdateQueue)
+        ->Arg(16)
+        ->Arg(32)
+        ->Arg(64)
+        ->Unit(benchmark::kMillisecond);
+#endif
+}
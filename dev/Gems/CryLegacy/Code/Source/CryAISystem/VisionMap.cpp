@@ -69,7 +69,7 @@ void CVisionMap::Reset()
 
     m_observers.clear();
 
-    m_observablesGrid.clear();
+    m_observableStore.Clear();
     m_observables.clear();
 
     m_observerPVSUpdateQueue.clear();
@@ -144,7 +144,7 @@ void CVisionMap::RegisterObservable(const ObservableID& observableID, const Obse
     AZStd::pair<Observables::iterator, bool> result = m_observables.insert(Observables::value_type(observableID, ObservableInfo(observableID, ObservableParams())));
 
     ObservableInfo& insertedObservableInfo = result.first->second;
-    m_observablesGrid.insert(insertedObservableInfo.observableParams.observablePositions[0], &insertedObservableInfo);
+    m_observableStore.Add(observableID, insertedObservableInfo.observableParams);
 
     ObservableChanged(observableID, observerParams, eChangedAll);
 
@@ -204,7 +204,7 @@ void CVisionMap::UnregisterObservable(const ObservableID& observableID)
         observerInfo.pvs.erase(pvsIt);
     }
 
-    m_observablesGrid.erase(observableInfo.observableParams.observablePositions[0], &observableInfo);
+    m_observableStore.Remove(observableID);
     m_observables.erase(observableIt);
 }
 
@@ -354,10 +354,7 @@ void CVisionMap::ObservableChanged(const ObservableID& observableID, const Obser
 
         if (!IsEquivalent(oldPosition, newObservableParams.observablePositions[0], positionEpsilon))
         {
-            FRAME_PROFILER("CVisionMap::ObservableChanged_UpdateHashGrid", GetISystem(), PROFILE_AI);
-
             currentObservableParams.observablePositions[0] = newObservableParams.observablePositions[0];
-            m_observablesGrid.move(m_observablesGrid.find(oldPosition, &observableInfo), newObservableParams.observablePositions[0]);
             observableVisibilityPotentiallyChanged = true;
 
             currentObservableParams.observablePositionsCount = newObservableParams.observablePositionsCount;
@@ -427,6 +424,8 @@ void CVisionMap::ObservableChanged(const ObservableID& observableID, const Obser
     {
         FRAME_PROFILER("CVisionMap::ObservableChanged_VisibilityChanged", GetISystem(), PROFILE_AI);
 
+        m_observableStore.Update(observableID, currentObservableParams);
+
         CTimeValue now = gEnv->pTimer->GetFrameStartTime();
 
         for (Observers::iterator observersIt = m_observers.begin(), end = m_observers.end(); observersIt != end; ++observersIt)
@@ -538,63 +537,9 @@ void CVisionMap::Update(float frameTime)
     UpdateObservers();
 }
 
-bool CVisionMap::IsInSightRange(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const
-{
-    if (observerInfo.observerParams.sightRange <= 0.0f)
-    {
-        return true;
-    }
-
-    const float distance = (observableInfo.observableParams.observablePositions[0] - observerInfo.observerParams.eyePosition).len();
-    return distance <= observerInfo.observerParams.sightRange;
-}
-
-bool CVisionMap::IsInFoV(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const
-{
-    if (observerInfo.observerParams.fovCos <= -1.0f)
-    {
-        return true;
-    }
-
-    for (int i = 0; i < observableInfo.observableParams.observablePositionsCount; i++)
-    {
-        Vec3 directionToObservablePosition = (observableInfo.observableParams.observablePositions[i] - observerInfo.observerParams.eyePosition);
-        directionToObservablePosition.NormalizeFast();
-        const float dot = directionToObservablePosition.Dot(observerInfo.observerParams.eyeDirection);
-        if (observerInfo.observerParams.fovCos <= dot)
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
-
 bool CVisionMap::ShouldObserve(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const
 {
-    const bool matchesType = ((observerInfo.observerParams.typesToObserveMask & observableInfo.observableParams.typeMask) != 0);
-    if (!matchesType)
-    {
-        return false;
-    }
-
-    const bool matchesFaction = ((observerInfo.observerParams.factionsToObserveMask & (1 << observableInfo.observableParams.faction)) != 0);
-    if (!matchesFaction)
-    {
-        return false;
-    }
-
-    if (!IsInSightRange(observerInfo, observableInfo))
-    {
-        return false;
-    }
-
-    if (!IsInFoV(observerInfo, observableInfo))
-    {
-        return false;
-    }
-
-    return true;
+    return CVisionMapObservableStore::ShouldObserve(observerInfo.observerParams, observableInfo.observableParams);
 }
 
 RayCastRequest::Priority CVisionMap::GetRayCastRequestPriority(const ObserverParams& observerParams, const ObservableParams& observableParams)
@@ -652,10 +597,75 @@ void CVisionMap::AddToObserverPVS(ObserverInfo& observerInfo, const ObservableIn
     assert(result.second);
 }
 
-void CVisionMap::UpdatePVS(ObserverInfo& observerInfo)
+void CVisionMap::UpdatePVS(const CTimeValue& now)
 {
     FUNCTION_PROFILER(GetISystem(), PROFILE_AI);
 
+    const size_t updateCount = std::min<size_t>(m_observerPVSUpdateQueue.size(), std::max<int>(gAIEnv.CVars.VisionMapNumberOfPVSUpdatesPerFrame, 0));
+    if (!updateCount)
+    {
+        return;
+    }
+
+    m_pvsUpdateObserverIDs.resize(updateCount);
+    m_pvsQueries.resize(updateCount);
+    m_pvsObserved.resize(updateCount);
+
+    for (size_t i = 0; i < updateCount; ++i)
+    {
+        const ObserverInfo& observerInfo = m_observers.find(m_observerPVSUpdateQueue[i])->second;
+
+        m_pvsUpdateObserverIDs[i] = observerInfo.observerID;
+        m_pvsQueries[i].observerParams = &observerInfo.observerParams;
+        m_pvsQueries[i].observerID = observerInfo.observerID;
+    }
+
+    {
+        FRAME_PROFILER("UpdatePVS_FindObserved", GetISystem(), PROFILE_AI);
+
+        m_observableStore.FindObserved(&m_pvsQueries[0], updateCount);
+    }
+
+    // The callbacks triggered while applying the PVS can register and unregister observers and observables,
+    // the observers leave the queue and their results are resolved to observable ids before any of them runs
+    for (size_t i = 0; i < updateCount; ++i)
+    {
+        const std::vector<CVisionMapObservableStore::Index>& indices = m_pvsQueries[i].observed;
+        std::vector<ObservableID>& observed = m_pvsObserved[i];
+
+        observed.clear();
+        observed.reserve(indices.size());
+        for (size_t j = 0; j < indices.size(); ++j)
+        {
+            observed.push_back(m_observableStore.GetObservableID(indices[j]));
+        }
+
+        m_observers.find(m_observerPVSUpdateQueue.front())->second.queuedForPVSUpdate = false;
+        m_observerPVSUpdateQueue.pop_front();
+    }
+
+    // Applied in queue order, the PVS changes and the rays later queued for them match the queue order
+    for (size_t i = 0; i < updateCount; ++i)
+    {
+        Observers::iterator observerIt = m_observers.find(m_pvsUpdateObserverIDs[i]);
+        if (observerIt == m_observers.end())
+        {
+            continue;
+        }
+
+        ObserverInfo& observerInfo = observerIt->second;
+
+        ApplyPVS(observerInfo, m_pvsObserved[i]);
+        observerInfo.needsPVSUpdate = false;
+
+#if VISIONMAP_DEBUG
+        m_pvsUpdateQueueLatency = now - observerInfo.queuedForPVSUpdateTime;
+#endif
+    }
+}
+
+void CVisionMap::ApplyPVS(ObserverInfo& observerInfo, const std::vector<ObservableID>& observed)
+{
 #if VISIONMAP_DEBUG
     ++m_numberOfPVSUpdatesThisFrame;
 #endif
@@ -665,70 +675,72 @@ void CVisionMap::UpdatePVS(ObserverInfo& observerInfo)
     // Step1:
     // - Make sure everything in the PVS is in supposed to be there
     // - Delete what it's not
+    // The callbacks can unregister observables, erasing their entries from this PVS, so the entries to delete are
+    // gathered first and looked up again before and after their callbacks
     {
         FRAME_PROFILER("UpdatePVS_Step1", GetISystem(), PROFILE_AI);
 
-        for (PVS::iterator pvsIt = pvs.begin(), end = pvs.end(); pvsIt != end; )
+        m_pvsRemoved.clear();
+        for (PVS::iterator pvsIt = pvs.begin(), end = pvs.end(); pvsIt != end; ++pvsIt)
+        {
+            if (!std::binary_search(observed.begin(), observed.end(), pvsIt->first))
+            {
+                m_pvsRemoved.push_back(pvsIt->first);
+            }
+        }
+
+        for (size_t i = 0; i < m_pvsRemoved.size(); ++i)
         {
-            const ObservableID& observableID = pvsIt->first;
-            const ObservableInfo& observableInfo = pvsIt->second.observableInfo;
+            PVS::iterator pvsIt = pvs.find(m_pvsRemoved[i]);
+            if (pvsIt == pvs.end())
+            {
+                continue;
+            }
 
-            if (!ShouldObserve(observerInfo, observableInfo))
+            // Not visible anymore by the time the callbacks run, unregistering the observable doesn't report it twice
+            if (pvsIt->second.visible)
             {
-                PVSEntry& pvsEntry = pvsIt->second;
-                PVS::iterator nextIt = pvsIt;
-                ++nextIt;
+                pvsIt->second.visible = false;
+                TriggerObserverCallback(observerInfo, pvsIt->second.observableInfo, false);
 
-                if (pvsEntry.visible)
+                pvsIt = pvs.find(m_pvsRemoved[i]);
+                if (pvsIt == pvs.end())
                 {
-                    TriggerObserverCallback(observerInfo, observableInfo, false);
-                    TriggerObservableCallback(observerInfo, observableInfo, false);
+                    continue;
                 }
 
-                DeletePendingRay(pvsEntry);
-
-                pvs.erase(pvsIt);
-                pvsIt = nextIt;
+                TriggerObservableCallback(observerInfo, pvsIt->second.observableInfo, false);
 
-                continue;
+                pvsIt = pvs.find(m_pvsRemoved[i]);
+                if (pvsIt == pvs.end())
+                {
+                    continue;
+                }
             }
 
-            ++pvsIt;
+            DeletePendingRay(pvsIt->second);
+            pvs.erase(pvsIt);
         }
     }
 
     // Step2:
-    // - Go through all objects in range
+    // - Go through all objects the observer should observe
     // - If object is already in the PVS skip it
-    // - Otherwise check if it should be added and add it
+    // - Otherwise add it, unless it was unregistered in the meantime
     {
         FRAME_PROFILER("UpdatePVS_Step2", GetISystem(), PROFILE_AI);
 
-        if (observerInfo.observerParams.sightRange > 0.0f)
+        for (std::vector<ObservableID>::const_iterator it = observed.begin(), end = observed.end(); it != end; ++it)
         {
-            // the sight range is defined query the obsevableGrid
-            m_queryObservables.clear();
-            uint32 observableCount = m_observablesGrid.query_sphere_distance(observerInfo.observerParams.eyePosition, observerInfo.observerParams.sightRange, m_queryObservables);
-
-            for (QueryObservables::iterator it = m_queryObservables.begin(), end = m_queryObservables.end(); it != end; ++it)
+            if (pvs.find(*it) != pvs.end())
             {
-                const ObservableInfo& observableInfo = *it->second;
-                if (ShouldBeAddedToObserverPVS(observerInfo, observableInfo))
-                {
-                    AddToObserverPVS(observerInfo, observableInfo);
-                }
+                continue;
             }
-        }
-        else
-        {
-            // the sight range is unlimited check all observables
-            for (Observables::iterator it = m_observables.begin(), end = m_observables.end(); it != end; ++it)
+
+            Observables::iterator observableIt = m_observables.find(*it);
+            if (observableIt != m_observables.end())
             {
-                ObservableInfo& observableInfo = it->second;
-                if (ShouldBeAddedToObserverPVS(observerInfo, observableInfo))
-                {
-                    AddToObserverPVS(observerInfo, observableInfo);
-                }
+                AddToObserverPVS(observerInfo, observableIt->second);
             }
         }
     }
@@ -1005,24 +1017,7 @@ void CVisionMap::UpdateObservers()
         }
     }
 
-    int numberOfPVSUpdatesLeft = gAIEnv.CVars.VisionMapNumberOfPVSUpdatesPerFrame;
-    while (numberOfPVSUpdatesLeft > 0 && m_observerPVSUpdateQueue.size() > 0)
-    {
-        Observers::iterator observerIt = m_observers.find(m_observerPVSUpdateQueue.front());
-        ObserverInfo& observerInfo = observerIt->second;
-
-        UpdatePVS(observerInfo);
-        observerInfo.needsPVSUpdate = false;
-
-        m_observerPVSUpdateQueue.pop_front();
-        observerInfo.queuedForPVSUpdate = false;
-
-        numberOfPVSUpdatesLeft--;
-
-#if VISIONMAP_DEBUG
-        m_pvsUpdateQueueLatency = now - observerInfo.queuedForPVSUpdateTime;
-#endif
-    }
+    UpdatePVS(now);
 
     // Update Visibility /////////////////////////////////////////////////////
     for (Observers::iterator it = m_observers.begin(), end = m_observers.end(); it != end; ++it)
@@ -19,10 +19,10 @@
 
 #include <IVisionMap.h>
 
-#include <HashGrid.h>
-
 #include <RayCastQueue.h>
 
+#include "VisionMapObservableStore.h"
+
 #ifdef CRYAISYSTEM_DEBUG
 #define VISIONMAP_DEBUG 1
 #endif
@@ -62,6 +62,10 @@ public:
 #endif
 
 private:
+#if defined(AZ_TESTS_ENABLED)
+    friend class VisionMapUnitTestAccessor;
+#endif
+
     struct ObservableInfo
     {
         ObservableInfo(const ObservableID& _observableID, const ObservableParams& _observableParams)
@@ -72,15 +76,6 @@ private:
         ObservableParams observableParams;
     };
 
-    struct ObservablePosition
-    {
-        inline Vec3 operator()(const ObservableInfo* observableInfo) const
-        {
-            return observableInfo->observableParams.observablePositions[0];
-        }
-    };
-
-    typedef hash_grid<256, ObservableInfo*, hash_grid_2d<Vec3, Vec3i>, ObservablePosition> ObservablesGrid;
     typedef AZStd::unordered_map<ObservableID, ObservableInfo, stl::hash_uint32> Observables;
 
     struct PVSEntry
@@ -188,15 +183,14 @@ private:
     void AddToObserverPVS(ObserverInfo& observerInfo, const ObservableInfo& observableInfo);
 
     void UpdateObservers();
-    void UpdatePVS(ObserverInfo& observerInfo);
+    void UpdatePVS(const CTimeValue& now);
+    void ApplyPVS(ObserverInfo& observerInfo, const std::vector<ObservableID>& observed);
 
     bool ShouldBeAddedToObserverPVS(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
 
     void UpdateVisibilityStatus(ObserverInfo& observerInfo);
 
     bool ShouldObserve(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
-    bool IsInSightRange(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
-    bool IsInFoV(const ObserverInfo& observerInfo, const ObservableInfo& observableInfo) const;
 
     void QueueRay(const ObserverInfo& observerInfo, PVSEntry& pvsEntry);
     bool RayCastSubmit(const QueuedRayID& queuedRayID, RayCastRequest& request);
@@ -211,14 +205,18 @@ private:
 
     Observers    m_observers;
     Observables m_observables;
-    ObservablesGrid m_observablesGrid;
+    CVisionMapObservableStore m_observableStore;
 
     typedef std::deque<ObserverID> ObserverQueue;
     ObserverQueue m_observerPVSUpdateQueue;
     ObserverQueue m_observerVisibilityUpdateQueue;
 
-    typedef std::vector<std::pair<float, ObservableInfo*> > QueryObservables;
-    QueryObservables m_queryObservables;
+    // Scratch memory of the PVS updates of a frame, one element per updated observer
+    std::vector<ObserverID> m_pvsUpdateObserverIDs;
+    std::vector<CVisionMapObservableStore::Query> m_pvsQueries;
+    std::vector<std::vector<ObservableID> > m_pvsObserved;
+    // The observables leaving the PVS of the observer being applied
+    std::vector<ObservableID> m_pvsRemoved;
 
     typedef std::map<QueuedRayID, PendingRayInfo> PendingRays;
     PendingRays m_pendingRays;
@@ -0,0 +1,287 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "CryLegacy_precompiled.h"
+#include "VisionMapObservableStore.h"
+
+namespace
+{
+    inline bool IsOffsetInSightRange(const ObserverParams& observerParams, float dx, float dy, float dz)
+    {
+        if (observerParams.sightRange <= 0.0f)
+        {
+            return true;
+        }
+
+        const float distanceSq = dx * dx + dy * dy + dz * dz;
+        return distanceSq <= observerParams.sightRange * observerParams.sightRange;
+    }
+
+    // The cosine is scaled by the distance instead of normalizing the direction to the observable
+    inline bool IsOffsetInFoV(const ObserverParams& observerParams, float dx, float dy, float dz)
+    {
+        const Vec3& eyeDirection = observerParams.eyeDirection;
+        const float dot = dx * eyeDirection.x + dy * eyeDirection.y + dz * eyeDirection.z;
+        const float distance = sqrtf(dx * dx + dy * dy + dz * dz);
+        return observerParams.fovCos * distance <= dot;
+    }
+}
+
+CVisionMapObservableStore::CVisionMapObservableStore()
+    : m_grid(20.0f, 20.0f, 20.0f, IndexPosition(this))
+{
+}
+
+void CVisionMapObservableStore::Add(const ObservableID& observableID, const ObservableParams& observableParams)
+{
+    Indices::iterator it = m_indices.find(observableID);
+    if (it != m_indices.end())
+    {
+        Update(observableID, observableParams);
+        return;
+    }
+
+    const Index index = static_cast<Index>(m_observableIDs.size());
+    m_indices.insert(Indices::value_type(observableID, index));
+    m_observableIDs.push_back(observableID);
+
+    Resize(m_observableIDs.size());
+    Write(index, observableID, observableParams);
+    m_grid.insert(GetPosition(index), index);
+}
+
+void CVisionMapObservableStore::Update(const ObservableID& observableID, const ObservableParams& observableParams)
+{
+    Indices::iterator it = m_indices.find(observableID);
+    assert(it != m_indices.end());
+    if (it != m_indices.end())
+    {
+        const Index index = it->second;
+        const IndicesGrid::iterator gridIt = m_grid.find(GetPosition(index), index);
+        assert(gridIt != m_grid.end());
+
+        Write(index, observableID, observableParams);
+        m_grid.move(gridIt, GetPosition(index));
+    }
+}
+
+void CVisionMapObservableStore::Remove(const ObservableID& observableID)
+{
+    Indices::iterator it = m_indices.find(observableID);
+    if (it == m_indices.end())
+    {
+        return;
+    }
+
+    // The last observable takes the place of the removed one
+    const Index index = it->second;
+    const Index lastIndex = static_cast<Index>(m_observableIDs.size() - 1);
+    m_indices.erase(it);
+    m_grid.erase(GetPosition(index), index);
+
+    if (index != lastIndex)
+    {
+        m_grid.erase(GetPosition(lastIndex), lastIndex);
+
+        m_observableIDs[index] = m_observableIDs[lastIndex];
+        m_ids[index] = m_ids[lastIndex];
+        m_typeMasks[index] = m_typeMasks[lastIndex];
+        m_factionBits[index] = m_factionBits[lastIndex];
+
+        for (size_t p = 0; p < ObservableParams::MaxPositionCount; ++p)
+        {
+            m_positionsX[p][index] = m_positionsX[p][lastIndex];
+            m_positionsY[p][index] = m_positionsY[p][lastIndex];
+            m_positionsZ[p][index] = m_positionsZ[p][lastIndex];
+        }
+
+        m_indices[m_ids[index]] = index;
+        m_grid.insert(GetPosition(index), index);
+    }
+
+    m_observableIDs.pop_back();
+    Resize(m_observableIDs.size());
+}
+
+void CVisionMapObservableStore::Clear()
+{
+    m_indices.clear();
+    m_grid.clear();
+    m_observableIDs.clear();
+    m_ids.clear();
+    m_typeMasks.clear();
+    m_factionBits.clear();
+
+    for (size_t p = 0; p < ObservableParams::MaxPositionCount; ++p)
+    {
+        m_positionsX[p].clear();
+        m_positionsY[p].clear();
+        m_positionsZ[p].clear();
+    }
+}
+
+bool CVisionMapObservableStore::Contains(const std::vector<Index>& observed, const ObservableID& observableID) const
+{
+    const uint32 id = observableID;
+    std::vector<Index>::const_iterator it = std::lower_bound(observed.begin(), observed.end(), id,
+            [this](Index index, uint32 value) { return m_ids[index] < value; });
+
+    return (it != observed.end()) && (m_ids[*it] == id);
+}
+
+void CVisionMapObservableStore::FindObserved(Query& query) const
+{
+    FindObserved(&query, 1);
+}
+
+void CVisionMapObservableStore::FindObserved(Query* queries, size_t queryCount) const
+{
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        Query& query = queries[q];
+        const ObserverParams& observerParams = *query.observerParams;
+        query.observed.clear();
+
+        if (observerParams.sightRange > 0.0f)
+        {
+            // Only the observables of the cells the sight range overlaps are filtered
+            m_candidates.clear();
+            m_grid.query_sphere(observerParams.eyePosition, observerParams.sightRange, m_candidates);
+
+            for (size_t i = 0; i < m_candidates.size(); ++i)
+            {
+                if (IsObserved(query, m_candidates[i]))
+                {
+                    query.observed.push_back(m_candidates[i]);
+                }
+            }
+        }
+        else
+        {
+            const Index count = static_cast<Index>(m_ids.size());
+            for (Index i = 0; i < count; ++i)
+            {
+                if (IsObserved(query, i))
+                {
+                    query.observed.push_back(i);
+                }
+            }
+        }
+
+        std::sort(query.observed.begin(), query.observed.end(),
+            [this](Index lhs, Index rhs) { return m_ids[lhs] < m_ids[rhs]; });
+    }
+}
+
+bool CVisionMapObservableStore::ShouldObserve(const ObserverParams& observerParams, const ObservableParams& observableParams)
+{
+    if (!(observerParams.typesToObserveMask & observableParams.typeMask))
+    {
+        return false;
+    }
+
+    if (!(observerParams.factionsToObserveMask & GetFactionBit(observableParams.faction)))
+    {
+        return false;
+    }
+
+    return IsInSightRange(observerParams, observableParams.observablePositions[0]) && IsInFoV(observerParams, observableParams);
+}
+
+bool CVisionMapObservableStore::IsInSightRange(const ObserverParams& observerParams, const Vec3& observablePosition)
+{
+    const Vec3& eyePosition = observerParams.eyePosition;
+    return IsOffsetInSightRange(observerParams, observablePosition.x - eyePosition.x, observablePosition.y - eyePosition.y, observablePosition.z - eyePosition.z);
+}
+
+bool CVisionMapObservableStore::IsInFoV(const ObserverParams& observerParams, const ObservableParams& observableParams)
+{
+    if (observerParams.fovCos <= -1.0f)
+    {
+        return true;
+    }
+
+    // An observable without positions is seen at its first one, as the store keeps at least one position per observable
+    const int positionCount = std::max<int>(observableParams.observablePositionsCount, 1);
+    const Vec3& eyePosition = observerParams.eyePosition;
+    for (int i = 0; i < positionCount; ++i)
+    {
+        const Vec3& observablePosition = observableParams.observablePositions[i];
+        if (IsOffsetInFoV(observerParams, observablePosition.x - eyePosition.x, observablePosition.y - eyePosition.y, observablePosition.z - eyePosition.z))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CVisionMapObservableStore::Write(Index index, const ObservableID& observableID, const ObservableParams& observableParams)
+{
+    m_ids[index] = observableID;
+    m_typeMasks[index] = observableParams.typeMask;
+    m_factionBits[index] = GetFactionBit(observableParams.faction);
+
+    const int positionCount = std::max<int>(observableParams.observablePositionsCount, 1);
+    for (int p = 0; p < ObservableParams::MaxPositionCount; ++p)
+    {
+        const Vec3& position = observableParams.observablePositions[(p < positionCount) ? p : 0];
+        m_positionsX[p][index] = position.x;
+        m_positionsY[p][index] = position.y;
+        m_positionsZ[p][index] = position.z;
+    }
+}
+
+void CVisionMapObservableStore::Resize(size_t count)
+{
+    m_ids.resize(count, 0);
+    m_typeMasks.resize(count, 0);
+    m_factionBits.resize(count, 0);
+
+    for (size_t p = 0; p < ObservableParams::MaxPositionCount; ++p)
+    {
+        m_positionsX[p].resize(count, 0.0f);
+        m_positionsY[p].resize(count, 0.0f);
+        m_positionsZ[p].resize(count, 0.0f);
+    }
+}
+
+bool CVisionMapObservableStore::IsObserved(const Query& query, Index index) const
+{
+    const ObserverParams& observerParams = *query.observerParams;
+
+    if (!(m_typeMasks[index] & observerParams.typesToObserveMask) || !(m_factionBits[index] & observerParams.factionsToObserveMask) || (m_ids[index] == query.observerID))
+    {
+        return false;
+    }
+
+    const Vec3& eyePosition = observerParams.eyePosition;
+    if (!IsOffsetInSightRange(observerParams, m_positionsX[0][index] - eyePosition.x, m_positionsY[0][index] - eyePosition.y, m_positionsZ[0][index] - eyePosition.z))
+    {
+        return false;
+    }
+
+    if (observerParams.fovCos <= -1.0f)
+    {
+        return true;
+    }
+
+    for (size_t p = 0; p < ObservableParams::MaxPositionCount; ++p)
+    {
+        if (IsOffsetInFoV(observerParams, m_positionsX[p][index] - eyePosition.x, m_positionsY[p][index] - eyePosition.y, m_positionsZ[p][index] - eyePosition.z))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
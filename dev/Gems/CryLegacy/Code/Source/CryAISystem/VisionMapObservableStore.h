@@ -0,0 +1,128 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+// Description : Structure of arrays of the vision map observables, filtered against an observer's
+//               type, faction, sight range and field of view. Observers with a sight range only
+//               filter the observables of the grid cells their range overlaps.
+
+#ifndef CRYINCLUDE_CRYAISYSTEM_VISIONMAPOBSERVABLESTORE_H
+#define CRYINCLUDE_CRYAISYSTEM_VISIONMAPOBSERVABLESTORE_H
+#pragma once
+
+#include <IVisionMap.h>
+
+#include <HashGrid.h>
+
+class CVisionMapObservableStore
+{
+public:
+    typedef uint32 Index;
+
+    CVisionMapObservableStore();
+
+    struct Query
+    {
+        Query()
+            : observerParams(NULL)
+            , observerID(0)
+        {
+        }
+
+        const ObserverParams* observerParams;
+        uint32 observerID;
+
+        // Indices of the observables the observer should observe, in increasing observable id order
+        std::vector<Index> observed;
+    };
+
+    // Adds the observable, or updates it when it is already stored
+    void Add(const ObservableID& observableID, const ObservableParams& observableParams);
+    void Update(const ObservableID& observableID, const ObservableParams& observableParams);
+    void Remove(const ObservableID& observableID);
+    void Clear();
+
+    inline size_t GetCount() const
+    {
+        return m_observableIDs.size();
+    }
+
+    inline const ObservableID& GetObservableID(Index index) const
+    {
+        return m_observableIDs[index];
+    }
+
+    // Whether the result of a query holds the observable
+    bool Contains(const std::vector<Index>& observed, const ObservableID& observableID) const;
+
+    void FindObserved(Query& query) const;
+    void FindObserved(Query* queries, size_t queryCount) const;
+
+    static bool ShouldObserve(const ObserverParams& observerParams, const ObservableParams& observableParams);
+    static bool IsInSightRange(const ObserverParams& observerParams, const Vec3& observablePosition);
+    static bool IsInFoV(const ObserverParams& observerParams, const ObservableParams& observableParams);
+
+    // Factions past 31 wrap around, as a plain shift would on the platforms the masks were authored on
+    static inline uint32 GetFactionBit(uint8 faction)
+    {
+        return 1u << (faction & 31);
+    }
+
+private:
+    CVisionMapObservableStore(const CVisionMapObservableStore&);
+    CVisionMapObservableStore& operator=(const CVisionMapObservableStore&);
+
+    struct IndexPosition
+    {
+        IndexPosition(const CVisionMapObservableStore* _store = NULL)
+            : store(_store)
+        {
+        }
+
+        inline Vec3 operator()(Index index) const
+        {
+            return store->GetPosition(index);
+        }
+
+        const CVisionMapObservableStore* store;
+    };
+
+    // Observables by their first position, as the vision map kept them before the store
+    typedef hash_grid<256, Index, hash_grid_2d<Vec3, Vec3i>, IndexPosition> IndicesGrid;
+
+    inline Vec3 GetPosition(Index index) const
+    {
+        return Vec3(m_positionsX[0][index], m_positionsY[0][index], m_positionsZ[0][index]);
+    }
+
+    void Write(Index index, const ObservableID& observableID, const ObservableParams& observableParams);
+    void Resize(size_t count);
+    bool IsObserved(const Query& query, Index index) const;
+
+    typedef std::unordered_map<uint32, Index> Indices;
+    Indices m_indices;
+
+    IndicesGrid m_grid;
+    mutable std::vector<Index> m_candidates;
+
+    std::vector<ObservableID> m_observableIDs;
+
+    std::vector<uint32> m_ids;
+    std::vector<uint32> m_typeMasks;
+    std::vector<uint32> m_factionBits;
+
+    // Positions past an observable's position count repeat its first position
+    std::vector<float> m_positionsX[ObservableParams::MaxPositionCount];
+    std::vector<float> m_positionsY[ObservableParams::MaxPositionCount];
+    std::vector<float> m_positionsZ[ObservableParams::MaxPositionCount];
+};
+
+#endif // CRYINCLUDE_CRYAISYSTEM_VISIONMAPOBSERVABLESTORE_H
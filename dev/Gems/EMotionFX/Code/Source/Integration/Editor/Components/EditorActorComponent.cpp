@@ -238,6 +238,9 @@ namespace EMotionFX
 
             m_actorInstance = nullptr;
             m_renderActorInstance.reset();
+
+            AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+                GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -571,6 +574,10 @@ namespace EMotionFX
 
             // Send general mesh creation notification to interested parties.
             LmbrCentral::MeshComponentNotificationBus::Event(GetEntityId(), &LmbrCentral::MeshComponentNotifications::OnMeshCreated, m_actorAsset);
+
+            // the actor loads asynchronously, so its selection bounds change after activation
+            AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+                GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
         }
 
         void EditorActorComponent::InitializeMaterial(ActorAsset& actorAsset)
@@ -21,6 +21,8 @@
 #include <QGraphicsItem>
 #include <QGraphicsSceneEvent>
 #include <QGraphicsView>
+#include <QLineF>
+#include <QPainterPath>
 #include <QScreen>
 #include <QMimeData>
 
@@ -28,6 +30,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/EntityUtils.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/sort.h>
 
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
@@ -1060,6 +1063,13 @@ namespace GraphCanvas
         m_gestureSceneHelper.SetSceneId(GetEntityId());
 
         m_nudgingController.SetGraphId(GetEntityId());
+
+        m_spatialIndex.SetBoundsProvider([](const AZ::EntityId& memberId)
+        {
+            QGraphicsItem* item = nullptr;
+            SceneMemberUIRequestBus::EventResult(item, memberId, &SceneMemberUIRequests::GetRootGraphicsItem);
+            return item ? item->sceneBoundingRect() : QRectF();
+        });
         
         m_mimeDelegateSceneHelper.Activate();
         m_gestureSceneHelper.Activate();
@@ -1085,6 +1095,8 @@ namespace GraphCanvas
         DeactivateItems(m_graphData.m_bookmarkAnchors);
         DeactivateItems(AZStd::initializer_list<AZ::Entity*>{ AzToolsFramework::GetEntity(m_grid) });
         SceneMemberRequestBus::Event(m_grid, &SceneMemberRequests::ClearScene, GetEntityId());
+
+        m_spatialIndex.Clear();
     }
 
     void SceneComponent::OnSystemTick()
@@ -1533,6 +1545,7 @@ namespace GraphCanvas
             }
 
             UnregisterSelectionItem(nodeId);
+            m_spatialIndex.RemoveMember(nodeId);
             SceneNotificationBus::Event(GetEntityId(), &SceneNotifications::OnNodeRemoved, nodeId);
             SceneMemberRequestBus::Event(nodeId, &SceneMemberRequests::ClearScene, GetEntityId());
 
@@ -1700,6 +1713,7 @@ namespace GraphCanvas
             }
 
             UnregisterSelectionItem(connectionId);
+            m_spatialIndex.RemoveMember(connectionId);
 
             SceneNotificationBus::Event(GetEntityId(), &SceneNotifications::OnConnectionRemoved, connectionId);
             SlotRequestBus::Event(targetEndpoint.GetSlotId(), &SlotRequests::RemoveConnectionId, connectionId, sourceEndpoint);
@@ -1958,6 +1972,7 @@ namespace GraphCanvas
             }
 
             UnregisterSelectionItem(bookmarkAnchorId);
+            m_spatialIndex.RemoveMember(bookmarkAnchorId);
             SceneNotificationBus::Event(GetEntityId(), &SceneNotifications::OnSceneMemberRemoved, bookmarkAnchorId);
             SceneMemberRequestBus::Event(bookmarkAnchorId, &SceneMemberRequests::ClearScene, GetEntityId());
 
@@ -2829,7 +2844,7 @@ namespace GraphCanvas
         GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
         AZStd::vector<Endpoint> result;
 
-        AZStd::vector<AZ::EntityId> entitiesThere = GetEntitiesInRect(rect, Qt::ItemSelectionMode::IntersectsItemShape);
+        AZStd::vector<AZ::EntityId> entitiesThere = GetSceneMembersInRect(rect, Qt::ItemSelectionMode::IntersectsItemShape);
         for (AZ::EntityId nodeId : entitiesThere)
         {
             if (NodeRequestBus::FindFirstHandler(nodeId) != nullptr)
@@ -2860,6 +2875,73 @@ namespace GraphCanvas
         return result;
     }
 
+    AZStd::vector<AZ::EntityId> SceneComponent::GetSceneMembersInRect(const QRectF& rect, Qt::ItemSelectionMode mode) const
+    {
+        GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+        AZStd::vector<AZ::EntityId> result;
+        m_spatialIndex.FindInRect(rect, mode, result);
+
+        if (mode == Qt::ItemSelectionMode::IntersectsItemShape || mode == Qt::ItemSelectionMode::ContainsItemShape)
+        {
+            // The index only knows the bounding rects, the candidates it found are checked against their item's shape
+            // the same way the QGraphicsScene would.
+            QPainterPath scenePath;
+            scenePath.addRect(rect);
+
+            result.erase(AZStd::remove_if(result.begin(), result.end(), [&scenePath, mode](const AZ::EntityId& memberId)
+            {
+                QGraphicsItem* item = nullptr;
+                SceneMemberUIRequestBus::EventResult(item, memberId, &SceneMemberUIRequests::GetRootGraphicsItem);
+                return item == nullptr || !item->collidesWithPath(item->mapFromScene(scenePath), mode);
+            }), result.end());
+        }
+
+        return result;
+    }
+
+    AZStd::vector<AZ::EntityId> SceneComponent::GetSceneMembersAt(const QPointF& scenePoint) const
+    {
+        GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+        AZStd::vector<AZ::EntityId> result;
+        m_spatialIndex.FindAt(scenePoint, result);
+
+        return result;
+    }
+
+    Endpoint SceneComponent::FindNearestSlot(const QPointF& scenePoint, qreal maxDistance) const
+    {
+        GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+        Endpoint result;
+        qreal nearestDistance = maxDistance;
+
+        // Connection points are inside the bounds of their node, so nodes further than the nearest slot found can be skipped.
+        m_spatialIndex.FindNearest(scenePoint, maxDistance, [&](const AZ::EntityId& memberId, qreal)
+        {
+            if (NodeRequestBus::FindFirstHandler(memberId) != nullptr)
+            {
+                AZStd::vector<AZ::EntityId> slotIds;
+                NodeRequestBus::EventResult(slotIds, memberId, &NodeRequests::GetSlotIds);
+
+                for (const AZ::EntityId& slotId : slotIds)
+                {
+                    QPointF connectionPoint;
+                    SlotUIRequestBus::EventResult(connectionPoint, slotId, &SlotUIRequests::GetConnectionPoint);
+
+                    const qreal distance = QLineF(scenePoint, connectionPoint).length();
+                    if (distance <= nearestDistance)
+                    {
+                        nearestDistance = distance;
+                        result = Endpoint(memberId, slotId);
+                    }
+                }
+            }
+
+            return nearestDistance;
+        });
+
+        return result;
+    }
+
     void SceneComponent::RegisterView(const AZ::EntityId& viewId)
     {
         GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
@@ -3335,6 +3417,20 @@ namespace GraphCanvas
     void SceneComponent::OnPositionChanged(const AZ::EntityId& itemId, const AZ::Vector2& position)
     {
         GRAPH_CANVAS_DETAILED_PROFILE_FUNCTION();
+        m_spatialIndex.MoveMember(itemId, position);
+
+        // Wrapped nodes are moved with their wrapper without signalling it
+        if (GraphUtils::IsWrapperNode(itemId))
+        {
+            AZStd::vector<AZ::EntityId> wrappedNodes;
+            WrapperNodeRequestBus::EventResult(wrappedNodes, itemId, &WrapperNodeRequests::GetWrappedNodeIds);
+
+            for (const AZ::EntityId& wrappedNode : wrappedNodes)
+            {
+                m_spatialIndex.DirtyMember(wrappedNode);
+            }
+        }
+
         if (m_pressedEntity.IsValid())
         {
             if (!m_isDraggingEntity)
@@ -3475,6 +3571,16 @@ namespace GraphCanvas
         }
     }
 
+    void SceneComponent::OnBoundsChanged()
+    {
+        const AZ::EntityId* memberId = GeometryNotificationBus::GetCurrentBusId();
+
+        if (memberId)
+        {
+            m_spatialIndex.DirtyMember(*memberId);
+        }
+    }
+
     void SceneComponent::OnViewParamsChanged(const ViewParams& viewParams)
     {
         m_genericAddOffset.setX(0);
@@ -3638,6 +3744,7 @@ namespace GraphCanvas
                 if (entity->GetState() == AZ::Entity::ES_ACTIVE)
                 {
                     GeometryNotificationBus::MultiHandler::BusDisconnect(entity->GetId());
+                    m_spatialIndex.RemoveMember(entity->GetId());
                     QGraphicsItem* item = nullptr;
                     SceneMemberUIRequestBus::EventResult(item, entity->GetId(), &SceneMemberUIRequests::GetRootGraphicsItem);
                     SceneMemberRequestBus::Event(entity->GetId(), &SceneMemberRequests::ClearScene, GetEntityId());
@@ -3742,6 +3849,28 @@ namespace GraphCanvas
             {
                 GeometryRequestBus::Event(sceneMemberId, &GeometryRequests::SetPosition, position);
             }
+
+            if (sceneMemberId != m_grid)
+            {
+                AZ::Vector2 memberPosition;
+                GeometryRequestBus::EventResult(memberPosition, sceneMemberId, &GeometryRequests::GetPosition);
+                m_spatialIndex.AddMember(sceneMemberId, graphicsItem->sceneBoundingRect(), memberPosition);
+
+                // The item can still have a layout pending, read its bounds again before the next query.
+                m_spatialIndex.DirtyMember(sceneMemberId);
+
+                // Connections are moved by the nodes they connect, not through their own position.
+                if (ConnectionRequestBus::FindFirstHandler(sceneMemberId) != nullptr)
+                {
+                    Endpoint sourceEndpoint;
+                    ConnectionRequestBus::EventResult(sourceEndpoint, sceneMemberId, &ConnectionRequests::GetSourceEndpoint);
+                    Endpoint targetEndpoint;
+                    ConnectionRequestBus::EventResult(targetEndpoint, sceneMemberId, &ConnectionRequests::GetTargetEndpoint);
+
+                    m_spatialIndex.AddDependent(sourceEndpoint.GetNodeId(), sceneMemberId);
+                    m_spatialIndex.AddDependent(targetEndpoint.GetNodeId(), sceneMemberId);
+                }
+            }
             
             SceneMemberRequestBus::Event(sceneMemberId, &SceneMemberRequests::SetScene, GetEntityId());
 
@@ -36,6 +36,7 @@
 #include <GraphCanvas/Utils/StateControllers/StateController.h>
 #include <GraphCanvas/Utils/GraphUtils.h>
 #include <GraphCanvas/Utils/NodeNudgingController.h>
+#include <GraphCanvas/Utils/SceneSpatialIndex.h>
 
 class QAction;
 class QMimeData;
@@ -449,6 +450,10 @@ namespace GraphCanvas
 
         AZStd::vector<Endpoint> GetEndpointsInRect(const QRectF& rect) const override;
 
+        AZStd::vector<AZ::EntityId> GetSceneMembersInRect(const QRectF& rect, Qt::ItemSelectionMode mode) const override;
+        AZStd::vector<AZ::EntityId> GetSceneMembersAt(const QPointF& scenePoint) const override;
+        Endpoint FindNearestSlot(const QPointF& scenePoint, qreal maxDistance) const override;
+
         void RegisterView(const AZ::EntityId& viewId) override;
         void RemoveView(const AZ::EntityId& viewId) override;
         ViewId GetViewId() const override;
@@ -496,6 +501,7 @@ namespace GraphCanvas
 
         // GeometryNotificationBus
         void OnPositionChanged(const AZ::EntityId& itemId, const AZ::Vector2& position) override;
+        void OnBoundsChanged() override;
         ////
 
         // ViewNotificationBus
@@ -576,6 +582,9 @@ namespace GraphCanvas
         AZ::EntityId m_grid;
         AZStd::unordered_map<QGraphicsItem*, AZ::EntityId> m_itemLookup;
 
+        // Queries run on it from const requests refresh the bounds of the members that changed
+        mutable SceneSpatialIndex m_spatialIndex;
+
         ViewId m_viewId;
         ViewParams m_viewParams;
 
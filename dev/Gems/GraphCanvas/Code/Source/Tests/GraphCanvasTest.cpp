@@ -12,6 +12,17 @@
 #include "precompiled.h"
 #include <AzTest/AzTest.h>
 
+#include <limits>
+
+#include <QtMath>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <GraphCanvas/Utils/SceneSpatialIndex.h>
+
 class GraphCanvasTest
     : public ::testing::Test
 {
@@ -22,4 +33,365 @@ TEST_F(GraphCanvasTest, Sanity_Pass)
     EXPECT_TRUE(1 == 1);
 }
 
+namespace
+{
+    // Headless graph model: node bounds are kept here instead of in QGraphicsItems, the index reads them back
+    // through its bounds provider like the scene does.
+    class SpatialIndexGraph
+    {
+    public:
+        void Populate(int numNodes, AZ::u64 seed)
+        {
+            m_random.SetSeed(seed);
+
+            m_index.Clear();
+            m_bounds.clear();
+            m_index.SetBoundsProvider([this](const AZ::EntityId& memberId) { return m_bounds[memberId]; });
+
+            for (int i = 0; i < numNodes; ++i)
+            {
+                AddNode(AZ::EntityId(i + 1));
+            }
+        }
+
+        void AddNode(const AZ::EntityId& nodeId)
+        {
+            QRectF bounds(RandomCoordinate(), RandomCoordinate(), 50 + RandomInt(250), 30 + RandomInt(200));
+            m_bounds[nodeId] = bounds;
+            m_index.AddMember(nodeId, bounds, AZ::Vector2(static_cast<float>(bounds.x()), static_cast<float>(bounds.y())));
+        }
+
+        void MoveNode(const AZ::EntityId& nodeId, qreal deltaX, qreal deltaY)
+        {
+            QRectF& bounds = m_bounds[nodeId];
+            bounds.translate(deltaX, deltaY);
+            m_index.MoveMember(nodeId, AZ::Vector2(static_cast<float>(bounds.x()), static_cast<float>(bounds.y())));
+        }
+
+        void ResizeNode(const AZ::EntityId& nodeId)
+        {
+            QRectF& bounds = m_bounds[nodeId];
+            bounds.setSize(QSizeF(50 + RandomInt(250), 30 + RandomInt(200)));
+            m_index.DirtyMember(nodeId);
+        }
+
+        void RemoveNode(const AZ::EntityId& nodeId)
+        {
+            m_bounds.erase(nodeId);
+            m_index.RemoveMember(nodeId);
+        }
+
+        AZStd::vector<AZ::EntityId> BruteForceInRect(const QRectF& rect, Qt::ItemSelectionMode mode) const
+        {
+            AZStd::vector<AZ::EntityId> result;
+            for (const auto& boundsPair : m_bounds)
+            {
+                if (mode == Qt::ContainsItemBoundingRect ? rect.contains(boundsPair.second) : rect.intersects(boundsPair.second))
+                {
+                    result.push_back(boundsPair.first);
+                }
+            }
+            return result;
+        }
+
+        AZStd::vector<AZ::EntityId> BruteForceAt(const QPointF& point) const
+        {
+            AZStd::vector<AZ::EntityId> result;
+            for (const auto& boundsPair : m_bounds)
+            {
+                if (boundsPair.second.contains(point))
+                {
+                    result.push_back(boundsPair.first);
+                }
+            }
+            return result;
+        }
+
+        qreal BruteForceNearestDistance(const QPointF& point) const
+        {
+            qreal nearestDistance = std::numeric_limits<qreal>::max();
+            for (const auto& boundsPair : m_bounds)
+            {
+                nearestDistance = AZStd::GetMin(nearestDistance, DistanceTo(boundsPair.second, point));
+            }
+            return nearestDistance;
+        }
+
+        static qreal DistanceTo(const QRectF& rect, const QPointF& point)
+        {
+            const qreal deltaX = AZStd::GetMax(AZStd::GetMax(rect.left() - point.x(), point.x() - rect.right()), 0.0);
+            const qreal deltaY = AZStd::GetMax(AZStd::GetMax(rect.top() - point.y(), point.y() - rect.bottom()), 0.0);
+            return qSqrt(deltaX * deltaX + deltaY * deltaY);
+        }
+
+        QRectF RandomRect()
+        {
+            return QRectF(RandomCoordinate(), RandomCoordinate(), 100 + RandomInt(1000), 100 + RandomInt(1000));
+        }
+
+        QPointF RandomPoint()
+        {
+            return QPointF(RandomCoordinate(), RandomCoordinate());
+        }
+
+        // Whole numbers keep the positions exact in the float vectors the geometry reports
+        qreal RandomCoordinate()
+        {
+            return static_cast<qreal>(RandomInt(10000));
+        }
+
+        int RandomInt(int range)
+        {
+            return static_cast<int>(m_random.GetRandom() % range);
+        }
+
+        GraphCanvas::SceneSpatialIndex m_index;
+        AZStd::unordered_map<AZ::EntityId, QRectF> m_bounds;
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    void SortIds(AZStd::vector<AZ::EntityId>& ids)
+    {
+        AZStd::sort(ids.begin(), ids.end());
+    }
+}
+
+class SceneSpatialIndexTest
+    : public UnitTest::AllocatorsTestFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsTestFixture::SetUp();
+        m_graph = AZStd::make_unique<SpatialIndexGraph>();
+        m_graph->Populate(2000, 42);
+    }
+
+    void TearDown() override
+    {
+        m_graph.reset();
+        UnitTest::AllocatorsTestFixture::TearDown();
+    }
+
+    void ExpectMatchesBruteForce()
+    {
+        EXPECT_TRUE(m_graph->m_index.IsValid());
+        EXPECT_EQ(m_graph->m_bounds.size(), m_graph->m_index.GetMemberCount());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const QRectF rect = m_graph->RandomRect();
+            for (Qt::ItemSelectionMode mode : { Qt::IntersectsItemBoundingRect, Qt::ContainsItemBoundingRect })
+            {
+                AZStd::vector<AZ::EntityId> found;
+                m_graph->m_index.FindInRect(rect, mode, found);
+                AZStd::vector<AZ::EntityId> expected = m_graph->BruteForceInRect(rect, mode);
+
+                SortIds(found);
+                SortIds(expected);
+                EXPECT_EQ(expected, found);
+            }
+
+            const QPointF point = m_graph->RandomPoint();
+            AZStd::vector<AZ::EntityId> found;
+            m_graph->m_index.FindAt(point, found);
+            AZStd::vector<AZ::EntityId> expected = m_graph->BruteForceAt(point);
+
+            SortIds(found);
+            SortIds(expected);
+            EXPECT_EQ(expected, found);
+        }
+    }
+
+    AZStd::unique_ptr<SpatialIndexGraph> m_graph;
+};
+
+TEST_F(SceneSpatialIndexTest, Queries_MatchBruteForce)
+{
+    ExpectMatchesBruteForce();
+
+    // A balanced tree of 2000 leaves
+    EXPECT_LT(m_graph->m_index.GetHeight(), 24);
+}
+
+TEST_F(SceneSpatialIndexTest, FindNearest_VisitsNearestMemberFirst)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        const QPointF point = m_graph->RandomPoint();
+
+        qreal nearestDistance = std::numeric_limits<qreal>::max();
+        qreal previousDistance = 0.0;
+        bool isOrdered = true;
+        m_graph->m_index.FindNearest(point, nearestDistance, [&](const AZ::EntityId&, qreal boundsDistance)
+        {
+            isOrdered = isOrdered && previousDistance <= boundsDistance;
+            previousDistance = boundsDistance;
+            nearestDistance = AZStd::GetMin(nearestDistance, boundsDistance);
+            return nearestDistance;
+        });
+
+        EXPECT_TRUE(isOrdered);
+        EXPECT_DOUBLE_EQ(m_graph->BruteForceNearestDistance(point), nearestDistance);
+    }
+}
+
+TEST_F(SceneSpatialIndexTest, FindNearest_MaxDistance_NothingVisited)
+{
+    m_graph->Populate(10, 1);
+
+    int numVisited = 0;
+    m_graph->m_index.FindNearest(QPointF(-100000.0, -100000.0), 10.0, [&numVisited](const AZ::EntityId&, qreal distance)
+    {
+        ++numVisited;
+        return distance;
+    });
+
+    EXPECT_EQ(0, numVisited);
+}
+
+TEST_F(SceneSpatialIndexTest, MoveResizeAndRemove_MatchBruteForce)
+{
+    for (int i = 0; i < 5000; ++i)
+    {
+        const AZ::EntityId nodeId(1 + m_graph->RandomInt(2000));
+        if (m_graph->m_bounds.find(nodeId) == m_graph->m_bounds.end())
+        {
+            m_graph->AddNode(nodeId);
+            continue;
+        }
+
+        switch (m_graph->RandomInt(4))
+        {
+        case 0:
+            // Nudged, stays in its leaf most of the time
+            m_graph->MoveNode(nodeId, m_graph->RandomInt(21) - 10, m_graph->RandomInt(21) - 10);
+            break;
+        case 1:
+            m_graph->MoveNode(nodeId, m_graph->RandomInt(2001) - 1000, m_graph->RandomInt(2001) - 1000);
+            break;
+        case 2:
+            m_graph->ResizeNode(nodeId);
+            break;
+        default:
+            m_graph->RemoveNode(nodeId);
+            break;
+        }
+    }
+
+    ExpectMatchesBruteForce();
+}
+
+TEST_F(SceneSpatialIndexTest, MoveMember_DirtiesDependents)
+{
+    m_graph->Populate(0, 1);
+
+    const AZ::EntityId sourceNode(1);
+    const AZ::EntityId targetNode(2);
+    const AZ::EntityId connection(3);
+
+    auto connectionBounds = [this, sourceNode, targetNode]()
+    {
+        return QRectF(m_graph->m_bounds[sourceNode].center(), m_graph->m_bounds[targetNode].center()).normalized();
+    };
+
+    m_graph->m_bounds[sourceNode] = QRectF(0, 0, 100, 100);
+    m_graph->m_bounds[targetNode] = QRectF(400, 0, 100, 100);
+    m_graph->m_index.AddMember(sourceNode, m_graph->m_bounds[sourceNode], AZ::Vector2(0, 0));
+    m_graph->m_index.AddMember(targetNode, m_graph->m_bounds[targetNode], AZ::Vector2(400, 0));
+
+    m_graph->m_bounds[connection] = connectionBounds();
+    m_graph->m_index.AddMember(connection, m_graph->m_bounds[connection], AZ::Vector2::CreateZero());
+    m_graph->m_index.AddDependent(sourceNode, connection);
+    m_graph->m_index.AddDependent(targetNode, connection);
+
+    m_graph->MoveNode(targetNode, 0, 1000);
+    m_graph->m_bounds[connection] = connectionBounds();
+
+    AZStd::vector<AZ::EntityId> found;
+    m_graph->m_index.FindAt(QPointF(450, 600), found);
+    ASSERT_EQ(1u, found.size());
+    EXPECT_EQ(connection, found.front());
+    EXPECT_EQ(m_graph->m_bounds[connection], m_graph->m_index.GetMemberBounds(connection));
+
+    m_graph->RemoveNode(connection);
+    m_graph->MoveNode(sourceNode, 0, 1000);
+    EXPECT_TRUE(m_graph->m_index.IsValid());
+    EXPECT_EQ(2u, m_graph->m_index.GetMemberCount());
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SceneSpatialIndexBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_graph = AZStd::make_unique<SpatialIndexGraph>();
+            m_graph->Populate(static_cast<int>(state.range(0)), 42);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_graph.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<SpatialIndexGraph> m_graph;
+    };
+
+    BENCHMARK_DEFINE_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_FindInRect)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::EntityId> found;
+        for (auto _ : state)
+        {
+            found.clear();
+            m_graph->m_index.FindInRect(m_graph->RandomRect(), Qt::IntersectsItemBoundingRect, found);
+            benchmark::DoNotOptimize(found.data());
+        }
+    }
+
+    // What every rect query cost before the index, without the QGraphicsScene overhead
+    BENCHMARK_DEFINE_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_BruteForceInRect)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZStd::vector<AZ::EntityId> found = m_graph->BruteForceInRect(m_graph->RandomRect(), Qt::IntersectsItemBoundingRect);
+            benchmark::DoNotOptimize(found.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_MoveMember)(benchmark::State& state)
+    {
+        const int numNodes = static_cast<int>(state.range(0));
+        for (auto _ : state)
+        {
+            m_graph->MoveNode(AZ::EntityId(1 + m_graph->RandomInt(numNodes)), m_graph->RandomInt(201) - 100, m_graph->RandomInt(201) - 100);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_FindNearest)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            qreal nearestDistance = 500.0;
+            m_graph->m_index.FindNearest(m_graph->RandomPoint(), nearestDistance, [&nearestDistance](const AZ::EntityId&, qreal boundsDistance)
+            {
+                nearestDistance = AZStd::GetMin(nearestDistance, boundsDistance);
+                return nearestDistance;
+            });
+            benchmark::DoNotOptimize(nearestDistance);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_FindInRect)->Arg(1000)->Arg(5000)->Arg(20000);
+    BENCHMARK_REGISTER_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_BruteForceInRect)->Arg(1000)->Arg(5000)->Arg(20000);
+    BENCHMARK_REGISTER_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_MoveMember)->Arg(1000)->Arg(5000)->Arg(20000);
+    BENCHMARK_REGISTER_F(SceneSpatialIndexBenchmarkFixture, BM_SceneSpatialIndex_FindNearest)->Arg(1000)->Arg(5000)->Arg(20000);
+}
+#endif
+
 AZ_UNIT_TEST_HOOK();
@@ -236,6 +236,17 @@ namespace GraphCanvas
         //! Get the endpoints known to the scene in the given rectangle.
         virtual AZStd::vector<Endpoint> GetEndpointsInRect(const QRectF& rect) const = 0;
 
+        //! Get the scene members in the given rectangle. Uses the scene's spatial index rather than the QGraphicsScene,
+        //! with shape selection modes the members it finds are then checked against the shape of their root item.
+        virtual AZStd::vector<AZ::EntityId> GetSceneMembersInRect(const QRectF& rect, Qt::ItemSelectionMode mode) const = 0;
+
+        //! Get the scene members whose bounding rect contains the given point in scene space.
+        virtual AZStd::vector<AZ::EntityId> GetSceneMembersAt(const QPointF& scenePoint) const = 0;
+
+        //! Find the slot whose connection point is the closest to the given point in scene space.
+        //! Returns an invalid endpoint if no connection point is within maxDistance.
+        virtual Endpoint FindNearestSlot(const QPointF& scenePoint, qreal maxDistance) const = 0;
+
         //! Obtain the scene as a QGraphicsScene
         virtual QGraphicsScene* AsQGraphicsScene() = 0;
 
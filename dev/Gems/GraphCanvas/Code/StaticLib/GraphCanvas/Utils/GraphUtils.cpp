@@ -2118,10 +2118,10 @@ namespace GraphCanvas
                     breakoutCounter -= 1;
 
                     // Triple the size of the node to try to minimize the number of repetitions we need to do here.
-                    // Going to try to use Qt's underlying tree system rather then iterating over everything on the graph.
+                    // Going to use the scene's spatial index rather then iterating over everything on the graph.
                     sceneBoundingRect.adjust(-sceneBoundingRect.width(), -sceneBoundingRect.height(), sceneBoundingRect.width(), sceneBoundingRect.height());
 
-                    SceneRequestBus::EventResult(nearbyEntities, graphId, &SceneRequests::GetEntitiesInRect, sceneBoundingRect, Qt::ItemSelectionMode::IntersectsItemBoundingRect);
+                    SceneRequestBus::EventResult(nearbyEntities, graphId, &SceneRequests::GetSceneMembersInRect, sceneBoundingRect, Qt::ItemSelectionMode::IntersectsItemBoundingRect);
 
                     for (const AZ::EntityId& nearbyEntityId : nearbyEntities)
                     {
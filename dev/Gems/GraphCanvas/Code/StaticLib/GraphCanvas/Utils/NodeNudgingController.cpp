@@ -307,7 +307,7 @@ namespace GraphCanvas
             // Find all of the entities we may intersect with
             // in out new position so we can update them
             AZStd::vector< AZ::EntityId > sceneEntities;
-            SceneRequestBus::EventResult(sceneEntities, m_graphId, &SceneRequests::GetEntitiesInRect, currentBoundingBox, Qt::ItemSelectionMode::IntersectsItemBoundingRect);
+            SceneRequestBus::EventResult(sceneEntities, m_graphId, &SceneRequests::GetSceneMembersInRect, currentBoundingBox, Qt::ItemSelectionMode::IntersectsItemBoundingRect);
                 
             for (const AZ::EntityId& sceneMemberId : sceneEntities)
             {
@@ -0,0 +1,669 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <QtMath>
+
+#include <AzCore/std/algorithm.h>
+
+#include <GraphCanvas/Utils/SceneSpatialIndex.h>
+
+namespace GraphCanvas
+{
+    ////////////////////////////
+    // SceneSpatialIndex::Bounds
+    ////////////////////////////
+
+    SceneSpatialIndex::Bounds SceneSpatialIndex::Bounds::FromRect(const QRectF& rect)
+    {
+        const QRectF normalized = rect.normalized();
+
+        Bounds bounds;
+        bounds.m_minX = normalized.left();
+        bounds.m_minY = normalized.top();
+        bounds.m_maxX = normalized.right();
+        bounds.m_maxY = normalized.bottom();
+        return bounds;
+    }
+
+    QRectF SceneSpatialIndex::Bounds::ToRect() const
+    {
+        return QRectF(QPointF(m_minX, m_minY), QPointF(m_maxX, m_maxY));
+    }
+
+    SceneSpatialIndex::Bounds SceneSpatialIndex::Bounds::Union(const Bounds& other) const
+    {
+        Bounds bounds;
+        bounds.m_minX = AZStd::GetMin(m_minX, other.m_minX);
+        bounds.m_minY = AZStd::GetMin(m_minY, other.m_minY);
+        bounds.m_maxX = AZStd::GetMax(m_maxX, other.m_maxX);
+        bounds.m_maxY = AZStd::GetMax(m_maxY, other.m_maxY);
+        return bounds;
+    }
+
+    SceneSpatialIndex::Bounds SceneSpatialIndex::Bounds::Expanded(qreal margin) const
+    {
+        Bounds bounds;
+        bounds.m_minX = m_minX - margin;
+        bounds.m_minY = m_minY - margin;
+        bounds.m_maxX = m_maxX + margin;
+        bounds.m_maxY = m_maxY + margin;
+        return bounds;
+    }
+
+    qreal SceneSpatialIndex::Bounds::Perimeter() const
+    {
+        return 2.0 * ((m_maxX - m_minX) + (m_maxY - m_minY));
+    }
+
+    bool SceneSpatialIndex::Bounds::Contains(const Bounds& other) const
+    {
+        return m_minX <= other.m_minX && m_minY <= other.m_minY && other.m_maxX <= m_maxX && other.m_maxY <= m_maxY;
+    }
+
+    bool SceneSpatialIndex::Bounds::Contains(const QPointF& point) const
+    {
+        return m_minX <= point.x() && point.x() <= m_maxX && m_minY <= point.y() && point.y() <= m_maxY;
+    }
+
+    bool SceneSpatialIndex::Bounds::Intersects(const Bounds& other) const
+    {
+        // Same as QRectF::intersects, rects that only touch don't intersect
+        return m_minX < other.m_maxX && other.m_minX < m_maxX && m_minY < other.m_maxY && other.m_minY < m_maxY;
+    }
+
+    qreal SceneSpatialIndex::Bounds::DistanceTo(const QPointF& point) const
+    {
+        const qreal deltaX = AZStd::GetMax(AZStd::GetMax(m_minX - point.x(), point.x() - m_maxX), 0.0);
+        const qreal deltaY = AZStd::GetMax(AZStd::GetMax(m_minY - point.y(), point.y() - m_maxY), 0.0);
+        return qSqrt(deltaX * deltaX + deltaY * deltaY);
+    }
+
+    //////////////////////
+    // SceneSpatialIndex
+    //////////////////////
+
+    void SceneSpatialIndex::SetBoundsProvider(const BoundsProvider& boundsProvider)
+    {
+        m_boundsProvider = boundsProvider;
+    }
+
+    void SceneSpatialIndex::Clear()
+    {
+        m_nodes.clear();
+        m_root = k_nullNode;
+        m_freeList = k_nullNode;
+        m_members.clear();
+        m_dirtyMembers.clear();
+    }
+
+    void SceneSpatialIndex::AddMember(const AZ::EntityId& memberId, const QRectF& bounds, const AZ::Vector2& position)
+    {
+        auto memberIter = m_members.find(memberId);
+        if (memberIter != m_members.end())
+        {
+            memberIter->second.m_position = position;
+            SetMemberBounds(memberIter->second, Bounds::FromRect(bounds));
+            return;
+        }
+
+        const int leaf = AllocateNode();
+        TreeNode& leafNode = m_nodes[leaf];
+        leafNode.m_memberBounds = Bounds::FromRect(bounds);
+        leafNode.m_bounds = leafNode.m_memberBounds.Expanded(k_boundsMargin);
+        leafNode.m_memberId = memberId;
+        leafNode.m_height = 0;
+        InsertLeaf(leaf);
+
+        Member& member = m_members[memberId];
+        member.m_leaf = leaf;
+        member.m_position = position;
+    }
+
+    void SceneSpatialIndex::RemoveMember(const AZ::EntityId& memberId)
+    {
+        auto memberIter = m_members.find(memberId);
+        if (memberIter != m_members.end())
+        {
+            RemoveLeaf(memberIter->second.m_leaf);
+            FreeNode(memberIter->second.m_leaf);
+
+            m_dirtyMembers.erase(memberId);
+            m_members.erase(memberIter);
+        }
+    }
+
+    bool SceneSpatialIndex::HasMember(const AZ::EntityId& memberId) const
+    {
+        return m_members.find(memberId) != m_members.end();
+    }
+
+    size_t SceneSpatialIndex::GetMemberCount() const
+    {
+        return m_members.size();
+    }
+
+    void SceneSpatialIndex::MoveMember(const AZ::EntityId& memberId, const AZ::Vector2& position)
+    {
+        auto memberIter = m_members.find(memberId);
+        if (memberIter != m_members.end())
+        {
+            Member& member = memberIter->second;
+            const qreal deltaX = position.GetX() - member.m_position.GetX();
+            const qreal deltaY = position.GetY() - member.m_position.GetY();
+            member.m_position = position;
+
+            Bounds bounds = m_nodes[member.m_leaf].m_memberBounds;
+            bounds.m_minX += deltaX;
+            bounds.m_maxX += deltaX;
+            bounds.m_minY += deltaY;
+            bounds.m_maxY += deltaY;
+            SetMemberBounds(member, bounds);
+
+            DirtyDependents(member);
+        }
+    }
+
+    void SceneSpatialIndex::DirtyMember(const AZ::EntityId& memberId)
+    {
+        auto memberIter = m_members.find(memberId);
+        if (memberIter != m_members.end())
+        {
+            m_dirtyMembers.insert(memberId);
+            DirtyDependents(memberIter->second);
+        }
+    }
+
+    void SceneSpatialIndex::AddDependent(const AZ::EntityId& memberId, const AZ::EntityId& dependentId)
+    {
+        auto memberIter = m_members.find(memberId);
+        if (memberIter != m_members.end())
+        {
+            AZStd::vector<AZ::EntityId>& dependents = memberIter->second.m_dependents;
+            if (AZStd::find(dependents.begin(), dependents.end(), dependentId) == dependents.end())
+            {
+                dependents.push_back(dependentId);
+            }
+        }
+    }
+
+    QRectF SceneSpatialIndex::GetMemberBounds(const AZ::EntityId& memberId)
+    {
+        RefreshDirtyMembers();
+
+        auto memberIter = m_members.find(memberId);
+        return memberIter != m_members.end() ? m_nodes[memberIter->second.m_leaf].m_memberBounds.ToRect() : QRectF();
+    }
+
+    void SceneSpatialIndex::FindInRect(const QRectF& rect, Qt::ItemSelectionMode mode, AZStd::vector<AZ::EntityId>& result)
+    {
+        RefreshDirtyMembers();
+
+        if (m_root == k_nullNode)
+        {
+            return;
+        }
+
+        const Bounds queryBounds = Bounds::FromRect(rect);
+        const bool mustContain = (mode == Qt::ContainsItemBoundingRect || mode == Qt::ContainsItemShape);
+
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty())
+        {
+            const TreeNode& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+
+            if (!node.m_bounds.Intersects(queryBounds) && !queryBounds.Contains(node.m_bounds))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                const bool isMatch = mustContain ? queryBounds.Contains(node.m_memberBounds) : node.m_memberBounds.Intersects(queryBounds);
+                if (isMatch)
+                {
+                    result.push_back(node.m_memberId);
+                }
+            }
+            else
+            {
+                m_stack.push_back(node.m_left);
+                m_stack.push_back(node.m_right);
+            }
+        }
+    }
+
+    void SceneSpatialIndex::FindAt(const QPointF& point, AZStd::vector<AZ::EntityId>& result)
+    {
+        RefreshDirtyMembers();
+
+        if (m_root == k_nullNode)
+        {
+            return;
+        }
+
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty())
+        {
+            const TreeNode& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+
+            if (node.IsLeaf())
+            {
+                if (node.m_memberBounds.Contains(point))
+                {
+                    result.push_back(node.m_memberId);
+                }
+            }
+            else if (node.m_bounds.Contains(point))
+            {
+                m_stack.push_back(node.m_left);
+                m_stack.push_back(node.m_right);
+            }
+        }
+    }
+
+    void SceneSpatialIndex::FindNearest(const QPointF& point, qreal maxDistance, const NearestVisitor& visitor)
+    {
+        RefreshDirtyMembers();
+
+        if (m_root == k_nullNode)
+        {
+            return;
+        }
+
+        // Best first search, leaves are keyed by the distance to the member bounds
+        using DistanceNode = AZStd::pair<qreal, int>;
+        auto isFurther = [](const DistanceNode& lhs, const DistanceNode& rhs) { return lhs.first > rhs.first; };
+
+        AZStd::vector<DistanceNode> openNodes;
+        openNodes.emplace_back(m_nodes[m_root].IsLeaf() ? m_nodes[m_root].m_memberBounds.DistanceTo(point) : m_nodes[m_root].m_bounds.DistanceTo(point), m_root);
+
+        qreal searchDistance = maxDistance;
+        while (!openNodes.empty())
+        {
+            AZStd::pop_heap(openNodes.begin(), openNodes.end(), isFurther);
+            const DistanceNode closest = openNodes.back();
+            openNodes.pop_back();
+
+            if (closest.first > searchDistance)
+            {
+                break;
+            }
+
+            const TreeNode& node = m_nodes[closest.second];
+            if (node.IsLeaf())
+            {
+                searchDistance = AZStd::GetMin(searchDistance, visitor(node.m_memberId, closest.first));
+                continue;
+            }
+
+            for (int child : { node.m_left, node.m_right })
+            {
+                const TreeNode& childNode = m_nodes[child];
+                const qreal distance = childNode.IsLeaf() ? childNode.m_memberBounds.DistanceTo(point) : childNode.m_bounds.DistanceTo(point);
+                if (distance <= searchDistance)
+                {
+                    openNodes.emplace_back(distance, child);
+                    AZStd::push_heap(openNodes.begin(), openNodes.end(), isFurther);
+                }
+            }
+        }
+    }
+
+    bool SceneSpatialIndex::IsValid() const
+    {
+        if (m_root != k_nullNode && m_nodes[m_root].m_parent != k_nullNode)
+        {
+            return false;
+        }
+
+        for (const auto& memberPair : m_members)
+        {
+            const int leaf = memberPair.second.m_leaf;
+            if (leaf < 0 || leaf >= static_cast<int>(m_nodes.size()) || !m_nodes[leaf].IsLeaf() || m_nodes[leaf].m_memberId != memberPair.first)
+            {
+                return false;
+            }
+        }
+
+        return m_root == k_nullNode ? m_members.empty() : IsValid(m_root);
+    }
+
+    int SceneSpatialIndex::GetHeight() const
+    {
+        return m_root == k_nullNode ? 0 : m_nodes[m_root].m_height;
+    }
+
+    int SceneSpatialIndex::AllocateNode()
+    {
+        if (m_freeList == k_nullNode)
+        {
+            m_nodes.emplace_back();
+            return static_cast<int>(m_nodes.size()) - 1;
+        }
+
+        const int node = m_freeList;
+        m_freeList = m_nodes[node].m_parent;
+        m_nodes[node] = TreeNode();
+        return node;
+    }
+
+    void SceneSpatialIndex::FreeNode(int node)
+    {
+        m_nodes[node].m_parent = m_freeList;
+        m_nodes[node].m_height = -1;
+        m_freeList = node;
+    }
+
+    void SceneSpatialIndex::InsertLeaf(int leaf)
+    {
+        if (m_root == k_nullNode)
+        {
+            m_root = leaf;
+            m_nodes[leaf].m_parent = k_nullNode;
+            return;
+        }
+
+        // Find the sibling with the least perimeter growth, growing a parent costs the same to all its children
+        const Bounds leafBounds = m_nodes[leaf].m_bounds;
+        int sibling = m_root;
+        while (!m_nodes[sibling].IsLeaf())
+        {
+            const TreeNode& node = m_nodes[sibling];
+
+            const qreal combinedPerimeter = node.m_bounds.Union(leafBounds).Perimeter();
+            const qreal cost = 2.0 * combinedPerimeter;
+            const qreal inheritanceCost = 2.0 * (combinedPerimeter - node.m_bounds.Perimeter());
+
+            auto childCost = [this, &leafBounds, inheritanceCost](int child)
+            {
+                const TreeNode& childNode = m_nodes[child];
+                const qreal perimeter = childNode.m_bounds.Union(leafBounds).Perimeter();
+                return (childNode.IsLeaf() ? perimeter : perimeter - childNode.m_bounds.Perimeter()) + inheritanceCost;
+            };
+
+            const qreal leftCost = childCost(node.m_left);
+            const qreal rightCost = childCost(node.m_right);
+            if (cost < leftCost && cost < rightCost)
+            {
+                break;
+            }
+
+            sibling = leftCost < rightCost ? node.m_left : node.m_right;
+        }
+
+        const int oldParent = m_nodes[sibling].m_parent;
+        const int newParent = AllocateNode();
+        m_nodes[newParent].m_parent = oldParent;
+        m_nodes[newParent].m_bounds = leafBounds.Union(m_nodes[sibling].m_bounds);
+        m_nodes[newParent].m_height = m_nodes[sibling].m_height + 1;
+        m_nodes[newParent].m_left = sibling;
+        m_nodes[newParent].m_right = leaf;
+        m_nodes[sibling].m_parent = newParent;
+        m_nodes[leaf].m_parent = newParent;
+
+        if (oldParent == k_nullNode)
+        {
+            m_root = newParent;
+        }
+        else if (m_nodes[oldParent].m_left == sibling)
+        {
+            m_nodes[oldParent].m_left = newParent;
+        }
+        else
+        {
+            m_nodes[oldParent].m_right = newParent;
+        }
+
+        FixUpwards(newParent);
+    }
+
+    void SceneSpatialIndex::RemoveLeaf(int leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = k_nullNode;
+            return;
+        }
+
+        const int parent = m_nodes[leaf].m_parent;
+        const int grandParent = m_nodes[parent].m_parent;
+        const int sibling = m_nodes[parent].m_left == leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+        m_nodes[sibling].m_parent = grandParent;
+        FreeNode(parent);
+
+        if (grandParent == k_nullNode)
+        {
+            m_root = sibling;
+            return;
+        }
+
+        if (m_nodes[grandParent].m_left == parent)
+        {
+            m_nodes[grandParent].m_left = sibling;
+        }
+        else
+        {
+            m_nodes[grandParent].m_right = sibling;
+        }
+
+        FixUpwards(grandParent);
+    }
+
+    // Rotates the taller grandchild up if a node is unbalanced, returns the root of the subtree.
+    int SceneSpatialIndex::Balance(int indexA)
+    {
+        TreeNode* nodeA = &m_nodes[indexA];
+        if (nodeA->IsLeaf() || nodeA->m_height < 2)
+        {
+            return indexA;
+        }
+
+        const int indexB = nodeA->m_left;
+        const int indexC = nodeA->m_right;
+        TreeNode* nodeB = &m_nodes[indexB];
+        TreeNode* nodeC = &m_nodes[indexC];
+
+        const int balance = nodeC->m_height - nodeB->m_height;
+
+        // Rotate C up
+        if (balance > 1)
+        {
+            const int indexF = nodeC->m_left;
+            const int indexG = nodeC->m_right;
+            TreeNode* nodeF = &m_nodes[indexF];
+            TreeNode* nodeG = &m_nodes[indexG];
+
+            nodeC->m_left = indexA;
+            nodeC->m_parent = nodeA->m_parent;
+            nodeA->m_parent = indexC;
+
+            if (nodeC->m_parent == k_nullNode)
+            {
+                m_root = indexC;
+            }
+            else if (m_nodes[nodeC->m_parent].m_left == indexA)
+            {
+                m_nodes[nodeC->m_parent].m_left = indexC;
+            }
+            else
+            {
+                m_nodes[nodeC->m_parent].m_right = indexC;
+            }
+
+            if (nodeF->m_height > nodeG->m_height)
+            {
+                nodeC->m_right = indexF;
+                nodeA->m_right = indexG;
+                nodeG->m_parent = indexA;
+                nodeA->m_bounds = nodeB->m_bounds.Union(nodeG->m_bounds);
+                nodeC->m_bounds = nodeA->m_bounds.Union(nodeF->m_bounds);
+                nodeA->m_height = 1 + AZStd::GetMax(nodeB->m_height, nodeG->m_height);
+                nodeC->m_height = 1 + AZStd::GetMax(nodeA->m_height, nodeF->m_height);
+            }
+            else
+            {
+                nodeC->m_right = indexG;
+                nodeA->m_right = indexF;
+                nodeF->m_parent = indexA;
+                nodeA->m_bounds = nodeB->m_bounds.Union(nodeF->m_bounds);
+                nodeC->m_bounds = nodeA->m_bounds.Union(nodeG->m_bounds);
+                nodeA->m_height = 1 + AZStd::GetMax(nodeB->m_height, nodeF->m_height);
+                nodeC->m_height = 1 + AZStd::GetMax(nodeA->m_height, nodeG->m_height);
+            }
+
+            return indexC;
+        }
+
+        // Rotate B up
+        if (balance < -1)
+        {
+            const int indexD = nodeB->m_left;
+            const int indexE = nodeB->m_right;
+            TreeNode* nodeD = &m_nodes[indexD];
+            TreeNode* nodeE = &m_nodes[indexE];
+
+            nodeB->m_left = indexA;
+            nodeB->m_parent = nodeA->m_parent;
+            nodeA->m_parent = indexB;
+
+            if (nodeB->m_parent == k_nullNode)
+            {
+                m_root = indexB;
+            }
+            else if (m_nodes[nodeB->m_parent].m_left == indexA)
+            {
+                m_nodes[nodeB->m_parent].m_left = indexB;
+            }
+            else
+            {
+                m_nodes[nodeB->m_parent].m_right = indexB;
+            }
+
+            if (nodeD->m_height > nodeE->m_height)
+            {
+                nodeB->m_right = indexD;
+                nodeA->m_left = indexE;
+                nodeE->m_parent = indexA;
+                nodeA->m_bounds = nodeC->m_bounds.Union(nodeE->m_bounds);
+                nodeB->m_bounds = nodeA->m_bounds.Union(nodeD->m_bounds);
+                nodeA->m_height = 1 + AZStd::GetMax(nodeC->m_height, nodeE->m_height);
+                nodeB->m_height = 1 + AZStd::GetMax(nodeA->m_height, nodeD->m_height);
+            }
+            else
+            {
+                nodeB->m_right = indexE;
+                nodeA->m_left = indexD;
+                nodeD->m_parent = indexA;
+                nodeA->m_bounds = nodeC->m_bounds.Union(nodeD->m_bounds);
+                nodeB->m_bounds = nodeA->m_bounds.Union(nodeE->m_bounds);
+                nodeA->m_height = 1 + AZStd::GetMax(nodeC->m_height, nodeD->m_height);
+                nodeB->m_height = 1 + AZStd::GetMax(nodeA->m_height, nodeE->m_height);
+            }
+
+            return indexB;
+        }
+
+        return indexA;
+    }
+
+    // Rebalances and refits the nodes from node to the root
+    void SceneSpatialIndex::FixUpwards(int node)
+    {
+        while (node != k_nullNode)
+        {
+            node = Balance(node);
+
+            TreeNode& treeNode = m_nodes[node];
+            const TreeNode& left = m_nodes[treeNode.m_left];
+            const TreeNode& right = m_nodes[treeNode.m_right];
+            treeNode.m_height = 1 + AZStd::GetMax(left.m_height, right.m_height);
+            treeNode.m_bounds = left.m_bounds.Union(right.m_bounds);
+
+            node = treeNode.m_parent;
+        }
+    }
+
+    void SceneSpatialIndex::SetMemberBounds(Member& member, const Bounds& bounds)
+    {
+        const int leaf = member.m_leaf;
+        m_nodes[leaf].m_memberBounds = bounds;
+        if (m_nodes[leaf].m_bounds.Contains(bounds))
+        {
+            return;
+        }
+
+        RemoveLeaf(leaf);
+        m_nodes[leaf].m_bounds = bounds.Expanded(k_boundsMargin);
+        InsertLeaf(leaf);
+    }
+
+    void SceneSpatialIndex::DirtyDependents(const Member& member)
+    {
+        for (const AZ::EntityId& dependentId : member.m_dependents)
+        {
+            if (m_members.find(dependentId) != m_members.end())
+            {
+                m_dirtyMembers.insert(dependentId);
+            }
+        }
+    }
+
+    void SceneSpatialIndex::RefreshDirtyMembers()
+    {
+        if (m_dirtyMembers.empty() || !m_boundsProvider)
+        {
+            return;
+        }
+
+        for (const AZ::EntityId& memberId : m_dirtyMembers)
+        {
+            auto memberIter = m_members.find(memberId);
+            if (memberIter != m_members.end())
+            {
+                SetMemberBounds(memberIter->second, Bounds::FromRect(m_boundsProvider(memberId)));
+            }
+        }
+        m_dirtyMembers.clear();
+    }
+
+    bool SceneSpatialIndex::IsValid(int node) const
+    {
+        const TreeNode& treeNode = m_nodes[node];
+        if (treeNode.IsLeaf())
+        {
+            return treeNode.m_height == 0 && treeNode.m_right == k_nullNode && treeNode.m_bounds.Contains(treeNode.m_memberBounds);
+        }
+
+        const TreeNode& left = m_nodes[treeNode.m_left];
+        const TreeNode& right = m_nodes[treeNode.m_right];
+        if (left.m_parent != node || right.m_parent != node)
+        {
+            return false;
+        }
+
+        if (treeNode.m_height != 1 + AZStd::GetMax(left.m_height, right.m_height) || left.m_height - right.m_height > 1 || right.m_height - left.m_height > 1)
+        {
+            return false;
+        }
+
+        if (!treeNode.m_bounds.Contains(left.m_bounds) || !treeNode.m_bounds.Contains(right.m_bounds))
+        {
+            return false;
+        }
+
+        return IsValid(treeNode.m_left) && IsValid(treeNode.m_right);
+    }
+}
@@ -0,0 +1,140 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <QPoint>
+#include <QRect>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace GraphCanvas
+{
+    // Dynamic AABB tree over the bounding rects of the members of a scene, so hit tests and area queries
+    // don't need to visit every node of the graph.
+    //
+    // Leaves keep the exact bounds of a member inside enlarged bounds, members moving a little (dragged or nudged)
+    // only update their leaf. A member can depend on others, like a connection on the nodes it connects: when a member
+    // moves or is resized its dependents are dirtied, and the bounds of dirty members are read again from the bounds
+    // provider before the next query.
+    class SceneSpatialIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SceneSpatialIndex, AZ::SystemAllocator, 0);
+
+        using BoundsProvider = AZStd::function<QRectF(const AZ::EntityId& memberId)>;
+
+        // Called by FindNearest with members in increasing distance of their bounds to the point.
+        // Returns the new search distance, members further than that are not visited.
+        using NearestVisitor = AZStd::function<qreal(const AZ::EntityId& memberId, qreal boundsDistance)>;
+
+        // Members moving less than this don't change the tree
+        static constexpr qreal k_boundsMargin = 20.0;
+
+        SceneSpatialIndex() = default;
+
+        void SetBoundsProvider(const BoundsProvider& boundsProvider);
+        void Clear();
+
+        // The position is the one reported by the member's geometry, MoveMember translates the bounds from it.
+        void AddMember(const AZ::EntityId& memberId, const QRectF& bounds, const AZ::Vector2& position);
+        void RemoveMember(const AZ::EntityId& memberId);
+        bool HasMember(const AZ::EntityId& memberId) const;
+        size_t GetMemberCount() const;
+
+        void MoveMember(const AZ::EntityId& memberId, const AZ::Vector2& position);
+        void DirtyMember(const AZ::EntityId& memberId);
+        void AddDependent(const AZ::EntityId& memberId, const AZ::EntityId& dependentId);
+
+        QRectF GetMemberBounds(const AZ::EntityId& memberId);
+
+        // Item shape modes are handled as the matching bounding rect modes.
+        void FindInRect(const QRectF& rect, Qt::ItemSelectionMode mode, AZStd::vector<AZ::EntityId>& result);
+        void FindAt(const QPointF& point, AZStd::vector<AZ::EntityId>& result);
+        void FindNearest(const QPointF& point, qreal maxDistance, const NearestVisitor& visitor);
+
+        // For tests, checks the links, bounds and heights of the tree
+        bool IsValid() const;
+        int GetHeight() const;
+
+    private:
+        static const int k_nullNode = -1;
+
+        struct Bounds
+        {
+            qreal m_minX = 0.0;
+            qreal m_minY = 0.0;
+            qreal m_maxX = 0.0;
+            qreal m_maxY = 0.0;
+
+            static Bounds FromRect(const QRectF& rect);
+            QRectF ToRect() const;
+
+            Bounds Union(const Bounds& other) const;
+            Bounds Expanded(qreal margin) const;
+            qreal Perimeter() const;
+            bool Contains(const Bounds& other) const;
+            bool Contains(const QPointF& point) const;
+            bool Intersects(const Bounds& other) const;
+            qreal DistanceTo(const QPointF& point) const;
+        };
+
+        struct TreeNode
+        {
+            Bounds m_bounds;                // Enlarged bounds for leaves
+            Bounds m_memberBounds;          // Leaves only
+            AZ::EntityId m_memberId;        // Leaves only
+            int m_parent = k_nullNode;      // Next free node when the node is free
+            int m_left = k_nullNode;
+            int m_right = k_nullNode;
+            int m_height = 0;               // 0 for leaves, -1 for free nodes
+
+            bool IsLeaf() const { return m_left == k_nullNode; }
+        };
+
+        struct Member
+        {
+            int m_leaf = k_nullNode;
+            AZ::Vector2 m_position = AZ::Vector2::CreateZero();
+            AZStd::vector<AZ::EntityId> m_dependents;
+        };
+
+        int AllocateNode();
+        void FreeNode(int node);
+
+        void InsertLeaf(int leaf);
+        void RemoveLeaf(int leaf);
+        int Balance(int node);
+        void FixUpwards(int node);
+
+        void SetMemberBounds(Member& member, const Bounds& bounds);
+        void DirtyDependents(const Member& member);
+        void RefreshDirtyMembers();
+
+        bool IsValid(int node) const;
+
+        AZStd::vector<TreeNode> m_nodes;
+        int m_root = k_nullNode;
+        int m_freeList = k_nullNode;
+
+        AZStd::unordered_map<AZ::EntityId, Member> m_members;
+        AZStd::unordered_set<AZ::EntityId> m_dirtyMembers;
+        BoundsProvider m_boundsProvider;
+
+        AZStd::vector<int> m_stack;
+    };
+}
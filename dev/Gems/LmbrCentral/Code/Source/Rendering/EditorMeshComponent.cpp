@@ -258,12 +258,19 @@ namespace LmbrCentral
         {
             OnTransformChanged(GetTransform()->GetLocalTM(), GetTransform()->GetWorldTM());
         }
+
+        // the mesh loads asynchronously, so its selection bounds change after activation
+        AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+            GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
     }
 
     void EditorMeshComponent::OnMeshDestroyed()
     {
         AZ::Data::AssetBus::Handler::BusDisconnect();
         DestroyEditorPhysics();
+
+        AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+            GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
     }
 
     IRenderNode* EditorMeshComponent::GetRenderNode()
@@ -214,11 +214,18 @@ namespace LmbrCentral
         {
             OnTransformChanged(GetTransform()->GetLocalTM(), GetTransform()->GetWorldTM());
         }
+
+        // the mesh loads asynchronously, so its selection bounds change after activation
+        AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+            GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
     }
 
     void EditorSkinnedMeshComponent::OnMeshDestroyed()
     {
         DestroyEditorPhysics();
+
+        AzToolsFramework::EditorComponentSelectionNotificationsBus::Event(
+            GetEntityId(), &AzToolsFramework::EditorComponentSelectionNotifications::OnEditorSelectionBoundsChanged);
     }
 
     IRenderNode* EditorSkinnedMeshComponent::GetRenderNode()
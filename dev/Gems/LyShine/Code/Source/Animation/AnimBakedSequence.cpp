@@ -0,0 +1,601 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "LyShine_precompiled.h"
+#include "AnimBakedSequence.h"
+
+#include "AnimSequence.h"
+#include "AnimSplineTrack.h"
+#include "AzEntityNode.h"
+#include "BoolTrack.h"
+#include "CompoundSplineTrack.h"
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Vector2.h>
+
+namespace
+{
+    typedef UiSpline::TrackSplineInterpolator<Vec2> BakedSpline;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimBakedSequence::Compile(CUiAnimSequence& sequence)
+{
+    Reset();
+
+    if (sequence.GetActiveDirector())
+    {
+        return false;
+    }
+
+    const int nodeCount = sequence.GetNodeCount();
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        IUiAnimNode* animNode = sequence.GetNode(i);
+        if (animNode->GetType() != eUiAnimNodeType_AzEntity || animNode->HasDirectorAsParent())
+        {
+            Reset();
+            return false;
+        }
+
+        if (!CompileNode(static_cast<CUiAnimAzEntityNode*>(animNode)))
+        {
+            Reset();
+            return false;
+        }
+    }
+
+    m_isCompiled = true;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::Reset()
+{
+    // Keep the capacity, playing the same sequence again doesn't allocate
+    m_keys.clear();
+    m_boolKeyTimes.clear();
+    m_curves.clear();
+    m_boolCurves.clear();
+    m_channels.clear();
+    m_nodes.clear();
+    m_isCompiled = false;
+
+    AZ::EntityBus::MultiHandler::BusDisconnect();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::Animate(SUiAnimContext& ec)
+{
+    for (const Node& node : m_nodes)
+    {
+        CUiAnimAzEntityNode* animNode = node.m_node;
+        if (animNode->GetFlags() & eUiAnimNodeFlags_Disabled)
+        {
+            continue;
+        }
+
+        if (!node.m_isBound || animNode->GetAzEntityId() != node.m_entityId)
+        {
+            // The entity was deactivated, or the node animates another one, since the sequence was compiled.
+            // The resolved fields don't apply anymore.
+            animNode->Animate(ec);
+            continue;
+        }
+
+        const Channel* channel = m_channels.data() + node.m_firstChannel;
+        const Channel* channelEnd = channel + node.m_numChannels;
+        for (; channel != channelEnd; ++channel)
+        {
+            ApplyChannel(*channel, ec.time);
+        }
+
+        animNode->OnAnimated(ec.time);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimBakedSequence::CompileNode(CUiAnimAzEntityNode* animNode)
+{
+    Node node;
+    node.m_node = animNode;
+    node.m_entityId = animNode->GetAzEntityId();
+    node.m_firstChannel = static_cast<uint32>(m_channels.size());
+    node.m_isBound = false;
+
+    AZ::Entity* entity = nullptr;
+    if (node.m_entityId.IsValid())
+    {
+        EBUS_EVENT_RESULT(entity, AZ::ComponentApplicationBus, FindEntity, node.m_entityId);
+    }
+
+    // Without an active entity the node is kept with no channels and animated the regular way
+    if (entity && entity->GetState() == AZ::Entity::ES_ACTIVE)
+    {
+        node.m_isBound = true;
+        AZ::EntityBus::MultiHandler::BusConnect(node.m_entityId);
+
+        const int trackCount = animNode->GetTrackCount();
+        for (int trackIndex = 0; trackIndex < trackCount; ++trackIndex)
+        {
+            IUiAnimTrack* track = animNode->GetTrackByIndex(trackIndex);
+
+            // UI tracks are never masked so, unlike CUiAnimAzEntityNode::Animate, the track mask is not checked
+            if (!track->HasKeys() || (track->GetFlags() & IUiAnimTrack::eUiAnimTrackFlags_Disabled))
+            {
+                continue;
+            }
+
+            const UiAnimParamData& paramData = track->GetParamData();
+            AZ::Component* component = paramData.GetComponent(entity);
+            if (!component)
+            {
+                continue;
+            }
+
+            char* componentData = reinterpret_cast<char*>(component);
+            void* elementData = componentData + paramData.GetOffset();
+
+            bool channelAdded = true;
+            const AZ::Uuid& typeId = paramData.GetTypeId();
+            if (typeId == AZ::SerializeTypeInfo<float>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Float, elementData, track);
+            }
+            else if (typeId == AZ::SerializeTypeInfo<bool>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Bool, elementData, track);
+            }
+            else if (typeId == AZ::SerializeTypeInfo<AZ::Vector2>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Vector2, elementData, track);
+            }
+            else if (typeId == AZ::SerializeTypeInfo<AZ::Vector3>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Vector3, elementData, track);
+            }
+            else if (typeId == AZ::SerializeTypeInfo<AZ::Vector4>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Vector4, elementData, track);
+            }
+            else if (typeId == AZ::SerializeTypeInfo<AZ::Color>::GetUuid())
+            {
+                channelAdded = AddChannel(ChannelType::Color, elementData, track);
+            }
+            else
+            {
+                // A compound field, each sub-track writes its own element
+                for (int k = 0; k < track->GetSubTrackCount() && channelAdded; ++k)
+                {
+                    IUiAnimTrack* subTrack = track->GetSubTrack(k);
+                    if (subTrack->GetParameterType() != eUiAnimParamType_AzComponentField)
+                    {
+                        continue;
+                    }
+
+                    const UiAnimParamData& subTrackParamData = subTrack->GetParamData();
+                    void* subElementData = componentData + subTrackParamData.GetOffset();
+                    if (subTrackParamData.GetTypeId() == AZ::SerializeTypeInfo<float>::GetUuid())
+                    {
+                        channelAdded = AddChannel(ChannelType::Float, subElementData, subTrack);
+                    }
+                    else if (subTrackParamData.GetTypeId() == AZ::SerializeTypeInfo<bool>::GetUuid())
+                    {
+                        channelAdded = AddChannel(ChannelType::Bool, subElementData, subTrack);
+                    }
+                }
+            }
+
+            if (!channelAdded)
+            {
+                return false;
+            }
+        }
+    }
+
+    node.m_numChannels = static_cast<uint32>(m_channels.size()) - node.m_firstChannel;
+    m_nodes.push_back(node);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimBakedSequence::AddChannel(ChannelType type, void* target, IUiAnimTrack* track)
+{
+    Channel channel;
+    channel.m_target = target;
+    channel.m_type = type;
+
+    switch (type)
+    {
+    case ChannelType::Float:
+    {
+        // A compound track only gives the value of its first sub-track as a float
+        IUiAnimTrack* floatTrack = track->GetSubTrackCount() > 0 ? track->GetSubTrack(0) : track;
+        channel.m_firstCurve = static_cast<uint32>(m_curves.size());
+        channel.m_numCurves = 1;
+        if (!AddCurve(floatTrack))
+        {
+            return false;
+        }
+        break;
+    }
+    case ChannelType::Bool:
+    {
+        if (!azrtti_cast<UiBoolTrack*>(track))
+        {
+            return false;
+        }
+        channel.m_firstCurve = static_cast<uint32>(m_boolCurves.size());
+        channel.m_numCurves = 1;
+        AddBoolCurve(track);
+        break;
+    }
+    default:
+    {
+        const int maxElements = (type == ChannelType::Vector2) ? 2 : (type == ChannelType::Vector3) ? 3 : 4;
+        const int subTrackCount = track->GetSubTrackCount();
+        if (!azrtti_cast<UiCompoundSplineTrack*>(track) || subTrackCount > maxElements)
+        {
+            return false;
+        }
+
+        channel.m_firstCurve = static_cast<uint32>(m_curves.size());
+        channel.m_numCurves = static_cast<uint8>(subTrackCount);
+        for (int i = 0; i < subTrackCount; ++i)
+        {
+            if (!AddCurve(track->GetSubTrack(i)))
+            {
+                return false;
+            }
+        }
+        break;
+    }
+    }
+
+    m_channels.push_back(channel);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimBakedSequence::AddCurve(IUiAnimTrack* track)
+{
+    C2DSplineTrack* splineTrack = azrtti_cast<C2DSplineTrack*>(track);
+    if (!splineTrack)
+    {
+        return false;
+    }
+
+    Curve curve;
+    curve.m_firstKey = static_cast<uint32>(m_keys.size());
+    curve.m_numKeys = 0;
+    curve.m_cursor = 0;
+    curve.m_defaultValue = 0.0f;
+    curve.m_loop = false;
+
+    BakedSpline* spline = static_cast<BakedSpline*>(splineTrack->GetSpline());
+    if (spline->empty())
+    {
+        // Without keys the track returns its default value
+        splineTrack->GetValue(0.0f, curve.m_defaultValue);
+    }
+    else
+    {
+        // Sorts the keys and computes the tangents, as the first interpolation would
+        spline->update();
+
+        curve.m_numKeys = spline->num_keys();
+        curve.m_loop = spline->isORT(BakedSpline::ORT_CYCLE) || spline->isORT(BakedSpline::ORT_LOOP);
+        for (int i = 0; i < spline->num_keys(); ++i)
+        {
+            Key key;
+            key.m_time = spline->time(i);
+            key.m_value = spline->value(i);
+            key.m_inTangent = spline->ds(i);
+            key.m_outTangent = spline->dd(i);
+            key.m_inTangentType = static_cast<uint8>(spline->GetInTangentType(i));
+            key.m_outTangentType = static_cast<uint8>(spline->GetOutTangentType(i));
+            m_keys.push_back(key);
+        }
+    }
+
+    m_curves.push_back(curve);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::AddBoolCurve(IUiAnimTrack* track)
+{
+    UiBoolTrack* boolTrack = static_cast<UiBoolTrack*>(track);
+
+    // Getting a value sorts the keys if they were modified
+    bool value;
+    boolTrack->GetValue(0.0f, value);
+
+    BoolCurve curve;
+    curve.m_firstKey = static_cast<uint32>(m_boolKeyTimes.size());
+    curve.m_numKeys = boolTrack->GetNumKeys();
+    curve.m_cursor = 0;
+    curve.m_defaultValue = boolTrack->GetDefaultValue();
+    for (int i = 0; i < boolTrack->GetNumKeys(); ++i)
+    {
+        m_boolKeyTimes.push_back(boolTrack->GetKeyTime(i));
+    }
+
+    m_boolCurves.push_back(curve);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::UnbindEntity(const AZ::EntityId& entityId)
+{
+    for (Node& node : m_nodes)
+    {
+        if (node.m_entityId == entityId)
+        {
+            node.m_isBound = false;
+        }
+    }
+
+    AZ::EntityBus::MultiHandler::BusDisconnect(entityId);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::OnEntityDeactivated(const AZ::EntityId& entityId)
+{
+    // Components can only be added, removed or recreated while the entity is inactive
+    UnbindEntity(entityId);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::OnEntityDestruction(const AZ::EntityId& entityId)
+{
+    UnbindEntity(entityId);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::ApplyChannel(const Channel& channel, float time)
+{
+    switch (channel.m_type)
+    {
+    case ChannelType::Float:
+        *static_cast<float*>(channel.m_target) = EvaluateCurve(m_curves[channel.m_firstCurve], time);
+        break;
+    case ChannelType::Bool:
+        *static_cast<bool*>(channel.m_target) = EvaluateBoolCurve(m_boolCurves[channel.m_firstCurve], time);
+        break;
+    default:
+    {
+        // Elements without a sub-track keep the value a track would start from, the color alpha is opaque
+        const float initialValue = (channel.m_type == ChannelType::Color) ? 1.0f : 0.0f;
+        float values[4] = { initialValue, initialValue, initialValue, initialValue };
+        for (int i = 0; i < channel.m_numCurves; ++i)
+        {
+            values[i] = EvaluateCurve(m_curves[channel.m_firstCurve + i], time);
+        }
+
+        switch (channel.m_type)
+        {
+        case ChannelType::Vector2:
+            *static_cast<AZ::Vector2*>(channel.m_target) = AZ::Vector2(values[0], values[1]);
+            break;
+        case ChannelType::Vector3:
+            *static_cast<AZ::Vector3*>(channel.m_target) = AZ::Vector3(values[0], values[1], values[2]);
+            break;
+        case ChannelType::Vector4:
+            *static_cast<AZ::Vector4*>(channel.m_target) = AZ::Vector4(values[0], values[1], values[2], values[3]);
+            break;
+        case ChannelType::Color:
+            *static_cast<AZ::Color*>(channel.m_target) = AZ::Color(values[0], values[1], values[2], values[3]);
+            break;
+        }
+        break;
+    }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+float CUiAnimBakedSequence::EvaluateCurve(Curve& curve, float time)
+{
+    // Same as TUiAnimSplineTrack<Vec2>::GetValue, which solves the time warp of the curve
+    // with TrackSplineInterpolator<Vec2>::search_u
+    if (curve.m_numKeys == 0)
+    {
+        return curve.m_defaultValue;
+    }
+
+    const Key* keys = m_keys.data() + curve.m_firstKey;
+    const int lastKey = curve.m_numKeys - 1;
+
+    AdjustTime(curve, time);
+
+    float timeToCheck = time;
+    const int curr = SeekKey(curve, time);
+    const int next = (curr < lastKey) ? curr + 1 : curr;
+
+    if (time < keys[0].m_time)
+    {
+        time = keys[0].m_time;
+    }
+    else if (time > keys[lastKey].m_time)
+    {
+        time = keys[lastKey].m_time;
+    }
+
+    Vec2 value;
+    const float epsilon = 0.00001f;
+    float timeDelta = keys[next].m_time - keys[curr].m_time;
+    if (timeDelta == 0)
+    {
+        timeDelta = epsilon;
+    }
+
+    if (keys[curr].m_outTangentType == SPLINE_KEY_TANGENT_STEP || keys[next].m_inTangentType == SPLINE_KEY_TANGENT_STEP)
+    {
+        InterpolateKeys(curve, timeToCheck, value);
+        return value.y;
+    }
+
+    // Newton's method to find the u where the x of the curve is the time
+    int count = 0;
+    do
+    {
+        InterpolateKeys(curve, timeToCheck, value);
+
+        float u = (timeToCheck - keys[curr].m_time) / timeDelta;
+        if (fabs(value.x - time) < epsilon)
+        {
+            break;
+        }
+
+        float dt = ComputeTimeDerivative(keys[curr], keys[next], u);
+        double dfdt = (double(value.x) - double(time)) / (double(dt) + epsilon);
+        u -= float(dfdt);
+        if (u < 0)
+        {
+            u = 0;
+        }
+        else if (u > 1)
+        {
+            u = 1;
+        }
+        timeToCheck = u * (keys[next].m_time - keys[curr].m_time) + keys[curr].m_time;
+        ++count;
+    }
+    while (count < 10);
+
+    return value.y;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimBakedSequence::EvaluateBoolCurve(BoolCurve& curve, float time)
+{
+    // Same as UiBoolTrack::GetValue, every key reached toggles the default value
+    if (curve.m_numKeys == 0)
+    {
+        return curve.m_defaultValue;
+    }
+
+    const float* keyTimes = m_boolKeyTimes.data() + curve.m_firstKey;
+    const int numKeys = curve.m_numKeys;
+
+    int key = curve.m_cursor;
+    while (key > 0 && time < keyTimes[key - 1])
+    {
+        --key;
+    }
+    while (key < numKeys && time >= keyTimes[key])
+    {
+        ++key;
+    }
+    curve.m_cursor = key;
+
+    return curve.m_defaultValue ? !(key & 1) : (key & 1) != 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+int CUiAnimBakedSequence::SeekKey(Curve& curve, float time) const
+{
+    const Key* keys = m_keys.data() + curve.m_firstKey;
+    const int numKeys = curve.m_numKeys;
+    if ((curve.m_cursor >= numKeys) || (keys[curve.m_cursor].m_time > time))
+    {
+        // Search from beginning.
+        curve.m_cursor = 0;
+    }
+    while ((curve.m_cursor < numKeys - 1) && (keys[curve.m_cursor + 1].m_time <= time))
+    {
+        ++curve.m_cursor;
+    }
+    return curve.m_cursor;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::AdjustTime(const Curve& curve, float& time) const
+{
+    if (curve.m_loop)
+    {
+        const float endTime = m_keys[curve.m_firstKey + curve.m_numKeys - 1].m_time;
+        if (time > endTime)
+        {
+            // Warp time.
+            time = spline::fast_fmod(time, endTime);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::InterpolateKeys(Curve& curve, float time, Vec2& value) const
+{
+    const Key* keys = m_keys.data() + curve.m_firstKey;
+    const int lastKey = curve.m_numKeys - 1;
+
+    if (time < keys[0].m_time)
+    {
+        value = keys[0].m_value;
+        return;
+    }
+
+    AdjustTime(curve, time);
+
+    const int curr = SeekKey(curve, time);
+    if (curr < lastKey)
+    {
+        const float u = (time - keys[curr].m_time) / (keys[curr + 1].m_time - keys[curr].m_time);
+        InterpolateSegment(keys[curr], keys[curr + 1], u, value);
+    }
+    else
+    {
+        value = keys[lastKey].m_value;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimBakedSequence::InterpolateSegment(const Key& from, const Key& to, float u, Vec2& value) const
+{
+    if (from.m_outTangentType == SPLINE_KEY_TANGENT_STEP)
+    {
+        value = to.m_value;
+    }
+    else if (to.m_inTangentType == SPLINE_KEY_TANGENT_STEP)
+    {
+        value = from.m_value;
+    }
+    else
+    {
+        spline::BezierBasis basis(u);
+
+        const Vec2 p0 = from.m_value;
+        const Vec2 p3 = to.m_value;
+        const Vec2 p1 = p0 + from.m_outTangent;
+        const Vec2 p2 = p3 - to.m_inTangent;
+
+        value = (basis[0] * p0) + (basis[1] * p1) + (basis[2] * p2) + (basis[3] * p3);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+float CUiAnimBakedSequence::ComputeTimeDerivative(const Key& from, const Key& to, float u) const
+{
+    float u2 = u * u;
+    float b0 = -3.0f * u2 + 6.0f * u - 3;
+    float b1 = 9.0f * u2 - 12.0f * u + 3;
+    float b2 = -9.0f * u2 + 6.0f * u;
+    float b3 = 3.0f * u2;
+
+    float p0 = from.m_value.x;
+    float p3 = to.m_value.x;
+    float p1 = p0 + from.m_outTangent.x;
+    float p2 = p3 - to.m_inTangent.x;
+
+    return (b0 * p0) + (b1 * p1) + (b2 * p2) + (b3 * p3);
+}
@@ -0,0 +1,147 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <LyShine/Animation/IUiAnimation.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/std/containers/vector.h>
+
+class CUiAnimSequence;
+class CUiAnimAzEntityNode;
+
+//////////////////////////////////////////////////////////////////////////
+//! A playing sequence flattened into contiguous arrays.
+//!
+//! Compile copies the keys and tangents of every spline track into one key array and resolves
+//! the component field each track writes to, so evaluating a frame is a walk over plain arrays:
+//! no virtual track calls, no type id compares, no component lookups and no heap allocations.
+//! Keys are found with a cursor per curve, which only moves forward while the sequence plays.
+//!
+//! The baked data is a snapshot, the sequence compiles it when it starts playing and drops it
+//! when it stops. The curves are evaluated with the same math as UiSpline::TrackSplineInterpolator
+//! so the values written are the ones the tracks would return.
+//!
+//! Fields are only resolved on active entities, whose components can't change until they are
+//! deactivated. The field addresses of a node are dropped as soon as its entity is deactivated or
+//! destroyed, so an element recreated at the same address is never written through stale pointers.
+class CUiAnimBakedSequence
+    : public AZ::EntityBus::MultiHandler
+{
+public:
+    AZ_CLASS_ALLOCATOR(CUiAnimBakedSequence, AZ::SystemAllocator, 0)
+
+    //! Bakes the nodes of the sequence. Returns false, and leaves nothing compiled, if the sequence
+    //! uses a node or track type that can't be baked, the caller then keeps animating the nodes.
+    bool Compile(CUiAnimSequence& sequence);
+
+    //! Drops the baked data
+    void Reset();
+
+    bool IsCompiled() const { return m_isCompiled; }
+
+    //! Writes the values of all enabled nodes at ec.time to their components
+    void Animate(SUiAnimContext& ec);
+
+    // EntityEvents
+    void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+    void OnEntityDestruction(const AZ::EntityId& entityId) override;
+    // ~EntityEvents
+
+private:
+    //! A key of a 2D bezier float track, the x of the value is the time warp of the curve
+    struct Key
+    {
+        float m_time;
+        Vec2 m_value;
+        Vec2 m_inTangent;
+        Vec2 m_outTangent;
+        uint8 m_inTangentType;
+        uint8 m_outTangentType;
+    };
+
+    //! One float track, a range of m_keys
+    struct Curve
+    {
+        uint32 m_firstKey;
+        uint32 m_numKeys;
+        int m_cursor;
+        float m_defaultValue;
+        bool m_loop;
+    };
+
+    //! One bool track, a range of m_boolKeyTimes. Every key toggles the value.
+    struct BoolCurve
+    {
+        uint32 m_firstKey;
+        uint32 m_numKeys;
+        int m_cursor;
+        bool m_defaultValue;
+    };
+
+    enum class ChannelType : uint8
+    {
+        Float,
+        Bool,
+        Vector2,
+        Vector3,
+        Vector4,
+        Color
+    };
+
+    //! A component field written by a track. Float and vector channels read m_numCurves curves
+    //! starting at m_firstCurve, a bool channel reads the bool curve m_firstCurve.
+    struct Channel
+    {
+        void* m_target;
+        uint32 m_firstCurve;
+        uint8 m_numCurves;
+        ChannelType m_type;
+    };
+
+    //! A node whose channels are not bound, because its entity wasn't active when compiling or has
+    //! been deactivated since, is animated from its tracks
+    struct Node
+    {
+        CUiAnimAzEntityNode* m_node;
+        AZ::EntityId m_entityId;
+        uint32 m_firstChannel;
+        uint32 m_numChannels;
+        bool m_isBound;
+    };
+
+    bool CompileNode(CUiAnimAzEntityNode* animNode);
+    bool AddChannel(ChannelType type, void* target, IUiAnimTrack* track);
+    bool AddCurve(IUiAnimTrack* track);
+    void AddBoolCurve(IUiAnimTrack* track);
+    void UnbindEntity(const AZ::EntityId& entityId);
+
+    void ApplyChannel(const Channel& channel, float time);
+
+    float EvaluateCurve(Curve& curve, float time);
+    bool EvaluateBoolCurve(BoolCurve& curve, float time);
+
+    // These mirror TSpline::seek_key, TSpline::interpolate and BezierSpline::interp_keys on a baked curve
+    int SeekKey(Curve& curve, float time) const;
+    void AdjustTime(const Curve& curve, float& time) const;
+    void InterpolateKeys(Curve& curve, float time, Vec2& value) const;
+    void InterpolateSegment(const Key& from, const Key& to, float u, Vec2& value) const;
+    float ComputeTimeDerivative(const Key& from, const Key& to, float u) const;
+
+    AZStd::vector<Key> m_keys;
+    AZStd::vector<float> m_boolKeyTimes;
+    AZStd::vector<Curve> m_curves;
+    AZStd::vector<BoolCurve> m_boolCurves;
+    AZStd::vector<Channel> m_channels;
+    AZStd::vector<Node> m_nodes;
+    bool m_isCompiled = false;
+};
@@ -161,6 +161,8 @@ bool CUiAnimSequence::AddNode(IUiAnimNode* pAnimNode)
 
     static_cast<CUiAnimNode*>(pAnimNode)->SetSequence(this);
     pAnimNode->SetTimeRange(m_timeRange);
+    // The baked data doesn't know the new node, animate the tracks until the sequence is played again
+    m_bakedSequence.Reset();
     m_nodes.push_back(AZStd::intrusive_ptr<IUiAnimNode>(pAnimNode));
 
     const int nodeId = static_cast<CUiAnimNode*>(pAnimNode)->GetId();
@@ -247,6 +249,8 @@ void CUiAnimSequence::RemoveNode(IUiAnimNode* node)
     static_cast<CUiAnimNode*>(node)->Activate(false);
     static_cast<CUiAnimNode*>(node)->OnReset();
 
+    m_bakedSequence.Reset();
+
     for (int i = 0; i < (int)m_nodes.size(); )
     {
         if (node == m_nodes[i].get())
@@ -289,6 +293,7 @@ void CUiAnimSequence::RemoveNode(IUiAnimNode* node)
 //////////////////////////////////////////////////////////////////////////
 void CUiAnimSequence::RemoveAll()
 {
+    m_bakedSequence.Reset();
     stl::free_container(m_nodes);
     stl::free_container(m_nodesNeedToRender);
     m_pActiveDirector = NULL;
@@ -440,6 +445,12 @@ bool CUiAnimSequence::IsPaused() const
     return m_bPaused;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool CUiAnimSequence::IsBaked() const
+{
+    return m_bakedSequence.IsCompiled();
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CUiAnimSequence::OnStart()
 {
@@ -448,11 +459,20 @@ void CUiAnimSequence::OnStart()
         IUiAnimNode* pAnimNode = it->get();
         static_cast<CUiAnimNode*>(pAnimNode)->OnStart();
     }
+
+    // Flatten the tracks for playback. In the editor keys can be edited while the sequence plays so
+    // the tracks are always evaluated directly there.
+    if (!gEnv->IsEditor())
+    {
+        m_bakedSequence.Compile(*this);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
 void CUiAnimSequence::OnStop()
 {
+    m_bakedSequence.Reset();
+
     for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
     {
         IUiAnimNode* pAnimNode = it->get();
@@ -489,6 +509,13 @@ void CUiAnimSequence::Animate(const SUiAnimContext& ec)
     animContext.pSequence = this;
     m_time = animContext.time;
 
+    // Played from the keys flattened by OnStart
+    if (m_bakedSequence.IsCompiled())
+    {
+        m_bakedSequence.Animate(animContext);
+        return;
+    }
+
     // Evaluate all animation nodes in sequence.
     // The director first.
     if (m_pActiveDirector)
@@ -559,6 +586,8 @@ void CUiAnimSequence::Deactivate()
         return;
     }
 
+    m_bakedSequence.Reset();
+
     // Detach animation block from all nodes in this sequence.
     for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
     {
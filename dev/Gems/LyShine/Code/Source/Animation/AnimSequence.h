@@ -14,6 +14,7 @@
 #pragma once
 
 #include <LyShine/Animation/IUiAnimation.h>
+#include "AnimBakedSequence.h"
 
 class CUiAnimSequence
     : public IUiAnimSequence
@@ -99,6 +100,8 @@ public:
 
     void StillUpdate();
     void Animate(const SUiAnimContext& ec);
+    //! True while the sequence plays from the data baked by OnStart
+    bool IsBaked() const;
     void Render();
 
     void Serialize(XmlNodeRef& xmlNode, bool bLoading, bool bLoadEmptyTracks = true, uint32 overrideId = 0, bool bResetLightAnimSet = false);
@@ -152,4 +155,7 @@ private:
     float m_time;
 
     VectorSet<IEntity*> m_precachedEntitiesSet;
+
+    //! The tracks flattened for playback, compiled when the sequence starts playing
+    CUiAnimBakedSequence m_bakedSequence;
 };
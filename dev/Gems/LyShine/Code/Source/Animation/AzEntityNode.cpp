@@ -784,7 +784,13 @@ void CUiAnimAzEntityNode::Animate(SUiAnimContext& ec)
         }
     }
 
-    m_time = ec.time;
+    OnAnimated(ec.time);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CUiAnimAzEntityNode::OnAnimated(float time)
+{
+    m_time = time;
 
     if (m_pOwner)
     {
@@ -58,6 +58,9 @@ public:
     virtual void StillUpdate();
     virtual void Animate(SUiAnimContext& ec);
 
+    //! Notifies the owner and the entity once the animated values have been written at the given time
+    void OnAnimated(float time);
+
     virtual void CreateDefaultTracks();
 
     bool SetParamValueAz(float time, const UiAnimParamData& param, float value) override;
@@ -39,6 +39,7 @@ public:
     void GetKeyInfo(int key, const char*& description, float& duration);
 
     void SetDefaultValue(const bool bDefaultValue);
+    bool GetDefaultValue() const { return m_bDefaultValue; }
 
     static void Reflect(AZ::SerializeContext* serializeContext);
 
@@ -0,0 +1,312 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "LyShine_precompiled.h"
+
+#include "LyShineTest.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AzEntityNode.h"
+#include <ISplines.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Vector2.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    // Stands in for the UI components, the animated fields are found by offset like the serialized ones
+    class AnimatedFieldsComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(AnimatedFieldsComponent, "{5D0B3C0E-3B8B-4A7C-9C2B-8E7D3F1A6C41}");
+
+        static void Reflect(AZ::ReflectContext*) {}
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        template<typename T>
+        size_t GetOffset(const T& field) const
+        {
+            return reinterpret_cast<const char*>(&field) - reinterpret_cast<const char*>(this);
+        }
+
+        float m_float = 0.0f;
+        bool m_bool = false;
+        AZ::Vector2 m_vector2 = AZ::Vector2::CreateZero();
+        AZ::Vector3 m_vector3 = AZ::Vector3::CreateZero();
+        AZ::Color m_color = AZ::Color::CreateZero();
+    };
+
+    class LyShineAnimBakedSequenceTest
+        : public LyShineTest
+    {
+    protected:
+        void SetupApplication() override
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 10 * 1024 * 1024;
+            appDesc.m_recordingMode = AZ::Debug::AllocationRecords::RECORD_FULL;
+            appDesc.m_stackRecordLevels = 20;
+
+            AZ::ComponentApplication::StartupParameters appStartup;
+            // Module needs to be created this way to create CryString allocator for test
+            appStartup.m_createStaticModulesCallback =
+                [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new LyShine::LyShineModule);
+            };
+
+            m_systemEntity = m_application.Create(appDesc, appStartup);
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+        }
+
+        void TearDown() override
+        {
+            m_canvases.set_capacity(0);
+
+            LyShineTest::TearDown();
+        }
+
+        // Adds the curve keys of a float track, with a mix of tangent types
+        static void AddFloatKeys(IUiAnimTrack* track, std::mt19937& random, float duration)
+        {
+            std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+            std::uniform_int_distribution<int> tangent(SPLINE_KEY_TANGENT_NONE, SPLINE_KEY_TANGENT_LINEAR);
+
+            const int numKeys = 2 + random() % 6;
+            for (int i = 0; i < numKeys; ++i)
+            {
+                // Keys are at least MIN_TIME_PRECISION apart or they are merged
+                const float time = duration * i / (numKeys - 1);
+                track->SetValue(time, value(random));
+            }
+            for (int i = 0; i < track->GetNumKeys(); ++i)
+            {
+                const int inTangent = tangent(random);
+                const int outTangent = tangent(random);
+                track->SetKeyFlags(i, (inTangent << SPLINE_KEY_TANGENT_IN_SHIFT) | (outTangent << SPLINE_KEY_TANGENT_OUT_SHIFT));
+            }
+            if (random() % 3 == 0)
+            {
+                track->SetFlags(track->GetFlags() | IUiAnimTrack::eUiAnimTrackFlags_Loop);
+            }
+        }
+
+        static void AddVectorKeys(IUiAnimTrack* track, std::mt19937& random, float duration)
+        {
+            for (int i = 0; i < track->GetSubTrackCount(); ++i)
+            {
+                AddFloatKeys(track->GetSubTrack(i), random, duration);
+            }
+        }
+
+        // Animates every field of the component, the same seed gives the same tracks
+        static void AddTracks(CUiAnimAzEntityNode* node, AnimatedFieldsComponent* component, unsigned int seed)
+        {
+            std::mt19937 random(seed);
+            const float duration = 1.0f + (random() % 40) * 0.1f;
+            const AZ::ComponentId componentId = component->GetId();
+
+            IUiAnimTrack* floatTrack = node->CreateTrackForAzField(UiAnimParamData(componentId, "Float",
+                AZ::SerializeTypeInfo<float>::GetUuid(), component->GetOffset(component->m_float)));
+            AddFloatKeys(floatTrack, random, duration);
+
+            IUiAnimTrack* boolTrack = node->CreateTrackForAzField(UiAnimParamData(componentId, "Bool",
+                AZ::SerializeTypeInfo<bool>::GetUuid(), component->GetOffset(component->m_bool)));
+            const int numBoolKeys = 1 + random() % 4;
+            for (int i = 0; i < numBoolKeys; ++i)
+            {
+                boolTrack->CreateKey(duration * (i + 1) / (numBoolKeys + 1));
+            }
+
+            IUiAnimTrack* vector2Track = node->CreateTrackForAzField(UiAnimParamData(componentId, "Vector2",
+                AZ::SerializeTypeInfo<AZ::Vector2>::GetUuid(), component->GetOffset(component->m_vector2)));
+            AddVectorKeys(vector2Track, random, duration);
+
+            IUiAnimTrack* vector3Track = node->CreateTrackForAzField(UiAnimParamData(componentId, "Vector3",
+                AZ::SerializeTypeInfo<AZ::Vector3>::GetUuid(), component->GetOffset(component->m_vector3)));
+            AddVectorKeys(vector3Track, random, duration);
+
+            IUiAnimTrack* colorTrack = node->CreateTrackForAzField(UiAnimParamData(componentId, "Color",
+                AZ::SerializeTypeInfo<AZ::Color>::GetUuid(), component->GetOffset(component->m_color)));
+            AddVectorKeys(colorTrack, random, duration);
+        }
+
+        // One canvas worth of animation: an element and two sequences with the same tracks,
+        // one played from baked data and one evaluating its tracks
+        struct Canvas
+        {
+            AZStd::unique_ptr<AZ::Entity> m_element;
+            AnimatedFieldsComponent* m_component = nullptr;
+            AZStd::intrusive_ptr<CUiAnimSequence> m_baked;
+            AZStd::intrusive_ptr<CUiAnimSequence> m_tracks;
+        };
+
+        void CreateCanvases(int numCanvases)
+        {
+            for (int i = 0; i < numCanvases; ++i)
+            {
+                Canvas canvas;
+                canvas.m_element = AZStd::make_unique<AZ::Entity>();
+                canvas.m_component = canvas.m_element->CreateComponent<AnimatedFieldsComponent>();
+                canvas.m_element->Init();
+                canvas.m_element->Activate();
+
+                canvas.m_baked = aznew CUiAnimSequence(nullptr, i);
+                canvas.m_tracks = aznew CUiAnimSequence(nullptr, i);
+                for (CUiAnimSequence* sequence : { canvas.m_baked.get(), canvas.m_tracks.get() })
+                {
+                    CUiAnimAzEntityNode* node = static_cast<CUiAnimAzEntityNode*>(sequence->CreateNode(eUiAnimNodeType_AzEntity));
+                    node->SetAzEntity(canvas.m_element.get());
+                    AddTracks(node, canvas.m_component, 1000 + i);
+                    sequence->Activate();
+                }
+                canvas.m_baked->OnStart();
+
+                m_canvases.push_back(AZStd::move(canvas));
+            }
+        }
+
+        void DestroyCanvases()
+        {
+            for (Canvas& canvas : m_canvases)
+            {
+                canvas.m_baked->OnStop();
+                canvas.m_baked->Deactivate();
+                canvas.m_tracks->Deactivate();
+                canvas.m_baked.reset();
+                canvas.m_tracks.reset();
+                canvas.m_element.reset();
+            }
+            m_canvases.clear();
+        }
+
+        static void ExpectSameValues(const AnimatedFieldsComponent& expected, const AnimatedFieldsComponent& actual, float time)
+        {
+            const float tolerance = 0.001f;
+            EXPECT_NEAR(expected.m_float, actual.m_float, tolerance) << "time " << time;
+            EXPECT_EQ(expected.m_bool, actual.m_bool) << "time " << time;
+            EXPECT_TRUE(expected.m_vector2.IsClose(actual.m_vector2, tolerance)) << "time " << time;
+            EXPECT_TRUE(expected.m_vector3.IsClose(actual.m_vector3, tolerance)) << "time " << time;
+            EXPECT_TRUE(expected.m_color.IsClose(actual.m_color, tolerance)) << "time " << time;
+        }
+
+        // Animates both sequences of every canvas at the time and compares what they wrote
+        void AnimateAndCompare(float time)
+        {
+            SUiAnimContext ec;
+            ec.time = time;
+            for (Canvas& canvas : m_canvases)
+            {
+                canvas.m_tracks->Animate(ec);
+                const AnimatedFieldsComponent expected = *canvas.m_component;
+
+                canvas.m_baked->Animate(ec);
+                ExpectSameValues(expected, *canvas.m_component, time);
+            }
+        }
+
+        AZStd::vector<Canvas> m_canvases;
+    };
+
+    TEST_F(LyShineAnimBakedSequenceTest, PlayingSequences_AreBaked)
+    {
+        CreateCanvases(4);
+
+        for (const Canvas& canvas : m_canvases)
+        {
+            EXPECT_TRUE(canvas.m_baked->IsBaked());
+            EXPECT_FALSE(canvas.m_tracks->IsBaked());
+        }
+
+        m_canvases[0].m_baked->OnStop();
+        EXPECT_FALSE(m_canvases[0].m_baked->IsBaked());
+
+        DestroyCanvases();
+    }
+
+    TEST_F(LyShineAnimBakedSequenceTest, BakedSequences_MatchTrackValues)
+    {
+        CreateCanvases(64);
+
+        // Play forward at 60 fps, past the end so looping tracks wrap
+        for (int frame = 0; frame < 400; ++frame)
+        {
+            AnimateAndCompare(frame / 60.0f - 0.1f);
+        }
+
+        // Seeking backwards restarts the key search
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> seekTime(-1.0f, 8.0f);
+        for (int seek = 0; seek < 100; ++seek)
+        {
+            AnimateAndCompare(seekTime(random));
+        }
+
+        DestroyCanvases();
+    }
+
+    TEST_F(LyShineAnimBakedSequenceTest, RecreatedElement_IsAnimatedFromTracks)
+    {
+        CreateCanvases(1);
+        Canvas& canvas = m_canvases[0];
+
+        // Replace the element with a new entity with the same id, the baked field addresses are stale.
+        // The new one is allocated first so it can't reuse the address of the old one.
+        AZStd::unique_ptr<AZ::Entity> element = AZStd::make_unique<AZ::Entity>(canvas.m_element->GetId());
+        AnimatedFieldsComponent* component = element->CreateComponent<AnimatedFieldsComponent>();
+        component->SetId(canvas.m_component->GetId());
+        canvas.m_element = AZStd::move(element);
+        canvas.m_component = component;
+        canvas.m_element->Init();
+
+        EXPECT_TRUE(canvas.m_baked->IsBaked());
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            AnimateAndCompare(frame / 20.0f);
+        }
+
+        DestroyCanvases();
+    }
+
+    TEST_F(LyShineAnimBakedSequenceTest, ElementRecreatedAtSameAddress_IsAnimatedFromTracks)
+    {
+        CreateCanvases(1);
+        Canvas& canvas = m_canvases[0];
+
+        // Recreate the element in place, the entity address and id are the same as when compiling
+        // but the component is a new one
+        AZ::Entity* element = canvas.m_element.get();
+        const AZ::EntityId elementId = element->GetId();
+        const AZ::ComponentId componentId = canvas.m_component->GetId();
+        element->~Entity();
+        new(element) AZ::Entity(elementId);
+
+        canvas.m_component = element->CreateComponent<AnimatedFieldsComponent>();
+        canvas.m_component->SetId(componentId);
+        element->Init();
+        element->Activate();
+
+        EXPECT_TRUE(canvas.m_baked->IsBaked());
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            AnimateAndCompare(frame / 20.0f);
+        }
+
+        DestroyCanvases();
+    }
+} //namespace UnitTest
@@ -22,6 +22,8 @@ namespace physx
 
 namespace PhysXCharacters
 {
+    class CharacterMoveBatch;
+
     class SystemRequests
         : public AZ::EBusTraits
     {
@@ -32,6 +34,9 @@ namespace PhysXCharacters
 
         /// Gets a pointer to the per-scene singleton responsible for character controller creation, destruction etc.
         virtual physx::PxControllerManager* GetControllerManager(const Physics::World& world) = 0;
+
+        /// Gets the per-scene batch which runs the moves of the character controllers in deferred mode.
+        virtual CharacterMoveBatch* GetMoveBatch(const Physics::World& world) = 0;
     };
     using SystemRequestBus = AZ::EBus<SystemRequests>;
 } // namespace PhysXCharacters
@@ -21,6 +21,7 @@
 #include <PhysXCharacters/NativeTypeIdentifiers.h>
 #include <API/CharacterController.h>
 #include <API/CharacterControllerCosmeticReplica.h>
+#include <API/CharacterMoveBatch.h>
 #include <AzFramework/Physics/CollisionBus.h>
 #include <AzFramework/Physics/World.h>
 #include <PhysX/PhysXLocks.h>
@@ -36,6 +37,7 @@ namespace PhysXCharacters
                 ->Field("SlopeBehaviour", &CharacterControllerConfiguration::m_slopeBehaviour)
                 ->Field("ContactOffset", &CharacterControllerConfiguration::m_contactOffset)
                 ->Field("ScaleCoeff", &CharacterControllerConfiguration::m_scaleCoefficient)
+                ->Field("DeferMovement", &CharacterControllerConfiguration::m_deferMovement)
                 ;
 
             if (auto editContext = serializeContext->GetEditContext())
@@ -56,6 +58,9 @@ namespace PhysXCharacters
                         "Scale", "Scalar coefficient used to scale the controller, usually slightly smaller than 1")
                     ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CharacterControllerConfiguration::m_deferMovement,
+                        "Defer Movement", "Queue moves and run them with the other controllers of the world before the "
+                        "next physics update, rather than when they are requested")
                     ;
             }
         }
@@ -158,6 +163,8 @@ namespace PhysXCharacters
 
     CharacterController::~CharacterController()
     {
+        SetMoveBatch(nullptr);
+
         m_shape = nullptr; //shape has to go before m_pxController 
         if (m_pxController)
         {
@@ -370,6 +377,17 @@ namespace PhysXCharacters
     }
 
     AZ::Vector3 CharacterController::TryRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime)
+    {
+        if (m_moveBatch)
+        {
+            m_moveBatch->QueueMove(*this, deltaPosition, deltaTime);
+            return GetBasePosition();
+        }
+
+        return ApplyMove(deltaPosition, deltaTime);
+    }
+
+    AZ::Vector3 CharacterController::ApplyMove(const AZ::Vector3& deltaPosition, float deltaTime)
     {
         const AZ::Vector3& oldPosition = GetBasePosition();
 
@@ -580,6 +598,31 @@ namespace PhysXCharacters
         m_pxController->resize(height);
     }
 
+    void CharacterController::SetMoveBatch(CharacterMoveBatch* moveBatch)
+    {
+        if (m_moveBatch)
+        {
+            m_moveBatch->RemoveController(*this);
+        }
+
+        m_moveBatch = moveBatch;
+
+        if (m_moveBatch)
+        {
+            m_moveBatch->AddController(*this);
+        }
+    }
+
+    bool CharacterController::IsMovementDeferred() const
+    {
+        return m_moveBatch != nullptr;
+    }
+
+    void CharacterController::SetDeferredMoveHandler(const DeferredMoveHandler& handler)
+    {
+        m_deferredMoveHandler = handler;
+    }
+
     float CharacterController::GetHeight() const
     {
         if (!m_pxController)
@@ -17,6 +17,8 @@
 
 namespace PhysXCharacters
 {
+    class CharacterMoveBatch;
+
     static const float epsilon = 1e-3f;
 
     enum class SlopeBehaviour
@@ -41,6 +43,7 @@ namespace PhysXCharacters
         SlopeBehaviour m_slopeBehaviour = SlopeBehaviour::PreventClimbing; ///< Behaviour on surfaces above maximum slope.
         float m_contactOffset = 0.1f; ///< Extra distance outside the controller used to give smoother contact resolution.
         float m_scaleCoefficient = 0.8f; ///< Scalar coefficient used to scale the controller, usually slightly smaller than 1.
+        bool m_deferMovement = false; ///< Queue moves and run them with the other controllers of the world before the next physics update.
     };
 
     class CharacterController
@@ -49,8 +52,12 @@ namespace PhysXCharacters
         , public physx::PxQueryFilterCallback
     {
         friend class CharacterControllerComponent;
+        friend class CharacterMoveBatch;
 
     public:
+        /// Receives the new base position of a controller in deferred mode once its queued moves have run.
+        using DeferredMoveHandler = AZStd::function<void(const AZ::Vector3& newPosition)>;
+
         AZ_CLASS_ALLOCATOR(CharacterController, AZ::SystemAllocator, 0);
         AZ_TYPE_INFO_LEGACY(CharacterController, "{A75A7D19-BC21-4F7E-A3D9-05031D2DFC94}", Physics::Character);
         static void Reflect(AZ::ReflectContext* context);
@@ -120,7 +127,16 @@ namespace PhysXCharacters
         float GetHalfForwardExtent() const;
         void SetHalfForwardExtent(float halfForwardExtent);
 
+        /// Puts the controller in deferred mode, TryRelativeMove then queues the move in the batch and returns the current
+        /// position, the new position is given to the deferred move handler. A null batch moves the controller immediately.
+        void SetMoveBatch(CharacterMoveBatch* moveBatch);
+        bool IsMovementDeferred() const;
+        void SetDeferredMoveHandler(const DeferredMoveHandler& handler);
+
     private:
+        /// Moves the controller right away and updates its shadow body and observed velocity, returns the new base position.
+        AZ::Vector3 ApplyMove(const AZ::Vector3& deltaPosition, float deltaTime);
+
         /// Update the velocity based on the outcome of the controller's movement in the simulation.  This can differ
         /// from the desired velocity, for example if the character is stuck in a corner its observed velocity may be
         /// zero in spite of having a non-zero desired velocity.
@@ -137,5 +153,7 @@ namespace PhysXCharacters
         AZStd::unique_ptr<Physics::RigidBody> m_shadowBody; ///< A kinematic-synchronised rigid body used to store additional colliders.
         AZStd::string m_name = "Character Controller"; ///< Name to set on the PhysX actor associated with the controller.
         AZ::Crc32 m_colliderTag; ///< Tag used to identify the collider associated with the controller.
+        CharacterMoveBatch* m_moveBatch = nullptr; ///< Runs the moves of the controller when it is in deferred mode.
+        DeferredMoveHandler m_deferredMoveHandler; ///< Notified of the new position once a deferred move has run.
     };
 } // namespace PhysXCharacters
\ No newline at end of file
@@ -0,0 +1,151 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <PhysXCharacters_precompiled.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <API/CharacterController.h>
+#include <API/CharacterMoveBatch.h>
+#include <PhysX/PhysXLocks.h>
+
+namespace PhysXCharacters
+{
+    CharacterMoveBatch::CharacterMoveBatch(const Physics::World& world)
+        : m_scene(static_cast<physx::PxScene*>(world.GetNativePointer()))
+    {
+        Physics::WorldNotificationBus::Handler::BusConnect(world.GetWorldId());
+    }
+
+    CharacterMoveBatch::~CharacterMoveBatch()
+    {
+        Physics::WorldNotificationBus::Handler::BusDisconnect();
+
+        // The controllers can outlive the world and its batch, they don't need to remove themselves from it anymore
+        for (CharacterController* controller : m_controllers)
+        {
+            controller->m_moveBatch = nullptr;
+        }
+    }
+
+    void CharacterMoveBatch::AddController(CharacterController& controller)
+    {
+        m_controllers.push_back(&controller);
+    }
+
+    void CharacterMoveBatch::RemoveController(const CharacterController& controller)
+    {
+        m_controllers.erase(AZStd::remove(m_controllers.begin(), m_controllers.end(), &controller), m_controllers.end());
+
+        m_queuedMoves.erase(AZStd::remove_if(m_queuedMoves.begin(), m_queuedMoves.end(),
+            [&controller](const MoveRequest& move) { return move.m_controller == &controller; }), m_queuedMoves.end());
+
+        // The controller can be deleted while the batch notifies the controllers of their new positions
+        for (MoveRequest& move : m_runningMoves)
+        {
+            if (move.m_controller == &controller)
+            {
+                move.m_controller = nullptr;
+            }
+        }
+    }
+
+    void CharacterMoveBatch::QueueMove(CharacterController& controller, const AZ::Vector3& deltaPosition, float deltaTime)
+    {
+        m_queuedMoves.push_back({ &controller, controller.GetEntityId(), deltaPosition, deltaTime });
+    }
+
+    size_t CharacterMoveBatch::GetNumQueuedMoves() const
+    {
+        return m_queuedMoves.size();
+    }
+
+    void CharacterMoveBatch::Flush()
+    {
+        if (m_queuedMoves.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        // Controllers notified below can queue new moves, those run in the next batch
+        m_runningMoves.swap(m_queuedMoves);
+        m_queuedMoves.clear();
+
+        // The order of the entities is deterministic, the order they queued their moves in isn't. Controllers with the
+        // same entity id keep the order of their requests so their moves can be merged below.
+        AZStd::stable_sort(m_runningMoves.begin(), m_runningMoves.end(), [](const MoveRequest& lhs, const MoveRequest& rhs)
+        {
+            return lhs.m_entityId < rhs.m_entityId;
+        });
+
+        size_t numMoves = 0;
+        for (const MoveRequest& move : m_runningMoves)
+        {
+            MoveRequest* mergedMove = nullptr;
+            for (size_t moveIndex = numMoves; moveIndex > 0 && m_runningMoves[moveIndex - 1].m_entityId == move.m_entityId; --moveIndex)
+            {
+                if (m_runningMoves[moveIndex - 1].m_controller == move.m_controller)
+                {
+                    mergedMove = &m_runningMoves[moveIndex - 1];
+                    break;
+                }
+            }
+
+            if (mergedMove)
+            {
+                mergedMove->m_deltaPosition += move.m_deltaPosition;
+                mergedMove->m_deltaTime += move.m_deltaTime;
+            }
+            else
+            {
+                m_runningMoves[numMoves++] = move;
+            }
+        }
+        m_runningMoves.resize(numMoves);
+
+        m_newPositions.resize(numMoves);
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_scene);
+            for (size_t moveIndex = 0; moveIndex < numMoves; ++moveIndex)
+            {
+                const MoveRequest& move = m_runningMoves[moveIndex];
+                m_newPositions[moveIndex] = move.m_controller->ApplyMove(move.m_deltaPosition, move.m_deltaTime);
+            }
+        }
+
+        for (size_t moveIndex = 0; moveIndex < numMoves; ++moveIndex)
+        {
+            const CharacterController* controller = m_runningMoves[moveIndex].m_controller;
+            if (controller && controller->m_deferredMoveHandler)
+            {
+                controller->m_deferredMoveHandler(m_newPositions[moveIndex]);
+            }
+        }
+
+        m_runningMoves.clear();
+    }
+
+    // Physics::WorldNotificationBus
+    void CharacterMoveBatch::OnPrePhysicsUpdate(float /*fixedDeltaTime*/)
+    {
+        Flush();
+    }
+
+    int CharacterMoveBatch::GetPhysicsTickOrder()
+    {
+        // After the components, scripts and game code which move characters from the physics update,
+        // game code handlers keeping the default order
+        return Default + 1;
+    }
+} // namespace PhysXCharacters
@@ -0,0 +1,72 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/World.h>
+
+namespace physx
+{
+    class PxScene;
+} // namespace physx
+
+namespace PhysXCharacters
+{
+    class CharacterController;
+
+    /// Runs the moves of the character controllers in deferred mode of a world as one batch.
+    /// Controllers in deferred mode queue their moves when they are requested, usually from their entity's tick, and
+    /// the batch runs them before the next physics update, taking the scene lock once for all of them.
+    /// Moves run in entity id order, so controllers pushing against each other resolve the same way whatever order
+    /// their entities ticked in. Several moves queued by the same controller are merged into one.
+    /// The batch keeps track of the controllers using it, when it is destroyed with its world they go back to moving
+    /// immediately instead of keeping a dangling pointer to it.
+    class CharacterMoveBatch
+        : public Physics::WorldNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CharacterMoveBatch, AZ::SystemAllocator, 0);
+
+        explicit CharacterMoveBatch(const Physics::World& world);
+        ~CharacterMoveBatch();
+
+        void AddController(CharacterController& controller);
+        /// Forgets a controller and drops the moves it queued.
+        void RemoveController(const CharacterController& controller);
+        void QueueMove(CharacterController& controller, const AZ::Vector3& deltaPosition, float deltaTime);
+        size_t GetNumQueuedMoves() const;
+
+        /// Runs the queued moves, then notifies the controllers of their new positions once the scene is unlocked.
+        void Flush();
+
+        // Physics::WorldNotificationBus
+        void OnPrePhysicsUpdate(float fixedDeltaTime) override;
+        int GetPhysicsTickOrder() override;
+
+    private:
+        struct MoveRequest
+        {
+            CharacterController* m_controller;
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_deltaPosition;
+            float m_deltaTime;
+        };
+
+        physx::PxScene* m_scene = nullptr;
+        AZStd::vector<CharacterController*> m_controllers; ///< Controllers using the batch, reset when it is destroyed.
+        AZStd::vector<MoveRequest> m_queuedMoves;
+        AZStd::vector<MoveRequest> m_runningMoves; ///< Kept to reuse its memory between frames.
+        AZStd::vector<AZ::Vector3> m_newPositions;
+    };
+} // namespace PhysXCharacters
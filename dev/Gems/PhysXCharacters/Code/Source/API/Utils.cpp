@@ -153,6 +153,14 @@ namespace PhysXCharacters
             controller->CreateShadowBody(characterConfig, world);
             controller->SetTag(characterConfig.m_colliderTag);
 
+            if (characterConfig.RTTI_GetType() == CharacterControllerConfiguration::RTTI_Type()
+                && static_cast<const CharacterControllerConfiguration&>(characterConfig).m_deferMovement)
+            {
+                CharacterMoveBatch* moveBatch = nullptr;
+                SystemRequestBus::BroadcastResult(moveBatch, &SystemRequests::GetMoveBatch, world);
+                controller->SetMoveBatch(moveBatch);
+            }
+
             return controller;
         }
 
@@ -117,6 +117,14 @@ namespace PhysXCharacters
             // make the foot position coincide with the entity position.
             m_controller->SetBasePosition(entityTranslation);
             AttachColliders(*m_controller);
+
+            // Deferred moves report the new position the same way immediate moves do
+            const AZ::EntityId entityId = GetEntityId();
+            static_cast<CharacterController*>(m_controller.get())->SetDeferredMoveHandler([entityId](const AZ::Vector3& newPosition)
+            {
+                AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetWorldTranslation, newPosition);
+            });
+
             CharacterControllerRequestBus::Handler::BusConnect(GetEntityId());
         }
 
@@ -139,6 +147,12 @@ namespace PhysXCharacters
         CharacterControllerRequestBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::Handler::BusDisconnect();
         Physics::CharacterRequestBus::Handler::BusDisconnect();
+
+        if (m_controller && m_characterConfig->m_directControl)
+        {
+            // Drop the moves still queued, the controller is only deleted later
+            static_cast<CharacterController*>(m_controller.get())->SetMoveBatch(nullptr);
+        }
         Physics::Utils::DeferDelete(AZStd::move(m_controller));
     }
 
@@ -249,7 +263,10 @@ namespace PhysXCharacters
         }
 
         const AZ::Vector3& newPosition = m_controller->TryRelativeMove(deltaPosition, deltaTime);
-        AZ::TransformBus::Event(GetEntityId(), &AZ::TransformBus::Events::SetWorldTranslation, newPosition);
+        if (!static_cast<CharacterController*>(m_controller.get())->IsMovementDeferred())
+        {
+            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformBus::Events::SetWorldTranslation, newPosition);
+        }
         return newPosition;
     }
 
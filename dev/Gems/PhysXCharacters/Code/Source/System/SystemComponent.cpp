@@ -17,6 +17,7 @@
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/World.h>
 #include <API/CharacterController.h>
+#include <API/CharacterMoveBatch.h>
 #include <API/Ragdoll.h>
 #include <API/Utils.h>
 #include <System/SystemComponent.h>
@@ -86,6 +87,8 @@ namespace PhysXCharacters
         Physics::SystemNotificationBus::Handler::BusDisconnect();
         SystemRequestBus::Handler::BusDisconnect();
 
+        m_moveBatches.clear();
+
         for (auto worldManagerPair : m_controllerManagers)
         {
             worldManagerPair.second->release();
@@ -129,9 +132,37 @@ namespace PhysXCharacters
         return manager;
     }
 
+    CharacterMoveBatch* SystemComponent::GetMoveBatch(const Physics::World& world)
+    {
+        for (const auto& worldBatchPair : m_moveBatches)
+        {
+            if (worldBatchPair.first == &world)
+            {
+                return worldBatchPair.second.get();
+            }
+        }
+
+        m_moveBatches.emplace_back(&world, AZStd::make_unique<CharacterMoveBatch>(world));
+        return m_moveBatches.back().second.get();
+    }
+
     // Physics::SystemNotificationBus
     void SystemComponent::OnPreWorldDestroy(Physics::World* world)
     {
+        for (size_t worldBatchPairIndex = 0; worldBatchPairIndex < m_moveBatches.size();)
+        {
+            if (m_moveBatches[worldBatchPairIndex].first == world)
+            {
+                m_moveBatches[worldBatchPairIndex] = AZStd::move(m_moveBatches.back());
+                m_moveBatches.pop_back();
+            }
+
+            else
+            {
+                worldBatchPairIndex++;
+            }
+        }
+
         for (size_t worldManagerPairIndex = 0; worldManagerPairIndex < m_controllerManagers.size();)
         {
             if (m_controllerManagers[worldManagerPairIndex].first == world)
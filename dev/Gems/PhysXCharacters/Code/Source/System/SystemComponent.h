@@ -21,6 +21,7 @@
 namespace PhysXCharacters
 {
     class CharacterController;
+    class CharacterMoveBatch;
 
     class SystemComponent
         : public AZ::Component
@@ -49,6 +50,7 @@ namespace PhysXCharacters
 
         // SystemRequestBus
         physx::PxControllerManager* GetControllerManager(const Physics::World& world) override;
+        CharacterMoveBatch* GetMoveBatch(const Physics::World& world) override;
 
         // Physics::SystemNotificationBus
         virtual void OnPreWorldDestroy(Physics::World* world) override;
@@ -65,5 +67,6 @@ namespace PhysXCharacters
 
     private:
         AZStd::vector<AZStd::pair<const Physics::World*, physx::PxControllerManager*>> m_controllerManagers;
+        AZStd::vector<AZStd::pair<const Physics::World*, AZStd::unique_ptr<CharacterMoveBatch>>> m_moveBatches;
     };
 } // namespace PhysXCharacters
@@ -13,6 +13,8 @@
 #include <PhysXCharacters_precompiled.h>
 
 #include <API/CharacterController.h>
+#include <API/CharacterMoveBatch.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
@@ -38,6 +40,10 @@
 #include <System/SystemComponent.h>
 #include <Components/RagdollComponent.h>
 
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
 namespace PhysXCharacters
 {
     class PhysXCharactersTestEnvironment
@@ -443,6 +449,113 @@ namespace PhysXCharacters
         EXPECT_TRUE(m_triggerExitEvents.size() == 1);
     }
 
+    TEST_F(PhysXCharactersTest, CharacterController_DeferredMovement_MovesOnPhysicsUpdate)
+    {
+        ControllerTestBasis basis;
+
+        CharacterControllerConfiguration characterConfig;
+        characterConfig.m_entityId = AZ::EntityId(1);
+        characterConfig.m_deferMovement = true;
+        Physics::CapsuleShapeConfiguration shapeConfig;
+
+        AZStd::unique_ptr<Physics::Character> controller;
+        Physics::CharacterSystemRequestBus::BroadcastResult(controller,
+            &Physics::CharacterSystemRequests::CreateCharacter, characterConfig, shapeConfig, *basis.m_world);
+        ASSERT_TRUE(controller != nullptr);
+        EXPECT_TRUE(static_cast<CharacterController*>(controller.get())->IsMovementDeferred());
+
+        const AZ::Vector3 startPosition(0.0f, 2.0f, 0.0f);
+        controller->SetBasePosition(startPosition);
+
+        AZ::Vector3 handlerPosition = AZ::Vector3::CreateZero();
+        int handlerCalls = 0;
+        static_cast<CharacterController*>(controller.get())->SetDeferredMoveHandler(
+            [&handlerPosition, &handlerCalls](const AZ::Vector3& position)
+            {
+                handlerPosition = position;
+                handlerCalls++;
+            });
+
+        // the move is queued, the controller stays where it is until the next physics update
+        const AZ::Vector3 movementDelta = AZ::Vector3::CreateAxisX(0.1f);
+        EXPECT_TRUE(controller->TryRelativeMove(movementDelta, basis.m_timeStep).IsClose(startPosition));
+        EXPECT_TRUE(controller->TryRelativeMove(movementDelta, basis.m_timeStep).IsClose(startPosition));
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(startPosition));
+        EXPECT_EQ(handlerCalls, 0);
+
+        // both moves are merged and applied once
+        basis.Update(AZ::Vector3::CreateZero());
+
+        const AZ::Vector3 expectedPosition = startPosition + 2.0f * movementDelta;
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(expectedPosition));
+        EXPECT_EQ(handlerCalls, 1);
+        EXPECT_TRUE(handlerPosition.IsClose(expectedPosition));
+
+        // moves queued by a controller which is deleted are dropped
+        controller->TryRelativeMove(movementDelta, basis.m_timeStep);
+        controller = nullptr;
+        basis.Update(AZ::Vector3::CreateZero());
+        EXPECT_EQ(handlerCalls, 1);
+    }
+
+    TEST_F(PhysXCharactersTest, CharacterController_DeferredMovementOfBlockingControllers_IndependentOfRequestOrder)
+    {
+        ControllerTestBasis basis;
+
+        CharacterControllerConfiguration characterConfig;
+        characterConfig.m_deferMovement = true;
+        Physics::CapsuleShapeConfiguration shapeConfig;
+
+        // two controllers walking into each other, the first one to move takes the space between them
+        auto moveControllers = [&](bool reverseRequestOrder)
+        {
+            AZStd::unique_ptr<Physics::Character> controllers[2];
+            for (int i = 0; i < 2; i++)
+            {
+                characterConfig.m_entityId = AZ::EntityId(i + 1);
+                Physics::CharacterSystemRequestBus::BroadcastResult(controllers[i],
+                    &Physics::CharacterSystemRequests::CreateCharacter, characterConfig, shapeConfig, *basis.m_world);
+                controllers[i]->SetBasePosition(AZ::Vector3(i == 0 ? -0.5f : 0.5f, 2.0f, 0.0f));
+            }
+
+            for (int i = 0; i < 2; i++)
+            {
+                const int controllerIndex = reverseRequestOrder ? 1 - i : i;
+                controllers[controllerIndex]->TryRelativeMove(AZ::Vector3::CreateAxisX(controllerIndex == 0 ? 0.4f : -0.4f), basis.m_timeStep);
+            }
+            basis.Update(AZ::Vector3::CreateZero());
+
+            return AZStd::make_pair(controllers[0]->GetBasePosition(), controllers[1]->GetBasePosition());
+        };
+
+        auto positions = moveControllers(false);
+        auto reversedPositions = moveControllers(true);
+
+        EXPECT_TRUE(positions.first.IsClose(reversedPositions.first));
+        EXPECT_TRUE(positions.second.IsClose(reversedPositions.second));
+
+        // the controllers were blocked, so they can't both have made their full move
+        EXPECT_GT(positions.second.GetX() - positions.first.GetX(), 0.2f);
+    }
+
+    TEST_F(PhysXCharactersTest, CharacterController_MoveBatchDestroyedFirst_ControllerMovesImmediately)
+    {
+        ControllerTestBasis basis;
+        CharacterController* controller = static_cast<CharacterController*>(basis.m_controller.get());
+
+        // a batch destroyed with its world leaves the controllers which were using it in immediate mode
+        auto moveBatch = AZStd::make_unique<CharacterMoveBatch>(*basis.m_world);
+        controller->SetMoveBatch(moveBatch.get());
+        controller->TryRelativeMove(AZ::Vector3::CreateAxisX(0.1f), basis.m_timeStep);
+        EXPECT_EQ(moveBatch->GetNumQueuedMoves(), 1);
+        moveBatch = nullptr;
+
+        EXPECT_FALSE(controller->IsMovementDeferred());
+        const AZ::Vector3 movementDelta = AZ::Vector3::CreateAxisX(0.1f);
+        const AZ::Vector3 startPosition = controller->GetBasePosition();
+        EXPECT_TRUE(controller->TryRelativeMove(movementDelta, basis.m_timeStep).IsClose(startPosition + movementDelta));
+    }
+
     TEST_F(PhysXCharactersTest, RagdollComponentSerialization_SharedPointerVersion1_NotRegisteredErrorDoesNotOccur)
     {
         // A stream buffer corresponding to a ragdoll component that was serialized before the "PhysXRagdoll" element
@@ -466,5 +579,89 @@ namespace PhysXCharacters
     }
 
     AZ_UNIT_TEST_HOOK(new PhysXCharactersTestEnvironment);
+
+#ifdef HAVE_BENCHMARK
+    namespace Benchmarks
+    {
+        static const int Seed = 100;
+
+        class CharacterControllerBenchmarkFixture
+            : public benchmark::Fixture
+            , public PhysXCharactersTestEnvironment
+        {
+        public:
+            //! Creates controllers standing in a grid on a floor.
+            //!
+            //! \state.range(0) - number of controllers
+            //! \state.range(1) - 1 for controllers with deferred movement
+            void SetUp(const ::benchmark::State& state) override
+            {
+                SetupEnvironment();
+
+                m_world = m_defaultWorld;
+                m_floor = Physics::AddStaticFloorToWorld(m_world.get(), defaultFloorTransform);
+
+                CharacterControllerConfiguration characterConfig;
+                characterConfig.m_deferMovement = state.range(1) != 0;
+                Physics::CapsuleShapeConfiguration shapeConfig;
+
+                const int numControllers = aznumeric_cast<int>(state.range(0));
+                const int gridSize = aznumeric_cast<int>(ceil(sqrt(aznumeric_cast<float>(numControllers))));
+                const float spacing = 0.6f;
+                const float gridOffset = -0.5f * spacing * gridSize;
+                for (int i = 0; i < numControllers; i++)
+                {
+                    characterConfig.m_entityId = AZ::EntityId(i + 1);
+                    AZStd::unique_ptr<Physics::Character> controller;
+                    Physics::CharacterSystemRequestBus::BroadcastResult(controller,
+                        &Physics::CharacterSystemRequests::CreateCharacter, characterConfig, shapeConfig, *m_world);
+                    controller->SetBasePosition(AZ::Vector3(gridOffset + spacing * (i % gridSize), gridOffset + spacing * (i / gridSize), 0.0f));
+                    m_controllers.push_back(AZStd::move(controller));
+                }
+                m_world->Update(m_timeStep);
+            }
+
+            void TearDown(const ::benchmark::State& state) override
+            {
+                m_controllers.clear();
+                m_floor = nullptr;
+                m_world = nullptr;
+                TeardownEnvironment();
+            }
+
+        protected:
+            AZStd::shared_ptr<Physics::World> m_world;
+            AZStd::shared_ptr<Physics::RigidBodyStatic> m_floor;
+            AZStd::vector<AZStd::unique_ptr<Physics::Character>> m_controllers;
+            float m_timeStep = 1.0f / 60.0f;
+        };
+
+        //! Every frame each controller walks in a random direction, bumping into its neighbours in the grid.
+        BENCHMARK_DEFINE_F(CharacterControllerBenchmarkFixture, BM_CharacterControllerMoves)(benchmark::State& state)
+        {
+            AZ::SimpleLcgRandom random(Seed);
+            const float maxSpeed = 2.0f;
+
+            for (auto _ : state)
+            {
+                for (auto& controller : m_controllers)
+                {
+                    const AZ::Vector3 velocity(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, 0.0f);
+                    controller->TryRelativeMove(velocity * 2.0f * maxSpeed * m_timeStep, m_timeStep);
+                }
+                m_world->Update(m_timeStep);
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_controllers.size());
+        }
+
+        BENCHMARK_REGISTER_F(CharacterControllerBenchmarkFixture, BM_CharacterControllerMoves)
+            ->Args({ 1000, 0 })
+            ->Args({ 1000, 1 })
+            ->Unit(benchmark::kMillisecond);
+    } // namespace Benchmarks
+
+    AZ_BENCHMARK_HOOK()
+#endif
 } // namespace PhysXCharacters
 
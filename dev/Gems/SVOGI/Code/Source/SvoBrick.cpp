@@ -22,6 +22,7 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 
 #include "SvoBrick.h"
+#include "SvoVoxelizer.h"
 #include "I3DEngine.h"
 #include "IEntityRenderState.h"
 
@@ -182,73 +183,6 @@ namespace SVOGI
     }
 
 
-    //Note: This should ultimately be vectorized properly. 
-    bool SphereTriangleIntersection(const AZStd::vector<AZ::Vector3>& tri, const AZ::Vector3& center, AZ::VectorFloat radiusSq)
-    {
-        AZ::Vector3 v01 = tri[1] - tri[0];
-        AZ::Vector3 v02 = tri[2] - tri[0];
-
-        AZ::VectorFloat zero = AZ::VectorFloat(0.0f);
-        AZ::VectorFloat t;
-        AZ::Vector3 p;
-
-        p = center - tri[0];
-        AZ::VectorFloat d10 = v01.Dot(p);
-        AZ::VectorFloat d20 = v02.Dot(p);
-
-        //Nearest point is 0 index
-        if (d10 <= zero && d20 <= zero)
-        {
-            return p.Dot(p) <= radiusSq;
-        }
-
-        p = center - tri[1];
-        AZ::VectorFloat d11 = v01.Dot(p);
-        AZ::VectorFloat d21 = v02.Dot(p);
-
-        //Nearest point is 1 index.
-        if (d11 >= zero && d21 <= d11)
-        {
-            return p.Dot(p) <= radiusSq;
-        }
-
-        //Nearest point is on 0 to 1 edge
-        if (d10*d21 - d11 * d20 <= zero && d10 >= zero && d11 <= zero)
-        {
-            t = d10 / (d10 - d11);
-            p = center - (tri[0] + t * v01);
-            return p.Dot(p) <= radiusSq;
-        }
-
-        //Nearest point is 2 index;
-        p = center - tri[2];
-        AZ::VectorFloat d12 = v01.Dot(p);
-        AZ::VectorFloat d22 = v02.Dot(p);
-        if (d22 >= zero && d12 <= d22)
-        {
-            return p.Dot(p) <= radiusSq;
-        }
-
-        //Nearest point is along 0 to 2 edge.
-        if (d12*d20 - d10 * d22 <= zero && d20 >= zero && d22 <= zero)
-        {
-            t = d20 / (d20 - d22);
-            p = center - (tri[0] + t * v02);
-            return p.Dot(p) <= radiusSq;
-        }
-
-        //Nearest point is along 1 to 2 edge
-        if (d11*d22 - d12 * d21 <= zero && (d21 - d11) >= zero && (d12 - d22) >= zero)
-        {
-            t = (d21 - d11) / ((d21 - d11) + (d12 - d22));
-            p = center - (tri[1] + t * (tri[2] - tri[1]));
-            return p.Dot(p) <= radiusSq;
-        }
-
-        //If we made it this far we are inside the triangle
-        return true;
-    }
-
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Brick
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,21 +259,18 @@ namespace SVOGI
         AZStd::vector<AZ::Vector2> triUvs(3);
         AZStd::vector<ColorB> triColors(3);
 
-        AZ::VectorFloat subBrickRadius = (GetBrickSize() / brickDimension) * .5f;
-        AZ::VectorFloat subBrickRadiusSq = subBrickRadius * subBrickRadius;
-
-        AZ::VectorFloat subSubBrickRadius = subBrickRadius * .5f;
-        AZ::VectorFloat subSubBrickRadiusSq = subSubBrickRadius * subSubBrickRadius;
+        AZ::Aabb worldBrickAabb;
+        worldBrickAabb.SetMin(m_brickAabb.GetMin() + m_brickOrigin);
+        worldBrickAabb.SetMax(m_brickAabb.GetMax() + m_brickOrigin);
+        const BrickSampler sampler(worldBrickAabb, centers);
 
         bool dataGenerated = false;
 
-        const AZ::VectorFloat offsets[4] = { -3.f, -1.f, 1.f, 3.f };
-
         for (const auto& triangle : m_triangles)
         {
             //Note: All this triangle data needs to be restructured to be better vectorized.
             // AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Renderer, "Brick::ProcessMeshes::PerTriWork");
-            //Extract needed triangle data and compute containing plane. 
+            //Extract needed triangle data.
             triVerts = { LYVec3ToAZVec3(m_vertices[triangle.arrVertId[0]].v),
                 LYVec3ToAZVec3(m_vertices[triangle.arrVertId[1]].v),
                 LYVec3ToAZVec3(m_vertices[triangle.arrVertId[2]].v)
@@ -351,8 +282,6 @@ namespace SVOGI
 
             triColors = { m_vertices[triangle.arrVertId[0]].c, m_vertices[triangle.arrVertId[1]].c, m_vertices[triangle.arrVertId[2]].c };
 
-            AZ::Plane plane = AZ::Plane::CreateFromTriangle(triVerts[0], triVerts[1], triVerts[2]);
-
             AZ::VectorFloat triEmitance = 0.0f;
             SvoMaterialInfo& matInfo = m_materials.at(triangle.nMatID);
             if (matInfo.m_material)
@@ -360,56 +289,25 @@ namespace SVOGI
                 triEmitance = matInfo.m_material->GetShaderItem(0).m_pShaderResources->GetFinalEmittance().Luminance();
             }
 
-
-            //Each brick consists of NxNxN samples.  For each sample compute the triangle contribution.
-            for (AZ::u32 offset = 0; offset < brickDimension * brickDimension * brickDimension; ++offset)
-            {
-                //Check if the triangle is within the circumscribed sphere of the subbrick.  
-                //This could have the disadvantage of missing triangles that cut through the corners
-                //but if that becomes an issue there are several remedies. 
-                //1) decrease the voxel min size to increase sampling density.
-                //2) test against the circumscribing sphere and then do a box triangle test
-
-                //If the bounding sphere doesn't touch the plane skip. 
-                if (fabs(plane.GetPointDist(centers[offset])) > subBrickRadius)
-                {
-                    continue;
-                }
-
-                //Check if the sphere touches the triangle. 
-                if (!SphereTriangleIntersection(triVerts, centers[offset], subBrickRadiusSq))
+            //Each brick consists of NxNxN cells split into 4x4x4 samples. Compute the triangle contribution to the
+            //samples it touches, only the cells overlapping the triangle bounds are visited.
+            sampler.ForEachSample(triVerts.data(),
+                [&](AZ::u32 offset, int x, int y, int z, const AZ::Vector3& samplePoint)
                 {
-                    continue;
-                }
-                for (int x = 0; x < 4; ++x)
-                {
-                    for (int y = 0; y < 4; ++y)
+                    //AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Renderer, "Brick::ProcessMeshes::ComputeVoxelData");
+                    //Note: There are some redundant pointer indirections and function calls we could 
+                    //elide here if we need more perf later. 
+                    AZ::Color colTraced = ProcessMaterial(triangle, matInfo, triVerts, triUvs, triColors, samplePoint);
+                    if (colTraced.GetA() > 0.f)
                     {
-                        for (int z = 0; z < 4; ++z)
-                        {
-                            //AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Renderer, "Brick::ProcessMeshes::ComputeVoxelData");
-                            AZ::Vector3 samplePoint = centers[offset] + AZ::Vector3(offsets[x], offsets[y], offsets[z])*subSubBrickRadius;
-                            //Check if the sphere touches the triangle. 
-                            if (!SphereTriangleIntersection(triVerts, samplePoint, subSubBrickRadiusSq))
-                            {
-                                continue;
-                            }
-                            //Note: There are some redundant pointer indirections and function calls we could 
-                            //elide here if we need more perf later. 
-                            AZ::Color colTraced = ProcessMaterial(triangle, matInfo, triVerts, triUvs, triColors, samplePoint);
-                            if (colTraced.GetA() > 0.f)
-                            {
-                                //opacity = AZStd::max(opacity, AZStd::min(AZ::VectorFloat(triangle.nOpacity), SATURATEB(colTraced.GetA()*255.f)));
-                                data[offset].m_opacities[x][y][z] += AZ::VectorFloat(triangle.nOpacity);
-                                data[offset].m_normals[x][y][z] += (LYVec3ToAZVec3(triangle.vFaceNorm));
-                                data[offset].m_colors[x][y][z] += AZ::Color(colTraced.GetR(), colTraced.GetG(), colTraced.GetB(), AZ::VectorFloat(1.f));
-                                data[offset].m_emittances[x][y][z] += triEmitance;
-                                dataGenerated = true;
-                            }
-                        }
+                        //opacity = AZStd::max(opacity, AZStd::min(AZ::VectorFloat(triangle.nOpacity), SATURATEB(colTraced.GetA()*255.f)));
+                        data[offset].m_opacities[x][y][z] += AZ::VectorFloat(triangle.nOpacity);
+                        data[offset].m_normals[x][y][z] += (LYVec3ToAZVec3(triangle.vFaceNorm));
+                        data[offset].m_colors[x][y][z] += AZ::Color(colTraced.GetR(), colTraced.GetG(), colTraced.GetB(), AZ::VectorFloat(1.f));
+                        data[offset].m_emittances[x][y][z] += triEmitance;
+                        dataGenerated = true;
                     }
-                }
-            }
+                });
         }
         return dataGenerated;
     }
@@ -617,29 +515,11 @@ namespace SVOGI
         scratch.Reset();
         DataBrick<AZ::Vector3> centers;
 
-        AZ::Aabb voxBox;
-        AZ::Vector3 brickAabbData[2];
-        brickAabbData[0] = AZ::Vector3(m_brickAabb.GetMin() + m_brickOrigin);
-        brickAabbData[1] = AZ::Vector3(m_brickAabb.GetMax() + m_brickOrigin);
-
         //Generate subbrick centers.
-        for (AZ::u32 X = 0; X < brickDimension; X++)
-        {
-            for (AZ::u32 Y = 0; Y < brickDimension; Y++)
-            {
-                for (AZ::u32 Z = 0; Z < brickDimension; Z++)
-                {
-                    AZ::Vector3 vMin = brickAabbData[0] + (brickAabbData[1] - brickAabbData[0]) * AZ::Vector3((float)X / brickDimension, (float)Y / brickDimension, (float)Z / brickDimension);
-                    AZ::Vector3 vMax = brickAabbData[0] + (brickAabbData[1] - brickAabbData[0]) * AZ::Vector3((float)(X + 1) / brickDimension, (float)(Y + 1) / brickDimension, (float)(Z + 1) / brickDimension);
-
-                    voxBox.SetMin(vMin);
-                    voxBox.SetMax(vMax);
-
-                    AZ::u32 brickOffset = Z * brickDimension * brickDimension + Y * brickDimension + X;
-                    centers[brickOffset] = voxBox.GetCenter();
-                }
-            }
-        }
+        AZ::Aabb worldBrickAabb;
+        worldBrickAabb.SetMin(m_brickAabb.GetMin() + m_brickOrigin);
+        worldBrickAabb.SetMax(m_brickAabb.GetMax() + m_brickOrigin);
+        ComputeBrickCellCenters(worldBrickAabb, centers);
 
         {//Process Legacy Elements
 
@@ -648,9 +528,6 @@ namespace SVOGI
             {
                 m_collectedLegacyObjects = true;
 
-                AZ::Aabb worldBrickAabb;
-                worldBrickAabb.SetMin(m_brickAabb.GetMin() + m_brickOrigin);
-                worldBrickAabb.SetMax(m_brickAabb.GetMax() + m_brickOrigin);
                 Brick::CollectLegacyObjects(worldBrickAabb, &objects);
 
                 m_numLegacyObjects = objects.size();
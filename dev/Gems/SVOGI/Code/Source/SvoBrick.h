@@ -31,6 +31,8 @@
 #include "IStatObj.h"
 #include <SVOGI_Traits_Platform.h>
 
+#include "SvoDataBrick.h"
+
 
 namespace AzFramework
 {
@@ -67,27 +69,9 @@ namespace SVOGI
 
     using EntityMeshDataMap = AZStd::unordered_map<AZ::EntityId, AZStd::shared_ptr<MeshData>>;
 
-    const AZ::s32 brickDimension = (16);
     const AZ::s32 nVoxBloMaxDim = (16);
     const AZ::s32 nVoxNodMaxDim = 2;
 
-    template <typename T>
-    struct DataBrick
-    {
-        AZ_CLASS_ALLOCATOR(DataBrick, AZ::SystemAllocator, 0);
-        T m_data[brickDimension * brickDimension * brickDimension];
-        DataBrick()
-        {
-            Reset();
-        }
-        T& operator[](size_t idx) { return m_data[idx]; }
-        const T& operator[](size_t idx) const { return m_data[idx]; }
-        void Reset()
-        {
-            memset(m_data, 0, sizeof(m_data));
-        }
-    };
-
     struct ObjectInfo
     {
         ObjectInfo() { memset(this, 0, sizeof(*this)); }
@@ -155,14 +139,6 @@ namespace SVOGI
     };
     
 
-    struct GISubVoxels
-    {
-        AZ::Color m_colors[4][4][4];
-        AZ::Vector3 m_normals[4][4][4];
-        AZ::VectorFloat m_emittances[4][4][4];
-        AZ::VectorFloat m_opacities[4][4][4];
-    };
-
     class Brick
         : public SuperMesh
     {
@@ -0,0 +1,55 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+// Original file Copyright Crytek GMBH or its affiliates, used under license.
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Vector3.h>
+
+#include <cstring>//for memset
+
+/*
+ Brick data storage shared by the bricks of the tree and the voxelizer. Only depends on AzCore so
+ the voxelization can run without a renderer.
+*/
+namespace SVOGI
+{
+    const AZ::s32 brickDimension = (16);
+
+    //Cells of a brick are indexed z * brickDimension * brickDimension + y * brickDimension + x.
+    template <typename T>
+    struct DataBrick
+    {
+        AZ_CLASS_ALLOCATOR(DataBrick, AZ::SystemAllocator, 0);
+        T m_data[brickDimension * brickDimension * brickDimension];
+        DataBrick()
+        {
+            Reset();
+        }
+        T& operator[](size_t idx) { return m_data[idx]; }
+        const T& operator[](size_t idx) const { return m_data[idx]; }
+        void Reset()
+        {
+            memset(m_data, 0, sizeof(m_data));
+        }
+    };
+
+    struct GISubVoxels
+    {
+        AZ::Color m_colors[4][4][4];
+        AZ::Vector3 m_normals[4][4][4];
+        AZ::VectorFloat m_emittances[4][4][4];
+        AZ::VectorFloat m_opacities[4][4][4];
+    };
+}
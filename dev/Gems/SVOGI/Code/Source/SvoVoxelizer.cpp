@@ -0,0 +1,135 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "StdAfx.h"
+
+#include "SvoVoxelizer.h"
+
+namespace SVOGI
+{
+    BrickCellRange GetBrickCellRange(const AZ::Aabb& brickBox, const AZ::Aabb& box, float radius)
+    {
+        BrickCellRange range;
+        const AZ::Vector3 cellSize = brickBox.GetExtents() / AZ::VectorFloat(static_cast<float>(brickDimension));
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            //The center of cell i is at brickMin + (i + 0.5) * cellSize. Round outwards, an extra cell
+            //only costs a rejected sphere test while a missing one would lose samples.
+            const float brickMin = brickBox.GetMin().GetElement(axis);
+            const float size = cellSize.GetElement(axis);
+            const float low = floorf((box.GetMin().GetElement(axis) - radius - brickMin) / size - 0.5f);
+            const float high = ceilf((box.GetMax().GetElement(axis) + radius - brickMin) / size - 0.5f);
+            //Clamp before converting, the box can be far outside the brick. An empty range has min > max.
+            range.m_min[axis] = static_cast<AZ::s32>(AZ::GetClamp(low, 0.0f, static_cast<float>(brickDimension)));
+            range.m_max[axis] = static_cast<AZ::s32>(AZ::GetClamp(high, -1.0f, static_cast<float>(brickDimension - 1)));
+        }
+        return range;
+    }
+
+    void ComputeBrickCellCenters(const AZ::Aabb& brickBox, DataBrick<AZ::Vector3>& centers)
+    {
+        const AZ::Vector3 brickMin = brickBox.GetMin();
+        const AZ::Vector3 brickExtents = brickBox.GetExtents();
+
+        for (AZ::u32 X = 0; X < brickDimension; X++)
+        {
+            for (AZ::u32 Y = 0; Y < brickDimension; Y++)
+            {
+                for (AZ::u32 Z = 0; Z < brickDimension; Z++)
+                {
+                    AZ::Vector3 vMin = brickMin + brickExtents * AZ::Vector3((float)X / brickDimension, (float)Y / brickDimension, (float)Z / brickDimension);
+                    AZ::Vector3 vMax = brickMin + brickExtents * AZ::Vector3((float)(X + 1) / brickDimension, (float)(Y + 1) / brickDimension, (float)(Z + 1) / brickDimension);
+
+                    AZ::u32 brickOffset = Z * brickDimension * brickDimension + Y * brickDimension + X;
+                    centers[brickOffset] = (vMin + vMax) * 0.5f;
+                }
+            }
+        }
+    }
+
+    //Note: This should ultimately be vectorized properly.
+    bool SphereTriangleIntersection(const AZ::Vector3* tri, const AZ::Vector3& center, AZ::VectorFloat radiusSq)
+    {
+        AZ::Vector3 v01 = tri[1] - tri[0];
+        AZ::Vector3 v02 = tri[2] - tri[0];
+
+        AZ::VectorFloat zero = AZ::VectorFloat(0.0f);
+        AZ::VectorFloat t;
+        AZ::Vector3 p;
+
+        p = center - tri[0];
+        AZ::VectorFloat d10 = v01.Dot(p);
+        AZ::VectorFloat d20 = v02.Dot(p);
+
+        //Nearest point is 0 index
+        if (d10 <= zero && d20 <= zero)
+        {
+            return p.Dot(p) <= radiusSq;
+        }
+
+        p = center - tri[1];
+        AZ::VectorFloat d11 = v01.Dot(p);
+        AZ::VectorFloat d21 = v02.Dot(p);
+
+        //Nearest point is 1 index.
+        if (d11 >= zero && d21 <= d11)
+        {
+            return p.Dot(p) <= radiusSq;
+        }
+
+        //Nearest point is on 0 to 1 edge
+        if (d10*d21 - d11 * d20 <= zero && d10 >= zero && d11 <= zero)
+        {
+            t = d10 / (d10 - d11);
+            p = center - (tri[0] + t * v01);
+            return p.Dot(p) <= radiusSq;
+        }
+
+        //Nearest point is 2 index;
+        p = center - tri[2];
+        AZ::VectorFloat d12 = v01.Dot(p);
+        AZ::VectorFloat d22 = v02.Dot(p);
+        if (d22 >= zero && d12 <= d22)
+        {
+            return p.Dot(p) <= radiusSq;
+        }
+
+        //Nearest point is along 0 to 2 edge.
+        if (d12*d20 - d10 * d22 <= zero && d20 >= zero && d22 <= zero)
+        {
+            t = d20 / (d20 - d22);
+            p = center - (tri[0] + t * v02);
+            return p.Dot(p) <= radiusSq;
+        }
+
+        //Nearest point is along 1 to 2 edge
+        if (d11*d22 - d12 * d21 <= zero && (d21 - d11) >= zero && (d12 - d22) >= zero)
+        {
+            t = (d21 - d11) / ((d21 - d11) + (d12 - d22));
+            p = center - (tri[1] + t * (tri[2] - tri[1]));
+            return p.Dot(p) <= radiusSq;
+        }
+
+        //If we made it this far we are inside the triangle
+        return true;
+    }
+
+    BrickSampler::BrickSampler(const AZ::Aabb& brickBox, const DataBrick<AZ::Vector3>& centers)
+        : m_brickBox(brickBox)
+        , m_centers(centers)
+    {
+        m_subBrickRadius = (brickBox.GetDepth() / brickDimension) * .5f;
+        m_subBrickRadiusSq = m_subBrickRadius * m_subBrickRadius;
+        m_subSubBrickRadius = m_subBrickRadius * .5f;
+        m_subSubBrickRadiusSq = m_subSubBrickRadius * m_subSubBrickRadius;
+    }
+}
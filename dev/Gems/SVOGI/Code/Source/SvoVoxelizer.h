@@ -0,0 +1,123 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
+
+#include "SvoDataBrick.h"
+
+/*
+ Sampling of triangles into the cells of a brick, used by Brick::ProcessTriangles. Only depends on AzCore
+ so it can run on any thread, and without a renderer, for example from benchmarks.
+*/
+namespace SVOGI
+{
+    //Inclusive range of cells of a brick, per axis.
+    struct BrickCellRange
+    {
+        AZ::s32 m_min[3];
+        AZ::s32 m_max[3];
+
+        bool IsEmpty() const
+        {
+            return m_min[0] > m_max[0] || m_min[1] > m_max[1] || m_min[2] > m_max[2];
+        }
+    };
+
+    //Returns the cells of the brick whose center is within radius of the box.
+    //Only these cells can have a sample sphere of that radius touching a triangle bounded by the box.
+    BrickCellRange GetBrickCellRange(const AZ::Aabb& brickBox, const AZ::Aabb& box, float radius);
+
+    //Computes the world position of the center of each cell of the brick.
+    void ComputeBrickCellCenters(const AZ::Aabb& brickBox, DataBrick<AZ::Vector3>& centers);
+
+    bool SphereTriangleIntersection(const AZ::Vector3* tri, const AZ::Vector3& center, AZ::VectorFloat radiusSq);
+
+    //Finds the sub voxel samples of a brick touched by triangles.
+    //Each cell of the brick is split into 4x4x4 samples, a sample is touched when its bounding sphere
+    //touches the triangle. Only the cells overlapping the bounds of the triangle are tested.
+    class BrickSampler
+    {
+    public:
+        BrickSampler(const AZ::Aabb& brickBox, const DataBrick<AZ::Vector3>& centers);
+
+        //Calls sampleFunc(cellOffset, x, y, z, samplePoint) for each sample touched by the triangle.
+        template<typename SampleFunc>
+        void ForEachSample(const AZ::Vector3* triVerts, SampleFunc&& sampleFunc) const;
+
+    private:
+        AZ::Aabb                        m_brickBox;
+        const DataBrick<AZ::Vector3>&   m_centers;
+        AZ::VectorFloat                 m_subBrickRadius;
+        AZ::VectorFloat                 m_subBrickRadiusSq;
+        AZ::VectorFloat                 m_subSubBrickRadius;
+        AZ::VectorFloat                 m_subSubBrickRadiusSq;
+    };
+
+    template<typename SampleFunc>
+    void BrickSampler::ForEachSample(const AZ::Vector3* triVerts, SampleFunc&& sampleFunc) const
+    {
+        AZ::Aabb triBox = AZ::Aabb::CreateFromPoint(triVerts[0]);
+        triBox.AddPoint(triVerts[1]);
+        triBox.AddPoint(triVerts[2]);
+
+        const BrickCellRange cells = GetBrickCellRange(m_brickBox, triBox, m_subBrickRadius);
+        if (cells.IsEmpty())
+        {
+            return;
+        }
+
+        const AZ::Plane plane = AZ::Plane::CreateFromTriangle(triVerts[0], triVerts[1], triVerts[2]);
+        const AZ::VectorFloat offsets[4] = { -3.f, -1.f, 1.f, 3.f };
+
+        for (AZ::s32 Z = cells.m_min[2]; Z <= cells.m_max[2]; ++Z)
+        {
+            for (AZ::s32 Y = cells.m_min[1]; Y <= cells.m_max[1]; ++Y)
+            {
+                for (AZ::s32 X = cells.m_min[0]; X <= cells.m_max[0]; ++X)
+                {
+                    const AZ::u32 offset = Z * brickDimension * brickDimension + Y * brickDimension + X;
+                    const AZ::Vector3& center = m_centers[offset];
+
+                    //If the bounding sphere doesn't touch the plane skip.
+                    if (fabs(plane.GetPointDist(center)) > m_subBrickRadius)
+                    {
+                        continue;
+                    }
+
+                    //Check if the sphere touches the triangle.
+                    if (!SphereTriangleIntersection(triVerts, center, m_subBrickRadiusSq))
+                    {
+                        continue;
+                    }
+
+                    for (int x = 0; x < 4; ++x)
+                    {
+                        for (int y = 0; y < 4; ++y)
+                        {
+                            for (int z = 0; z < 4; ++z)
+                            {
+                                AZ::Vector3 samplePoint = center + AZ::Vector3(offsets[x], offsets[y], offsets[z]) * m_subSubBrickRadius;
+                                if (SphereTriangleIntersection(triVerts, samplePoint, m_subSubBrickRadiusSq))
+                                {
+                                    sampleFunc(offset, x, y, z, samplePoint);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -14,6 +14,15 @@
 
 #include <AzTest/AzTest.h>
 
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Source/SvoVoxelizer.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 class SVOGITest
     : public ::testing::Test
 {
@@ -34,4 +43,256 @@ TEST_F(SVOGITest, ExampleTest)
     ASSERT_TRUE(true);
 }
 
+namespace SVOGI
+{
+    struct SceneTriangle
+    {
+        AZ::Vector3 m_vertices[3];
+    };
+
+    //A scene of randomly placed boxes voxelized without a renderer. The scene is split in a grid of bricks and each
+    //brick overlapped by a box gets the triangles overlapping it.
+    class SyntheticVoxelScene
+    {
+    public:
+        struct SceneBrick
+        {
+            AZ::Aabb                            m_box;
+            AZStd::vector<SceneTriangle>    m_triangles;
+        };
+
+        void Build(AZ::u32 numBoxes, float sceneSize, float brickSize)
+        {
+            AZ::SimpleLcgRandom random(1234);
+            m_triangles.clear();
+            for (AZ::u32 boxIndex = 0; boxIndex < numBoxes; ++boxIndex)
+            {
+                const AZ::Vector3 center(random.GetRandomFloat() * sceneSize, random.GetRandomFloat() * sceneSize, random.GetRandomFloat() * sceneSize);
+                const AZ::Vector3 halfSize = AZ::Vector3(0.5f + random.GetRandomFloat() * brickSize);
+                AddBox(AZ::Aabb::CreateCenterHalfExtents(center, halfSize));
+            }
+
+            m_bricks.clear();
+            const AZ::s32 bricksPerAxis = static_cast<AZ::s32>(sceneSize / brickSize);
+            for (AZ::s32 z = 0; z < bricksPerAxis; ++z)
+            {
+                for (AZ::s32 y = 0; y < bricksPerAxis; ++y)
+                {
+                    for (AZ::s32 x = 0; x < bricksPerAxis; ++x)
+                    {
+                        const AZ::Vector3 brickMin = AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * brickSize;
+                        SceneBrick brick;
+                        brick.m_box = AZ::Aabb::CreateFromMinMax(brickMin, brickMin + AZ::Vector3(brickSize));
+                        for (const SceneTriangle& triangle : m_triangles)
+                        {
+                            if (GetTriangleBox(triangle).Overlaps(brick.m_box))
+                            {
+                                brick.m_triangles.push_back(triangle);
+                            }
+                        }
+                        if (!brick.m_triangles.empty())
+                        {
+                            m_bricks.emplace_back(AZStd::move(brick));
+                        }
+                    }
+                }
+            }
+        }
+
+        void AddBox(const AZ::Aabb& box)
+        {
+            AZ::Vector3 corners[8];
+            for (AZ::u8 corner = 0; corner < 8; ++corner)
+            {
+                corners[corner] = AZ::Vector3(
+                    (corner & 4) ? box.GetMax().GetX() : box.GetMin().GetX(),
+                    (corner & 2) ? box.GetMax().GetY() : box.GetMin().GetY(),
+                    (corner & 1) ? box.GetMax().GetZ() : box.GetMin().GetZ());
+            }
+
+            const AZ::u8 faces[6][4] = { { 0, 1, 3, 2 }, { 4, 6, 7, 5 }, { 0, 4, 5, 1 }, { 2, 3, 7, 6 }, { 0, 2, 6, 4 }, { 1, 5, 7, 3 } };
+            for (const auto& face : faces)
+            {
+                AddTriangle(corners[face[0]], corners[face[1]], corners[face[2]]);
+                AddTriangle(corners[face[0]], corners[face[2]], corners[face[3]]);
+            }
+        }
+
+        void AddTriangle(const AZ::Vector3& v0, const AZ::Vector3& v1, const AZ::Vector3& v2)
+        {
+            SceneTriangle triangle;
+            triangle.m_vertices[0] = v0;
+            triangle.m_vertices[1] = v1;
+            triangle.m_vertices[2] = v2;
+            m_triangles.push_back(triangle);
+        }
+
+        AZStd::vector<SceneTriangle> m_triangles;
+        AZStd::vector<SceneBrick> m_bricks;
+
+    private:
+
+        static AZ::Aabb GetTriangleBox(const SceneTriangle& triangle)
+        {
+            AZ::Aabb box = AZ::Aabb::CreateFromPoint(triangle.m_vertices[0]);
+            box.AddPoint(triangle.m_vertices[1]);
+            box.AddPoint(triangle.m_vertices[2]);
+            return box;
+        }
+    };
+
+    //Adds the opacity of the triangles to the samples they touch, as Brick::ProcessTriangles does before resolving materials.
+    static AZ::u32 SampleTriangles(const AZ::Aabb& brickBox, const DataBrick<AZ::Vector3>& centers, const AZStd::vector<SceneTriangle>& triangles, DataBrick<GISubVoxels>& data)
+    {
+        const BrickSampler sampler(brickBox, centers);
+        AZ::u32 numSamples = 0;
+        for (const SceneTriangle& triangle : triangles)
+        {
+            sampler.ForEachSample(triangle.m_vertices,
+                [&](AZ::u32 offset, int x, int y, int z, const AZ::Vector3&)
+                {
+                    data[offset].m_opacities[x][y][z] += AZ::VectorFloat(255.0f);
+                    ++numSamples;
+                });
+        }
+        return numSamples;
+    }
+
+    using SvoVoxelizerTest = UnitTest::AllocatorsTestFixture;
+
+    TEST_F(SvoVoxelizerTest, GetBrickCellRange_ContainsEveryTouchedCell)
+    {
+        SyntheticVoxelScene scene;
+        scene.Build(16, 32.0f, 4.0f);
+        ASSERT_FALSE(scene.m_bricks.empty());
+
+        // The voxelization only visits the cells in the range of a triangle, every cell whose sphere
+        // touches the triangle has to be in it.
+        for (const SyntheticVoxelScene::SceneBrick& brick : scene.m_bricks)
+        {
+            DataBrick<AZ::Vector3> centers;
+            ComputeBrickCellCenters(brick.m_box, centers);
+            const AZ::VectorFloat subBrickRadius = (brick.m_box.GetDepth() / brickDimension) * .5f;
+
+            for (const SceneTriangle& triangle : brick.m_triangles)
+            {
+                AZ::Aabb triangleBox = AZ::Aabb::CreateFromPoint(triangle.m_vertices[0]);
+                triangleBox.AddPoint(triangle.m_vertices[1]);
+                triangleBox.AddPoint(triangle.m_vertices[2]);
+                const BrickCellRange range = GetBrickCellRange(brick.m_box, triangleBox, subBrickRadius);
+
+                for (AZ::s32 z = 0; z < brickDimension; ++z)
+                {
+                    for (AZ::s32 y = 0; y < brickDimension; ++y)
+                    {
+                        for (AZ::s32 x = 0; x < brickDimension; ++x)
+                        {
+                            const AZ::Vector3& center = centers[z * brickDimension * brickDimension + y * brickDimension + x];
+                            if (SphereTriangleIntersection(triangle.m_vertices, center, subBrickRadius * subBrickRadius))
+                            {
+                                EXPECT_TRUE(x >= range.m_min[0] && x <= range.m_max[0]);
+                                EXPECT_TRUE(y >= range.m_min[1] && y <= range.m_max[1]);
+                                EXPECT_TRUE(z >= range.m_min[2] && z <= range.m_max[2]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_F(SvoVoxelizerTest, BrickSampler_MatchesTestingEveryCell)
+    {
+        SyntheticVoxelScene scene;
+        scene.Build(16, 32.0f, 4.0f);
+        ASSERT_FALSE(scene.m_bricks.empty());
+
+        const AZ::VectorFloat offsets[4] = { -3.f, -1.f, 1.f, 3.f };
+        for (const SyntheticVoxelScene::SceneBrick& brick : scene.m_bricks)
+        {
+            DataBrick<AZ::Vector3> centers;
+            ComputeBrickCellCenters(brick.m_box, centers);
+            const AZ::VectorFloat subSubBrickRadius = (brick.m_box.GetDepth() / brickDimension) * .25f;
+
+            // Every sample of every cell, as the voxelization did before it visited only the cells in range
+            AZ::u32 numExpected = 0;
+            for (const SceneTriangle& triangle : brick.m_triangles)
+            {
+                for (const AZ::Vector3& center : centers.m_data)
+                {
+                    for (int x = 0; x < 4; ++x)
+                    {
+                        for (int y = 0; y < 4; ++y)
+                        {
+                            for (int z = 0; z < 4; ++z)
+                            {
+                                const AZ::Vector3 samplePoint = center + AZ::Vector3(offsets[x], offsets[y], offsets[z]) * subSubBrickRadius;
+                                if (SphereTriangleIntersection(triangle.m_vertices, samplePoint, subSubBrickRadius * subSubBrickRadius))
+                                {
+                                    ++numExpected;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            DataBrick<GISubVoxels>* data = aznew DataBrick<GISubVoxels>();
+            EXPECT_EQ(numExpected, SampleTriangles(brick.m_box, centers, brick.m_triangles, *data));
+            delete data;
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //Samples a synthetic scene brick by brick with no renderer, the triangle work of one SvoEnvironment voxel job.
+    class BM_SvoVoxelizer
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_scene = aznew SyntheticVoxelScene();
+            m_scene->Build(64, 64.0f, 4.0f);
+            m_centers = aznew DataBrick<AZ::Vector3>();
+            m_scratch = aznew DataBrick<GISubVoxels>();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_scratch;
+            delete m_centers;
+            delete m_scene;
+
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        SyntheticVoxelScene* m_scene = nullptr;
+        DataBrick<AZ::Vector3>* m_centers = nullptr;
+        DataBrick<GISubVoxels>* m_scratch = nullptr;
+    };
+
+    BENCHMARK_F(BM_SvoVoxelizer, BrickSampler)(benchmark::State& state)
+    {
+        AZ::u32 numSamples = 0;
+        while (state.KeepRunning())
+        {
+            for (const SyntheticVoxelScene::SceneBrick& brick : m_scene->m_bricks)
+            {
+                m_scratch->Reset();
+                ComputeBrickCellCenters(brick.m_box, *m_centers);
+                numSamples += SampleTriangles(brick.m_box, *m_centers, brick.m_triangles, *m_scratch);
+            }
+        }
+        state.counters["bricks"] = static_cast<double>(m_scene->m_bricks.size());
+        state.counters["triangles"] = static_cast<double>(m_scene->m_triangles.size());
+        benchmark::DoNotOptimize(numSamples);
+    }
+#endif // HAVE_BENCHMARK
+}
+
 AZ_UNIT_TEST_HOOK();
+#if defined(HAVE_BENCHMARK)
+AZ_BENCHMARK_HOOK()
+#endif // HAVE_BENCHMARK
@@ -10,22 +10,190 @@
 *
 */
 
+#pragma once
+
 #include <AzCore/Math/MathUtils.h>
+#include <ScriptedEntityTweener/ScriptedEntityTweenerEnums.h>
 
 namespace ScriptedEntityTweener
 {
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Time into one play of an animation, and the eased ratio between its initial and target values.
+    struct EasingSample
+    {
+        float m_timeActive = 0.0f;
+        float m_duration = 1.0f;
+        float m_ratio = 0.0f;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     //! A collection of common easing/tweening equations.
     class EasingEquations
     {
     public:
+        //! Number of easing method and easing type combinations, see GetEasingCurveIndex.
+        static const int EasingCurveCount = (static_cast<int>(EasingMethod::Bounce) + 1) * (static_cast<int>(EasingType::InOut) + 1);
+
+        using EasingFunction = float(*)(float timeActive, float duration, float valueInitial, float valueTarget);
+
+        //! Index of the easing curve in [0, EasingCurveCount), -1 for an invalid easing method or type.
+        static int GetEasingCurveIndex(EasingMethod easeMethod, EasingType easeType)
+        {
+            const int method = static_cast<int>(easeMethod);
+            const int type = static_cast<int>(easeType);
+            if (method < 0 || method > static_cast<int>(EasingMethod::Bounce) || type < 0 || type > static_cast<int>(EasingType::InOut))
+            {
+                return -1;
+            }
+            return method * (static_cast<int>(EasingType::InOut) + 1) + type;
+        }
+
+        //! All the equations are linear in the initial and target values, so the result of any curve is
+        //! valueInitial + (valueTarget - valueInitial) * GetEasingRatio(...), whatever the type of the values.
+        static float GetEasingRatio(EasingMethod easeMethod, EasingType easeType, float timeActive, float duration)
+        {
+            return GetEasingResult(easeMethod, easeType, timeActive, duration, 0.0f, 1.0f);
+        }
+
+        //! Evaluates the eased ratio of many samples of the same curve. The curve is only looked up once, instead of once
+        //! per sample as with GetEasingResult.
+        static void GetEasingRatios(EasingMethod easeMethod, EasingType easeType, EasingSample* samples, size_t numSamples)
+        {
+            EasingFunction easingFunction = GetEasingFunction(easeMethod, easeType);
+            if (!easingFunction)
+            {
+                AZ_Warning("ScriptedEntityTweener", false, "ScriptedEntityTweenerMath::GetEasingRatios - Trying to animate with an invalid easing function [%i, %i]", static_cast<int>(easeMethod), static_cast<int>(easeType));
+                for (size_t i = 0; i < numSamples; ++i)
+                {
+                    samples[i].m_ratio = 0.0f;
+                }
+                return;
+            }
+
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                samples[i].m_ratio = easingFunction(samples[i].m_timeActive, samples[i].m_duration, 0.0f, 1.0f);
+            }
+        }
+
+        //! Returns the equation used by GetEasingResult for the easing method and type, nullptr if there is none.
+        static EasingFunction GetEasingFunction(EasingMethod easeMethod, EasingType easeType)
+        {
+            switch (easeMethod)
+            {
+            case EasingMethod::Linear:
+                return &GetEasingResultLinear<float>;
+            case EasingMethod::Quad:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return [](float timeActive, float duration, float valueInitial, float valueTarget) { return GetEasingResultCombinedIn(static_cast<float>(EasingMethod::Quad), timeActive, duration, valueInitial, valueTarget); };
+                case EasingType::InOut:
+                    return &GetEasingResultInOutQuad<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutQuad<float>;
+                }
+            case EasingMethod::Cubic:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return [](float timeActive, float duration, float valueInitial, float valueTarget) { return GetEasingResultCombinedIn(static_cast<float>(EasingMethod::Cubic), timeActive, duration, valueInitial, valueTarget); };
+                case EasingType::InOut:
+                    return &GetEasingResultInOutCubic<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutCubic<float>;
+                }
+            case EasingMethod::Quart:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return [](float timeActive, float duration, float valueInitial, float valueTarget) { return GetEasingResultCombinedIn(static_cast<float>(EasingMethod::Quart), timeActive, duration, valueInitial, valueTarget); };
+                case EasingType::InOut:
+                    return &GetEasingResultInOutQuart<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutQuart<float>;
+                }
+            case EasingMethod::Quint:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return [](float timeActive, float duration, float valueInitial, float valueTarget) { return GetEasingResultCombinedIn(static_cast<float>(EasingMethod::Quint), timeActive, duration, valueInitial, valueTarget); };
+                case EasingType::InOut:
+                    return &GetEasingResultInOutQuint<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutQuint<float>;
+                }
+            case EasingMethod::Sine:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInSine<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutSine<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutSine<float>;
+                }
+            case EasingMethod::Expo:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInExpo<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutExpo<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutExpo<float>;
+                }
+            case EasingMethod::Circ:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInCirc<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutCirc<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutCirc<float>;
+                }
+            case EasingMethod::Elastic:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInElastic<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutElastic<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutElastic<float>;
+                }
+            case EasingMethod::Back:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInBack<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutBack<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutBack<float>;
+                }
+            case EasingMethod::Bounce:
+                switch (easeType)
+                {
+                case EasingType::In:
+                    return &GetEasingResultInBounce<float>;
+                case EasingType::InOut:
+                    return &GetEasingResultInOutBounce<float>;
+                default: //EasingType::Out:
+                    return &GetEasingResultOutBounce<float>;
+                }
+            }
+            return nullptr;
+        }
+
         template <typename T>
         static T GetEasingResult(EasingMethod easeMethod, EasingType easeType, float timeActive, float duration, T valueInitial, T valueTarget)
         {
             switch (easeMethod)
             {
             case EasingMethod::Linear:
-                return valueInitial + (valueTarget - valueInitial) * (timeActive / duration);
+                return GetEasingResultLinear(timeActive, duration, valueInitial, valueTarget);
             case EasingMethod::Quad:
                 switch (easeType)
                 {
@@ -141,6 +309,12 @@ namespace ScriptedEntityTweener
             return valueInitial;
         }
 
+        template <typename T>
+        static T GetEasingResultLinear(float timeActive, float duration, T valueInitial, T valueTarget)
+        {
+            return valueInitial + (valueTarget - valueInitial) * (timeActive / duration);
+        }
+
         //!Helper method to get EaseIn results for Quad, Cubic, Quart, and Quint since they all follow the same equation besides from how many times to multiply progressPercent.
         template <typename T>
         static T GetEasingResultCombinedIn(float expo, float timeActive, float duration, T valueInitial, T valueTarget)
@@ -16,27 +16,29 @@
 #include <ScriptedEntityTweener/ScriptedEntityTweenerBus.h>
 
 #include "ScriptedEntityTweenerSubtask.h"
-#include "ScriptedEntityTweenerMath.h"
 
 namespace ScriptedEntityTweener
 {
     namespace SubtaskHelper
     {
-        template <typename T>
-        AZ_INLINE void DoSafeSet(AZ::BehaviorEBus::VirtualProperty* prop, AZ::EntityId entityId, T& data)
+        AZ_INLINE void ConvertAnimatedValue(float animatedValue, float& propertyValue)
         {
-            if (!prop || !prop->m_setter)
-            {
-                return;
-            }
-            if (prop->m_setter->m_event)
-            {
-                prop->m_setter->m_event->Invoke(entityId, data);
-            }
-            else if (prop->m_setter->m_broadcast)
-            {
-                prop->m_setter->m_broadcast->Invoke(data);
-            }
+            propertyValue = animatedValue;
+        }
+
+        AZ_INLINE void ConvertAnimatedValue(const AZ::Vector3& animatedValue, AZ::Vector3& propertyValue)
+        {
+            propertyValue = animatedValue;
+        }
+
+        AZ_INLINE void ConvertAnimatedValue(const AZ::Vector3& animatedValue, AZ::Color& propertyValue)
+        {
+            propertyValue = AZ::Color::CreateFromVector3(animatedValue);
+        }
+
+        AZ_INLINE void ConvertAnimatedValue(const AZ::Quaternion& animatedValue, AZ::Quaternion& propertyValue)
+        {
+            propertyValue = animatedValue;
         }
 
         template <typename T>
@@ -84,24 +86,52 @@ namespace ScriptedEntityTweener
         return false;
     }
 
+    bool ScriptedEntityTweenerSubtask::PrepareEasingSample(EasingSample& sample)
+    {
+        m_hasEasingRatio = false;
+        if (m_isPaused || !m_isActive)
+        {
+            return false;
+        }
+
+        sample.m_timeActive = AZ::GetClamp(m_timeSinceStart + m_animationProperties.m_timeIntoAnimation, .0f, m_animationProperties.m_timeDuration);
+
+        //If animation is meant to complete instantly, set timeToComplete and timeAnimationActive to the same non-zero value, so the easing result is m_valueTarget
+        if (m_animationProperties.m_timeDuration == 0)
+        {
+            m_animationProperties.m_timeDuration = sample.m_timeActive = 1.0f;
+        }
+        sample.m_duration = m_animationProperties.m_timeDuration;
+        sample.m_ratio = 0.0f;
+
+        m_easingSample = sample;
+        return true;
+    }
+
     void ScriptedEntityTweenerSubtask::Update(float deltaTime, AZStd::set<CallbackData>& callbacks)
     {
         if (m_isPaused || !m_isActive)
         {
+            m_hasEasingRatio = false;
             return;
         }
         //TODO: Use m_animationProperties.m_amplitudeOverride
-        
-        float timeAnimationActive = AZ::GetClamp(m_timeSinceStart + m_animationProperties.m_timeIntoAnimation, .0f, m_animationProperties.m_timeDuration);
 
-        //If animation is meant to complete instantly, set timeToComplete and timeAnimationActive to the same non-zero value, so GetEasingResult will return m_valueTarget
-        if (m_animationProperties.m_timeDuration == 0)
+        if (!m_hasEasingRatio)
         {
-            m_animationProperties.m_timeDuration = timeAnimationActive = 1.0f;
+            EasingSample sample;
+            PrepareEasingSample(sample);
+            SetEasingRatio(EasingEquations::GetEasingRatio(m_animationProperties.m_easeMethod, m_animationProperties.m_easeType, sample.m_timeActive, sample.m_duration));
         }
+        m_hasEasingRatio = false;
+
+        const float timeAnimationActive = m_easingSample.m_timeActive;
+        const float easingRatio = m_easingSample.m_ratio;
 
         EntityAnimatedValue currentValue;
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        switch (m_propertyType)
+        {
+        case PropertyType::Float:
         {
             float initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -109,11 +139,11 @@ namespace ScriptedEntityTweener
             float targetValue;
             m_valueTarget.GetValue(targetValue);
 
-            currentValue.SetValue(EasingEquations::GetEasingResult(m_animationProperties.m_easeMethod, m_animationProperties.m_easeType, timeAnimationActive, m_animationProperties.m_timeDuration, initialValue, targetValue));
-
-            SetVirtualValue(currentValue);
+            currentValue.SetValue(initialValue + (targetValue - initialValue) * easingRatio);
+            break;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid() || m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid())
+        case PropertyType::Vector3:
+        case PropertyType::Color:
         {
             AZ::Vector3 initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -121,11 +151,10 @@ namespace ScriptedEntityTweener
             AZ::Vector3 targetValue;
             m_valueTarget.GetValue(targetValue);
 
-            currentValue.SetValue(EasingEquations::GetEasingResult(m_animationProperties.m_easeMethod, m_animationProperties.m_easeType, timeAnimationActive, m_animationProperties.m_timeDuration, initialValue, targetValue));
-
-            SetVirtualValue(currentValue);
+            currentValue.SetValue(initialValue + (targetValue - initialValue) * easingRatio);
+            break;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid())
+        case PropertyType::Quaternion:
         {
             AZ::Quaternion initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -133,9 +162,16 @@ namespace ScriptedEntityTweener
             AZ::Quaternion targetValue;
             m_valueTarget.GetValue(targetValue);
 
-            currentValue.SetValue(EasingEquations::GetEasingResult(m_animationProperties.m_easeMethod, m_animationProperties.m_easeType, timeAnimationActive, m_animationProperties.m_timeDuration, initialValue, targetValue));
+            currentValue.SetValue(initialValue + (targetValue - initialValue) * easingRatio);
+            break;
+        }
+        default:
+            break;
+        }
 
-            SetVirtualValue(currentValue);
+        if (m_setterThunk)
+        {
+            m_setterThunk(m_setter, m_entityId, currentValue);
         }
 
         float progressPercent = timeAnimationActive / m_animationProperties.m_timeDuration;
@@ -274,12 +310,93 @@ namespace ScriptedEntityTweener
         {
             m_virtualProperty = virtualProperty;
             m_virtualPropertyTypeId = virtualPropertyTypeId;
+            ResolveSetterThunk();
             return true;
         }
 
         return false;
     }
 
+    void ScriptedEntityTweenerSubtask::ResolveSetterThunk()
+    {
+        m_propertyType = PropertyType::Unsupported;
+        m_setterThunk = nullptr;
+        m_setter = nullptr;
+
+        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        {
+            m_propertyType = PropertyType::Float;
+        }
+        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid())
+        {
+            m_propertyType = PropertyType::Vector3;
+        }
+        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid())
+        {
+            m_propertyType = PropertyType::Color;
+        }
+        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid())
+        {
+            m_propertyType = PropertyType::Quaternion;
+        }
+
+        if (!m_virtualProperty->m_setter)
+        {
+            return;
+        }
+
+        const bool isEvent = m_virtualProperty->m_setter->m_event != nullptr;
+        m_setter = isEvent ? m_virtualProperty->m_setter->m_event : m_virtualProperty->m_setter->m_broadcast;
+        if (!m_setter)
+        {
+            return;
+        }
+
+        switch (m_propertyType)
+        {
+        case PropertyType::Float:
+            m_setterThunk = isEvent ? &InvokeEventSetter<float, float> : &InvokeBroadcastSetter<float, float>;
+            break;
+        case PropertyType::Vector3:
+            m_setterThunk = isEvent ? &InvokeEventSetter<AZ::Vector3, AZ::Vector3> : &InvokeBroadcastSetter<AZ::Vector3, AZ::Vector3>;
+            break;
+        case PropertyType::Color:
+            m_setterThunk = isEvent ? &InvokeEventSetter<AZ::Vector3, AZ::Color> : &InvokeBroadcastSetter<AZ::Vector3, AZ::Color>;
+            break;
+        case PropertyType::Quaternion:
+            m_setterThunk = isEvent ? &InvokeEventSetter<AZ::Quaternion, AZ::Quaternion> : &InvokeBroadcastSetter<AZ::Quaternion, AZ::Quaternion>;
+            break;
+        default:
+            m_setter = nullptr;
+            break;
+        }
+    }
+
+    template <typename ValueType, typename PropertyValueType>
+    void ScriptedEntityTweenerSubtask::InvokeEventSetter(const AZ::BehaviorMethod* setter, const AZ::EntityId& entityId, const EntityAnimatedValue& value)
+    {
+        ValueType animatedValue;
+        value.GetValue(animatedValue);
+        PropertyValueType propertyValue;
+        SubtaskHelper::ConvertAnimatedValue(animatedValue, propertyValue);
+
+        AZ::EntityId address = entityId;
+        AZ::BehaviorValueParameter arguments[] = { &address, &propertyValue };
+        setter->Call(arguments, 2);
+    }
+
+    template <typename ValueType, typename PropertyValueType>
+    void ScriptedEntityTweenerSubtask::InvokeBroadcastSetter(const AZ::BehaviorMethod* setter, const AZ::EntityId& /*entityId*/, const EntityAnimatedValue& value)
+    {
+        ValueType animatedValue;
+        value.GetValue(animatedValue);
+        PropertyValueType propertyValue;
+        SubtaskHelper::ConvertAnimatedValue(animatedValue, propertyValue);
+
+        AZ::BehaviorValueParameter argument(&propertyValue);
+        setter->Call(&argument, 1);
+    }
+
     bool ScriptedEntityTweenerSubtask::IsVirtualPropertyCached()
     {
         return m_virtualProperty && !m_virtualPropertyTypeId.IsNull();
@@ -333,32 +450,37 @@ namespace ScriptedEntityTweener
             return false;
         }
 
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        switch (m_propertyType)
+        {
+        case PropertyType::Float:
         {
             float floatVal;
             value.GetValue(floatVal);
             anyValue = floatVal;
+            break;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid())
+        case PropertyType::Vector3:
         {
             AZ::Vector3 vectorValue;
             value.GetValue(vectorValue);
             anyValue = vectorValue;
+            break;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid())
+        case PropertyType::Color:
         {
             AZ::Vector3 vectorValue;
             value.GetValue(vectorValue);
             anyValue = AZ::Color::CreateFromVector3(vectorValue);
+            break;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid())
+        case PropertyType::Quaternion:
         {
             AZ::Quaternion quatValue;
             value.GetValue(quatValue);
             anyValue = quatValue;
+            break;
         }
-        else
-        {
+        default:
             AZ_Warning("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::GetValueAsAny - Virtual property type unsupported [%s]", m_animParamData.m_virtualPropertyName.c_str());
             return false;
         }
@@ -406,47 +528,6 @@ namespace ScriptedEntityTweener
         return true;
     }
 
-    bool ScriptedEntityTweenerSubtask::SetVirtualValue(const EntityAnimatedValue& value)
-    {
-        if (!IsVirtualPropertyCached())
-        {
-            return false;
-        }
-
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
-        {
-            float floatValue;
-            value.GetValue(floatValue);
-            SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, floatValue);
-        }
-        else if (m_virtualPropertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
-        {
-            AZ::Vector3 vector3Value;
-            value.GetValue(vector3Value);
-            SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, vector3Value);
-        }
-        else if (m_virtualPropertyTypeId == AZ::Color::TYPEINFO_Uuid())
-        {
-            AZ::Vector3 vector3Value;
-            value.GetValue(vector3Value);
-            AZ::Color colorValue(AZ::Color::CreateFromVector3(vector3Value));
-            SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, colorValue);
-        }
-        else if (m_virtualPropertyTypeId == AZ::Quaternion::TYPEINFO_Uuid())
-        {
-            AZ::Quaternion quaternionValue;
-            value.GetValue(quaternionValue);
-            SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, quaternionValue);
-        }
-        else
-        {
-            AZ_Warning("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::SetVirtualValue - Trying to set unsupported parameter type for [%s]", m_animParamData.m_virtualPropertyName.c_str());
-            return false;
-        }
-
-        return true;
-    }
-
     bool ScriptedEntityTweenerSubtask::GetVirtualPropertyValue(AZStd::any& returnVal, const AnimationParameterAddressData& animParamData)
     {
         // If this is called before initialization, the virtual property needs to be cached.
@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/set.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <ScriptedEntityTweener/ScriptedEntityTweenerEnums.h>
+#include "ScriptedEntityTweenerMath.h"
 
 namespace ScriptedEntityTweener
 {
@@ -33,10 +34,30 @@ namespace ScriptedEntityTweener
         bool Initialize(const AnimationParameterAddressData& animParamData, const AZStd::any& targetValue, const AnimationProperties& properties);
         
         //! Update virtual property based on animation properties, fill out callbacks vector with any callback information that needs to be called this update.
+        //! Uses the eased ratio set by SetEasingRatio when there is one, otherwise evaluates the easing curve.
         void Update(float deltaTime, AZStd::set<CallbackData>& callbacks);
 
+        //! Returns the easing curve to evaluate for the next Update, false if the subtask is not going to animate.
+        //! Used to evaluate the curves of many subtasks in batches, see EasingEquations::GetEasingRatios.
+        bool PrepareEasingSample(EasingSample& sample);
+
+        //! Eased ratio for the sample returned by PrepareEasingSample, used by the next Update.
+        void SetEasingRatio(float ratio)
+        {
+            m_easingSample.m_ratio = ratio;
+            m_hasEasingRatio = true;
+        }
+
+        const AnimationParameterAddressData& GetAddressData() const
+        {
+            return m_animParamData;
+        }
+
         //! True if active and animating a virtual property
-        bool IsActive() { return m_isActive; }
+        bool IsActive() const { return m_isActive; }
+
+        //! True if active and not paused
+        bool IsAnimating() const { return m_isActive && !m_isPaused; }
 
         void SetPaused(int timelineId, bool isPaused)
         {
@@ -135,6 +156,23 @@ namespace ScriptedEntityTweener
         // Type of the virtual property
         AZ::Uuid m_virtualPropertyTypeId;
 
+        //! Supported types of virtual property, resolved from m_virtualPropertyTypeId when caching the property.
+        enum class PropertyType : AZ::u8
+        {
+            Unsupported,
+            Float,
+            Vector3,
+            Color,
+            Quaternion
+        };
+        PropertyType m_propertyType;
+
+        //! Writes the value to the property through the setter, the property type and whether the setter takes an
+        //! entity id are resolved when caching the property so updates skip the type id and setter checks.
+        using SetterThunk = void(*)(const AZ::BehaviorMethod* setter, const AZ::EntityId& entityId, const EntityAnimatedValue& value);
+        SetterThunk m_setterThunk;
+        const AZ::BehaviorMethod* m_setter;
+
         bool m_isActive;
         bool m_isPaused;
         float m_timeSinceStart;
@@ -143,11 +181,16 @@ namespace ScriptedEntityTweener
         EntityAnimatedValue m_valueInitial;
         EntityAnimatedValue m_valueTarget;
 
+        EasingSample m_easingSample;
+        bool m_hasEasingRatio;
+
         void Reset()
         {
             m_isActive = false;
             m_isPaused = false;
             m_timeSinceStart = 0.0f;
+            m_easingSample = EasingSample();
+            m_hasEasingRatio = false;
 
             m_valueInitial = EntityAnimatedValue();
             m_valueTarget = EntityAnimatedValue();
@@ -158,6 +201,9 @@ namespace ScriptedEntityTweener
             m_animParamData = AnimationParameterAddressData();
             m_virtualPropertyTypeId = AZ::Uuid::CreateNull();
             m_virtualProperty = nullptr;
+            m_propertyType = PropertyType::Unsupported;
+            m_setterThunk = nullptr;
+            m_setter = nullptr;
         }
 
         //! Cache the virtual property to be animated
@@ -166,6 +212,15 @@ namespace ScriptedEntityTweener
         //! Return whether the virtual property has been cached
         bool IsVirtualPropertyCached();
 
+        //! Resolve the property type and setter thunk of the cached virtual property
+        void ResolveSetterThunk();
+
+        template <typename ValueType, typename PropertyValueType>
+        static void InvokeEventSetter(const AZ::BehaviorMethod* setter, const AZ::EntityId& entityId, const EntityAnimatedValue& value);
+
+        template <typename ValueType, typename PropertyValueType>
+        static void InvokeBroadcastSetter(const AZ::BehaviorMethod* setter, const AZ::EntityId& entityId, const EntityAnimatedValue& value);
+
         //! Set value from an AZStd::any object
         bool GetValueFromAny(EntityAnimatedValue& value, const AZStd::any& anyValue);
 
@@ -174,8 +229,5 @@ namespace ScriptedEntityTweener
 
         //! Get value from the virtual address's value
         bool GetVirtualValue(EntityAnimatedValue& animatedValue);
-
-        //! Set the virtual address's value
-        bool SetVirtualValue(const EntityAnimatedValue& value);
     };
 }
\ No newline at end of file
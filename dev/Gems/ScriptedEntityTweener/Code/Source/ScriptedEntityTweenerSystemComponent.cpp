@@ -146,10 +146,12 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::AnimateEntity(const AZ::EntityId& entityId, const AnimationParameters& params)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
-            animationTask = m_animationTasks.insert(ScriptedEntityTweenerTask(entityId)).first;
+            m_animationTaskIndices[entityId] = m_animationTasks.size();
+            m_animationTasks.emplace_back(entityId);
+            animationTask = &m_animationTasks.back();
         }
 
         animationTask->AddAnimation(params);
@@ -184,8 +186,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::Stop(int timelineId, const AZ::EntityId& entityId)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -195,8 +197,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::Pause(int timelineId, const AZ::EntityId& entityId, const AZStd::string& componentName, const AZStd::string& virtualPropertyName)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -207,8 +209,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::Resume(int timelineId, const AZ::EntityId& entityId, const AZStd::string& componentName, const AZStd::string& virtualPropertyName)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -219,8 +221,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::SetPlayDirectionReversed(int timelineId, const AZ::EntityId& entityId, const AZStd::string& componentName, const AZStd::string& virtualPropertyName, bool rewind)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -231,8 +233,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::SetSpeed(int timelineId, const AZ::EntityId& entityId, const AZStd::string& componentName, const AZStd::string& virtualPropertyName, float speed)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -243,8 +245,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::SetInitialValue(const AZ::Uuid& animationId, const AZ::EntityId& entityId, const AZStd::string& componentName, const AZStd::string& virtualPropertyName, const AZStd::any& initialValue)
     {
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask == m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (!animationTask)
         {
             return;
         }
@@ -258,8 +260,8 @@ namespace ScriptedEntityTweener
         AZStd::any toReturn;
         AnimationParameterAddressData data(componentName, virtualPropertyName);
 
-        auto animationTask = m_animationTasks.find(ScriptedEntityTweenerTask(entityId));
-        if (animationTask != m_animationTasks.end())
+        ScriptedEntityTweenerTask* animationTask = FindTask(entityId);
+        if (animationTask)
         {
             animationTask->GetVirtualPropertyValue(toReturn, data);
         }
@@ -274,26 +276,109 @@ namespace ScriptedEntityTweener
     void ScriptedEntityTweenerSystemComponent::Reset()
     {
         m_animationTasks.clear();
+        m_animationTaskIndices.clear();
     }
 
     void ScriptedEntityTweenerSystemComponent::OnTick(float deltaTime, AZ::ScriptTimePoint /*time*/)
     {
-        for (auto& animTask : m_animationTasks)
+        // Tasks are indexed rather than iterated, as callbacks can add tasks while they update.
+        // Animations whose delay is over are started first so they also animate this tick.
+        for (size_t taskIndex = 0; taskIndex < m_animationTasks.size(); ++taskIndex)
         {
-            animTask.Update(deltaTime);
+            m_animationTasks[taskIndex].UpdateQueuedSubtasks(deltaTime);
         }
 
-        //TODO: Possible optimization: Logic to remove "stale" animation tasks, use a "garbage collection" method to defer set removal operations (which is O(n))
-        for (auto it = m_animationTasks.begin(); it != m_animationTasks.end(); )
+        EvaluateEasingCurves();
+
+        // Each task writes all the properties of its entity in one go, then executes the callbacks of the entity.
+        for (size_t taskIndex = 0; taskIndex < m_animationTasks.size(); ++taskIndex)
+        {
+            m_animationTasks[taskIndex].UpdateSubtasks(deltaTime);
+        }
+
+        RemoveInactiveTasks();
+    }
+
+    ScriptedEntityTweenerTask* ScriptedEntityTweenerSystemComponent::FindTask(const AZ::EntityId& entityId)
+    {
+        auto taskIndex = m_animationTaskIndices.find(entityId);
+        if (taskIndex == m_animationTaskIndices.end())
+        {
+            return nullptr;
+        }
+        return &m_animationTasks[taskIndex->second];
+    }
+
+    void ScriptedEntityTweenerSystemComponent::EvaluateEasingCurves()
+    {
+        for (EasingBatch& batch : m_easingBatches)
         {
-            if (!((*it).GetIsActive()))
+            batch.m_samples.clear();
+            batch.m_subtasks.clear();
+        }
+
+        for (ScriptedEntityTweenerTask& animTask : m_animationTasks)
+        {
+            animTask.VisitActiveSubtasks([this](ScriptedEntityTweenerSubtask& subtask)
             {
-                it = m_animationTasks.erase(it);
+                EasingSample sample;
+                if (!subtask.PrepareEasingSample(sample))
+                {
+                    return;
+                }
+
+                const AnimationProperties& properties = subtask.GetAnimationProperties();
+                const int curveIndex = EasingEquations::GetEasingCurveIndex(properties.m_easeMethod, properties.m_easeType);
+                if (curveIndex < 0)
+                {
+                    subtask.SetEasingRatio(EasingEquations::GetEasingRatio(properties.m_easeMethod, properties.m_easeType, sample.m_timeActive, sample.m_duration));
+                    return;
+                }
+
+                m_easingBatches[curveIndex].m_samples.push_back(sample);
+                m_easingBatches[curveIndex].m_subtasks.push_back(&subtask);
+            });
+        }
+
+        const int easingTypeCount = static_cast<int>(EasingType::InOut) + 1;
+        for (int curveIndex = 0; curveIndex < EasingEquations::EasingCurveCount; ++curveIndex)
+        {
+            EasingBatch& batch = m_easingBatches[curveIndex];
+            if (batch.m_samples.empty())
+            {
+                continue;
+            }
+
+            const EasingMethod easeMethod = static_cast<EasingMethod>(curveIndex / easingTypeCount);
+            const EasingType easeType = static_cast<EasingType>(curveIndex % easingTypeCount);
+            EasingEquations::GetEasingRatios(easeMethod, easeType, batch.m_samples.data(), batch.m_samples.size());
+
+            for (size_t sampleIndex = 0; sampleIndex < batch.m_samples.size(); ++sampleIndex)
+            {
+                batch.m_subtasks[sampleIndex]->SetEasingRatio(batch.m_samples[sampleIndex].m_ratio);
             }
-            else
+        }
+    }
+
+    void ScriptedEntityTweenerSystemComponent::RemoveInactiveTasks()
+    {
+        // Swap the inactive tasks with the last one, the order of the tasks doesn't matter
+        size_t taskIndex = 0;
+        while (taskIndex < m_animationTasks.size())
+        {
+            if (m_animationTasks[taskIndex].GetIsActive())
+            {
+                ++taskIndex;
+                continue;
+            }
+
+            m_animationTaskIndices.erase(m_animationTasks[taskIndex].GetEntityId());
+            if (taskIndex + 1 < m_animationTasks.size())
             {
-                ++it;
+                m_animationTasks[taskIndex] = AZStd::move(m_animationTasks.back());
+                m_animationTaskIndices[m_animationTasks[taskIndex].GetEntityId()] = taskIndex;
             }
+            m_animationTasks.pop_back();
         }
     }
 
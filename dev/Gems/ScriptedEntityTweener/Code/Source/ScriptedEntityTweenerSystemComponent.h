@@ -15,7 +15,9 @@
 #include <AzCore/Component/TickBus.h>
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <ScriptedEntityTweener/ScriptedEntityTweenerBus.h>
 #include "ScriptedEntityTweenerTask.h"
@@ -88,7 +90,25 @@ namespace ScriptedEntityTweener
         ////////////////////////////////////////////////////////////////////////
 
     private:
-        AZStd::set<ScriptedEntityTweenerTask> m_animationTasks;
+        ScriptedEntityTweenerTask* FindTask(const AZ::EntityId& entityId);
+
+        //! Evaluates the easing curves of all the animating subtasks, grouped by curve.
+        void EvaluateEasingCurves();
+
+        void RemoveInactiveTasks();
+
+        //! One task per animated entity. Callbacks can start animations on other entities while a task is updating, a deque
+        //! keeps the task being updated in place when new ones are added.
+        AZStd::deque<ScriptedEntityTweenerTask> m_animationTasks;
+        AZStd::unordered_map<AZ::EntityId, size_t> m_animationTaskIndices;
+
+        //! Samples of the easing curves evaluated each tick, one batch per easing method and type.
+        struct EasingBatch
+        {
+            AZStd::vector<EasingSample> m_samples;
+            AZStd::vector<ScriptedEntityTweenerSubtask*> m_subtasks;
+        };
+        EasingBatch m_easingBatches[EasingEquations::EasingCurveCount];
 
         //! Used by AnimateEntityScript, setup by SetOptionalParams
         AnimationParameters m_tempParams;
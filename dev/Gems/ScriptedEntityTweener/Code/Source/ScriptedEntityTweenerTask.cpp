@@ -28,10 +28,6 @@ namespace ScriptedEntityTweener
     {
     }
 
-    ScriptedEntityTweenerTask::~ScriptedEntityTweenerTask()
-    {
-    }
-
     void ScriptedEntityTweenerTask::AddAnimation(const AnimationParameters& params, bool overwriteQueued)
     {
         float timeToDelay = params.m_animationProperties.m_timeToDelayAnim;
@@ -54,7 +50,7 @@ namespace ScriptedEntityTweener
                     addressData.m_virtualPropertyName);
             }
 
-            auto subtask = m_subtasks.find(addressData);
+            auto subtask = FindSubtask(addressData);
             if (subtask == m_subtasks.end())
             {
                 //For this property on this entity, an animation isn't already running.
@@ -73,14 +69,14 @@ namespace ScriptedEntityTweener
                 else
                 {
                     //Animation will play over some time, enqueue it to play as part of the update loop.
-                    subtask = m_subtasks.emplace(addressData, subtaskToAdd).first;
+                    subtask = m_subtasks.insert(m_subtasks.end(), subtaskToAdd);
                 }
             }
             else
             {
                 //An animation already exists for this virtual property
                 //Cleanup any callbacks it may have registered.
-                ClearCallbacks(subtask->second.GetAnimationProperties());
+                ClearCallbacks(subtask->GetAnimationProperties());
 
                 //Overwrite any queued animations on this subtask if the animation wasn't started from the queue, as it was user specified.
                 if (overwriteQueued)
@@ -118,7 +114,7 @@ namespace ScriptedEntityTweener
                 }
             }
 
-            if (!InitializeSubtask(subtask->second, it, params))
+            if (!InitializeSubtask(*subtask, it, params))
             {
                 m_subtasks.erase(subtask);
             }
@@ -126,6 +122,12 @@ namespace ScriptedEntityTweener
     }
 
     void ScriptedEntityTweenerTask::Update(float deltaTime)
+    {
+        UpdateQueuedSubtasks(deltaTime);
+        UpdateSubtasks(deltaTime);
+    }
+
+    void ScriptedEntityTweenerTask::UpdateQueuedSubtasks(float deltaTime)
     {
         auto queuedIter = m_queuedSubtasks.begin();
         while (queuedIter != m_queuedSubtasks.end())
@@ -143,11 +145,10 @@ namespace ScriptedEntityTweener
                         const AZStd::any& initialValue = queuedIter->GetInitialValue(addressData);
                         if (!initialValue.empty())
                         {
-                            auto subtaskPair = m_subtasks.find(addressData);
-                            if (subtaskPair != m_subtasks.end())
+                            auto subtask = FindSubtask(addressData);
+                            if (subtask != m_subtasks.end())
                             {
-                                ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-                                subtask.SetInitialValue(queuedIter->GetAnimationId(), initialValue);
+                                subtask->SetInitialValue(queuedIter->GetAnimationId(), initialValue);
                             }
                         }
                     }
@@ -159,11 +160,13 @@ namespace ScriptedEntityTweener
                 ++queuedIter;
             }
         }
+    }
 
+    void ScriptedEntityTweenerTask::UpdateSubtasks(float deltaTime)
+    {
         m_callbacks.clear();
-        for (auto& subtaskPair : m_subtasks)
+        for (ScriptedEntityTweenerSubtask& subtask : m_subtasks)
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair.second;
             if (subtask.IsActive())
             {
                 subtask.Update(deltaTime, m_callbacks);
@@ -173,11 +176,9 @@ namespace ScriptedEntityTweener
         // Aggregate all callbacks from the subtasks to execute them all at once, as multiple subtasks may reference the same callback
         ExecuteCallbacks(m_callbacks);
 
-        //TODO: Possible optimization: Logic to remove "stale" animation subtasks, use a "garbage collection" method to defer set removal operations (which is O(n))
         for (auto it = m_subtasks.begin(); it != m_subtasks.end(); )
         {
-            ScriptedEntityTweenerSubtask& subtask = it->second;
-            if (!subtask.IsActive())
+            if (!it->IsActive())
             {
                 it = m_subtasks.erase(it);
             }
@@ -190,9 +191,8 @@ namespace ScriptedEntityTweener
 
     bool ScriptedEntityTweenerTask::GetIsActive()
     {
-        for (auto& subtaskPair : m_subtasks)
+        for (const ScriptedEntityTweenerSubtask& subtask : m_subtasks)
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair.second;
             if (subtask.IsActive())
             {
                 return true;
@@ -220,10 +220,9 @@ namespace ScriptedEntityTweener
 
         for (auto it = m_subtasks.begin(); it != m_subtasks.end(); )
         {
-            ScriptedEntityTweenerSubtask& subtask = it->second;
-            if (timelineId == 0 || subtask.GetTimelineId() == timelineId)
+            if (timelineId == 0 || it->GetTimelineId() == timelineId)
             {
-                ClearCallbacks(subtask.GetAnimationProperties());
+                ClearCallbacks(it->GetAnimationProperties());
                 it = m_subtasks.erase(it);
             }
             else
@@ -235,11 +234,10 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerTask::SetPaused(const AnimationParameterAddressData& addressData, int timelineId, bool isPaused)
     {
-        auto subtaskPair = m_subtasks.find(addressData);
-        if (subtaskPair != m_subtasks.end())
+        auto subtask = FindSubtask(addressData);
+        if (subtask != m_subtasks.end())
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-            subtask.SetPaused(timelineId, isPaused);
+            subtask->SetPaused(timelineId, isPaused);
         }
 
         if (IsTimelineIdValid(timelineId))
@@ -256,11 +254,10 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerTask::SetPlayDirectionReversed(const AnimationParameterAddressData& addressData, int timelineId, bool isPlayingBackward)
     {
-        auto subtaskPair = m_subtasks.find(addressData);
-        if (subtaskPair != m_subtasks.end())
+        auto subtask = FindSubtask(addressData);
+        if (subtask != m_subtasks.end())
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-            subtask.SetPlayDirectionReversed(timelineId, isPlayingBackward);
+            subtask->SetPlayDirectionReversed(timelineId, isPlayingBackward);
         }
 
         //Remove any subtask queued for this timeline id, as now that we're rewinding, they should not play.
@@ -284,11 +281,10 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerTask::SetSpeed(const AnimationParameterAddressData& addressData, int timelineId, float speed)
     {
-        auto subtaskPair = m_subtasks.find(addressData);
-        if (subtaskPair != m_subtasks.end())
+        auto subtask = FindSubtask(addressData);
+        if (subtask != m_subtasks.end())
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-            subtask.SetSpeed(timelineId, speed);
+            subtask->SetSpeed(timelineId, speed);
         }
 
         if (IsTimelineIdValid(timelineId))
@@ -305,11 +301,10 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerTask::SetInitialValue(const AnimationParameterAddressData& addressData, const AZ::Uuid& animationId, const AZStd::any& initialValue)
     {
-        auto subtaskPair = m_subtasks.find(addressData);
-        if (subtaskPair != m_subtasks.end())
+        auto subtask = FindSubtask(addressData);
+        if (subtask != m_subtasks.end())
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-            subtask.SetInitialValue(animationId, initialValue);
+            subtask->SetInitialValue(animationId, initialValue);
         }
 
         if (!animationId.IsNull())
@@ -326,11 +321,10 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerTask::GetVirtualPropertyValue(AZStd::any& returnVal, const AnimationParameterAddressData& addressData)
     {
-        auto subtaskPair = m_subtasks.find(addressData);
-        if (subtaskPair != m_subtasks.end())
+        auto subtask = FindSubtask(addressData);
+        if (subtask != m_subtasks.end())
         {
-            ScriptedEntityTweenerSubtask& subtask = subtaskPair->second;
-            subtask.GetVirtualPropertyValue(returnVal, addressData);
+            subtask->GetVirtualPropertyValue(returnVal, addressData);
         }
         else
         {
@@ -339,6 +333,18 @@ namespace ScriptedEntityTweener
         }
     }
 
+    AZStd::vector<ScriptedEntityTweenerSubtask>::iterator ScriptedEntityTweenerTask::FindSubtask(const AnimationParameterAddressData& addressData)
+    {
+        for (auto it = m_subtasks.begin(); it != m_subtasks.end(); ++it)
+        {
+            if (it->GetAddressData() == addressData)
+            {
+                return it;
+            }
+        }
+        return m_subtasks.end();
+    }
+
     bool ScriptedEntityTweenerTask::InitializeSubtask(ScriptedEntityTweenerSubtask& subtask, const AZStd::pair<AnimationParameterAddressData, AZStd::any> initData, AnimationParameters params)
     {
         if (!subtask.Initialize(initData.first, initData.second, params.m_animationProperties))
@@ -15,6 +15,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/vector.h>
 #include <ScriptedEntityTweener/ScriptedEntityTweenerEnums.h>
 #include "ScriptedEntityTweenerSubtask.h"
 
@@ -26,12 +27,36 @@ namespace ScriptedEntityTweener
     {
     public: // member functions
         ScriptedEntityTweenerTask(AZ::EntityId id);
-        ~ScriptedEntityTweenerTask();
 
         void AddAnimation(const AnimationParameters& params, bool overwriteQueued = true);
 
+        //! Same as UpdateQueuedSubtasks followed by UpdateSubtasks.
         void Update(float deltaTime);
 
+        //! Starts the queued animations whose delay is over.
+        void UpdateQueuedSubtasks(float deltaTime);
+
+        //! Animates the virtual properties of the entity, then executes the callbacks of the subtasks all at once.
+        void UpdateSubtasks(float deltaTime);
+
+        //! Calls visitor(subtask) for each active subtask.
+        template <typename Visitor>
+        void VisitActiveSubtasks(Visitor&& visitor)
+        {
+            for (ScriptedEntityTweenerSubtask& subtask : m_subtasks)
+            {
+                if (subtask.IsActive())
+                {
+                    visitor(subtask);
+                }
+            }
+        }
+
+        const AZ::EntityId& GetEntityId() const
+        {
+            return m_entityId;
+        }
+
         bool GetIsActive();
 
         void Stop(int timelineId);
@@ -62,8 +87,11 @@ namespace ScriptedEntityTweener
     private: // member functions
         AZ::EntityId m_entityId;
 
-        //! Unique(per address data) active subtasks being updated
-        AZStd::unordered_map<AnimationParameterAddressData, ScriptedEntityTweenerSubtask> m_subtasks;
+        //! Unique(per address data) active subtasks being updated. An entity only animates a handful of properties,
+        //! a linear search by address is cheaper than hashing the names and keeps the subtasks contiguous.
+        AZStd::vector<ScriptedEntityTweenerSubtask> m_subtasks;
+
+        AZStd::vector<ScriptedEntityTweenerSubtask>::iterator FindSubtask(const AnimationParameterAddressData& addressData);
 
         class QueuedSubtaskInfo
         {
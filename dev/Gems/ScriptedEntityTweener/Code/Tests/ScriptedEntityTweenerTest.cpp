@@ -14,6 +14,18 @@
 
 #include <AzTest/AzTest.h>
 
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <ScriptedEntityTweener/ScriptedEntityTweenerBus.h>
+#include <ScriptedEntityTweenerMath.h>
+#include <ScriptedEntityTweenerSystemComponent.h>
+
 class ScriptedEntityTweenerTest
     : public ::testing::Test
 {
@@ -34,4 +46,309 @@ TEST_F(ScriptedEntityTweenerTest, ExampleTest)
     ASSERT_TRUE(true);
 }
 
+namespace ScriptedEntityTweener
+{
+    //! Virtual properties of each supported type, animated by the tests.
+    class TweenerTestRequests
+        : public AZ::ComponentBus
+    {
+    public:
+        virtual float GetFade() = 0;
+        virtual void SetFade(float fade) = 0;
+        virtual AZ::Vector3 GetOffset() = 0;
+        virtual void SetOffset(AZ::Vector3 offset) = 0;
+        virtual AZ::Color GetColor() = 0;
+        virtual void SetColor(AZ::Color color) = 0;
+        virtual AZ::Quaternion GetRotation() = 0;
+        virtual void SetRotation(AZ::Quaternion rotation) = 0;
+    };
+    using TweenerTestRequestBus = AZ::EBus<TweenerTestRequests>;
+
+    class TweenerTestTarget
+        : public TweenerTestRequestBus::Handler
+    {
+    public:
+        AZ_TYPE_INFO(TweenerTestTarget, "{7D0A43F4-2F0B-4C1E-9E57-2E6C3F1D8B51}");
+        AZ_CLASS_ALLOCATOR(TweenerTestTarget, AZ::SystemAllocator, 0);
+
+        float GetFade() override { return m_fade; }
+        void SetFade(float fade) override { m_fade = fade; ++m_numSets; }
+        AZ::Vector3 GetOffset() override { return m_offset; }
+        void SetOffset(AZ::Vector3 offset) override { m_offset = offset; ++m_numSets; }
+        AZ::Color GetColor() override { return m_color; }
+        void SetColor(AZ::Color color) override { m_color = color; ++m_numSets; }
+        AZ::Quaternion GetRotation() override { return m_rotation; }
+        void SetRotation(AZ::Quaternion rotation) override { m_rotation = rotation; ++m_numSets; }
+
+        float m_fade = 0.0f;
+        AZ::Vector3 m_offset = AZ::Vector3::CreateZero();
+        AZ::Color m_color = AZ::Color::CreateZero();
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        int m_numSets = 0;
+    };
+
+    //! Component application with the tweener system component and the test virtual properties reflected.
+    class TweenerTestApplication
+    {
+    public:
+        void SetUpInternal()
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 20 * 1024 * 1024;
+            m_systemEntity = m_application.Create(appDesc);
+
+            AZ::BehaviorContext* behaviorContext = m_application.GetBehaviorContext();
+            behaviorContext->EBus<TweenerTestRequestBus>("TweenerTestRequestBus")
+                ->Event("GetFade", &TweenerTestRequestBus::Events::GetFade)
+                ->Event("SetFade", &TweenerTestRequestBus::Events::SetFade)
+                ->VirtualProperty("Fade", "GetFade", "SetFade")
+                ->Event("GetOffset", &TweenerTestRequestBus::Events::GetOffset)
+                ->Event("SetOffset", &TweenerTestRequestBus::Events::SetOffset)
+                ->VirtualProperty("Offset", "GetOffset", "SetOffset")
+                ->Event("GetColor", &TweenerTestRequestBus::Events::GetColor)
+                ->Event("SetColor", &TweenerTestRequestBus::Events::SetColor)
+                ->VirtualProperty("Color", "GetColor", "SetColor")
+                ->Event("GetRotation", &TweenerTestRequestBus::Events::GetRotation)
+                ->Event("SetRotation", &TweenerTestRequestBus::Events::SetRotation)
+                ->VirtualProperty("Rotation", "GetRotation", "SetRotation");
+            behaviorContext->Class<TweenerTestTarget>("TweenerTestComponent")
+                ->RequestBus("TweenerTestRequestBus");
+
+            m_application.RegisterComponentDescriptor(ScriptedEntityTweenerSystemComponent::CreateDescriptor());
+            m_systemEntity->CreateComponent<ScriptedEntityTweenerSystemComponent>();
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+        }
+
+        void TearDownInternal()
+        {
+            m_targets.set_capacity(0);
+            m_application.Destroy();
+        }
+
+        //! Creates a target connected to the test bus at a new entity id.
+        TweenerTestTarget& CreateTarget()
+        {
+            m_targets.emplace_back(aznew TweenerTestTarget());
+            m_targets.back()->BusConnect(AZ::EntityId(m_targets.size()));
+            return *m_targets.back();
+        }
+
+        static AZ::EntityId GetTargetId(size_t targetIndex)
+        {
+            return AZ::EntityId(targetIndex + 1);
+        }
+
+        static void Animate(const AZ::EntityId& entityId, const char* propertyName, const AZStd::any& target, const AnimationProperties& properties)
+        {
+            AnimationParameters params;
+            params.m_animationProperties = properties;
+            params.m_animationParameters.emplace(AnimationParameterAddressData("TweenerTestComponent", propertyName), target);
+            ScriptedEntityTweenerBus::Broadcast(&ScriptedEntityTweenerBus::Events::AnimateEntity, entityId, params);
+        }
+
+        static void Tick(float deltaTime)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, deltaTime, AZ::ScriptTimePoint());
+        }
+
+        AZ::ComponentApplication m_application;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::vector<AZStd::unique_ptr<TweenerTestTarget>> m_targets;
+    };
+
+    class ScriptedEntityTweenerAnimationTest
+        : public ::testing::Test
+        , public TweenerTestApplication
+    {
+    protected:
+        void SetUp() override
+        {
+            SetUpInternal();
+        }
+
+        void TearDown() override
+        {
+            TearDownInternal();
+        }
+
+        static AnimationProperties CreateProperties(float duration, EasingMethod easeMethod, EasingType easeType)
+        {
+            AnimationProperties properties;
+            properties.m_timeDuration = duration;
+            properties.m_easeMethod = easeMethod;
+            properties.m_easeType = easeType;
+            return properties;
+        }
+    };
+
+    TEST_F(ScriptedEntityTweenerAnimationTest, EasingRatios_MatchEasingResults)
+    {
+        for (int method = 0; method <= static_cast<int>(EasingMethod::Bounce); ++method)
+        {
+            for (int type = 0; type <= static_cast<int>(EasingType::InOut); ++type)
+            {
+                const EasingMethod easeMethod = static_cast<EasingMethod>(method);
+                const EasingType easeType = static_cast<EasingType>(type);
+                EXPECT_GE(EasingEquations::GetEasingCurveIndex(easeMethod, easeType), 0);
+                EXPECT_LT(EasingEquations::GetEasingCurveIndex(easeMethod, easeType), EasingEquations::EasingCurveCount);
+
+                EasingSample samples[21];
+                for (int i = 0; i < 21; ++i)
+                {
+                    samples[i].m_timeActive = i * 0.1f;
+                    samples[i].m_duration = 2.0f;
+                }
+                EasingEquations::GetEasingRatios(easeMethod, easeType, samples, AZ_ARRAY_SIZE(samples));
+
+                for (const EasingSample& sample : samples)
+                {
+                    const float expected = EasingEquations::GetEasingResult(easeMethod, easeType, sample.m_timeActive, sample.m_duration, -2.0f, 6.0f);
+                    EXPECT_NEAR(expected, -2.0f + 8.0f * sample.m_ratio, 1e-4f) << "method " << method << " type " << type << " time " << sample.m_timeActive;
+                }
+            }
+        }
+    }
+
+    TEST_F(ScriptedEntityTweenerAnimationTest, AnimateFloat_Linear_ReachesTargetAndCompletes)
+    {
+        TweenerTestTarget& target = CreateTarget();
+        Animate(GetTargetId(0), "Fade", AZStd::any(1.0f), CreateProperties(1.0f, EasingMethod::Linear, EasingType::In));
+
+        const float expected[] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+        for (float expectedFade : expected)
+        {
+            Tick(0.25f);
+            EXPECT_FLOAT_EQ(expectedFade, target.m_fade);
+        }
+        EXPECT_EQ(5, target.m_numSets);
+
+        // The animation is over, the property isn't written anymore
+        Tick(0.25f);
+        EXPECT_EQ(5, target.m_numSets);
+    }
+
+    TEST_F(ScriptedEntityTweenerAnimationTest, AnimatePropertyTypes_MatchEasingEquations)
+    {
+        TweenerTestTarget& target = CreateTarget();
+        const AZ::Vector3 targetOffset(4.0f, -2.0f, 8.0f);
+        const AZ::Color targetColor(1.0f, 0.5f, 0.25f, 1.0f);
+        const AZ::Quaternion targetRotation = AZ::Quaternion::CreateRotationZ(1.0f);
+        const AnimationProperties properties = CreateProperties(1.0f, EasingMethod::Quad, EasingType::InOut);
+        Animate(GetTargetId(0), "Offset", AZStd::any(targetOffset), properties);
+        Animate(GetTargetId(0), "Color", AZStd::any(targetColor), properties);
+        Animate(GetTargetId(0), "Rotation", AZStd::any(targetRotation), properties);
+
+        for (int frame = 0; frame < 8; ++frame)
+        {
+            Tick(0.125f);
+            const float timeActive = frame * 0.125f;
+
+            const AZ::Vector3 expectedOffset = EasingEquations::GetEasingResult(properties.m_easeMethod, properties.m_easeType, timeActive, 1.0f, AZ::Vector3::CreateZero(), targetOffset);
+            EXPECT_TRUE(target.m_offset.IsClose(expectedOffset, 1e-4f));
+
+            const AZ::Vector3 expectedColor = EasingEquations::GetEasingResult(properties.m_easeMethod, properties.m_easeType, timeActive, 1.0f, AZ::Vector3::CreateZero(), targetColor.GetAsVector3());
+            EXPECT_TRUE(target.m_color.GetAsVector3().IsClose(expectedColor, 1e-4f));
+
+            const AZ::Quaternion expectedRotation = EasingEquations::GetEasingResult(properties.m_easeMethod, properties.m_easeType, timeActive, 1.0f, AZ::Quaternion::CreateIdentity(), targetRotation);
+            EXPECT_TRUE(target.m_rotation.IsClose(expectedRotation, 1e-4f));
+        }
+        EXPECT_EQ(24, target.m_numSets);
+    }
+
+    TEST_F(ScriptedEntityTweenerAnimationTest, PausedAnimation_IsNotWritten)
+    {
+        TweenerTestTarget& pausedTarget = CreateTarget();
+        TweenerTestTarget& playingTarget = CreateTarget();
+        AnimationProperties properties = CreateProperties(1.0f, EasingMethod::Sine, EasingType::Out);
+        properties.m_timelineId = 7;
+        Animate(GetTargetId(0), "Fade", AZStd::any(1.0f), properties);
+        Animate(GetTargetId(1), "Fade", AZStd::any(1.0f), properties);
+
+        Tick(0.25f);
+        ScriptedEntityTweenerBus::Broadcast(&ScriptedEntityTweenerBus::Events::Pause, 7, GetTargetId(0), "TweenerTestComponent", "Fade");
+        Tick(0.25f);
+        Tick(0.25f);
+        EXPECT_EQ(1, pausedTarget.m_numSets);
+        EXPECT_EQ(3, playingTarget.m_numSets);
+
+        // Resuming continues from where the animation was paused
+        ScriptedEntityTweenerBus::Broadcast(&ScriptedEntityTweenerBus::Events::Resume, 7, GetTargetId(0), "TweenerTestComponent", "Fade");
+        Tick(0.25f);
+        EXPECT_FLOAT_EQ(EasingEquations::GetEasingResult(EasingMethod::Sine, EasingType::Out, 0.25f, 1.0f, 0.0f, 1.0f), pausedTarget.m_fade);
+    }
+
+    TEST_F(ScriptedEntityTweenerAnimationTest, StoppedEntity_IsRemovedAndOthersKeepAnimating)
+    {
+        const size_t numTargets = 8;
+        for (size_t targetIndex = 0; targetIndex < numTargets; ++targetIndex)
+        {
+            CreateTarget();
+            Animate(GetTargetId(targetIndex), "Fade", AZStd::any(1.0f), CreateProperties(1.0f, EasingMethod::Linear, EasingType::In));
+        }
+
+        Tick(0.25f);
+        ScriptedEntityTweenerBus::Broadcast(&ScriptedEntityTweenerBus::Events::Stop, 0, GetTargetId(2));
+        ScriptedEntityTweenerBus::Broadcast(&ScriptedEntityTweenerBus::Events::Stop, 0, GetTargetId(5));
+        Tick(0.25f);
+        Tick(0.25f);
+
+        for (size_t targetIndex = 0; targetIndex < numTargets; ++targetIndex)
+        {
+            const bool isStopped = targetIndex == 2 || targetIndex == 5;
+            EXPECT_EQ(isStopped ? 1 : 3, m_targets[targetIndex]->m_numSets);
+            EXPECT_FLOAT_EQ(isStopped ? 0.0f : 0.5f, m_targets[targetIndex]->m_fade);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Per frame cost of the tweener with many animations playing, half animating a float and half a Vector3,
+    //! spread over all the easing curves. The animations loop so they all stay active.
+    class BM_ScriptedEntityTweener
+        : public ::benchmark::Fixture
+        , public TweenerTestApplication
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUpInternal();
+
+            const size_t numTweens = static_cast<size_t>(state.range(0));
+            for (size_t tweenIndex = 0; tweenIndex < numTweens; tweenIndex += 2)
+            {
+                const size_t targetIndex = tweenIndex / 2;
+                CreateTarget();
+
+                const int curveIndex = static_cast<int>(targetIndex % EasingEquations::EasingCurveCount);
+                AnimationProperties properties;
+                properties.m_timeDuration = 0.5f + 0.01f * (targetIndex % 100);
+                properties.m_easeMethod = static_cast<EasingMethod>(curveIndex / (static_cast<int>(EasingType::InOut) + 1));
+                properties.m_easeType = static_cast<EasingType>(curveIndex % (static_cast<int>(EasingType::InOut) + 1));
+                properties.m_timesToPlay = -1;
+                Animate(GetTargetId(targetIndex), "Fade", AZStd::any(1.0f), properties);
+                Animate(GetTargetId(targetIndex), "Offset", AZStd::any(AZ::Vector3(1.0f, 2.0f, 3.0f)), properties);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownInternal();
+        }
+    };
+
+    BENCHMARK_DEFINE_F(BM_ScriptedEntityTweener, TickActiveTweens)(benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            Tick(1.0f / 60.0f);
+        }
+        state.counters["tweens"] = static_cast<double>(state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptedEntityTweener, TickActiveTweens)->Arg(500)->Arg(5000)->Unit(::benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+}
+
 AZ_UNIT_TEST_HOOK();
+#if defined(HAVE_BENCHMARK)
+AZ_BENCHMARK_HOOK()
+#endif // HAVE_BENCHMARK